@@ -0,0 +1,479 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+
+#include "ArrayAlgorithms.hpp"
+#include "BenchmarkCounters.hpp"
+#include "BenchmarkInputs.hpp"
+#include "EytzingerArray.hpp"
+#include "ExternalSort.hpp"
+#include "HardwareCounters.hpp"
+
+
+using namespace array_algorithms;
+using benchmarks::InputPattern;
+using benchmarks::makeInput;
+using benchmarks::patternName;
+using benchmarks::reportHardwareCounters;
+using containers::DynamicArray;
+
+
+namespace {
+
+using SortFn = void (*)(DynamicArray<int>&);
+
+constexpr int64_t MIN_SIZE = 100;        // 1e2
+constexpr int64_t MAX_SIZE = 100000000;  // 1e8
+constexpr int64_t QUADRATIC_CAP = 10000; // 1e4: keeps O(n^2) runs under a second
+constexpr int64_t BIN_SORT_CAP = 10000000; // 1e7: one heap node + two bins per element
+constexpr int64_t SEARCH_MAX_SIZE = 10000000; // 1e7: keeps the key set in memory
+constexpr int64_t PROFILE_SIZE = 1000000; // 1e6: larger than L2, so cache misses show
+
+
+/**
+ * @brief Describes one sort under benchmark.
+ *
+ * The per-pattern caps bound the largest size that is registered for each
+ * input shape, so that algorithms with a quadratic worst case (e.g. the
+ * Lomuto QuickSort on reversed or duplicate-heavy inputs) stay measurable
+ * without removing them from the comparison.
+ */
+struct SortCase {
+    const char* name;
+    SortFn sort;
+    int64_t cap_random;
+    int64_t cap_sorted;
+    int64_t cap_reversed;
+    int64_t cap_few_unique;
+};
+
+
+/// Sorts a fresh copy of the generated input on every iteration.
+void runSort(benchmark::State& state, const SortFn sort) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto pattern = static_cast<InputPattern>(state.range(1));
+    const DynamicArray<int> input = makeInput(n, pattern);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> data(input);
+        state.ResumeTiming();
+
+        sort(data);
+
+        benchmark::DoNotOptimize(data.begin());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    state.SetLabel(patternName(pattern));
+}
+
+
+int64_t capFor(const SortCase& sort_case, const InputPattern pattern) {
+    switch (pattern) {
+    case InputPattern::Random:
+        return sort_case.cap_random;
+    case InputPattern::Sorted:
+        return sort_case.cap_sorted;
+    case InputPattern::Reversed:
+        return sort_case.cap_reversed;
+    case InputPattern::FewUnique:
+        return sort_case.cap_few_unique;
+    }
+    return 0;
+}
+
+
+const SortCase SORT_CASES[] = {
+    {"BubbleSort", [](DynamicArray<int>& a) { BubbleSort(a); },
+     QUADRATIC_CAP, QUADRATIC_CAP, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"ImprovedBubbleSort", [](DynamicArray<int>& a) { ImprovedBubbleSort(a); },
+     QUADRATIC_CAP, MAX_SIZE, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"LinearInsertionSort", [](DynamicArray<int>& a) { LinearInsertionSort(a); },
+     QUADRATIC_CAP, MAX_SIZE, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"BinaryInsertionSort", [](DynamicArray<int>& a) { BinaryInsertionSort(a); },
+     QUADRATIC_CAP, MAX_SIZE, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"QuickSort", [](DynamicArray<int>& a) { QuickSort(a); },
+     MAX_SIZE, MAX_SIZE, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"MergeSort", [](DynamicArray<int>& a) { MergeSort(a); },
+     MAX_SIZE, MAX_SIZE, MAX_SIZE, MAX_SIZE},
+    {"MergeSortInPlace", [](DynamicArray<int>& a) { MergeSortInPlace(a); },
+     QUADRATIC_CAP, MAX_SIZE, QUADRATIC_CAP, QUADRATIC_CAP},
+    {"HeapSort", [](DynamicArray<int>& a) { HeapSort(a); },
+     MAX_SIZE, MAX_SIZE, MAX_SIZE, MAX_SIZE},
+    {"HybridSort", [](DynamicArray<int>& a) { HybridSort(a); },
+     MAX_SIZE, MAX_SIZE, MAX_SIZE, MAX_SIZE},
+    {"BinSortUniverse",
+     [](DynamicArray<int>& a) { BinSort(a, a.size()); },
+     BIN_SORT_CAP, BIN_SORT_CAP, BIN_SORT_CAP, BIN_SORT_CAP},
+    {"BinSortRange",
+     [](DynamicArray<int>& a) { BinSort(a, 0, static_cast<int>(a.size()) - 1); },
+     BIN_SORT_CAP, BIN_SORT_CAP, BIN_SORT_CAP, BIN_SORT_CAP},
+    {"RadixSortLSD", [](DynamicArray<int>& a) { RadixSortLSD(a); },
+     MAX_SIZE, MAX_SIZE, MAX_SIZE, MAX_SIZE},
+    {"RadixSortMSD", [](DynamicArray<int>& a) { RadixSortMSD(a); },
+     MAX_SIZE, MAX_SIZE, MAX_SIZE, MAX_SIZE},
+};
+
+
+/**
+ * @brief Registers every sort for every input pattern, sizes 1e2..1e8 in
+ * powers of ten (bounded by the per-pattern caps above).
+ */
+bool registerSortBenchmarks() {
+    constexpr InputPattern patterns[] = {InputPattern::Random, InputPattern::Sorted,
+                                         InputPattern::Reversed, InputPattern::FewUnique};
+
+    for (const SortCase& sort_case : SORT_CASES) {
+        for (const InputPattern pattern : patterns) {
+            const std::string name = std::string("Sort/") + sort_case.name + "/" +
+                                     patternName(pattern);
+            auto* bench = benchmark::RegisterBenchmark(name.c_str(), runSort,
+                                                       sort_case.sort);
+            for (int64_t n = MIN_SIZE; n <= capFor(sort_case, pattern); n *= 10)
+                bench->Args({n, static_cast<int64_t>(pattern)});
+            bench->ArgNames({"n", "pattern"})->Unit(benchmark::kMicrosecond);
+        }
+    }
+    return true;
+}
+
+
+const bool sort_benchmarks_registered = registerSortBenchmarks();
+
+
+/// runSort() with hardware counters around each sort, reported per element
+/// (see reportHardwareCounters()).
+void runProfiledSort(benchmark::State& state, const SortFn sort) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto pattern = static_cast<InputPattern>(state.range(1));
+    const DynamicArray<int> input = makeInput(n, pattern);
+
+    HardwareCounters counters;
+    CounterReading total;
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> data(input);
+        state.ResumeTiming();
+
+        counters.start();
+        sort(data);
+        total += counters.stop();
+
+        benchmark::DoNotOptimize(data.begin());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    state.SetLabel(patternName(pattern));
+    reportHardwareCounters(state, total, n * static_cast<size_t>(state.iterations()));
+}
+
+
+/**
+ * @brief Registers every sort for every input pattern at one size (1e6, or
+ * the cap of the pattern) with hardware counters, so that one run lines up
+ * algorithm, input shape and cache behaviour.
+ */
+bool registerProfiledSortBenchmarks() {
+    constexpr InputPattern patterns[] = {InputPattern::Random, InputPattern::Sorted,
+                                         InputPattern::Reversed, InputPattern::FewUnique};
+
+    for (const SortCase& sort_case : SORT_CASES) {
+        for (const InputPattern pattern : patterns) {
+            const std::string name = std::string("SortProfile/") + sort_case.name + "/" +
+                                     patternName(pattern);
+            const int64_t n = std::min(PROFILE_SIZE, capFor(sort_case, pattern));
+            benchmark::RegisterBenchmark(name.c_str(), runProfiledSort, sort_case.sort)
+                ->Args({n, static_cast<int64_t>(pattern)})
+                ->ArgNames({"n", "pattern"})
+                ->Unit(benchmark::kMicrosecond);
+        }
+    }
+    return true;
+}
+
+
+const bool profiled_sort_benchmarks_registered = registerProfiledSortBenchmarks();
+
+
+/// Cost of the instrumentation policy: the default compiles the hooks away,
+/// counting adds an increment per event, and a function pointer (the former
+/// default callback type) adds an indirect call.
+void BM_InstrumentedQuickSort(benchmark::State& state, const SortFn sort) {
+    runSort(state, sort);
+}
+BENCHMARK_CAPTURE(BM_InstrumentedQuickSort, NoInstrumentation,
+                  [](DynamicArray<int>& a) { QuickSort(a); })
+    ->ArgsProduct({{10000, 100000, 1000000}, {static_cast<int64_t>(InputPattern::Random)}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_InstrumentedQuickSort, CountingInstrumentation,
+                  [](DynamicArray<int>& a) {
+                      CountingInstrumentation counts;
+                      QuickSort(a, counts);
+                      benchmark::DoNotOptimize(counts);
+                  })
+    ->ArgsProduct({{10000, 100000, 1000000}, {static_cast<int64_t>(InputPattern::Random)}})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_InstrumentedQuickSort, FunctionPointer,
+                  [](DynamicArray<int>& a) {
+                      void (*callback)(size_t, size_t, size_t) = [](size_t, size_t, size_t) {};
+                      benchmark::DoNotOptimize(callback);
+                      QuickSort(a, callback);
+                  })
+    ->ArgsProduct({{10000, 100000, 1000000}, {static_cast<int64_t>(InputPattern::Random)}})
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// Linear and binary search over a sorted array; the target sits at the end.
+void BM_LinearSearch(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> data = makeInput(n, InputPattern::Sorted);
+    const int target = static_cast<int>(n) - 1;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(LinearSearch(data, target));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_LinearSearch)->RangeMultiplier(10)->Range(MIN_SIZE, SEARCH_MAX_SIZE);
+
+
+void BM_BinarySearch(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> data = makeInput(n, InputPattern::Sorted);
+    const DynamicArray<int> targets = benchmarks::makeShuffledKeys(n);
+    size_t next = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            BinarySearch(data, targets[next], [](size_t) {}));
+        next = next + 1 == n ? 0 : next + 1;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BinarySearch)->RangeMultiplier(10)->Range(MIN_SIZE, SEARCH_MAX_SIZE);
+
+
+/// Without a callback BinarySearch() takes the branchless, prefetching path.
+void BM_BinarySearchBranchless(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> data = makeInput(n, InputPattern::Sorted);
+    const DynamicArray<int> targets = benchmarks::makeShuffledKeys(n);
+    size_t next = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BinarySearch(data, targets[next]));
+        next = next + 1 == n ? 0 : next + 1;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BinarySearchBranchless)->RangeMultiplier(10)->Range(MIN_SIZE, SEARCH_MAX_SIZE);
+
+
+void BM_EytzingerSearch(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const EytzingerArray<int> index(makeInput(n, InputPattern::Sorted));
+    const DynamicArray<int> targets = benchmarks::makeShuffledKeys(n);
+    size_t next = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(index.find(targets[next]));
+        next = next + 1 == n ? 0 : next + 1;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EytzingerSearch)->RangeMultiplier(10)->Range(MIN_SIZE, SEARCH_MAX_SIZE);
+
+
+/// A 256-byte row sorted by its first field.
+struct WideRow {
+    int key;
+    char payload[252];
+};
+
+DynamicArray<WideRow> makeWideRows(const size_t n) {
+    const DynamicArray<int> keys = makeInput(n, InputPattern::Random);
+    DynamicArray<WideRow> rows(n);
+    for (size_t i = 0; i < n; ++i) {
+        rows.addLast(WideRow{});
+        rows[i].key = keys[i];
+    }
+    return rows;
+}
+
+
+/// Sorting wide rows directly moves whole rows on every exchange.
+void BM_WideRowsMergeSort(benchmark::State& state) {
+    const DynamicArray<WideRow> input = makeWideRows(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<WideRow> rows(input);
+        state.ResumeTiming();
+
+        MergeSort(rows, {}, &WideRow::key);
+        benchmark::DoNotOptimize(rows.begin());
+    }
+}
+BENCHMARK(BM_WideRowsMergeSort)->RangeMultiplier(10)->Range(1000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// Sorting indices moves each row once, when the permutation is applied.
+void BM_WideRowsArgSort(benchmark::State& state) {
+    const DynamicArray<WideRow> input = makeWideRows(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<WideRow> rows(input);
+        state.ResumeTiming();
+
+        const auto permutation = ArgSort<std::uint32_t>(rows, {}, &WideRow::key);
+        ApplyPermutation(rows, permutation);
+        benchmark::DoNotOptimize(rows.begin());
+    }
+}
+BENCHMARK(BM_WideRowsArgSort)->RangeMultiplier(10)->Range(1000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// Doubles: the radix sort through the order-preserving bit mapping against
+/// the comparison-based default.
+void BM_SortDoubles(benchmark::State& state, void (*sort)(DynamicArray<double>&)) {
+    const auto n = static_cast<size_t>(state.range(0));
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1e9, 1e9);
+    DynamicArray<double> input(n);
+    for (size_t i = 0; i < n; ++i)
+        input.addLast(dist(rng));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<double> data(input);
+        state.ResumeTiming();
+
+        sort(data);
+        benchmark::DoNotOptimize(data.begin());
+    }
+}
+BENCHMARK_CAPTURE(BM_SortDoubles, RadixSortLSD,
+                  [](DynamicArray<double>& a) { RadixSortLSD(a); })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SortDoubles, HybridSort,
+                  [](DynamicArray<double>& a) { HybridSort(a); })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// Short strings with shared prefixes, as in path- or log-style keys.
+void BM_SortStrings(benchmark::State& state, void (*sort)(DynamicArray<std::string>&)) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const char* prefixes[] = {"user/", "user/admin/", "log-2024-", "cfg."};
+    std::mt19937 rng(42);
+    DynamicArray<std::string> input(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string value = prefixes[rng() % 4];
+        for (int c = 0; c < 8; ++c)
+            value.push_back(static_cast<char>('a' + rng() % 26));
+        input.addLast(std::move(value));
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<std::string> data(input);
+        state.ResumeTiming();
+
+        sort(data);
+        benchmark::DoNotOptimize(data.begin());
+    }
+}
+BENCHMARK_CAPTURE(BM_SortStrings, RadixSortMSD,
+                  [](DynamicArray<std::string>& a) { RadixSortMSD(a); })
+    ->RangeMultiplier(10)->Range(1000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_SortStrings, MergeSort,
+                  [](DynamicArray<std::string>& a) { MergeSort(a); })
+    ->RangeMultiplier(10)->Range(1000, 1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// Percentile and top-100 queries over random ints: a full HybridSort
+/// against the selection algorithms that answer them directly.
+void BM_Select(benchmark::State& state, void (*select)(DynamicArray<int>&)) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> input = makeInput(n, InputPattern::Random);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int> data(input);
+        state.ResumeTiming();
+
+        select(data);
+        benchmark::DoNotOptimize(data.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK_CAPTURE(BM_Select, HybridSortThenIndex,
+                  [](DynamicArray<int>& a) { HybridSort(a); })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Select, NthElementMedian,
+                  [](DynamicArray<int>& a) { NthElement(a, a.size() / 2); })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Select, PartialSortTop100,
+                  [](DynamicArray<int>& a) { PartialSort(a, 100, std::ranges::greater{}); })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_Select, TopKStream100,
+                  [](DynamicArray<int>& a) {
+                      TopK<int> best(100);
+                      best.pushAll(a);
+                      DynamicArray<int> top = best.extractSorted();
+                      benchmark::DoNotOptimize(top.begin());
+                  })
+    ->RangeMultiplier(10)->Range(1000, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+
+
+/// ExternalSort of a file of random ints with a memory budget of one
+/// eighth of the data, so every size needs eight or more runs.
+void BM_ExternalSort(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto directory = std::filesystem::temp_directory_path();
+    const auto input = directory / "external_sort_benchmark_input";
+    const auto output = directory / "external_sort_benchmark_output";
+    {
+        const DynamicArray<int> data = makeInput(n, InputPattern::Random);
+        std::FILE* file = std::fopen(input.string().c_str(), "wb");
+        std::fwrite(data.begin(), sizeof(int), n, file);
+        std::fclose(file);
+    }
+
+    ExternalSortOptions options;
+    options.memory_budget = std::max(n * sizeof(int) / 8, EXTERNAL_SORT_MIN_BUDGET);
+    options.io_block_bytes = size_t{1} << 20;
+    for (auto _ : state) {
+        const ExternalSortStats stats = ExternalSort<int>(input, output, options);
+        benchmark::DoNotOptimize(stats.runs);
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n * sizeof(int)));
+}
+BENCHMARK(BM_ExternalSort)->RangeMultiplier(10)->Range(100000, 10000000)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
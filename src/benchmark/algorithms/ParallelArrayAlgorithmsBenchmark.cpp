@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "ParallelArrayAlgorithms.hpp"
+
+
+using namespace array_algorithms;
+using containers::DynamicArray;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100000;    // 1e5
+constexpr int64_t MAX_SIZE = 100000000; // 1e8
+constexpr int64_t MAX_THREADS = 32;
+
+
+/// Random 64-bit keys from a fixed seed.
+DynamicArray<int64_t> makeKeys(const size_t n) {
+    std::mt19937_64 rng(0xC0FFEEu);
+    DynamicArray<int64_t> data(n);
+    for (size_t i = 0; i < n; ++i)
+        data.addLast(static_cast<int64_t>(rng()));
+    return data;
+}
+
+
+/// Sorts a fresh copy of n random keys with the given number of threads
+/// (range(1)); threads = 1 is the serial baseline.
+template <void (*Sort)(DynamicArray<int64_t>&, size_t)>
+void BM_ParallelSort(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto threads = static_cast<size_t>(state.range(1));
+    const DynamicArray<int64_t> input = makeKeys(n);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        DynamicArray<int64_t> data(input);
+        state.ResumeTiming();
+
+        Sort(data, threads);
+
+        benchmark::DoNotOptimize(data.begin());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+void quickSort(DynamicArray<int64_t>& a, const size_t t) { ParallelQuickSort(a, t); }
+void mergeSort(DynamicArray<int64_t>& a, const size_t t) { ParallelMergeSort(a, t); }
+void radixSort(DynamicArray<int64_t>& a, const size_t t) { ParallelRadixSortLSD(a, t); }
+
+
+void sizesAndThreads(benchmark::internal::Benchmark* bench) {
+    for (int64_t n = MIN_SIZE; n <= MAX_SIZE; n *= 10)
+        for (int64_t threads = 1; threads <= MAX_THREADS; threads *= 2)
+            bench->Args({n, threads});
+    bench->ArgNames({"n", "threads"})->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_ParallelSort<quickSort>)->Apply(sizesAndThreads);
+BENCHMARK(BM_ParallelSort<mergeSort>)->Apply(sizesAndThreads);
+BENCHMARK(BM_ParallelSort<radixSort>)->Apply(sizesAndThreads);
+
+} // namespace
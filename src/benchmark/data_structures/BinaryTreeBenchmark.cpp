@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "BinaryTree.hpp"
+#include "NodePool.hpp"
+
+
+using containers::BinaryTree;
+using containers::PooledNodes;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;    // 1e3
+constexpr int64_t MAX_SIZE = 1000000; // 1e6
+
+
+/// Builds a complete tree of n values by level-order insertion.
+void BM_BinaryTreeBuild(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+
+    for (auto _ : state) {
+        BinaryTree<int, PooledNodes<>> tree;
+        for (int i = 0; i < n; ++i)
+            tree.insert(i);
+        benchmark::DoNotOptimize(tree.getRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinaryTreeBuild)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Sums a tree of n values through one of its lazy traversals.
+template <auto Traversal>
+void BM_BinaryTreeTraverse(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    BinaryTree<int> tree;
+    for (int i = 0; i < n; ++i)
+        tree.insert(i);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const int value : (tree.*Traversal)())
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BinaryTreeTraverse<&BinaryTree<int>::preOrder>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BinaryTreeTraverse<&BinaryTree<int>::inOrder>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BinaryTreeTraverse<&BinaryTree<int>::postOrder>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BinaryTreeTraverse<&BinaryTree<int>::levelOrder>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+#include "ConcurrentHashMap.hpp"
+#include "HashMap.hpp"
+
+
+using containers::ConcurrentHashMap;
+using containers::HashMap;
+
+
+namespace {
+
+constexpr int KEY_RANGE = 1 << 20;
+constexpr uint32_t WRITE_PERCENT = 10;
+constexpr int MAX_THREADS = 64;
+
+
+/// Baseline: a single HashMap behind one global mutex.
+class GlobalMutexHashMap {
+    mutable std::mutex mutex_;
+    HashMap<int, int> map_;
+
+  public:
+    void insert(const int key, const int value) {
+        std::lock_guard lock(mutex_);
+        map_.insert(key, value);
+    }
+
+    bool contains(const int key) const {
+        std::lock_guard lock(mutex_);
+        return map_.contains(key);
+    }
+};
+
+
+/// Cheap per-thread pseudo random generator (xorshift32).
+uint32_t nextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+
+/// Map shared by every thread of a benchmark run, pre-filled with half of the
+/// key range so that lookups hit about half the time.
+template <typename Map>
+Map& sharedMap() {
+    static Map map;
+    static const bool filled = [] {
+        for (int key = 0; key < KEY_RANGE; key += 2)
+            map.insert(key, key);
+        return true;
+    }();
+    static_cast<void>(filled);
+    return map;
+}
+
+
+/**
+ * Mixed workload: every thread performs lookups and WRITE_PERCENT percent
+ * inserts on random keys of a shared map. Items per second across all threads
+ * shows how throughput scales with the thread count.
+ */
+template <typename Map>
+void BM_SharedMapMixed(benchmark::State& state) {
+    Map& map = sharedMap<Map>();
+    uint32_t rng = 0x9E3779B9u ^ static_cast<uint32_t>(state.thread_index() + 1) * 0x85EBCA6Bu;
+
+    for (auto _ : state) {
+        const uint32_t r = nextRandom(rng);
+        const int key = static_cast<int>(r % KEY_RANGE);
+        if (r % 100 < WRITE_PERCENT)
+            map.insert(key, key);
+        else
+            benchmark::DoNotOptimize(map.contains(key));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+BENCHMARK_TEMPLATE(BM_SharedMapMixed, GlobalMutexHashMap)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedMapMixed, ConcurrentHashMap<int, int>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "ConcurrentQueue.hpp"
+#include "Queue.hpp"
+
+
+using containers::MpmcQueue;
+using containers::Queue;
+using containers::SpscQueue;
+
+
+namespace {
+
+constexpr int ITEMS = 1 << 20;
+constexpr size_t RING_CAPACITY = 1024;
+constexpr int MAX_THREADS = 16;
+
+
+/// Baseline: a Queue behind a mutex, with a condition variable for the consumer.
+class LockedQueue {
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    Queue<int> queue_;
+
+  public:
+    explicit LockedQueue(size_t) {}
+
+    bool tryEnqueue(const int value) {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.enqueue(value);
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    std::optional<int> tryDequeue() {
+        std::unique_lock lock(mutex_);
+        if (!not_empty_.wait_for(lock, std::chrono::milliseconds(1),
+                                 [&] { return !queue_.isEmpty(); }))
+            return std::nullopt;
+        const int value = queue_.front();
+        queue_.dequeue();
+        return value;
+    }
+};
+
+
+/**
+ * One producer thread hands ITEMS integers to the benchmark thread, one at a
+ * time (Batch == 1) or Batch at a time through enqueueBulk / dequeueBulk.
+ */
+template <typename Channel, size_t Batch = 1>
+void BM_Handoff(benchmark::State& state) {
+    for (auto _ : state) {
+        Channel channel(RING_CAPACITY);
+        std::thread producer([&] {
+            int next = 0;
+            while (next < ITEMS) {
+                size_t sent = 0;
+                if constexpr (Batch == 1) {
+                    sent = channel.tryEnqueue(next);
+                } else {
+                    int batch[Batch];
+                    for (size_t i = 0; i < Batch; ++i)
+                        batch[i] = next + static_cast<int>(i);
+                    sent = channel.enqueueBulk(batch, Batch);
+                }
+                // Back off when full, so that the consumer gets to run even
+                // when both threads share a core.
+                if (sent == 0)
+                    std::this_thread::yield();
+                next += static_cast<int>(sent);
+            }
+        });
+
+        int64_t sum = 0;
+        int received = 0;
+        while (received < ITEMS) {
+            size_t n = 0;
+            if constexpr (Batch == 1) {
+                if (const std::optional<int> value = channel.tryDequeue()) {
+                    sum += *value;
+                    n = 1;
+                }
+            } else {
+                int batch[Batch];
+                n = channel.dequeueBulk(batch, Batch);
+                for (size_t i = 0; i < n; ++i)
+                    sum += batch[i];
+            }
+            if (n == 0)
+                std::this_thread::yield();
+            received += static_cast<int>(n);
+        }
+        producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * ITEMS);
+}
+BENCHMARK(BM_Handoff<LockedQueue>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Handoff<SpscQueue<int>>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Handoff<SpscQueue<int>, 32>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Handoff<MpmcQueue<int>>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Handoff<MpmcQueue<int>, 32>)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+/// Queue shared by every thread of a benchmark run.
+template <typename Channel>
+Channel& sharedChannel() {
+    static Channel channel(RING_CAPACITY);
+    return channel;
+}
+
+
+/**
+ * Every thread alternately enqueues and dequeues on one shared queue. Items
+ * per second across all threads shows how the queue scales under contention.
+ */
+template <typename Channel>
+void BM_SharedQueuePingPong(benchmark::State& state) {
+    Channel& channel = sharedChannel<Channel>();
+    const int value = state.thread_index();
+
+    for (auto _ : state) {
+        while (!channel.tryEnqueue(value))
+            std::this_thread::yield();
+        benchmark::DoNotOptimize(channel.tryDequeue());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedQueuePingPong<LockedQueue>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+BENCHMARK(BM_SharedQueuePingPong<MpmcQueue<int>>)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+} // namespace
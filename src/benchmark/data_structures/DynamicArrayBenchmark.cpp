@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "BenchmarkCounters.hpp"
+#include "DynamicArray.hpp"
+
+
+using benchmarks::reportAllocations;
+using containers::AllocationCounter;
+using containers::CountingAllocator;
+using containers::DynamicArray;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100;     // 1e2
+constexpr int64_t MAX_SIZE = 1000000; // 1e6
+
+
+/// Appends n doubles to an empty array, growing from the default capacity.
+template <typename Array>
+void BM_ArrayGrowth(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Array array;
+        for (size_t i = 0; i < n; ++i)
+            array.emplace_back(static_cast<double>(i));
+        benchmark::DoNotOptimize(array.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ArrayGrowth<DynamicArray<double>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ArrayGrowth<std::vector<double>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ArrayGrowth<DynamicArray<double, std::allocator<double>, 0, containers::ShrinkWhenSparse<150>>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// BM_ArrayGrowth with a CountingAllocator: how many reallocations and
+/// bytes each growth strategy spends per element.
+template <typename Array>
+void BM_ArrayGrowthAllocations(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    AllocationCounter counter;
+
+    for (auto _ : state) {
+        Array array{typename Array::allocator_type(counter)};
+        for (size_t i = 0; i < n; ++i)
+            array.emplace_back(static_cast<double>(i));
+        benchmark::DoNotOptimize(array.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    reportAllocations(state, counter.counts(), n * static_cast<size_t>(state.iterations()));
+}
+BENCHMARK(BM_ArrayGrowthAllocations<DynamicArray<double, CountingAllocator<double>>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ArrayGrowthAllocations<std::vector<double, CountingAllocator<double>>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Inserts into and erases from the middle of an array of n doubles.
+void BM_DynamicArrayMiddleInsertErase(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    DynamicArray<double> array(n + 1);
+    for (size_t i = 0; i < n; ++i)
+        array.addLast(static_cast<double>(i));
+
+    for (auto _ : state) {
+        array.insert(1.0, n / 2);
+        array.removeAt(n / 2);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DynamicArrayMiddleInsertErase)->RangeMultiplier(10)->Range(MIN_SIZE, 100000);
+
+
+/// std::vector counterpart of BM_DynamicArrayMiddleInsertErase.
+void BM_VectorMiddleInsertErase(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<double> array(n);
+
+    for (auto _ : state) {
+        array.insert(array.begin() + static_cast<std::ptrdiff_t>(n / 2), 1.0);
+        array.erase(array.begin() + static_cast<std::ptrdiff_t>(n / 2));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VectorMiddleInsertErase)->RangeMultiplier(10)->Range(MIN_SIZE, 100000);
+
+} // namespace
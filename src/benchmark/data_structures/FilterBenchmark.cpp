@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "BenchmarkInputs.hpp"
+#include "BlockedBloomFilter.hpp"
+#include "CuckooFilter.hpp"
+#include "FilteredHashMap.hpp"
+#include "HashMap.hpp"
+
+
+using benchmarks::makeShuffledKeys;
+using containers::BlockedBloomFilter;
+using containers::CuckooFilter;
+using containers::DefaultHash;
+using containers::DynamicArray;
+using containers::FilteredHashMap;
+using containers::HashMap;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;     // 1e3
+constexpr int64_t MAX_SIZE = 10000000; // 1e7
+
+
+/// Inserts n distinct keys into a filter sized for n.
+template <typename Filter>
+void BM_FilterInsert(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+
+    for (auto _ : state) {
+        Filter filter(n);
+        for (size_t i = 0; i < n; ++i)
+            filter.insert(keys[i]);
+        benchmark::DoNotOptimize(filter.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/**
+ * Queries n absent keys against a filter holding n keys. Reports the
+ * measured false-positive rate as "fpr" and the filter's memory as
+ * "bits_per_key".
+ */
+template <typename Filter>
+void BM_FilterLookupMiss(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    const DynamicArray<int> probes = makeShuffledKeys(n, static_cast<int>(n));
+
+    Filter filter(n);
+    for (size_t i = 0; i < n; ++i)
+        filter.insert(keys[i]);
+
+    size_t positives = 0;
+    for (auto _ : state) {
+        positives = 0;
+        for (size_t i = 0; i < n; ++i)
+            positives += filter.mayContain(probes[i]);
+        benchmark::DoNotOptimize(positives);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    state.counters["fpr"] = static_cast<double>(positives) / static_cast<double>(n);
+    state.counters["bits_per_key"] = 8.0 * static_cast<double>(filter.byteSize()) / static_cast<double>(n);
+}
+
+
+/// Queries n present keys; every query reaches the block or buckets.
+template <typename Filter>
+void BM_FilterLookupHit(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+
+    Filter filter(n);
+    for (size_t i = 0; i < n; ++i)
+        filter.insert(keys[i]);
+
+    for (auto _ : state)
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(filter.mayContain(probes[i]));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// contains() for n absent keys on a map of n keys: the case a filter in
+/// front of the map is meant for.
+template <typename Map>
+void BM_FilteredMapMiss(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    const DynamicArray<int> probes = makeShuffledKeys(n, static_cast<int>(n));
+
+    Map map;
+    for (size_t i = 0; i < n; ++i)
+        map.insert(keys[i], static_cast<int>(i));
+
+    for (auto _ : state)
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(map.contains(probes[i]));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// contains() for n present keys, which pay for the filter probe on top of
+/// the table lookup.
+template <typename Map>
+void BM_FilteredMapHit(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+
+    Map map;
+    for (size_t i = 0; i < n; ++i)
+        map.insert(keys[i], static_cast<int>(i));
+
+    for (auto _ : state)
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(map.contains(probes[i]));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+using IntBloomFilter = BlockedBloomFilter<int>;
+using IntCuckooFilter = CuckooFilter<int>;
+
+using PlainMap = HashMap<int, int>;
+using BloomMap = FilteredHashMap<int, int>;
+using CuckooMap = FilteredHashMap<int, int, DefaultHash<int>, CuckooFilter<int>>;
+
+BENCHMARK_TEMPLATE(BM_FilterInsert, IntBloomFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilterInsert, IntCuckooFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilterLookupMiss, IntBloomFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilterLookupMiss, IntCuckooFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilterLookupHit, IntBloomFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilterLookupHit, IntCuckooFilter)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+BENCHMARK_TEMPLATE(BM_FilteredMapMiss, PlainMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilteredMapMiss, BloomMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilteredMapMiss, CuckooMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilteredMapHit, PlainMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilteredMapHit, BloomMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_FilteredMapHit, CuckooMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
@@ -0,0 +1,318 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "BenchmarkInputs.hpp"
+#include "FlatHashMap.hpp"
+#include "HashMap.hpp"
+#include "RobinHoodHashMap.hpp"
+
+
+using benchmarks::makeShuffledKeys;
+using containers::DefaultHash;
+using containers::DynamicArray;
+using containers::FlatHashMap;
+using containers::HashMap;
+using containers::IncrementalRehash;
+using containers::RobinHoodHashMap;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100;      // 1e2
+constexpr int64_t MAX_SIZE = 10000000; // 1e7
+
+
+/// Builds a map holding every key of the given set.
+template <typename Map>
+Map buildMap(const DynamicArray<int>& keys) {
+    Map map;
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.insert(keys[i], static_cast<int>(i));
+    return map;
+}
+
+
+/// Inserts n distinct keys into an empty map (includes every rehash). Maps
+/// that count their rebuilds report them as "rehashes".
+template <typename Map>
+void BM_MapInsert(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+
+    size_t rehashes = 0;
+    for (auto _ : state) {
+        Map map;
+        for (size_t i = 0; i < n; ++i)
+            map.insert(keys[i], static_cast<int>(i));
+        benchmark::DoNotOptimize(map.size());
+        if constexpr (requires { map.rehashCount(); })
+            rehashes = map.rehashCount();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+    if constexpr (requires(const Map& map) { map.rehashCount(); })
+        state.counters["rehashes"] = static_cast<double>(rehashes);
+}
+
+
+/// Looks up every present key, in an order unrelated to insertion.
+template <typename Map>
+void BM_MapLookupHit(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Map map = buildMap<Map>(makeShuffledKeys(n));
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+
+    for (auto _ : state)
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(map.at(probes[i]));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Looks up keys that are guaranteed to be absent.
+template <typename Map>
+void BM_MapLookupMiss(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Map map = buildMap<Map>(makeShuffledKeys(n));
+    const DynamicArray<int> probes = makeShuffledKeys(n, static_cast<int>(n));
+
+    for (auto _ : state)
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(map.contains(probes[i]));
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Removes every key of a freshly built map.
+template <typename Map>
+void BM_MapRemove(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Map map = buildMap<Map>(keys);
+        state.ResumeTiming();
+
+        for (size_t i = 0; i < n; ++i)
+            benchmark::DoNotOptimize(map.remove(keys[i]));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/**
+ * Insert/remove churn on a map of constant size n: every iteration removes the
+ * oldest key, inserts a new one and looks up a live key. Tombstone-based maps
+ * accumulate deleted buckets here until their next rebuild.
+ */
+template <typename Map>
+void BM_MapChurn(benchmark::State& state) {
+    const auto n = static_cast<int>(state.range(0));
+    Map map;
+    for (int i = 0; i < n; ++i)
+        map.insert(i, i);
+
+    int oldest = 0;
+    for (auto _ : state) {
+        map.remove(oldest);
+        map.insert(oldest + n, oldest);
+        benchmark::DoNotOptimize(map.contains(oldest + n / 2));
+        ++oldest;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+
+/**
+ * Inserts n distinct keys and reports the slowest single insert as the
+ * "max_insert_ns" counter. Bulk rehashing shows up here as one O(n) outlier;
+ * incremental rehashing should keep it near the mean.
+ */
+template <typename Map>
+void BM_MapInsertWorstCase(benchmark::State& state) {
+    using Clock = std::chrono::steady_clock;
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    double worst_ns = 0.0;
+
+    for (auto _ : state) {
+        Map map;
+        for (size_t i = 0; i < n; ++i) {
+            const auto start = Clock::now();
+            map.insert(keys[i], static_cast<int>(i));
+            const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+            worst_ns = std::max(worst_ns, elapsed.count());
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.counters["max_insert_ns"] = worst_ns;
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Builds a map of n keys with reserve() + insertRange(), to compare with the
+/// one-by-one growth measured by BM_MapInsert.
+template <typename Map>
+void BM_MapBulkBuild(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    DynamicArray<std::pair<int, int>> entries;
+    for (size_t i = 0; i < n; ++i)
+        entries.addLast(std::pair<int, int>(keys[i], static_cast<int>(i)));
+
+    for (auto _ : state) {
+        Map map(entries.begin(), entries.end());
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Looks up every present key through findMany(), which prefetches the
+/// buckets of a whole batch before probing (compare with BM_MapLookupHit).
+template <typename Map>
+void BM_MapFindMany(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Map map = buildMap<Map>(makeShuffledKeys(n));
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+    DynamicArray<const int*> results(n);
+    for (size_t i = 0; i < n; ++i)
+        results.addLast(nullptr);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.findMany(&probes[0], n, &results[0]));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Builds a map of n keys from parallel key and value arrays with
+/// insertMany(), which hashes and prefetches a batch at a time (compare with
+/// BM_MapBulkBuild).
+template <typename Map>
+void BM_MapInsertMany(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    DynamicArray<int> values(n);
+    for (size_t i = 0; i < n; ++i)
+        values.addLast(static_cast<int>(i));
+
+    for (auto _ : state) {
+        Map map;
+        map.insertMany(&keys[0], &values[0], n);
+        benchmark::DoNotOptimize(map.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Hashes 4096 strings of the given length.
+template <typename Hash>
+void BM_HashStrings(benchmark::State& state) {
+    const auto length = static_cast<size_t>(state.range(0));
+    DynamicArray<std::string> strings;
+    for (size_t i = 0; i < 4096; ++i) {
+        std::string text(length, 'a');
+        for (size_t j = 0; j < length; ++j)
+            text[j] = static_cast<char>('a' + (i * 31 + j * 7) % 26);
+        strings.addLast(std::move(text));
+    }
+
+    const Hash hash;
+    for (auto _ : state) {
+        size_t sum = 0;
+        for (const std::string& text : strings)
+            sum += hash(text);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(strings.size() * length));
+}
+
+
+/// Hashes n integer keys one call at a time.
+void BM_HashIntegers(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    DynamicArray<std::uint64_t> keys(n);
+    DynamicArray<size_t> hashes(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.addLast(i * 0x9e3779b97f4a7c15ull);
+        hashes.addLast(0);
+    }
+
+    const DefaultHash<std::uint64_t> hash;
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i)
+            hashes[i] = hash(keys[i]);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+/// Hashes the same keys with hashBatch() (compare with BM_HashIntegers).
+void BM_HashBatch(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    DynamicArray<std::uint64_t> keys(n);
+    DynamicArray<size_t> hashes(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys.addLast(i * 0x9e3779b97f4a7c15ull);
+        hashes.addLast(0);
+    }
+
+    for (auto _ : state) {
+        DefaultHash<std::uint64_t>::hashBatch(&keys[0], n, &hashes[0]);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+
+#define MAP_BENCHMARKS(Map)                                                               \
+    BENCHMARK_TEMPLATE(BM_MapInsert, Map)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);    \
+    BENCHMARK_TEMPLATE(BM_MapLookupHit, Map)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE); \
+    BENCHMARK_TEMPLATE(BM_MapLookupMiss, Map)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);\
+    BENCHMARK_TEMPLATE(BM_MapRemove, Map)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);    \
+    BENCHMARK_TEMPLATE(BM_MapChurn, Map)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE)
+
+using IntHashMap = HashMap<int, int>;
+using IntIncrementalHashMap = HashMap<int, int, containers::DefaultHash<int>, 70, IncrementalRehash<>>;
+using IntFlatHashMap = FlatHashMap<int, int>;
+using IntRobinHoodHashMap = RobinHoodHashMap<int, int>;
+
+MAP_BENCHMARKS(IntHashMap);
+MAP_BENCHMARKS(IntIncrementalHashMap);
+MAP_BENCHMARKS(IntFlatHashMap);
+MAP_BENCHMARKS(IntRobinHoodHashMap);
+
+BENCHMARK_TEMPLATE(BM_MapBulkBuild, IntHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_MapFindMany, IntHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_MapInsertMany, IntHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+BENCHMARK_TEMPLATE(BM_HashStrings, DefaultHash<std::string>)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_TEMPLATE(BM_HashStrings, std::hash<std::string>)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_HashIntegers)->RangeMultiplier(100)->Range(1000, 10000000);
+BENCHMARK(BM_HashBatch)->RangeMultiplier(100)->Range(1000, 10000000);
+
+BENCHMARK_TEMPLATE(BM_MapInsertWorstCase, IntHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK_TEMPLATE(BM_MapInsertWorstCase, IntIncrementalHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
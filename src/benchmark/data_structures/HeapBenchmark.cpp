@@ -0,0 +1,206 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "DaryHeap.hpp"
+#include "DynamicArray.hpp"
+#include "IndexedHeap.hpp"
+#include "MinHeap.hpp"
+
+
+using containers::DynamicArray;
+using containers::MinDaryHeap;
+using containers::MinHeap;
+using containers::MinIndexedHeap;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100;      // 1e2
+constexpr int64_t MAX_SIZE = 10000000; // 1e7: the pointer heap needs ~40 bytes per node
+
+
+DynamicArray<int> randomKeys(const size_t n) {
+    std::mt19937 rng(42);
+    DynamicArray<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+        keys.addLast(static_cast<int>(rng()));
+    return keys;
+}
+
+
+/// Inserts n random keys one by one, then extracts them all.
+template <typename Heap>
+void BM_HeapInsertExtract(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        Heap heap;
+        for (const int key : keys)
+            heap.insert(key);
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.extractRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_HeapInsertExtract<MinHeap<int>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_HeapInsertExtract<MinDaryHeap<int, 2>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_HeapInsertExtract<MinDaryHeap<int, 4>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Builds a heap of n keys in one O(n) heapify, then extracts them all.
+template <size_t Arity>
+void BM_HeapifyExtract(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        MinDaryHeap<int, Arity> heap(keys);
+        while (!heap.isEmpty())
+            benchmark::DoNotOptimize(heap.extractRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_HeapifyExtract<2>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_HeapifyExtract<4>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Keeps the 1000 largest of a stream of n keys with fused pushPop().
+template <size_t Arity>
+void BM_HeapTopK(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+    constexpr size_t K = 1000;
+
+    for (auto _ : state) {
+        MinDaryHeap<int, Arity> best;
+        best.reserve(K);
+        for (const int key : keys) {
+            if (best.size() < K)
+                best.insert(key);
+            else
+                best.pushPop(key);
+        }
+        benchmark::DoNotOptimize(best.peekRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_HeapTopK<2>)->RangeMultiplier(10)->Range(10000, MAX_SIZE);
+BENCHMARK(BM_HeapTopK<4>)->RangeMultiplier(10)->Range(10000, MAX_SIZE);
+
+
+
+/// Random directed graph in compressed adjacency form, DEGREE edges per node.
+struct Graph {
+    static constexpr size_t DEGREE = 8;
+    DynamicArray<std::uint32_t> targets;
+    DynamicArray<std::uint32_t> weights;
+
+    explicit Graph(const size_t n) : targets(n * DEGREE), weights(n * DEGREE) {
+        std::mt19937 rng(42);
+        for (size_t i = 0; i < n * DEGREE; ++i) {
+            targets.addLast(static_cast<std::uint32_t>(rng() % n));
+            weights.addLast(static_cast<std::uint32_t>(1 + rng() % 1000));
+        }
+    }
+};
+
+constexpr std::uint64_t UNREACHED = std::numeric_limits<std::uint64_t>::max();
+
+
+/// Dijkstra with a plain heap: an improved distance pushes a duplicate entry
+/// and stale entries are skipped when popped.
+void BM_DijkstraLazyDeletion(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Graph graph(n);
+    size_t peak = 0;
+
+    for (auto _ : state) {
+        DynamicArray<std::uint64_t> distance(n);
+        for (size_t i = 0; i < n; ++i)
+            distance.addLast(UNREACHED);
+        std::uint64_t* dist = distance.begin();
+
+        MinDaryHeap<std::pair<std::uint64_t, std::uint32_t>> heap;
+        dist[0] = 0;
+        heap.insert(std::pair{std::uint64_t{0}, std::uint32_t{0}});
+        while (!heap.isEmpty()) {
+            peak = std::max(peak, heap.size());
+            const auto [d, node] = heap.extractRoot();
+            if (d != dist[node])
+                continue;
+            for (size_t e = node * Graph::DEGREE; e < (node + 1) * Graph::DEGREE; ++e) {
+                const std::uint32_t to = graph.targets.begin()[e];
+                const std::uint64_t candidate = d + graph.weights.begin()[e];
+                if (candidate < dist[to]) {
+                    dist[to] = candidate;
+                    heap.insert(std::pair{candidate, to});
+                }
+            }
+        }
+        benchmark::DoNotOptimize(dist);
+    }
+
+    state.counters["peak_heap"] = static_cast<double>(peak);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_DijkstraLazyDeletion)->RangeMultiplier(10)->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+
+
+/// Dijkstra with the addressable heap: one entry per node, improved in place
+/// with decreaseKey().
+void BM_DijkstraDecreaseKey(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Graph graph(n);
+    using Heap = MinIndexedHeap<std::pair<std::uint64_t, std::uint32_t>>;
+    size_t peak = 0;
+
+    for (auto _ : state) {
+        DynamicArray<std::uint64_t> distance(n);
+        DynamicArray<Heap::Handle> handle_of(n);
+        for (size_t i = 0; i < n; ++i) {
+            distance.addLast(UNREACHED);
+            handle_of.addLast(Heap::INVALID_HANDLE);
+        }
+        std::uint64_t* dist = distance.begin();
+        Heap::Handle* handles = handle_of.begin();
+
+        Heap heap;
+        dist[0] = 0;
+        heap.insert(std::pair{std::uint64_t{0}, std::uint32_t{0}});
+        while (!heap.isEmpty()) {
+            peak = std::max(peak, heap.size());
+            const auto [d, node] = heap.extractRoot();
+            handles[node] = Heap::INVALID_HANDLE;
+            for (size_t e = node * Graph::DEGREE; e < (node + 1) * Graph::DEGREE; ++e) {
+                const std::uint32_t to = graph.targets.begin()[e];
+                const std::uint64_t candidate = d + graph.weights.begin()[e];
+                if (candidate >= dist[to])
+                    continue;
+                dist[to] = candidate;
+                if (handles[to] != Heap::INVALID_HANDLE)
+                    heap.decreaseKey(handles[to], std::pair{candidate, to});
+                else
+                    handles[to] = heap.insert(std::pair{candidate, to});
+            }
+        }
+        benchmark::DoNotOptimize(dist);
+    }
+
+    state.counters["peak_heap"] = static_cast<double>(peak);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_DijkstraDecreaseKey)->RangeMultiplier(10)->Range(10000, 1000000)
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
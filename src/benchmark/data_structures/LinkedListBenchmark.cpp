@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <iterator>
+#include <random>
+
+#include "LinkedList.hpp"
+#include "UnrolledLinkedList.hpp"
+
+
+using containers::LinkedList;
+using containers::UnrolledLinkedList;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;    // 1e3
+constexpr int64_t MAX_SIZE = 1000000; // 1e6
+
+
+/// A list of n values whose nodes were allocated interleaved with other
+/// allocations, as they would be in a long-running program.
+template <typename List>
+List scatteredList(const size_t n) {
+    std::mt19937 rng(5);
+    List list;
+    LinkedList<int64_t> noise;
+    for (size_t i = 0; i < n; ++i) {
+        list.addLast(static_cast<int64_t>(rng() % 16));
+        noise.addLast(0);
+    }
+    return list;
+}
+
+
+/// Sums every element through the iterators.
+template <typename List>
+void BM_ListTraversal(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const List list = scatteredList<List>(n);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (const int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ListTraversal<LinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ListTraversal<UnrolledLinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Reads 64 random indices with get(i).
+template <typename List>
+void BM_ListIndexedAccess(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    List list = scatteredList<List>(n);
+    std::mt19937 rng(9);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int i = 0; i < 64; ++i)
+            sum += list.get(rng() % n);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(BM_ListIndexedAccess<LinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, 100000);
+BENCHMARK(BM_ListIndexedAccess<UnrolledLinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, 100000);
+
+
+/// Inserts one element after every element reached by a cursor, then erases
+/// them again through the cursor.
+template <typename List>
+void BM_ListCursorEdits(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    List list = scatteredList<List>(n);
+
+    for (auto _ : state) {
+        for (auto it = list.begin(); it != list.end(); ++it)
+            it = list.insert(std::next(it), -1);
+        for (auto it = list.begin(); it != list.end();)
+            it = *it == -1 ? list.erase(it) : std::next(it);
+        benchmark::DoNotOptimize(list.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n) * 2);
+}
+BENCHMARK(BM_ListCursorEdits<LinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ListCursorEdits<UnrolledLinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Removes one of the 16 values; rebuilding and freeing the list is not
+/// timed.
+template <typename List>
+void BM_ListRemoveAll(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const List original = scatteredList<List>(n);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        List list(original);
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(list.removeAll(3));
+        state.PauseTiming();
+        list.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ListRemoveAll<LinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ListRemoveAll<UnrolledLinkedList<int64_t>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
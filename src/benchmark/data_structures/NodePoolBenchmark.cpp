@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "BinarySearchTree.hpp"
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "NodePool.hpp"
+
+
+using containers::BinarySearchTree;
+using containers::DynamicArray;
+using containers::HeapNodes;
+using containers::LinkedList;
+using containers::PooledNodes;
+using containers::ThreadPooledNodes;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;    // 1e3
+constexpr int64_t MAX_SIZE = 1000000; // 1e6
+
+
+DynamicArray<int> randomKeys(const size_t n) {
+    std::mt19937 rng(21);
+    DynamicArray<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+        keys.addLast(static_cast<int>(rng()));
+    return keys;
+}
+
+
+/// Builds a BST of n random keys; only the build is timed.
+template <typename NodePolicy>
+void BM_BSTBuild(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        BinarySearchTree<int, NodePolicy> tree;
+        for (const int key : keys)
+            tree.insert(key);
+        benchmark::DoNotOptimize(tree.getRoot());
+
+        state.PauseTiming();
+        tree.clear();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BSTBuild<HeapNodes>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BSTBuild<PooledNodes<>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BSTBuild<ThreadPooledNodes<>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Clears a BST of n random keys; only the teardown is timed.
+template <typename NodePolicy>
+void BM_BSTClear(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        BinarySearchTree<int, NodePolicy> tree;
+        for (const int key : keys)
+            tree.insert(key);
+        state.ResumeTiming();
+
+        tree.clear();
+        benchmark::DoNotOptimize(tree.getRoot());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BSTClear<HeapNodes>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BSTClear<PooledNodes<>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_BSTClear<ThreadPooledNodes<>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Appends n elements to a list, sums them and destroys the list.
+template <typename NodePolicy>
+void BM_ListFillTraverseClear(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        LinkedList<int64_t, NodePolicy> list;
+        for (size_t i = 0; i < n; ++i)
+            list.addLast(static_cast<int64_t>(i));
+
+        int64_t sum = 0;
+        for (const int64_t value : list)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ListFillTraverseClear<HeapNodes>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ListFillTraverseClear<PooledNodes<>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ListFillTraverseClear<ThreadPooledNodes<>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
@@ -0,0 +1,188 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "ArrayAlgorithms.hpp"
+#include "BPlusTree.hpp"
+#include "BinarySearchTree.hpp"
+#include "DynamicArray.hpp"
+#include "RedBlackTree.hpp"
+
+
+using containers::BinarySearchTree;
+using containers::BPlusTree;
+using containers::DynamicArray;
+using containers::PooledNodes;
+using containers::RedBlackTree;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;    // 1e3
+constexpr int64_t MAX_SIZE = 1000000; // 1e6
+constexpr int64_t MAX_SORTED_BST_SIZE = 10000; // the plain BST is O(n^2) on sorted keys
+
+
+DynamicArray<int> randomKeys(const size_t n) {
+    std::mt19937 rng(22);
+    DynamicArray<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+        keys.addLast(static_cast<int>(rng()));
+    return keys;
+}
+
+DynamicArray<int> ascendingKeys(const size_t n) {
+    DynamicArray<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+        keys.addLast(static_cast<int>(i));
+    return keys;
+}
+
+
+/// Inserts n keys, then looks every one of them up.
+template <typename Tree, DynamicArray<int> (*Keys)(size_t)>
+void BM_TreeInsertFind(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = Keys(n);
+
+    for (auto _ : state) {
+        Tree tree;
+        for (const int key : keys)
+            tree.insert(key);
+
+        size_t found = 0;
+        for (const int key : keys)
+            found += tree.contains(key);
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_TreeInsertFind<BinarySearchTree<int>, randomKeys>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_TreeInsertFind<RedBlackTree<int>, randomKeys>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_TreeInsertFind<RedBlackTree<int, std::less<int>, PooledNodes<>>, randomKeys>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_TreeInsertFind<BinarySearchTree<int>, ascendingKeys>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SORTED_BST_SIZE);
+BENCHMARK(BM_TreeInsertFind<RedBlackTree<int>, ascendingKeys>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Sums the keys of 1000 short [low, low + 64) range queries.
+void BM_RedBlackTreeRange(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    RedBlackTree<int> tree;
+    for (size_t i = 0; i < n; ++i)
+        tree.insert(static_cast<int>(i));
+
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> low(0, static_cast<int>(n));
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int query = 0; query < 1000; ++query) {
+            const int from = low(rng);
+            for (const int key : tree.range(from, from + 64))
+                sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_RedBlackTreeRange)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Inserts n random keys into a B+ tree one by one, then looks them all up.
+void BM_BPlusTreeInsertFind(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        BPlusTree<int, int> tree;
+        for (const int key : keys)
+            tree.insert(key, key);
+
+        size_t found = 0;
+        for (const int key : keys)
+            found += tree.contains(key);
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BPlusTreeInsertFind)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Sorts n random keys with RadixSortLSD and bulk-loads a B+ tree from them.
+void BM_BPlusTreeBulkLoad(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+
+    for (auto _ : state) {
+        DynamicArray<int> sorted = keys;
+        array_algorithms::RadixSortLSD(sorted);
+        DynamicArray<int> unique(sorted.size());
+        for (const int key : sorted)
+            if (unique.isEmpty() || unique.getLast() != key)
+                unique.addLast(key);
+
+        BPlusTree<int, int> tree(unique, unique);
+        benchmark::DoNotOptimize(tree.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_BPlusTreeBulkLoad)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Looks up n random keys in a tree built from them.
+template <typename Tree>
+void BM_TreeFind(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = randomKeys(n);
+    Tree tree;
+    for (const int key : keys) {
+        if constexpr (requires { tree.insert(key, key); })
+            tree.insert(key, key);
+        else
+            tree.insert(key);
+    }
+
+    for (auto _ : state) {
+        size_t found = 0;
+        for (const int key : keys)
+            found += tree.contains(key);
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_TreeFind<RedBlackTree<int>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_TreeFind<BPlusTree<int, int>>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Sums the values of 1000 short [low, low + 64) range scans.
+void BM_BPlusTreeScan(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    DynamicArray<int> keys = ascendingKeys(n);
+    const BPlusTree<int, int> tree(keys, keys);
+
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> low(0, static_cast<int>(n));
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (int query = 0; query < 1000; ++query) {
+            const int from = low(rng);
+            tree.scan(from, from + 64, [&](const int, const int value) { sum += value; });
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_BPlusTreeScan)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
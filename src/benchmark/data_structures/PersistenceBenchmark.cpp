@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "BenchmarkInputs.hpp"
+#include "DynamicArray.hpp"
+#include "FrozenHashMap.hpp"
+#include "HashMap.hpp"
+#include "MappedArray.hpp"
+
+
+using benchmarks::makeShuffledKeys;
+using containers::DefaultHash;
+using containers::DynamicArray;
+using containers::FrozenHashMap;
+using containers::HashMap;
+using containers::ImageCheck;
+using containers::MappedArray;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 1000;     // 1e3
+constexpr int64_t MAX_SIZE = 1000000;  // 1e6
+
+using Map = HashMap<int, int, DefaultHash<int, false>>;
+
+
+std::filesystem::path imagePath(const char* name, const size_t n) {
+    return std::filesystem::temp_directory_path() /
+           ("persistence_benchmark_" + std::string(name) + "_" + std::to_string(n));
+}
+
+Map buildMap(const DynamicArray<int>& keys) {
+    Map map;
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.insert(keys[i], static_cast<int>(i));
+    return map;
+}
+
+
+/// Cold start by rebuilding: inserts every entry into a new HashMap, then
+/// answers 64 lookups.
+void BM_ColdStartRebuildHashMap(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+
+    for (auto _ : state) {
+        const Map map = buildMap(keys);
+        int64_t sum = 0;
+        for (size_t i = 0; i < 64; ++i)
+            sum += map.at(keys[i * n / 64]);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ColdStartRebuildHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Cold start from an image: maps a FrozenHashMap, then answers the same 64
+/// lookups. Pages stay in the OS cache between iterations.
+template <ImageCheck Check>
+void BM_ColdStartFrozenHashMap(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const DynamicArray<int> keys = makeShuffledKeys(n);
+    const auto path = imagePath("map", n);
+    FrozenHashMap<int, int>::save(path, buildMap(keys));
+
+    for (auto _ : state) {
+        const FrozenHashMap<int, int> map(path, Check);
+        int64_t sum = 0;
+        for (size_t i = 0; i < 64; ++i)
+            sum += map.at(keys[i * n / 64]);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ColdStartFrozenHashMap<ImageCheck::Header>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(BM_ColdStartFrozenHashMap<ImageCheck::Checksum>)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Random lookups in a loaded HashMap and in a FrozenHashMap of the same
+/// entries.
+void BM_LookupHashMap(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const Map map = buildMap(makeShuffledKeys(n));
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < n; ++i)
+            sum += map.at(probes[i]);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_LookupHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+void BM_LookupFrozenHashMap(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto path = imagePath("lookup", n);
+    FrozenHashMap<int, int>::save(path, buildMap(makeShuffledKeys(n)));
+    const FrozenHashMap<int, int> map(path);
+    const DynamicArray<int> probes = makeShuffledKeys(n);
+
+    for (auto _ : state) {
+        int64_t sum = 0;
+        for (size_t i = 0; i < n; ++i)
+            sum += map.at(probes[i]);
+        benchmark::DoNotOptimize(sum);
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_LookupFrozenHashMap)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Loading an array: copying the image into a DynamicArray versus using the
+/// mapping in place, then summing every element.
+void BM_LoadArrayByCopy(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto path = imagePath("copy_array", n);
+    MappedArray<int>::save(path, makeShuffledKeys(n));
+
+    for (auto _ : state) {
+        const DynamicArray<int> array = MappedArray<int>(path).toDynamicArray();
+        int64_t sum = 0;
+        for (const int value : array)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_LoadArrayByCopy)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+void BM_LoadArrayByMapping(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto path = imagePath("map_array", n);
+    MappedArray<int>::save(path, makeShuffledKeys(n));
+
+    for (auto _ : state) {
+        const MappedArray<int> array(path);
+        int64_t sum = 0;
+        for (const int value : array)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+
+    std::filesystem::remove(path);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_LoadArrayByMapping)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+} // namespace
@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "Queue.hpp"
+#include "SegmentedQueue.hpp"
+
+
+using containers::Queue;
+using containers::SegmentedQueue;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100;       // 1e2
+constexpr int64_t MAX_SIZE = 100000000; // 1e8
+
+
+/// Enqueues n elements into an empty queue, then dequeues them all.
+void BM_QueueEnqueueDequeue(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Queue<int> queue;
+        for (size_t i = 0; i < n; ++i)
+            queue.enqueue(static_cast<int>(i));
+        while (!queue.isEmpty()) {
+            benchmark::DoNotOptimize(queue.front());
+            queue.dequeue();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_QueueEnqueueDequeue)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Alternates one enqueue and one dequeue on a queue that already holds n
+/// elements, so the front index keeps wrapping around the circular buffer.
+void BM_QueueSteadyState(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    Queue<int> queue;
+    for (size_t i = 0; i < n; ++i)
+        queue.enqueue(static_cast<int>(i));
+
+    for (auto _ : state) {
+        queue.enqueue(1);
+        benchmark::DoNotOptimize(queue.front());
+        queue.dequeue();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_QueueSteadyState)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/**
+ * Bursty traffic on a long-lived queue: each iteration enqueues n elements and
+ * drains them again. Shows how often each capacity policy regrows the buffer,
+ * and what a segmented queue, which never copies on growth, costs instead.
+ */
+template <typename Q>
+void BM_QueueBursts(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    Q queue;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i)
+            queue.enqueue(static_cast<int>(i));
+        while (!queue.isEmpty()) {
+            benchmark::DoNotOptimize(queue.front());
+            queue.dequeue();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_QueueBursts<Queue<int>>)->RangeMultiplier(10)->Range(MIN_SIZE, 10000000);
+BENCHMARK(BM_QueueBursts<Queue<int, std::allocator<int>, containers::HysteresisShrink<>>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, 10000000);
+BENCHMARK(BM_QueueBursts<Queue<int, std::allocator<int>, containers::NeverShrink<>>>)
+    ->RangeMultiplier(10)->Range(MIN_SIZE, 10000000);
+BENCHMARK(BM_QueueBursts<SegmentedQueue<int>>)->RangeMultiplier(10)->Range(MIN_SIZE, 10000000);
+
+} // namespace
@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "Stack.hpp"
+
+
+using containers::GrowOnlyStack;
+using containers::SmallStack;
+using containers::Stack;
+
+
+namespace {
+
+constexpr int64_t MIN_SIZE = 100;       // 1e2
+constexpr int64_t MAX_SIZE = 100000000; // 1e8
+
+
+/// Pushes n elements onto an empty stack, then pops them all.
+void BM_StackPushPop(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Stack<int> stack;
+        for (size_t i = 0; i < n; ++i)
+            stack.push(static_cast<int>(i));
+        while (!stack.isEmpty()) {
+            benchmark::DoNotOptimize(stack.top());
+            stack.pop();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_StackPushPop)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Alternates one push and one pop on a stack that already holds n elements.
+void BM_StackSteadyState(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    Stack<int> stack;
+    for (size_t i = 0; i < n; ++i)
+        stack.push(static_cast<int>(i));
+
+    for (auto _ : state) {
+        stack.push(1);
+        benchmark::DoNotOptimize(stack.top());
+        stack.pop();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StackSteadyState)->RangeMultiplier(10)->Range(MIN_SIZE, MAX_SIZE);
+
+
+/// Builds and drains many short-lived stacks of n <= 16 elements, comparing
+/// the heap-backed stack against one with 16 inline slots.
+template <typename StackType>
+void BM_ShortLivedStack(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        StackType stack;
+        for (size_t i = 0; i < n; ++i)
+            stack.push(static_cast<int>(i));
+        while (!stack.isEmpty()) {
+            benchmark::DoNotOptimize(stack.top());
+            stack.pop();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ShortLivedStack<Stack<int>>)->DenseRange(4, 16, 4);
+BENCHMARK(BM_ShortLivedStack<SmallStack<int, 16>>)->DenseRange(4, 16, 4);
+
+
+/// DFS-like bursts: the stack repeatedly fills to n elements and drains to a
+/// handful, pushing and popping one element at a time.
+template <typename StackType>
+void BM_StackBursts(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    StackType stack;
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; ++i)
+            stack.push(static_cast<int>(i));
+        while (stack.size() > 4) {
+            benchmark::DoNotOptimize(stack.top());
+            stack.pop();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_StackBursts<Stack<int>>)->RangeMultiplier(100)->Range(MIN_SIZE, 1000000);
+BENCHMARK(BM_StackBursts<GrowOnlyStack<int>>)->RangeMultiplier(100)->Range(MIN_SIZE, 1000000);
+
+
+/// Same bursts through the bulk interface: pushRange() of a prepared batch
+/// and a single popN().
+void BM_StackBulkBursts(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    std::vector<int> batch(n);
+    for (size_t i = 0; i < n; ++i)
+        batch[i] = static_cast<int>(i);
+    GrowOnlyStack<int> stack;
+
+    for (auto _ : state) {
+        stack.pushRange(batch.begin(), batch.end());
+        benchmark::DoNotOptimize(stack.top());
+        stack.popN(stack.size() - 4);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_StackBulkBursts)->RangeMultiplier(100)->Range(MIN_SIZE, 1000000);
+
+
+/// Pushes through pushUnchecked() after one reserve() per burst.
+void BM_StackReservedBursts(benchmark::State& state) {
+    const auto n = static_cast<size_t>(state.range(0));
+    GrowOnlyStack<int> stack;
+
+    for (auto _ : state) {
+        stack.reserve(stack.size() + n);
+        for (size_t i = 0; i < n; ++i)
+            stack.pushUnchecked(static_cast<int>(i));
+        benchmark::DoNotOptimize(stack.top());
+        stack.popN(stack.size() - 4);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_StackReservedBursts)->RangeMultiplier(100)->Range(MIN_SIZE, 1000000);
+
+} // namespace
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "TaskScheduler.hpp"
+
+
+using containers::TaskScheduler;
+
+
+namespace {
+
+constexpr int FIB_N = 27;
+constexpr int FIB_SERIAL_BELOW = 16;
+
+
+int64_t serialFib(const int n) {
+    return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2);
+}
+
+
+int64_t schedulerFib(TaskScheduler& scheduler, const int n) {
+    if (n < FIB_SERIAL_BELOW)
+        return serialFib(n);
+    int64_t a = 0, b = 0;
+    scheduler.parallelInvoke([&] { a = schedulerFib(scheduler, n - 1); },
+                             [&] { b = schedulerFib(scheduler, n - 2); });
+    return a + b;
+}
+
+
+/// Baseline: a new thread for every fork.
+int64_t threadFib(const int n) {
+    if (n < FIB_SERIAL_BELOW)
+        return serialFib(n);
+    int64_t a = 0;
+    std::thread left([&] { a = threadFib(n - 1); });
+    const int64_t b = threadFib(n - 2);
+    left.join();
+    return a + b;
+}
+
+
+/// Fork-join recursion with a few hundred tasks per call.
+void BM_ForkJoinScheduler(benchmark::State& state) {
+    TaskScheduler scheduler(static_cast<size_t>(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(schedulerFib(scheduler, FIB_N));
+}
+BENCHMARK(BM_ForkJoinScheduler)->RangeMultiplier(2)->Range(1, 16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+void BM_ForkJoinThreadPerTask(benchmark::State& state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(threadFib(FIB_N));
+}
+BENCHMARK(BM_ForkJoinThreadPerTask)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+/// Cost per index of parallelFor over a trivial body, by grain size.
+void BM_ParallelForOverhead(benchmark::State& state) {
+    constexpr size_t n = 1 << 16;
+    const auto grain = static_cast<size_t>(state.range(0));
+    std::vector<uint32_t> data(n);
+
+    for (auto _ : state) {
+        TaskScheduler::shared().parallelFor(0, n, [&](const size_t i) { data[i] += 1; }, grain);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+BENCHMARK(BM_ParallelForOverhead)->RangeMultiplier(16)->Range(1, 1 << 16)->UseRealTime();
+
+} // namespace
@@ -0,0 +1,75 @@
+#ifndef BENCHMARK_COUNTERS_HPP
+#define BENCHMARK_COUNTERS_HPP
+
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "AllocationCounter.hpp"
+#include "HardwareCounters.hpp"
+
+
+namespace benchmarks {
+
+using array_algorithms::CounterReading;
+using array_algorithms::CounterSource;
+using array_algorithms::HardwareEvent;
+using containers::AllocationCounts;
+using std::size_t;
+
+
+/**
+ * @brief Reports hardware counts as per-element benchmark counters.
+ *
+ * Adds cycles/elem, instr/elem, IPC, br_miss/elem, l1d_miss/elem and
+ * llc_miss/elem for the events that were measured. Without perf events
+ * the cycles come from the time-stamp counter and are reported as
+ * tsc/elem instead.
+ *
+ * @param state The running benchmark.
+ * @param reading Counts summed over every iteration.
+ * @param elements Elements processed over every iteration.
+ */
+inline void reportHardwareCounters(benchmark::State& state, const CounterReading& reading,
+                                   const size_t elements) {
+    if (reading.has(HardwareEvent::Cycles)) {
+        const char* name = reading.source == CounterSource::PerfEvents ? "cycles/elem" : "tsc/elem";
+        state.counters[name] = CounterReading::perElement(reading.cycles, elements);
+    }
+    if (reading.has(HardwareEvent::Instructions)) {
+        state.counters["instr/elem"] = CounterReading::perElement(reading.instructions, elements);
+        state.counters["IPC"] = reading.instructionsPerCycle();
+    }
+    if (reading.has(HardwareEvent::BranchMisses))
+        state.counters["br_miss/elem"] = CounterReading::perElement(reading.branch_misses, elements);
+    if (reading.has(HardwareEvent::L1DataMisses))
+        state.counters["l1d_miss/elem"] = CounterReading::perElement(reading.l1d_misses, elements);
+    if (reading.has(HardwareEvent::LastLevelMisses))
+        state.counters["llc_miss/elem"] = CounterReading::perElement(reading.llc_misses, elements);
+}
+
+
+/**
+ * @brief Reports allocation counts as per-element benchmark counters.
+ *
+ * Adds allocs/elem and bytes/elem over every iteration, and the largest
+ * live_bytes of any iteration as peak_bytes.
+ *
+ * @param state The running benchmark.
+ * @param counts Counts summed over every iteration (see
+ * AllocationCounter::reset()).
+ * @param elements Elements processed over every iteration.
+ */
+inline void reportAllocations(benchmark::State& state, const AllocationCounts& counts,
+                              const size_t elements) {
+    state.counters["allocs/elem"] = CounterReading::perElement(counts.allocations, elements);
+    state.counters["bytes/elem"] = CounterReading::perElement(counts.bytes_allocated, elements);
+    state.counters["peak_bytes"] = static_cast<double>(counts.peak_bytes);
+}
+
+
+} // namespace benchmarks
+
+
+#endif // BENCHMARK_COUNTERS_HPP
@@ -0,0 +1,113 @@
+#ifndef BENCHMARK_INPUTS_HPP
+#define BENCHMARK_INPUTS_HPP
+
+
+#include <cstdint>
+#include <random>
+
+#include "DynamicArray.hpp"
+
+
+namespace benchmarks {
+
+using containers::DynamicArray;
+using std::size_t;
+
+
+/// Shape of the generated input, passed to benchmarks as an integer argument.
+enum class InputPattern : int64_t { Random, Sorted, Reversed, FewUnique };
+
+
+/// Number of distinct values produced by InputPattern::FewUnique.
+constexpr int FEW_UNIQUE_VALUES = 16;
+
+
+/// Human-readable label used in benchmark names and reports.
+inline const char* patternName(const InputPattern pattern) {
+    switch (pattern) {
+    case InputPattern::Random:
+        return "random";
+    case InputPattern::Sorted:
+        return "sorted";
+    case InputPattern::Reversed:
+        return "reversed";
+    case InputPattern::FewUnique:
+        return "few_unique";
+    }
+    return "unknown";
+}
+
+
+/**
+ * @brief Generates a deterministic integer input of the requested shape.
+ *
+ * Values lie in [0, n) so that the universe-based BinSort can consume the same
+ * inputs as every other sort. A fixed seed keeps runs comparable.
+ *
+ * @param n Number of elements to generate.
+ * @param pattern Shape of the generated sequence.
+ * @return DynamicArray<int> The generated input.
+ */
+inline DynamicArray<int> makeInput(const size_t n, const InputPattern pattern) {
+    DynamicArray<int> data(n);
+    std::mt19937_64 rng(0xC0FFEEu);
+
+    switch (pattern) {
+    case InputPattern::Random: {
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(n) - 1);
+        for (size_t i = 0; i < n; ++i)
+            data.addLast(dist(rng));
+        break;
+    }
+    case InputPattern::Sorted:
+        for (size_t i = 0; i < n; ++i)
+            data.addLast(static_cast<int>(i));
+        break;
+    case InputPattern::Reversed:
+        for (size_t i = 0; i < n; ++i)
+            data.addLast(static_cast<int>(n - 1 - i));
+        break;
+    case InputPattern::FewUnique: {
+        std::uniform_int_distribution<int> dist(0, FEW_UNIQUE_VALUES - 1);
+        for (size_t i = 0; i < n; ++i)
+            data.addLast(dist(rng));
+        break;
+    }
+    }
+
+    return data;
+}
+
+
+/**
+ * @brief Generates n distinct keys in random order.
+ *
+ * Used by the container benchmarks so that every insertion creates a new entry
+ * and lookups hit a well-defined key set.
+ *
+ * @param n Number of keys to generate.
+ * @param offset Value added to every key (e.g. to build a disjoint miss set).
+ * @return DynamicArray<int> The shuffled keys offset, offset + 1, ..., offset + n - 1.
+ */
+inline DynamicArray<int> makeShuffledKeys(const size_t n, const int offset = 0) {
+    DynamicArray<int> keys(n);
+    for (size_t i = 0; i < n; ++i)
+        keys.addLast(offset + static_cast<int>(i));
+
+    std::mt19937_64 rng(0xBADC0DEu);
+    for (size_t i = n; i > 1; --i) {
+        std::uniform_int_distribution<size_t> dist(0, i - 1);
+        const size_t j = dist(rng);
+        const int tmp = keys[i - 1];
+        keys[i - 1] = keys[j];
+        keys[j] = tmp;
+    }
+
+    return keys;
+}
+
+
+} // namespace benchmarks
+
+
+#endif // BENCHMARK_INPUTS_HPP
@@ -5,13 +5,19 @@
  * containers::DynamicArray class, along with utility functions used by these
  * algorithms.
  *
- * Note that these algorithms can EXCLUSIVELY be used on DynamicArrays that
- * store built-in numeric types, specifically: int, double, float, unsigned int
- * and size_t.
+ * The plain overloads order elements with operator<, so they work on any
+ * DynamicArray whose element type provides it. QuickSort, MergeSort,
+ * HeapSort, NthElement, PartialSort, ArgSort and BinarySearch also take a
+ * comparator and a projection (std::ranges style) for user-defined types and
+ * custom orders. BinSort needs integral elements; the radix sorts need
+ * integral or IEEE floating-point elements, or a key function.
  *
  * The purpose of these functions is to provide a basis for the visualization
- * of these data structures and their algorithms, so there is no need to support
- * user-defined types.
+ * of these data structures and their algorithms.
+ *
+ * Operations are reported to an instrumentation policy passed as the last
+ * argument (see Instrumentation.hpp). The default, NoInstrumentation,
+ * compiles to nothing; CountingInstrumentation counts the events.
  */
 
 
@@ -19,11 +25,24 @@
 #define DYNAMIC_ARRAY_ALGORITHMS_HPP
 
 
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
+#include "DaryHeap.hpp"
 #include "DynamicArray.hpp"
+#include "Instrumentation.hpp"
+#include "SimdSearch.hpp"
 
 
 namespace array_algorithms {
@@ -43,9 +62,92 @@ void swap(Type& a, Type& b) noexcept {
 }
 
 
+namespace detail {
+
+/**
+ * @brief Singly linked bin storage for BinSort, drawing both the bin head/tail
+ * tables and the nodes from the sorted array's allocator (rebound).
+ */
+template <typename Type, typename Allocator>
+class BinLists {
+    struct Node {
+        Type value;
+        Node* next;
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAlloc>;
+    using PtrAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Node*>;
+
+    NodeAlloc node_alloc_;
+    DynamicArray<Node*, PtrAlloc> heads_;
+    DynamicArray<Node*, PtrAlloc> tails_;
+
+  public:
+    BinLists(const size_t bins, const Allocator& allocator)
+        : node_alloc_(allocator), heads_(bins, PtrAlloc(allocator)),
+          tails_(bins, PtrAlloc(allocator)) {
+        for (size_t b = 0; b < bins; ++b) {
+            heads_.addLast(nullptr);
+            tails_.addLast(nullptr);
+        }
+    }
+
+    BinLists(const BinLists&) = delete;
+    BinLists& operator=(const BinLists&) = delete;
+
+    /// Appends value to the given bin (keeps insertion order, so stable).
+    void append(const size_t bin, const Type& value) {
+        Node* node = std::to_address(NodeTraits::allocate(node_alloc_, 1));
+        std::construct_at(node, Node{value, nullptr});
+        if (!heads_[bin]) {
+            heads_[bin] = tails_[bin] = node;
+        } else {
+            tails_[bin]->next = node;
+            tails_[bin] = node;
+        }
+    }
+
+    /// Writes all values back in bin order and releases the nodes.
+    template <typename Output>
+    void drainInto(Output& output) {
+        size_t write = 0;
+        for (size_t b = 0; b < heads_.size(); ++b) {
+            Node* cur = heads_[b];
+            while (cur) {
+                output[write++] = cur->value;
+                Node* nxt = cur->next;
+                release(cur);
+                cur = nxt;
+            }
+            heads_[b] = tails_[b] = nullptr;
+        }
+    }
+
+    ~BinLists() {
+        for (size_t b = 0; b < heads_.size(); ++b) {
+            Node* cur = heads_[b];
+            while (cur) {
+                Node* nxt = cur->next;
+                release(cur);
+                cur = nxt;
+            }
+        }
+    }
+
+  private:
+    void release(Node* node) noexcept {
+        std::destroy_at(node);
+        NodeTraits::deallocate(node_alloc_, node, 1);
+    }
+};
+
+} // namespace detail
+
+
 /// Checks if the array is sorted in ascending order.
-template <typename Type>
-bool isSorted(const DynamicArray<Type>& array) noexcept {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+bool isSorted(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array) noexcept {
     for (size_t i = 1; i < array.size(); ++i)
         if (array[i] < array[i - 1])
             return false;
@@ -54,6 +156,50 @@ bool isSorted(const DynamicArray<Type>& array) noexcept {
 }
 
 
+namespace detail {
+
+/// Default element ordering of the sorts: operator< on the elements.
+struct Less {
+    template <typename A, typename B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        return a < b;
+    }
+};
+
+
+/// Element ordering comp(proj(a), proj(b)) used by the comparator overloads.
+template <typename Compare, typename Projection>
+struct ProjectedLess {
+    Compare& comp;
+    Projection& proj;
+
+    template <typename A, typename B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    }
+};
+
+
+/// isSorted() under an arbitrary element ordering.
+template <typename Array, typename Less>
+bool isSortedBy(const Array& array, Less&& less) {
+    for (size_t i = 1; i < array.size(); ++i)
+        if (less(array[i], array[i - 1]))
+            return false;
+
+    return true;
+}
+
+} // namespace detail
+
+
+/// Comparator accepted by the sorts for elements of Type under Projection,
+/// in the sense of std::ranges::sort.
+template <typename Compare, typename Type, typename Projection>
+concept SortComparator =
+    std::indirect_strict_weak_order<Compare, std::projected<const Type*, Projection>>;
+
+
 // -- Searching Algorithms -- //
 
 
@@ -64,6 +210,11 @@ bool isSorted(const DynamicArray<Type>& array) noexcept {
  * Returns the index of the first occurrence of the element, or array.size()
  * if not found.
  *
+ * Arrays of built-in numeric types are scanned with SIMD compares (see
+ * detail::findEqual()), 16-32 bytes of elements per instruction. The
+ * callback then receives the indices the scan covered, from 0 up to the
+ * match, once the scan is done.
+ *
  * @param array The array to search in.
  * @param target The element to search for.
  * @param callback The callback function to invoke on each index visited.
@@ -73,9 +224,17 @@ bool isSorted(const DynamicArray<Type>& array) noexcept {
  * - O(n) time.
  * - O(1) space.
  */
-template <typename Type, typename Callback = void (*)(size_t)>
-size_t LinearSearch(const DynamicArray<Type>& array, const Type& target,
-                    Callback&& callback = [](size_t) {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+size_t LinearSearch(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const Type& target,
+                    Callback&& callback = NoInstrumentation{}) {
+    if constexpr (detail::SimdSearchable<Type>) {
+        const size_t found = detail::findEqual(array.begin(), array.size(), target);
+        const size_t probed = found < array.size() ? found + 1 : array.size();
+        for (size_t i = 0; i < probed; ++i)
+            callback(i);
+        return found;
+    }
+
     for (size_t i = 0; i < array.size(); ++i) {
         callback(i);
         if (array[i] == target)
@@ -92,6 +251,11 @@ size_t LinearSearch(const DynamicArray<Type>& array, const Type& target,
  * Searches for an element equal to the given key and returns its index if
  * present; otherwise returns array.size().
  *
+ * Arrays of built-in numeric types use a branchless lower bound that
+ * prefetches the next probes (see detail::branchlessLowerBound()), reports
+ * each of them to the callback and returns the index of the first equal
+ * element.
+ *
  * Note for float/double: Arrays containing NaN are unsupported for ordering;
  * results are unspecified.
  *
@@ -104,9 +268,15 @@ size_t LinearSearch(const DynamicArray<Type>& array, const Type& target,
  * - O(log n) time.
  * - O(1) space.
  */
-template <typename Type, typename Callback>
-size_t BinarySearch(const DynamicArray<Type>& array, const Type& target,
-                    Callback&& callback = [](size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+    requires std::invocable<Callback&, size_t>
+size_t BinarySearch(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const Type& target,
+                    Callback&& callback = NoInstrumentation{}) {
+    if constexpr (std::is_arithmetic_v<Type>) {
+        const size_t first = detail::branchlessLowerBound(array.begin(), array.size(), target, callback);
+        return first < array.size() && array[first] == target ? first : array.size();
+    }
+
     // left: inclusive lower bound, right: exclusive upper bound
     size_t left = 0;
     size_t right = array.size() - 1;
@@ -133,6 +303,53 @@ size_t BinarySearch(const DynamicArray<Type>& array, const Type& target,
 }
 
 
+/**
+ * @brief Performs a binary search for a key under a comparator and a
+ * projection, in the style of std::ranges::binary_search().
+ *
+ * Requires the array to be sorted with respect to comp on the projected
+ * elements. Searches for the first element whose projection is equivalent to
+ * key (neither compares less than the other), so records can be looked up by
+ * one of their fields without building a key array.
+ *
+ * @param array The array to search in.
+ * @param key The projected value to search for.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing.
+ * @return The index of the first matching element, or array.size() if not
+ * found.
+ *
+ * @par Complexity
+ * - O(log n) comparisons and projections.
+ * - O(1) space.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Key,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires std::indirect_strict_weak_order<Compare, const Key*,
+                                             std::projected<const Type*, Projection>>
+size_t BinarySearch(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const Key& key,
+                    Compare comp, Projection proj = {}) {
+    size_t first = 0;
+    size_t count = array.size();
+
+    while (count > 0) {
+        const size_t half = count / 2;
+        if (std::invoke(comp, std::invoke(proj, array[first + half]), key)) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+
+    if (first < array.size() && !std::invoke(comp, key, std::invoke(proj, array[first])))
+        return first;
+
+    return array.size();
+}
+
+
 //*** Sorting Algorithms ***//
 
 
@@ -159,29 +376,29 @@ size_t BinarySearch(const DynamicArray<Type>& array, const Type& target,
  *  - code = 1: Swap(a, b)              — swapping indices a and b
  *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void BubbleSort(DynamicArray<Type>& array,
-                Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void BubbleSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                Callback&& callback = NoInstrumentation{}) {
     const size_t n = array.size();
     if (n <= 1 || isSorted(array)) {
         for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
     for (size_t i = 0; i < n - 1; ++i) {
         for (size_t j = 0; j < n - i - 1; ++j) {
-            callback(0, j, j + 1); // compare
+            callback(SORT_EVENT_COMPARE, j, j + 1); // compare
             if (array[j] > array[j + 1]) {
-                callback(1, j, j + 1); // swap
+                callback(SORT_EVENT_SWAP, j, j + 1); // swap
                 swap(array[j], array[j + 1]);
             }
         }
         // Mark the last element of this pass as sorted
-        callback(2, n - i - 1, 0);
+        callback(SORT_EVENT_MARK_SORTED, n - i - 1, 0);
     }
     // First element is also in its correct place after the final pass
-    callback(2, 0, 0);
+    callback(SORT_EVENT_MARK_SORTED, 0, 0);
 }
 
 
@@ -207,13 +424,13 @@ void BubbleSort(DynamicArray<Type>& array,
  *  - code = 1: Swap(a, b)              — swapping indices a and b
  *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void ImprovedBubbleSort(DynamicArray<Type>& array,
-                Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void ImprovedBubbleSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                Callback&& callback = NoInstrumentation{}) {
     size_t n = array.size();
     if (n <= 1 || isSorted(array)) {
         for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
@@ -223,9 +440,9 @@ void ImprovedBubbleSort(DynamicArray<Type>& array,
         size_t last_swap = 0;
 
         for (size_t j = 0; j + 1 < n; ++j) {
-            callback(0, j, j + 1); // compare
+            callback(SORT_EVENT_COMPARE, j, j + 1); // compare
             if (array[j] > array[j + 1]) {
-                callback(1, j, j + 1); // swap
+                callback(SORT_EVENT_SWAP, j, j + 1); // swap
                 swap(array[j], array[j + 1]);
                 swapped = true;
                 last_swap = j + 1;
@@ -235,19 +452,19 @@ void ImprovedBubbleSort(DynamicArray<Type>& array,
         // If no swaps, the remaining prefix is already sorted
         if (!swapped) {
             for (size_t i = 0; i < n; ++i)
-                callback(2, i, 0);
+                callback(SORT_EVENT_MARK_SORTED, i, 0);
             return;
         }
 
         // Everything after last_swap is in final position this pass
         const size_t old_n = n;
         for (size_t k = last_swap; k < old_n; ++k)
-            callback(2, k, 0);
+            callback(SORT_EVENT_MARK_SORTED, k, 0);
 
         n = last_swap;
     }
     // First element is also in its correct place after the final pass
-    callback(2, 0, 0);
+    callback(SORT_EVENT_MARK_SORTED, 0, 0);
 }
 
 
@@ -274,13 +491,13 @@ void ImprovedBubbleSort(DynamicArray<Type>& array,
  *  - code = 1: Swap(a, b)              — swapping indices a and b
  *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void LinearInsertionSort(DynamicArray<Type>& array,
-                                   Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void LinearInsertionSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                                   Callback&& callback = NoInstrumentation{}) {
     const size_t n = array.size();
 
     if (n <= 1 || isSorted(array)) {
-        for (size_t i = 0; i < n; ++i) callback(2, i, 0);
+        for (size_t i = 0; i < n; ++i) callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
@@ -288,7 +505,7 @@ void LinearInsertionSort(DynamicArray<Type>& array,
         size_t insert_pos = i;
 
         while (insert_pos > 0) {
-            callback(0, insert_pos - 1, i);
+            callback(SORT_EVENT_COMPARE, insert_pos - 1, i);
             if (array[insert_pos - 1] > array[i])
                 --insert_pos;
             else
@@ -296,14 +513,80 @@ void LinearInsertionSort(DynamicArray<Type>& array,
         }
 
         for (size_t j = i; j > insert_pos; --j) {
-            callback(1, j - 1, j);
+            callback(SORT_EVENT_SWAP, j - 1, j);
+            swap(array[j], array[j - 1]);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) callback(SORT_EVENT_MARK_SORTED, i, 0);
+}
+
+
+namespace detail {
+
+/**
+ * @brief Binary insertion sort of the index range [lo, hi).
+ *
+ * Shared by BinaryInsertionSort() and the small-range cutoffs of
+ * HybridSort() and NthElement(). Reports Compare and Swap events with array
+ * indices; marking elements as sorted is left to the caller. Elements are
+ * ordered by less (operator< by default).
+ */
+template <typename Array, typename Callback, typename Order = Less>
+void binaryInsertionSortRange(Array& array, const size_t lo, const size_t hi,
+                              Callback&& callback, Order&& less = Order{}) {
+    for (size_t i = lo + 1; i < hi; ++i) {
+        size_t left = lo, right = i;
+        while (left < right) {
+            size_t mid = left + (right - left) / 2;
+            callback(SORT_EVENT_COMPARE, mid, i);
+            if (!less(array[i], array[mid]))
+                left = mid + 1;
+            else
+                right = mid;
+        }
+        for (size_t j = i; j > left; --j) {
+            callback(SORT_EVENT_SWAP, j, j - 1);
             swap(array[j], array[j - 1]);
         }
     }
+}
+
+
+/// Children per node of the heap built by HeapSort().
+inline constexpr size_t HEAP_SORT_ARITY = 2;
+
+
+/**
+ * @brief Heap sort of the index range [lo, hi) with a max-heap rooted at lo.
+ *
+ * Shared by HeapSort() and the depth-limit fallback of HybridSort(), and
+ * built on the sift kernels of DaryHeap (containers::heap_detail). Reports
+ * Compare, Swap and MarkSorted events with array indices; every index of the
+ * range is marked sorted. Elements are ordered by less (operator< by
+ * default).
+ */
+template <typename Array, typename Callback, typename Order = Less>
+void heapSortRange(Array& array, const size_t lo, const size_t hi, Callback&& callback,
+                   Order&& less = Order{}) {
+    const size_t n = hi - lo;
+    if (n == 0)
+        return;
+
+    auto* data = array.begin() + lo;
+    containers::heap_detail::makeHeap<HEAP_SORT_ARITY>(data, n, less, callback, lo);
+
+    // Repeatedly move the maximum to the end of the shrinking heap
+    for (size_t heap_size = n; heap_size > 1; --heap_size) {
+        containers::heap_detail::popHeap<HEAP_SORT_ARITY>(data, heap_size, less, callback, lo);
+        callback(SORT_EVENT_MARK_SORTED, lo + heap_size - 1, 0); // mark sorted
+    }
 
-    for (size_t i = 0; i < n; ++i) callback(2, i, 0);
+    callback(SORT_EVENT_MARK_SORTED, lo, 0);
 }
 
+} // namespace detail
+
 
 /**
  * @brief Sorts the array in ascending (non-decreasing) order using the
@@ -331,87 +614,50 @@ void LinearInsertionSort(DynamicArray<Type>& array,
  *  - code = 1: Swap(a, b)              — swapping indices a and b
  *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void BinaryInsertionSort(DynamicArray<Type>& array,
-                                   Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void BinaryInsertionSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                                   Callback&& callback = NoInstrumentation{}) {
     const size_t n = array.size();
     if (n <= 1 || isSorted(array)) {
-        for (size_t i = 0; i < n; ++i) callback(2, i, 0);
+        for (size_t i = 0; i < n; ++i) callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
-    for (size_t i = 1; i < n; ++i) {
-        size_t left = 0, right = i;
-        while (left < right) {
-            size_t mid = left + (right - left) / 2;
-            callback(0, mid, i);
-            if (array[mid] <= array[i])
-                left = mid + 1;
-            else
-                right = mid;
-        }
-        for (size_t j = i; j > left; --j) {
-            callback(1, j, j - 1);
-            swap(array[j], array[j - 1]);
-        }
-    }
+    detail::binaryInsertionSortRange(array, 0, n, callback);
 
-    for (size_t i = 0; i < n; ++i) callback(2, i, 0);
+    for (size_t i = 0; i < n; ++i) callback(SORT_EVENT_MARK_SORTED, i, 0);
 }
 
 
-/**
- * @brief Sorts the array in ascending (non-decreasing) order using the Quick
- * Sort algorithm.
- *
- * Partitions the array around a pivot and recursively sorts the partitions.
- * Implementation partitions with "<= pivot" on the left side (Lomuto), and is
- * not stable.
- *
- * Note for float/double: Arrays containing NaN are unsupported for ordering;
- * results are unspecified.
- *
- * @par Complexity
- * - O(n log n) average time complexity.
- * - O(n^2) worst-case time complexity (e.g., already-sorted or duplicate-heavy
- * arrays with last-element pivot).
- * - O(log n) space complexity due to recursion stack (tail recursion eliminated
- * on larger side).
- *
- * @param array The array to sort.
- * @param callback Optional callback function to report each operation:
- * The callback receives events as (code, a, b):
- *  - code = 0: Compare(a, b)           — comparing indices a and b
- *  - code = 1: Swap(a, b)              — swapping indices a and b
- *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
- */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void QuickSort(DynamicArray<Type>& array,
-               Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+namespace detail {
+
+/// Quick sort under an arbitrary element ordering; see QuickSort().
+template <typename Array, typename Less, typename Callback>
+void quickSortBy(Array& array, Less&& less, Callback&& callback) {
     const size_t n = array.size();
-    if (n <= 1 || isSorted(array)) {
+    if (n <= 1 || isSortedBy(array, less)) {
         for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
     auto partition = [&](const size_t left, const size_t right) -> size_t {
-        Type pivot = array[right]; // Lomuto: pivot is last element
+        auto pivot = array[right]; // Lomuto: pivot is last element
         size_t i = left;
 
         for (size_t j = left; j < right; ++j) {
-            callback(0, j, right); // compare A[j] with pivot at 'right'
-            if (array[j] <= pivot) {
+            callback(SORT_EVENT_COMPARE, j, right); // compare A[j] with pivot at 'right'
+            if (!less(pivot, array[j])) {
                 if (i != j)
-                    callback(1, i, j); // swap A[i] <-> A[j]
+                    callback(SORT_EVENT_SWAP, i, j); // swap A[i] <-> A[j]
                 swap(array[i++], array[j]);
             }
         }
 
         if (i != right)
-            callback(1, i, right); // place pivot into final position
+            callback(SORT_EVENT_SWAP, i, right); // place pivot into final position
         swap(array[i], array[right]);
-        callback(2, i, 0); // pivot at index i is now in its final place
+        callback(SORT_EVENT_MARK_SORTED, i, 0); // pivot at index i is now in its final place
         return i;
     };
 
@@ -438,127 +684,404 @@ void QuickSort(DynamicArray<Type>& array,
 
         // When left == right, a single element remains unsorted; mark it.
         if (left == right)
-            callback(2, left, 0);
+            callback(SORT_EVENT_MARK_SORTED, left, 0);
     };
 
     quick_sort(quick_sort, 0, n - 1);
 }
 
+} // namespace detail
+
 
 /**
- * @brief Sorts the array in ascending (non-decreasing) order using the Merge
+ * @brief Sorts the array in ascending (non-decreasing) order using the Quick
  * Sort algorithm.
  *
- * This method recursively divides the array into halves, sorts each half,
- * and then merges the sorted halves back together. It uses a temporary
- * buffer for merging. Stable.
+ * Partitions the array around a pivot and recursively sorts the partitions.
+ * Implementation partitions with "<= pivot" on the left side (Lomuto), and is
+ * not stable.
  *
  * Note for float/double: Arrays containing NaN are unsupported for ordering;
  * results are unspecified.
  *
  * @par Complexity
- * - O(n log n) time complexity in all cases (best, average, worst).
- * - O(n) additional space complexity for the temporary buffer.
+ * - O(n log n) average time complexity.
+ * - O(n^2) worst-case time complexity (e.g., already-sorted or duplicate-heavy
+ * arrays with last-element pivot).
+ * - O(log n) space complexity due to recursion stack (tail recursion eliminated
+ * on larger side).
+ *
+ * @param array The array to sort.
+ * @param callback Optional callback function to report each operation:
+ * The callback receives events as (code, a, b):
+ *  - code = 0: Compare(a, b)           — comparing indices a and b
+ *  - code = 1: Swap(a, b)              — swapping indices a and b
+ *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+    requires std::invocable<Callback&, size_t, size_t, size_t>
+void QuickSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+               Callback&& callback = NoInstrumentation{}) {
+    detail::quickSortBy(array, detail::Less{}, callback);
+}
+
+
+/**
+ * @brief QuickSort() ordering the elements by comp(proj(a), proj(b)), in the
+ * style of std::ranges::sort().
  *
  * @param array The array to sort.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing, e.g. a
+ * pointer to a data member.
  */
-template <typename Type>
-void MergeSort(DynamicArray<Type>& array) {
-    const size_t n = array.size();
-    if (n <= 1 || isSorted(array))
-        return;
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+void QuickSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, Compare comp,
+               Projection proj = {}) {
+    detail::quickSortBy(array, detail::ProjectedLess<Compare, Projection>{comp, proj},
+                        NoInstrumentation{});
+}
 
-    // Recursive merge sort on inclusive bounds [left, right]
-    auto merge_sort = [&](auto&& self, size_t left, size_t right) -> void {
-        if (left >= right)
-            return;
 
-        size_t mid = left + (right - left) / 2;
+namespace detail {
 
-        // Sort both halves
-        self(self, left, mid);
-        self(self, mid + 1, right);
+/// Upper bound on the depth of the run stack of timSortRuns(). Run lengths
+/// on the stack grow at least like Fibonacci numbers, so 96 entries cover
+/// any array addressable with a 64-bit size_t.
+inline constexpr size_t MAX_MERGE_RUNS = 96;
+
+
+/// Minimal run length in [32, 64] for which n / minRun is close to, but not
+/// above, a power of two, as chosen by TimSort.
+constexpr size_t minRunLength(size_t n) noexcept {
+    size_t low_bits = 0;
+    while (n >= 64) {
+        low_bits |= n & 1;
+        n >>= 1;
+    }
+    return n + low_bits;
+}
+
+
+/// Length of the run starting at lo; a strictly descending run is reversed
+/// in place so that every returned run is ascending (stable).
+template <typename Array, typename Less>
+size_t takeAscendingRun(Array& array, const size_t lo, const size_t hi, Less& less) {
+    size_t end = lo + 1;
+    if (end == hi)
+        return 1;
+
+    if (less(array[end], array[lo])) {
+        while (end + 1 < hi && less(array[end + 1], array[end]))
+            ++end;
+        for (size_t a = lo, b = end; a < b; ++a, --b)
+            swap(array[a], array[b]);
+    } else {
+        while (end + 1 < hi && !less(array[end + 1], array[end]))
+            ++end;
+    }
+    return end + 1 - lo;
+}
+
+
+/// Extends the sorted run [lo, sorted_end) to [lo, hi) by binary insertion,
+/// shifting elements with moves instead of swaps. Stable.
+template <typename Array, typename Less>
+void extendRun(Array& array, const size_t lo, size_t sorted_end, const size_t hi, Less& less) {
+    for (; sorted_end < hi; ++sorted_end) {
+        size_t left = lo, right = sorted_end;
+        while (left < right) {
+            const size_t mid = left + (right - left) / 2;
+            if (less(array[sorted_end], array[mid]))
+                right = mid;
+            else
+                left = mid + 1;
+        }
+        if (left == sorted_end)
+            continue;
 
-        size_t n1 = mid - left + 1;
-        size_t n2 = right - mid;
+        auto value = std::move(array[sorted_end]);
+        for (size_t j = sorted_end; j > left; --j)
+            array[j] = std::move(array[j - 1]);
+        array[left] = std::move(value);
+    }
+}
 
-        // Create temp arrays
-        DynamicArray<Type> Left(n1), Right(n2);
 
-        // Copy data to temp arrays
-        for (int i = 0; i < n1; i++)
-            Left.addLast(array[left + i]);
-        for (int j = 0; j < n2; j++)
-            Right.addLast(array[mid + 1 + j]);
+/**
+ * @brief Stably merges the adjacent sorted runs [base1, base1 + len1) and
+ * [base1 + len1, base1 + len1 + len2).
+ *
+ * Elements already in their final place at either end are found by binary
+ * search and skipped, so non-overlapping runs merge with O(log n)
+ * comparisons. Only the shorter remaining run is moved into scratch, which
+ * must be empty and is left empty.
+ */
+template <typename Array, typename Scratch, typename Less>
+void mergeAdjacentRuns(Array& array, Scratch& scratch, size_t base1, size_t len1, size_t len2,
+                       Less& less) {
+    const size_t base2 = base1 + len1;
+
+    // Leading elements of run 1 that are <= the first element of run 2.
+    size_t first = base1, count = len1;
+    while (count > 0) {
+        const size_t half = count / 2;
+        if (!less(array[base2], array[first + half])) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+    len1 -= first - base1;
+    base1 = first;
+    if (len1 == 0)
+        return;
+
+    // Trailing elements of run 2 that are >= the last element of run 1.
+    first = base2;
+    count = len2;
+    while (count > 0) {
+        const size_t half = count / 2;
+        if (less(array[first + half], array[base2 - 1])) {
+            first += half + 1;
+            count -= half + 1;
+        } else {
+            count = half;
+        }
+    }
+    len2 = first - base2;
+    if (len2 == 0)
+        return;
 
-        size_t i = 0, j = 0, k = left;
+    if (len1 <= len2) {
+        for (size_t i = 0; i < len1; ++i)
+            scratch.addLast(std::move(array[base1 + i]));
 
-        // Merge the temp arrays back into array[left..right]
-        while (i < n1 && j < n2) {
-            if (Left[i] <= Right[j])
-                array[k++] = Left[i++];
+        size_t i = 0, j = base2, k = base1;
+        const size_t end2 = base2 + len2;
+        while (i < len1 && j < end2) {
+            if (less(array[j], scratch[i]))
+                array[k++] = std::move(array[j++]);
+            else
+                array[k++] = std::move(scratch[i++]);
+        }
+        while (i < len1)
+            array[k++] = std::move(scratch[i++]);
+    } else {
+        for (size_t i = 0; i < len2; ++i)
+            scratch.addLast(std::move(array[base2 + i]));
+
+        size_t i = base2, j = len2, k = base2 + len2;
+        while (i > base1 && j > 0) {
+            if (less(scratch[j - 1], array[i - 1]))
+                array[--k] = std::move(array[--i]);
             else
-                array[k++] = Right[j++];
+                array[--k] = std::move(scratch[--j]);
         }
+        while (j > 0)
+            array[--k] = std::move(scratch[--j]);
+    }
+    scratch.clear();
+}
 
-        // Copy the remaining elements of Left if there are any
-        while (i < n1)
-            array[k++] = Left[i++];
 
-        // Copy the remaining elements of Right if there are any
-        while (j < n2)
-            array[k++] = Right[j++];
+/**
+ * @brief TimSort-style natural merge sort of the whole array.
+ *
+ * Existing ascending and strictly descending runs are detected (the latter
+ * reversed), runs shorter than minRunLength() are extended by binary
+ * insertion (extendRun()), and runs are merged from a stack whose lengths follow the
+ * (corrected) TimSort invariants. Pre-sorted segments therefore cost close
+ * to linear time.
+ *
+ * @param scratch Empty buffer with capacity for at least n / 2 elements.
+ * @param less Strict weak ordering of the elements.
+ */
+template <typename Array, typename Scratch, typename Less>
+void timSortRuns(Array& array, Scratch& scratch, Less less) {
+    const size_t n = array.size();
+    const size_t min_run = minRunLength(n);
+
+    size_t run_base[MAX_MERGE_RUNS];
+    size_t run_len[MAX_MERGE_RUNS];
+    size_t stack_size = 0;
+
+    auto merge_at = [&](const size_t i) {
+        mergeAdjacentRuns(array, scratch, run_base[i], run_len[i], run_len[i + 1], less);
+        run_len[i] += run_len[i + 1];
+        if (i + 3 == stack_size) {
+            run_base[i + 1] = run_base[i + 2];
+            run_len[i + 1] = run_len[i + 2];
+        }
+        --stack_size;
     };
 
-    merge_sort(merge_sort, 0, n - 1);
+    size_t lo = 0;
+    while (lo < n) {
+        size_t len = takeAscendingRun(array, lo, n, less);
+        if (len < min_run) {
+            const size_t forced = min_run < n - lo ? min_run : n - lo;
+            extendRun(array, lo, lo + len, lo + forced, less);
+            len = forced;
+        }
+        run_base[stack_size] = lo;
+        run_len[stack_size] = len;
+        ++stack_size;
+        lo += len;
+
+        while (stack_size > 1) {
+            size_t i = stack_size - 2;
+            if ((i > 0 && run_len[i - 1] <= run_len[i] + run_len[i + 1]) ||
+                (i > 1 && run_len[i - 2] <= run_len[i - 1] + run_len[i])) {
+                if (run_len[i - 1] < run_len[i + 1])
+                    --i;
+            } else if (run_len[i] > run_len[i + 1]) {
+                break;
+            }
+            merge_at(i);
+        }
+    }
+
+    while (stack_size > 1) {
+        size_t i = stack_size - 2;
+        if (i > 0 && run_len[i - 1] < run_len[i + 1])
+            --i;
+        merge_at(i);
+    }
 }
 
+} // namespace detail
+
 
 /**
  * @brief Sorts the array in ascending (non-decreasing) order using a
- * divide-and-conquer merge-sort structure with an in-place merge.
+ * natural (TimSort-style) Merge Sort.
  *
- * The array is recursively split into halves and each half is sorted. The
- * merge step is performed in-place by repeatedly moving the next out-of-order
- * element from the right half leftwards using adjacent swaps (insertion-style
- * merging). This keeps the algorithm stable and uses O(1) auxiliary space
- * (besides the recursion stack), but the merge can be quadratic when many
- * elements must be moved across the boundary.
+ * Already ascending or strictly descending runs in the input are detected
+ * and kept, short runs are extended with binary insertion sort, and runs
+ * are merged pairwise with a stack discipline that keeps merges balanced.
+ * One scratch buffer of n / 2 elements is allocated up front and reused by
+ * every merge; see the overload taking a scratch buffer to avoid even that
+ * allocation across calls. Stable.
  *
  * Note for float/double: Arrays containing NaN are unsupported for ordering;
  * results are unspecified.
  *
  * @par Complexity
- * - Time: Θ(n^2) in the worst case and typically on average for random inputs,
- *   due to potentially quadratic merging; best case can approach O(n log n)
- *   when the two halves are already almost merged.
- * - Space: O(1) auxiliary space for data (plus O(log n) recursion stack).
+ * - O(n log n) time in the worst case, O(n) for input made of a few sorted
+ *   or reversed segments.
+ * - O(n) additional space for the scratch buffer.
  *
  * @param array The array to sort.
- * @param callback Optional callback function to report each operation:
- * The callback receives events as (code, a, b):
- *  - code = 0: Compare(a, b)           — comparing indices a and b
- *  - code = 1: Swap(a, b)              — swapping indices a and b
- *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void MergeSortInPlace(DynamicArray<Type>& array,
-               Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void MergeSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array) {
     const size_t n = array.size();
-    if (n <= 1 || isSorted(array)) {
-        for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+    if (n <= 1 || isSorted(array))
         return;
-    }
 
-    // Recursive merge sort on inclusive bounds [left, right]
-    auto merge_sort = [&](auto&& self, size_t left, size_t right) -> void {
-        if (left >= right)
-            return;
+    DynamicArray<Type, Allocator> scratch(n / 2 + 1, array.getAllocator());
+    detail::timSortRuns(array, scratch, detail::Less{});
+}
 
-        size_t mid = left + (right - left) / 2;
 
-        // Sort both halves
+/**
+ * @brief MergeSort() that borrows its scratch space from the caller.
+ *
+ * The contents of scratch are discarded. Its capacity is grown to n / 2
+ * elements if smaller, so a buffer reused across calls allocates at most
+ * once for arrays of the same size.
+ *
+ * @param array The array to sort.
+ * @param scratch Buffer used to hold runs while they are merged.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename ScratchAllocator>
+void MergeSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+               DynamicArray<Type, ScratchAllocator>& scratch) {
+    const size_t n = array.size();
+    if (n <= 1 || isSorted(array))
+        return;
+
+    scratch.clear();
+    scratch.reserve(n / 2 + 1);
+    detail::timSortRuns(array, scratch, detail::Less{});
+}
+
+
+/**
+ * @brief MergeSort() ordering the elements by comp(proj(a), proj(b)), in the
+ * style of std::ranges::stable_sort(). Stable.
+ *
+ * @param array The array to sort.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing, e.g. a
+ * pointer to a data member.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+void MergeSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, Compare comp,
+               Projection proj = {}) {
+    const detail::ProjectedLess<Compare, Projection> less{comp, proj};
+    const size_t n = array.size();
+    if (n <= 1 || detail::isSortedBy(array, less))
+        return;
+
+    DynamicArray<Type, Allocator> scratch(n / 2 + 1, array.getAllocator());
+    detail::timSortRuns(array, scratch, less);
+}
+
+
+/**
+ * @brief Sorts the array in ascending (non-decreasing) order using a
+ * divide-and-conquer merge-sort structure with an in-place merge.
+ *
+ * The array is recursively split into halves and each half is sorted. The
+ * merge step is performed in-place by repeatedly moving the next out-of-order
+ * element from the right half leftwards using adjacent swaps (insertion-style
+ * merging). This keeps the algorithm stable and uses O(1) auxiliary space
+ * (besides the recursion stack), but the merge can be quadratic when many
+ * elements must be moved across the boundary.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - Time: Θ(n^2) in the worst case and typically on average for random inputs,
+ *   due to potentially quadratic merging; best case can approach O(n log n)
+ *   when the two halves are already almost merged.
+ * - Space: O(1) auxiliary space for data (plus O(log n) recursion stack).
+ *
+ * @param array The array to sort.
+ * @param callback Optional callback function to report each operation:
+ * The callback receives events as (code, a, b):
+ *  - code = 0: Compare(a, b)           — comparing indices a and b
+ *  - code = 1: Swap(a, b)              — swapping indices a and b
+ *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void MergeSortInPlace(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+               Callback&& callback = NoInstrumentation{}) {
+    const size_t n = array.size();
+    if (n <= 1 || isSorted(array)) {
+        for (size_t i = 0; i < n; ++i)
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
+        return;
+    }
+
+    // Recursive merge sort on inclusive bounds [left, right]
+    auto merge_sort = [&](auto&& self, size_t left, size_t right) -> void {
+        if (left >= right)
+            return;
+
+        size_t mid = left + (right - left) / 2;
+
+        // Sort both halves
         self(self, left, mid);
         self(self, mid + 1, right);
 
@@ -567,14 +1090,14 @@ void MergeSortInPlace(DynamicArray<Type>& array,
         size_t j = mid + 1;
 
         while (i <= mid && j <= right) {
-            callback(0, i, j); // compare
+            callback(SORT_EVENT_COMPARE, i, j); // compare
             if (array[i] <= array[j]) {
                 ++i;
             } else {
                 // Move array[j] into position i by swapping it leftwards
                 size_t index = j;
                 while (index > i) {
-                    callback(1, index, index - 1); // swap
+                    callback(SORT_EVENT_SWAP, index, index - 1); // swap
                     swap(array[index], array[index - 1]);
                     --index;
                 }
@@ -589,7 +1112,7 @@ void MergeSortInPlace(DynamicArray<Type>& array,
 
     if (isSorted(array))
         for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
 }
 
 
@@ -613,66 +1136,658 @@ void MergeSortInPlace(DynamicArray<Type>& array,
  *  - code = 1: Swap(a, b)              — swapping indices a and b
  *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
  */
-template <typename Type, typename Callback = void (*)(size_t, size_t, size_t)>
-void HeapSort(DynamicArray<Type>& array,
-               Callback&& callback = [](size_t, size_t, size_t) -> void {}) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+    requires std::invocable<Callback&, size_t, size_t, size_t>
+void HeapSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+               Callback&& callback = NoInstrumentation{}) {
     const size_t n = array.size();
     if (n <= 1 || isSorted(array)) {
         for (size_t i = 0; i < n; ++i)
-            callback(2, i, 0);
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
         return;
     }
 
-    auto sift_down = [&](const size_t start, const size_t size) -> void {
-        size_t i = start;
-        while (true) {
-            const size_t left = 2 * i + 1;
-            if (left >= size)
-                break;
+    detail::heapSortRange(array, 0, n, callback);
+}
+
+
+/**
+ * @brief HeapSort() ordering the elements by comp(proj(a), proj(b)), in the
+ * style of std::ranges::sort().
+ *
+ * @param array The array to sort.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing, e.g. a
+ * pointer to a data member.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+void HeapSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, Compare comp,
+              Projection proj = {}) {
+    const detail::ProjectedLess<Compare, Projection> less{comp, proj};
+    if (array.size() <= 1 || detail::isSortedBy(array, less))
+        return;
+
+    detail::heapSortRange(array, 0, array.size(), NoInstrumentation{}, less);
+}
+
+
+namespace detail {
+
+/// Ranges of at most this many elements are finished by insertion sort.
+inline constexpr size_t HYBRID_INSERTION_THRESHOLD = 24;
+
+/// Ranges larger than this choose their pivot with Tukey's ninther.
+inline constexpr size_t HYBRID_NINTHER_THRESHOLD = 128;
+
+
+/// Index of the median of array[a], array[b], array[c].
+template <typename Array, typename Callback, typename Order = Less>
+size_t medianOfThree(const Array& array, size_t a, size_t b, size_t c, Callback&& callback,
+                     Order&& less = Order{}) {
+    callback(SORT_EVENT_COMPARE, a, b);
+    if (less(array[b], array[a]))
+        std::swap(a, b);
+    callback(SORT_EVENT_COMPARE, b, c);
+    if (less(array[c], array[b])) {
+        callback(SORT_EVENT_COMPARE, a, c);
+        return less(array[c], array[a]) ? a : c;
+    }
+    return b;
+}
+
+
+/// Pivot index for [lo, hi): median of three, or the ninther for large ranges.
+template <typename Array, typename Callback, typename Order = Less>
+size_t choosePivot(const Array& array, const size_t lo, const size_t hi, Callback&& callback,
+                   Order&& less = Order{}) {
+    const size_t size = hi - lo;
+    const size_t mid = lo + size / 2;
+    if (size <= HYBRID_NINTHER_THRESHOLD)
+        return medianOfThree(array, lo, mid, hi - 1, callback, less);
+
+    const size_t step = size / 8;
+    const size_t a = medianOfThree(array, lo, lo + step, lo + 2 * step, callback, less);
+    const size_t b = medianOfThree(array, mid - step, mid, mid + step, callback, less);
+    const size_t c = medianOfThree(array, hi - 1 - 2 * step, hi - 1 - step, hi - 1, callback, less);
+    return medianOfThree(array, a, b, c, callback, less);
+}
+
+
+/**
+ * @brief Three-way partition of [lo, hi) around the pivot at array[lo].
+ *
+ * Shared by HybridSort() and NthElement(). Reports Compare and Swap events
+ * with array indices.
+ *
+ * @return {lt, gt} such that [lo, lt) < pivot, [lt, gt) == pivot and
+ * [gt, hi) > pivot; lt < gt.
+ */
+template <typename Array, typename Callback, typename Order = Less>
+std::pair<size_t, size_t> threeWayPartition(Array& array, const size_t lo, const size_t hi,
+                                            Callback&& callback, Order&& less = Order{}) {
+    // array[lt] always holds a pivot copy.
+    const auto pivot_value = array[lo];
+    size_t lt = lo, i = lo + 1, gt = hi;
+    while (i < gt) {
+        callback(SORT_EVENT_COMPARE, i, lt);
+        if (less(array[i], pivot_value)) {
+            callback(SORT_EVENT_SWAP, lt, i);
+            swap(array[lt++], array[i++]);
+        } else if (less(pivot_value, array[i])) {
+            --gt;
+            if (i != gt)
+                callback(SORT_EVENT_SWAP, i, gt);
+            swap(array[i], array[gt]);
+        } else {
+            ++i;
+        }
+    }
+    return {lt, gt};
+}
+
+
+/**
+ * @brief Branchless Lomuto partition of [0, size) around data[0].
+ *
+ * The element order is rearranged without data-dependent branches: every
+ * step writes both candidate slots and advances the boundary by the result
+ * of the comparison. With PutEqualLeft the left side takes the elements
+ * <= pivot, otherwise only those < pivot.
+ *
+ * Each step is reported to callback, with indices offset by base, as a
+ * comparison with the pivot and, unless the slots coincide, the swap of
+ * slots i and boundary that the two writes perform. NoInstrumentation
+ * compiles the reports away and leaves the loop branchless.
+ *
+ * @return Final index of the pivot p: [0, p) holds the left side and
+ * (p, size) the rest.
+ */
+template <bool PutEqualLeft, typename Type, typename Callback>
+size_t branchlessPartition(Type* data, const size_t size, Callback& callback, const size_t base) {
+    const Type pivot = data[0];
+    size_t boundary = 1;
+    for (size_t i = 1; i < size; ++i) {
+        const Type value = data[i];
+        callback(SORT_EVENT_COMPARE, base, base + i);
+        const bool left = PutEqualLeft ? !(pivot < value) : value < pivot;
+        if (i != boundary)
+            callback(SORT_EVENT_SWAP, base + boundary, base + i);
+        data[i] = data[boundary];
+        data[boundary] = value;
+        boundary += left;
+    }
+    if (boundary > 1)
+        callback(SORT_EVENT_SWAP, base, base + boundary - 1);
+    swap(data[0], data[boundary - 1]);
+    return boundary - 1;
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Sorts the array in ascending order with an introsort/pdqsort style
+ * hybrid of quick sort, insertion sort and heap sort.
+ *
+ * Each range picks its pivot as the median of three elements, or with
+ * Tukey's ninther (median of three medians) above 128 elements, which
+ * neutralizes sorted, reversed and sorted-with-noise inputs. Ranges of at
+ * most 24 elements are finished by binary insertion sort. When the
+ * partitioning depth exceeds 2·log2(n), the range falls back to heap sort,
+ * so the worst case stays O(n log n).
+ *
+ * Duplicates are handled in one of two ways:
+ * - With an arithmetic Type, ranges are split by a branchless partition. A
+ *   range whose pivot equals the element just before it holds a run of that
+ *   key; it is partitioned into "equal" and "greater" and the equal part is
+ *   skipped, as in pdqsort.
+ * - Otherwise a three-way partition puts every key equal to the pivot into
+ *   its final place at once.
+ * Either way, inputs with few distinct keys take O(n log k) time. The
+ * choice depends on Type only, so an instrumented run reports the events of
+ * the same kernel an uninstrumented one executes.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n log n) time in the worst case, O(n) for already sorted input.
+ * - O(log n) stack space; not stable.
+ *
+ * @param array The array to sort.
+ * @param callback Optional callback function to report each operation:
+ * The callback receives events as (code, a, b):
+ *  - code = 0: Compare(a, b)           — comparing indices a and b
+ *  - code = 1: Swap(a, b)              — swapping indices a and b
+ *  - code = 2: MarkSorted(a, ignored)  — index a is now in final sorted place
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+void HybridSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                Callback&& callback = NoInstrumentation{}) {
+    const size_t n = array.size();
+    if (n <= 1 || isSorted(array)) {
+        for (size_t i = 0; i < n; ++i)
+            callback(SORT_EVENT_MARK_SORTED, i, 0);
+        return;
+    }
 
-            size_t largest = left;
-            const size_t right = left + 1;
+    constexpr bool branchless = std::is_arithmetic_v<Type>;
 
-            if (right < size) {
-                callback(0, right, left); // compare children
-                if (array[right] > array[left])
-                    largest = right;
+    // Iterates on the larger side and recurses into the smaller one.
+    auto hybrid_sort = [&](auto&& self, size_t lo, size_t hi, size_t depth_budget) -> void {
+        while (hi - lo > detail::HYBRID_INSERTION_THRESHOLD) {
+            if (depth_budget == 0) {
+                detail::heapSortRange(array, lo, hi, callback);
+                return;
             }
+            --depth_budget;
 
-            callback(0, i, largest); // compare parent with largest child
+            const size_t pivot = detail::choosePivot(array, lo, hi, callback);
+            if (pivot != lo) {
+                callback(SORT_EVENT_SWAP, lo, pivot);
+                swap(array[lo], array[pivot]);
+            }
 
-            if (array[i] >= array[largest])
-                break;
+            size_t left_end;   // [lo, left_end) remains to be sorted
+            size_t right_begin; // [right_begin, hi) remains to be sorted
+
+            if constexpr (branchless) {
+                Type* data = array.begin() + lo;
+                if (lo > 0) {
+                    callback(SORT_EVENT_COMPARE, lo - 1, lo);
+                    if (!(array[lo - 1] < array[lo])) {
+                        // Pivot equals its predecessor: skip the run of equal keys.
+                        const size_t run_end =
+                            lo + detail::branchlessPartition<true>(data, hi - lo, callback, lo) + 1;
+                        for (; lo < run_end; ++lo)
+                            callback(SORT_EVENT_MARK_SORTED, lo, 0);
+                        continue;
+                    }
+                }
+                const size_t p = lo + detail::branchlessPartition<false>(data, hi - lo, callback, lo);
+                callback(SORT_EVENT_MARK_SORTED, p, 0);
+                left_end = p;
+                right_begin = p + 1;
+            } else {
+                const auto [lt, gt] = detail::threeWayPartition(array, lo, hi, callback);
+                for (size_t k = lt; k < gt; ++k)
+                    callback(SORT_EVENT_MARK_SORTED, k, 0);
+                left_end = lt;
+                right_begin = gt;
+            }
 
-            if (i != largest)
-                callback(1, i, largest); // swap parent with largest child
-            swap(array[i], array[largest]);
-            i = largest;
+            if (left_end - lo < hi - right_begin) {
+                self(self, lo, left_end, depth_budget);
+                lo = right_begin;
+            } else {
+                self(self, right_begin, hi, depth_budget);
+                hi = left_end;
+            }
         }
+
+        detail::binaryInsertionSortRange(array, lo, hi, callback);
+        for (size_t k = lo; k < hi; ++k)
+            callback(SORT_EVENT_MARK_SORTED, k, 0);
     };
 
-    // Make heap
-    for (size_t i = (n - 2) / 2 + 1; i-- > 0;)
-        sift_down(i, n);
+    hybrid_sort(hybrid_sort, 0, n, 2 * static_cast<size_t>(std::bit_width(n)));
+}
+
 
+//*** Selection ***//
 
-    auto pop_heap = [&](const size_t size) -> void {
-        if (size <= 1)
+
+namespace detail {
+
+/// Elements per group of the median-of-medians pivot.
+inline constexpr size_t SELECT_GROUP_SIZE = 5;
+
+
+template <typename Array, typename Callback, typename Order>
+void selectRange(Array& array, size_t lo, size_t hi, size_t k, Callback& callback, Order& less);
+
+
+/**
+ * @brief Median-of-medians pivot for [lo, hi).
+ *
+ * Sorts each group of five elements, gathers the group medians at the front
+ * of the range and selects their median, which has at least 30% of the
+ * range on either side. Returns its index.
+ */
+template <typename Array, typename Callback, typename Order>
+size_t medianOfMedians(Array& array, const size_t lo, const size_t hi, Callback& callback,
+                       Order& less) {
+    size_t medians_end = lo;
+    for (size_t group = lo; group < hi; group += SELECT_GROUP_SIZE) {
+        const size_t group_end = group + SELECT_GROUP_SIZE < hi ? group + SELECT_GROUP_SIZE : hi;
+        binaryInsertionSortRange(array, group, group_end, callback, less);
+
+        const size_t median = group + (group_end - group) / 2;
+        if (median != medians_end)
+            callback(SORT_EVENT_SWAP, medians_end, median);
+        swap(array[medians_end++], array[median]);
+    }
+
+    const size_t middle = lo + (medians_end - lo) / 2;
+    selectRange(array, lo, medians_end, middle, callback, less);
+    return middle;
+}
+
+
+/**
+ * @brief Introselect of position k within [lo, hi).
+ *
+ * Narrows the range with the pivots and partitions of HybridSort() until k
+ * falls among the keys equal to the pivot: the branchless partition for
+ * arithmetic types under operator<, the three-way partition otherwise, with
+ * or without instrumentation. After 2·log2(n) rounds that fail to halve the
+ * range, pivots switch to the median of medians, which bounds the worst case
+ * to O(n). Small ranges are finished by binary insertion sort.
+ */
+template <typename Array, typename Callback, typename Order>
+void selectRange(Array& array, size_t lo, size_t hi, const size_t k, Callback& callback, Order& less) {
+    using Type = std::remove_cvref_t<decltype(array[0])>;
+    constexpr bool branchless = std::is_arithmetic_v<Type> && std::is_same_v<Order, Less>;
+
+    size_t budget = 2 * static_cast<size_t>(std::bit_width(hi - lo));
+    while (hi - lo > HYBRID_INSERTION_THRESHOLD) {
+        const size_t size = hi - lo;
+        size_t pivot;
+        if (budget > 0) {
+            --budget;
+            pivot = choosePivot(array, lo, hi, callback, less);
+        } else {
+            pivot = medianOfMedians(array, lo, hi, callback, less);
+        }
+        if (pivot != lo) {
+            callback(SORT_EVENT_SWAP, lo, pivot);
+            swap(array[lo], array[pivot]);
+        }
+
+        size_t lt, gt; // [lt, gt) holds keys equal to the pivot, including it
+        if constexpr (branchless) {
+            auto* data = array.begin() + lo;
+            bool equal_to_predecessor = false;
+            if (lo > 0) {
+                callback(SORT_EVENT_COMPARE, lo - 1, lo);
+                equal_to_predecessor = !less(array[lo - 1], array[lo]);
+            }
+            if (equal_to_predecessor) {
+                // Pivot equals its predecessor, a lower bound of the range:
+                // split off the run of equal keys.
+                lt = lo;
+                gt = lo + branchlessPartition<true>(data, hi - lo, callback, lo) + 1;
+            } else {
+                lt = lo + branchlessPartition<false>(data, hi - lo, callback, lo);
+                gt = lt + 1;
+            }
+        } else {
+            std::tie(lt, gt) = threeWayPartition(array, lo, hi, callback, less);
+        }
+
+        if (k < lt)
+            hi = lt;
+        else if (k >= gt)
+            lo = gt;
+        else
             return;
-        callback(1, 0, size - 1); // swap root with last
-        swap(array[0], array[size - 1]);
-        callback(2, size - 1, 0); // mark sorted
-        sift_down(0, size - 1);
-    };
 
-    // Repeatedly extract max to the end
-    for (size_t heap_size = n; heap_size > 1; --heap_size)
-        pop_heap(heap_size);
+        // A round that keeps more than half of the range counts against the
+        // budget twice, so bad pivots reach median of medians quickly.
+        if (budget > 0 && hi - lo > size / 2)
+            --budget;
+    }
+
+    binaryInsertionSortRange(array, lo, hi, callback, less);
+}
+
+
+/// NthElement() under an arbitrary element ordering.
+template <typename Array, typename Order, typename Callback>
+void nthElementBy(Array& array, const size_t k, Order less, Callback&& callback) {
+    if (k >= array.size())
+        throw std::out_of_range("Index out of range");
+
+    selectRange(array, 0, array.size(), k, callback, less);
+    callback(SORT_EVENT_MARK_SORTED, k, 0);
+}
+
 
-    callback(2, 0, 0);
+/// PartialSort() under an arbitrary element ordering.
+template <typename Array, typename Order, typename Callback>
+void partialSortBy(Array& array, const size_t k, Order less, Callback&& callback) {
+    const size_t n = array.size();
+    if (k > n)
+        throw std::out_of_range("Index out of range");
+    if (k == 0)
+        return;
+
+    if (k < n)
+        selectRange(array, 0, n, k - 1, callback, less);
+    heapSortRange(array, 0, k, callback, less);
 }
 
 
+/// Ordering with the arguments of Compare swapped.
+template <typename Compare>
+struct Reversed {
+    [[no_unique_address]] Compare comp;
+
+    template <typename A, typename B>
+    constexpr bool operator()(const A& a, const B& b) const {
+        return comp(b, a);
+    }
+};
+
+} // namespace detail
+
+
+/**
+ * @brief Rearranges the array so that array[k] holds the element that would
+ * be there if the array were sorted (introselect).
+ *
+ * Afterwards no element of array[0 .. k) is greater than array[k] and no
+ * element of array[k + 1 .. n) is less. Medians and percentiles therefore
+ * cost one call instead of a full sort:
+ *
+ * @code
+ * NthElement(latencies, latencies.size() * 99 / 100);
+ * const double p99 = latencies[latencies.size() * 99 / 100];
+ * @endcode
+ *
+ * Pivots are chosen and ranges partitioned as in HybridSort(); only the
+ * side holding k is kept, and keys equal to the pivot are never revisited.
+ * If the pivots keep failing to shrink the range, the median of medians
+ * takes over, so the worst case stays linear.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n) time on average and in the worst case.
+ * - O(log n) stack space; not stable.
+ *
+ * @param array The array to rearrange.
+ * @param k Position to select, 0-based.
+ * @param callback Optional callback function to report each operation:
+ * The callback receives events as (code, a, b):
+ *  - code = 0: Compare(a, b)           — comparing indices a and b
+ *  - code = 1: Swap(a, b)              — swapping indices a and b
+ *  - code = 2: MarkSorted(a, ignored)  — reported once, for index k
+ *
+ * @throws std::out_of_range If k >= array.size().
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+    requires std::invocable<Callback&, size_t, size_t, size_t>
+void NthElement(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const size_t k,
+                Callback&& callback = NoInstrumentation{}) {
+    detail::nthElementBy(array, k, detail::Less{}, callback);
+}
+
+
+/**
+ * @brief NthElement() ordering the elements by comp(proj(a), proj(b)), in
+ * the style of std::ranges::nth_element().
+ *
+ * @param array The array to rearrange.
+ * @param k Position to select, 0-based.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing.
+ *
+ * @throws std::out_of_range If k >= array.size().
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+void NthElement(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const size_t k,
+                Compare comp, Projection proj = {}) {
+    detail::nthElementBy(array, k, detail::ProjectedLess<Compare, Projection>{comp, proj},
+                         NoInstrumentation{});
+}
+
+
+/**
+ * @brief Sorts the k smallest elements into array[0 .. k); the order of the
+ * rest is unspecified.
+ *
+ * Selects position k - 1 with NthElement()'s introselect, then heap sorts
+ * the first k elements, which is O(n + k log k) instead of the O(n log n)
+ * of a full sort.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Complexity
+ * - O(n + k log k) time.
+ * - O(log n) stack space; not stable.
+ *
+ * @param array The array to rearrange.
+ * @param k Number of smallest elements to sort; 0 leaves the array as is.
+ * @param callback Optional callback function to report each operation:
+ * The callback receives events as (code, a, b):
+ *  - code = 0: Compare(a, b)           — comparing indices a and b
+ *  - code = 1: Swap(a, b)              — swapping indices a and b
+ *  - code = 2: MarkSorted(a, ignored)  — index a < k is in its final place
+ *
+ * @throws std::out_of_range If k > array.size().
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Callback = NoInstrumentation>
+    requires std::invocable<Callback&, size_t, size_t, size_t>
+void PartialSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const size_t k,
+                 Callback&& callback = NoInstrumentation{}) {
+    detail::partialSortBy(array, k, detail::Less{}, callback);
+}
+
+
+/**
+ * @brief PartialSort() ordering the elements by comp(proj(a), proj(b)), in
+ * the style of std::ranges::partial_sort(). With std::ranges::greater it
+ * sorts the k largest elements, best first.
+ *
+ * @param array The array to rearrange.
+ * @param k Number of leading elements to sort.
+ * @param comp Strict weak ordering on projected values. Pass {} for
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing.
+ *
+ * @throws std::out_of_range If k > array.size().
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy,
+          typename Compare = std::ranges::less, typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+void PartialSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const size_t k,
+                 Compare comp, Projection proj = {}) {
+    detail::partialSortBy(array, k, detail::ProjectedLess<Compare, Projection>{comp, proj},
+                          NoInstrumentation{});
+}
+
+
+/**
+ * @class TopK
+ *
+ * @brief Streaming accumulator of the k greatest elements seen.
+ *
+ * Elements are pushed one at a time and never stored beyond the k best, so
+ * a leaderboard over an unbounded stream needs O(k) memory. The kept
+ * elements live in a DaryHeap whose top is the smallest of them: an element
+ * that does not beat it is rejected after one comparison, and one that does
+ * replaces it with a single sift.
+ *
+ * @code
+ * TopK<Score, ByPoints> best(100);
+ * for (const Score& s : stream)
+ *     best.push(s);
+ * DynamicArray<Score> leaderboard = best.extractSorted(); // best first
+ * @endcode
+ *
+ * @tparam Type Element type.
+ * @tparam Compare Strict weak ordering; the k greatest under it are kept.
+ * std::greater<Type> keeps the k smallest instead.
+ *
+ * @par Complexity
+ * - push(): O(1) for a rejected element, O(log k) otherwise.
+ * - O(k) space.
+ */
+template <typename Type, typename Compare = std::less<Type>>
+class TopK {
+    containers::DaryHeap<Type, 4, detail::Reversed<Compare>> heap_;
+    size_t k_;
+    [[no_unique_address]] Compare comp_;
+
+  public:
+    /**
+     * @brief Creates an empty accumulator keeping at most k elements.
+     *
+     * @param k Number of elements to keep.
+     * @param comp Ordering of the elements.
+     */
+    explicit TopK(const size_t k, const Compare& comp = Compare())
+        : heap_(detail::Reversed<Compare>{comp}), k_(k), comp_(comp) {
+        heap_.reserve(k);
+    }
+
+    /**
+     * @brief Offers an element.
+     *
+     * @return true if the element is now among the kept ones.
+     */
+    template <typename U>
+    bool push(U&& element) {
+        if (heap_.size() < k_) {
+            heap_.insert(std::forward<U>(element));
+            return true;
+        }
+        if (k_ == 0 || !comp_(heap_.peekRoot(), element))
+            return false;
+
+        heap_.replaceTop(std::forward<U>(element));
+        return true;
+    }
+
+    /// Offers every element of the array.
+    template <typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+    void pushAll(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array) {
+        for (const Type& element : array)
+            push(element);
+    }
+
+    /**
+     * @brief Smallest of the kept elements: the bar a new element has to
+     * beat once k elements are kept.
+     *
+     * @throws std::out_of_range If nothing was kept.
+     */
+    [[nodiscard]]
+    const Type& threshold() const {
+        return heap_.peekRoot();
+    }
+
+    /// Number of elements kept, at most k.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return heap_.size();
+    }
+
+    /// Checks if nothing was kept.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return heap_.isEmpty();
+    }
+
+    /// Maximum number of elements kept.
+    [[nodiscard]]
+    size_t k() const noexcept {
+        return k_;
+    }
+
+    /// Removes every kept element.
+    void clear() noexcept {
+        heap_.clear();
+    }
+
+    /**
+     * @brief Removes the kept elements and returns them greatest first.
+     *
+     * @par Complexity
+     * - O(k log k) time.
+     */
+    DynamicArray<Type> extractSorted() {
+        const size_t n = heap_.size();
+        DynamicArray<Type> out(n);
+        for (size_t i = 0; i < n; ++i)
+            out.addLast(heap_.extractRoot());
+
+        for (size_t i = 0, j = n; i + 1 < j; ++i, --j)
+            swap(out[i], out[j - 1]);
+        return out;
+    }
+};
+
+
 /**
  * @brief Bin Sort for a known 0-based universe.
  *
@@ -691,68 +1806,29 @@ void HeapSort(DynamicArray<Type>& array,
  *
  * @throws std::out_of_range if a value is outside [0, universe_size).
  */
-template <typename Type>
-void BinSort(DynamicArray<Type>& array, const size_t universe_size) {
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void BinSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const size_t universe_size) {
     static_assert(std::numeric_limits<Type>::is_integer,
                   "BinSort(universe) requires an integral Type.");
 
     if (array.size() <= 1 || universe_size == 0)
         return;
 
-    struct Node {
-        Type value;
-        Node* next;
-    };
-
-    DynamicArray<Node*> heads(universe_size);
-    DynamicArray<Node*> tails(universe_size);
-
-    for (size_t b = 0; b < universe_size; ++b) {
-        heads.addLast(nullptr);
-        tails.addLast(nullptr);
-    }
+    // Lists release their nodes on destruction, also when a value throws
+    detail::BinLists<Type, Allocator> bins(universe_size, array.getAllocator());
 
     // Phase 1: distribute elements into bins
-    try {
-        for (size_t i = 0; i < array.size(); ++i) {
-            const Type v = array[i];
-            const auto bin = static_cast<size_t>(v);
-            if (bin >= universe_size)
-                throw std::out_of_range(
-                    "BinSort: value out of [0, m) universe");
-
-            Node* node = new Node{v, nullptr};
-            if (!heads[bin]) {
-                heads[bin] = tails[bin] = node;
-            } else {
-                tails[bin]->next = node;
-                tails[bin] = node;
-            }
-        }
-    } catch (...) {
-        // Cleanup lists before rethrow
-        for (size_t b = 0; b < universe_size; ++b) {
-            Node* cur = heads[b];
-            while (cur) {
-                Node* nxt = cur->next;
-                delete cur;
-                cur = nxt;
-            }
-        }
-        throw;
+    for (size_t i = 0; i < array.size(); ++i) {
+        const Type v = array[i];
+        const auto bin = static_cast<size_t>(v);
+        if (bin >= universe_size)
+            throw std::out_of_range(
+                "BinSort: value out of [0, m) universe");
+        bins.append(bin, v);
     }
 
     // Phase 2: collect back to A in increasing bin index
-    size_t write = 0;
-    for (size_t b = 0; b < universe_size; ++b) {
-        Node* cur = heads[b];
-        while (cur) {
-            array[write++] = cur->value;
-            Node* nxt = cur->next;
-            delete cur;
-            cur = nxt;
-        }
-    }
+    bins.drainInto(array);
 }
 
 
@@ -773,8 +1849,8 @@ void BinSort(DynamicArray<Type>& array, const size_t universe_size) {
  * @throws std::out_of_range if an element of the array is outside [min_value,
  * max_value].
  */
-template <typename Type>
-void BinSort(DynamicArray<Type>& array, const Type min_value,
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void BinSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, const Type min_value,
              const Type max_value) {
     static_assert(std::numeric_limits<Type>::is_integer,
                   "BinSort(range) requires an integral Type.");
@@ -796,214 +1872,232 @@ void BinSort(DynamicArray<Type>& array, const Type min_value,
 
     const size_t m = static_cast<size_t>(span) + 1;
 
-    struct Node {
-        Type value;
-        Node* next;
-    };
-
-    DynamicArray<Node*> heads(m);
-    DynamicArray<Node*> tails(m);
-
-    for (size_t b = 0; b < m; ++b) {
-        heads.addLast(nullptr);
-        tails.addLast(nullptr);
-    }
+    detail::BinLists<Type, Allocator> bins(m, array.getAllocator());
 
     // Phase 1: distribute elements into bins
-    try {
-        for (size_t i = 0; i < array.size(); ++i) {
-            const Type v = array[i];
-            if (v < min_value || v > max_value)
-                throw std::out_of_range(
-                    "BinSort: value out of [min,max] universe");
-
-            // Compute bin index in unsigned domain without narrowing
-            const auto bin = static_cast<size_t>(static_cast<U>(v) - umin);
-
-            Node* node = new Node{v, nullptr};
-            if (!heads[bin]) {
-                heads[bin] = tails[bin] = node;
-            } else {
-                tails[bin]->next = node;
-                tails[bin] = node;
-            }
-        }
-    } catch (...) {
-        for (size_t b = 0; b < m; ++b) {
-            Node* cur = heads[b];
-            while (cur) {
-                Node* nxt = cur->next;
-                delete cur;
-                cur = nxt;
-            }
-        }
-        throw;
+    for (size_t i = 0; i < array.size(); ++i) {
+        const Type v = array[i];
+        if (v < min_value || v > max_value)
+            throw std::out_of_range(
+                "BinSort: value out of [min,max] universe");
+
+        // Compute bin index in unsigned domain without narrowing
+        const auto bin = static_cast<size_t>(static_cast<U>(v) - umin);
+        bins.append(bin, v);
     }
 
     // Phase 2: collect back to A in increasing bin index
-    size_t write = 0;
-    for (size_t b = 0; b < m; ++b) {
-        Node* cur = heads[b];
-        while (cur) {
-            array[write++] = cur->value;
-            Node* nxt = cur->next;
-            delete cur;
-            cur = nxt;
-        }
+    bins.drainInto(array);
+}
+
+
+namespace detail {
+
+/// Types that RadixSortLSD() and RadixSortMSD() sort by their bit pattern.
+template <typename Type>
+concept RadixSortable =
+    (std::integral<Type> && !std::same_as<Type, bool>) ||
+    (std::floating_point<Type> && std::numeric_limits<Type>::is_iec559 &&
+     (sizeof(Type) == 4 || sizeof(Type) == 8));
+
+
+/**
+ * @brief Maps a value to an unsigned integer of the same width whose
+ * unsigned order matches the value order.
+ *
+ * Signed integers get their sign bit flipped. For IEEE floating-point values,
+ * negative numbers have all bits inverted and non-negative numbers get the
+ * sign bit set, so -inf < ... < -0.0 < +0.0 < ... < +inf. NaN values have no
+ * meaningful place in the order.
+ */
+template <RadixSortable Type>
+constexpr auto radixKey(const Type value) noexcept {
+    if constexpr (std::floating_point<Type>) {
+        using U = std::conditional_t<sizeof(Type) == 4, std::uint32_t, std::uint64_t>;
+        constexpr U SIGN = U{1} << (sizeof(U) * 8 - 1);
+        const U bits = std::bit_cast<U>(value);
+        return static_cast<U>((bits & SIGN) ? ~bits : (bits | SIGN));
+    } else {
+        using U = std::make_unsigned_t<Type>;
+        if constexpr (std::is_signed_v<Type>)
+            return static_cast<U>(static_cast<U>(value) ^ (U{1} << (sizeof(U) * 8 - 1)));
+        else
+            return static_cast<U>(value);
     }
 }
 
+} // namespace detail
+
 
 /**
  * @brief Sorts the array in ascending order using LSD Radix Sort (base 256).
  *
- * Stable O(k·n) for integral types, where k = sizeof(Type) bytes.
- * Handles signed types by flipping the sign bit on the most significant byte
- * pass so that negatives come before non-negatives.
+ * Stable O(k·n) for integral and IEEE floating-point types, where k =
+ * sizeof(Type) bytes. Values are sorted by an order-preserving unsigned
+ * image of their bits (see detail::radixKey()): signed integers get their
+ * sign bit flipped, and floats are mapped so that negatives come before
+ * non-negatives. Passes over a byte that is identical in every key are
+ * skipped.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
  *
  * @par Constraints
- * - Type must be an integral type.
+ * - Type must be an integral type, float or double.
  * - Uses O(n) temporary buffer.
  *
  * @param array The array to sort.
  */
-template <typename Type>
-void RadixSortLSD(DynamicArray<Type>& array) {
-    static_assert(std::numeric_limits<Type>::is_integer,
-                  "RadixSortLSD requires an integral Type.");
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void RadixSortLSD(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array) {
+    static_assert(detail::RadixSortable<Type>,
+                  "RadixSortLSD requires an integral or IEEE floating-point Type.");
 
-    const size_t n = array.size();
-    if (n <= 1 || isSorted(array))
+    if (array.size() <= 1 || isSorted(array))
         return;
 
-    using U = std::make_unsigned_t<Type>;
+    RadixSortLSD(array, [](const Type value) { return detail::radixKey(value); });
+}
+
+
+/**
+ * @brief Sorts the array by an unsigned key using LSD Radix Sort (base 256).
+ *
+ * key maps every element to an unsigned integer, and elements are ordered by
+ * ascending key. The key is recomputed on each pass instead of being stored,
+ * so sorting records needs no separate key array. Non-integral or composite
+ * keys are supported by mapping them to an order-preserving unsigned value,
+ * e.g. packing two 32-bit fields into one std::uint64_t. Stable.
+ *
+ * The histograms of all bytes are gathered in a single read pass up front.
+ * A byte whose histogram has a single non-zero bucket is equal in every key,
+ * so its distribution pass is skipped; keys that only use their low bytes
+ * therefore cost one pass per significant byte.
+ *
+ * @par Complexity
+ * - O(k·n) time, where k = sizeof(key(element)) bytes.
+ * - O(n) temporary buffer.
+ *
+ * @param array The array to sort.
+ * @param key Callable returning an unsigned integer for each element.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename KeyFunction>
+    requires std::unsigned_integral<
+        std::remove_cvref_t<std::invoke_result_t<KeyFunction&, const Type&>>>
+void RadixSortLSD(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, KeyFunction key) {
+    using Key = std::remove_cvref_t<std::invoke_result_t<KeyFunction&, const Type&>>;
+
+    const size_t n = array.size();
+    if (n <= 1)
+        return;
 
     constexpr size_t RADIX = 256;
     constexpr size_t BYTE_MASK = 0xFFu;
-    const size_t bytes = sizeof(Type);
+    constexpr size_t BYTES = sizeof(Key);
 
-    // Temporary buffer for stable distribution
-    DynamicArray<Type> temp(n);
+    DynamicArray<Type, Allocator> temp(n, array.getAllocator());
     for (size_t i = 0; i < n; ++i)
-        temp.addLast(Type());
+        temp.addLast(array[i]);
+
+    // Digit counts per byte do not depend on the element order, so all of
+    // them are computed in one pass.
+    size_t count[BYTES][RADIX] = {};
+    for (size_t i = 0; i < n; ++i) {
+        const Key k = std::invoke(key, std::as_const(array[i]));
+        for (size_t pass = 0; pass < BYTES; ++pass)
+            ++count[pass][static_cast<size_t>(k >> (8 * pass)) & BYTE_MASK];
+    }
 
-    for (size_t pass = 0; pass < bytes; ++pass) {
-        size_t count[RADIX] = {};
-        const bool msb_pass = (pass + 1 == bytes);
-        const bool use_array_as_source = (pass % 2 == 0);
-
-        // Counting occurrences from the correct source
-        if (use_array_as_source) {
-            for (size_t i = 0; i < n; ++i) {
-                U u = static_cast<U>(array[i]);
-                auto digit = static_cast<size_t>((u >> (8 * pass)) & BYTE_MASK);
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    if (msb_pass)
-                        digit ^= 0x80u;
-                ++count[digit];
-            }
-        } else {
-            for (size_t i = 0; i < n; ++i) {
-                U u = static_cast<U>(temp[i]);
-                auto digit = static_cast<size_t>((u >> (8 * pass)) & BYTE_MASK);
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    if (msb_pass)
-                        digit ^= 0x80u;
-                ++count[digit];
-            }
-        }
+    Type* source = array.begin();
+    Type* target = temp.begin();
+
+    for (size_t pass = 0; pass < BYTES; ++pass) {
+        const size_t shift = 8 * pass;
+        const size_t first_digit =
+            static_cast<size_t>(std::invoke(key, std::as_const(source[0])) >> shift) & BYTE_MASK;
+        if (count[pass][first_digit] == n)
+            continue; // every key has the same byte here
 
-        // Prefix sums to get starting positions
         size_t pos[RADIX];
         pos[0] = 0;
         for (size_t d = 1; d < RADIX; ++d)
-            pos[d] = pos[d - 1] + count[d - 1];
+            pos[d] = pos[d - 1] + count[pass][d - 1];
 
-        // Stable distribution: even passes write to temp, odd passes back to
-        // array
-        if (use_array_as_source) {
-            for (size_t i = 0; i < n; ++i) {
-                U u = static_cast<U>(array[i]);
-                auto digit = static_cast<size_t>((u >> (8 * pass)) & BYTE_MASK);
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    if (msb_pass)
-                        digit ^= 0x80u;
-                temp[pos[digit]++] = array[i];
-            }
-        } else {
-            for (size_t i = 0; i < n; ++i) {
-                U u = static_cast<U>(temp[i]);
-                auto digit = static_cast<size_t>((u >> (8 * pass)) & BYTE_MASK);
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    if (msb_pass)
-                        digit ^= 0x80u;
-                array[pos[digit]++] = temp[i];
-            }
+        for (size_t i = 0; i < n; ++i) {
+            const size_t digit =
+                static_cast<size_t>(std::invoke(key, std::as_const(source[i])) >> shift) &
+                BYTE_MASK;
+            target[pos[digit]++] = std::move(source[i]);
         }
+        std::swap(source, target);
     }
 
-    // If number of passes is odd, last write was into temp -> copy back
-    if ((bytes % 2) == 1)
+    // An odd number of passes leaves the result in temp
+    if (source != array.begin())
         for (size_t i = 0; i < n; ++i)
-            array[i] = temp[i];
+            array[i] = std::move(source[i]);
 }
 
 
 /**
  * @brief Sorts the array in ascending order using MSD Radix Sort (base 256).
  *
- * Stable O(k·n) for integral types, where k = sizeof(Type) bytes.
- * Starts from the most significant byte and recursively sorts buckets by the
- * next less significant byte. For signed types, the MSB pass flips the sign bit
- * so that negatives precede non-negatives.
+ * Stable O(k·n) for integral and IEEE floating-point types, where k =
+ * sizeof(Type) bytes. Starts from the most significant byte and recursively
+ * sorts buckets by the next less significant byte. Keys are the same
+ * order-preserving unsigned images as in RadixSortLSD(). A bucket whose keys
+ * all share the current byte is not redistributed; the next byte is examined
+ * directly.
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
  *
  * @par Constraints
- * - Type must be an integral type.
+ * - Type must be an integral type, float or double.
  * - Uses O(n) temporary buffer reused across recursion.
  *
  * @param array The array to sort.
  */
-template <typename Type>
-void RadixSortMSD(DynamicArray<Type>& array) {
-    static_assert(std::numeric_limits<Type>::is_integer,
-                  "RadixSortMSD requires an integral Type.");
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void RadixSortMSD(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array) {
+    static_assert(detail::RadixSortable<Type>,
+                  "RadixSortMSD requires an integral or IEEE floating-point Type.");
 
     const size_t n = array.size();
     if (n <= 1 || isSorted(array))
         return;
 
-    using U = std::make_unsigned_t<Type>;
     constexpr size_t RADIX = 256;
 
     // Helper to get the byte at position 'byte' (0-based from LSB)
-    auto get_digit = [](U u, const int byte) -> size_t {
-        return static_cast<size_t>((u >> (8 * byte)) & 0xFFu);
+    auto get_digit = [](const Type value, const int byte) -> size_t {
+        return static_cast<size_t>((detail::radixKey(value) >> (8 * byte)) & 0xFFu);
     };
 
     // Reusable temporary buffer for stable distribution
-    DynamicArray<Type> temp(n);
+    DynamicArray<Type, Allocator> temp(n, array.getAllocator());
     for (size_t i = 0; i < n; ++i)
         temp.addLast(Type());
 
     // Self-recursive lambda via fixpoint pattern: pass 'self' explicitly
-    auto msd_rec = [&](auto&& self, const size_t lo, const size_t hi,
-                       const int byte, const bool flip_msb) -> void {
-        if (const size_t len = hi - lo; len <= 1 || byte < 0)
+    auto msd_rec = [&](auto&& self, const size_t lo, const size_t hi, int byte) -> void {
+        if (hi - lo <= 1)
             return;
 
         size_t count[RADIX] = {};
-
-        // Count digits
-        for (size_t i = lo; i < hi; ++i) {
-            U u = static_cast<U>(array[i]);
-            size_t d = get_digit(u, byte);
-
-            if (flip_msb)
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    d ^= 0x80u; // map sign bit so negatives come first
-
-            ++count[d];
+        for (; byte >= 0; --byte) {
+            // Count digits
+            for (size_t d = 0; d < RADIX; ++d)
+                count[d] = 0;
+            for (size_t i = lo; i < hi; ++i)
+                ++count[get_digit(array[i], byte)];
+
+            // A single non-empty bucket leaves the order unchanged
+            if (count[get_digit(array[lo], byte)] != hi - lo)
+                break;
         }
+        if (byte < 0)
+            return; // all keys equal
 
         // Compute starting positions in [lo, hi)
         size_t pos[RADIX];
@@ -1012,33 +2106,261 @@ void RadixSortMSD(DynamicArray<Type>& array) {
             pos[d] = pos[d - 1] + count[d - 1];
 
         // Stable distribute into temp
-        for (size_t i = lo; i < hi; ++i) {
-            U u = static_cast<U>(array[i]);
-            size_t d = get_digit(u, byte);
-
-            if (flip_msb)
-                if constexpr (std::numeric_limits<Type>::is_signed)
-                    d ^= 0x80u;
-
-            temp[pos[d]++] = array[i];
-        }
+        for (size_t i = lo; i < hi; ++i)
+            temp[pos[get_digit(array[i], byte)]++] = array[i];
 
         // Copy back to array
         for (size_t i = lo; i < hi; ++i)
             array[i] = temp[i];
 
-        // Recurse on each non-empty bucket with next byte (no sign flip below
-        // MSB)
+        // Recurse on each non-empty bucket with next byte
         size_t start = lo;
         for (const size_t cnt : count) {
             if (cnt > 1)
-                self(self, start, start + cnt, byte - 1, false);
+                self(self, start, start + cnt, byte - 1);
             start += cnt;
         }
     };
 
-    // Start from the MSB (byte index sizeof(Type)-1), flip sign bit at MSB
-    msd_rec(msd_rec, 0, n, static_cast<int>(sizeof(Type)) - 1, true);
+    // Start from the MSB (byte index sizeof(Type)-1)
+    msd_rec(msd_rec, 0, n, static_cast<int>(sizeof(Type)) - 1);
+}
+
+
+namespace detail {
+
+/// String buckets of at most this many elements are finished by insertion
+/// sort.
+inline constexpr size_t STRING_RADIX_INSERTION_THRESHOLD = 32;
+
+
+/// Insertion sort of [lo, hi), comparing only from character depth on (all
+/// strings in the range share their first depth characters).
+template <typename Array>
+void stringInsertionSort(Array& array, const size_t lo, const size_t hi, const size_t depth) {
+    for (size_t i = lo + 1; i < hi; ++i) {
+        auto value = std::move(array[i]);
+        const std::string_view suffix = std::string_view(value).substr(depth);
+        size_t j = i;
+        while (j > lo && suffix < std::string_view(array[j - 1]).substr(depth)) {
+            array[j] = std::move(array[j - 1]);
+            --j;
+        }
+        array[j] = std::move(value);
+    }
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Sorts an array of strings in ascending (lexicographic, by unsigned
+ * byte) order using MSD Radix Sort.
+ *
+ * The string counterpart of RadixSortMSD(): each level distributes a bucket
+ * by the character at the current depth into 257 buckets, where bucket 0
+ * holds the strings that end before that depth (and are therefore complete).
+ * Buckets whose strings all share the current character are not moved, and
+ * buckets of at most 32 strings are finished by insertion sort on the
+ * remaining suffixes. Strings are moved, never copied. Stable.
+ *
+ * @par Complexity
+ * - O(D) character inspections, where D is the total length of the
+ *   distinguishing prefixes, plus O(257) per distributed bucket.
+ * - O(n) temporary buffer of strings reused across recursion.
+ *
+ * @param array The array to sort.
+ */
+template <typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void RadixSortMSD(DynamicArray<std::string, Allocator, InlineCapacity, CapacityPolicy>& array) {
+    const size_t n = array.size();
+    if (n <= 1 || isSorted(array))
+        return;
+
+    constexpr size_t BUCKETS = 257; // 0: string ended, 1 + c: character c
+
+    auto get_bucket = [](const std::string& value, const size_t depth) -> size_t {
+        return depth < value.size()
+                   ? 1 + static_cast<size_t>(static_cast<unsigned char>(value[depth]))
+                   : 0;
+    };
+
+    DynamicArray<std::string, Allocator> temp(n, array.getAllocator());
+    for (size_t i = 0; i < n; ++i)
+        temp.addLast(std::string());
+
+    auto msd_rec = [&](auto&& self, const size_t lo, const size_t hi, size_t depth) -> void {
+        if (hi - lo <= detail::STRING_RADIX_INSERTION_THRESHOLD) {
+            detail::stringInsertionSort(array, lo, hi, depth);
+            return;
+        }
+
+        size_t count[BUCKETS];
+        while (true) {
+            for (size_t& c : count)
+                c = 0;
+            for (size_t i = lo; i < hi; ++i)
+                ++count[get_bucket(array[i], depth)];
+
+            if (count[0] == hi - lo)
+                return; // all strings are equal
+            if (count[get_bucket(array[lo], depth)] != hi - lo)
+                break;
+            ++depth; // common character, nothing to distribute
+        }
+
+        size_t pos[BUCKETS];
+        pos[0] = lo;
+        for (size_t b = 1; b < BUCKETS; ++b)
+            pos[b] = pos[b - 1] + count[b - 1];
+
+        for (size_t i = lo; i < hi; ++i)
+            temp[pos[get_bucket(array[i], depth)]++] = std::move(array[i]);
+        for (size_t i = lo; i < hi; ++i)
+            array[i] = std::move(temp[i]);
+
+        // Bucket 0 is complete; recurse on the character buckets
+        size_t start = lo + count[0];
+        for (size_t b = 1; b < BUCKETS; ++b) {
+            if (count[b] > 1)
+                self(self, start, start + count[b], depth + 1);
+            start += count[b];
+        }
+    };
+
+    msd_rec(msd_rec, 0, n, 0);
+}
+
+
+//*** Index Sorting ***//
+
+
+/**
+ * @brief Returns the permutation that sorts the array, without moving any
+ * element of it.
+ *
+ * The result p satisfies comp(proj(array[p[i]]), proj(array[p[i - 1]])) ==
+ * false for every i, so array[p[0]], array[p[1]], ... visits the elements in
+ * sorted order. Only indices are moved while sorting, which avoids copying
+ * wide records and lets one permutation reorder several parallel arrays (see
+ * ApplyPermutation()). Equal elements keep their relative order (stable),
+ * and pre-sorted runs are detected as in MergeSort().
+ *
+ * @tparam Index Unsigned index type of the permutation, e.g. std::uint32_t
+ * to halve its size for arrays below 2^32 elements.
+ *
+ * @param array The array whose sorting permutation is computed.
+ * @param comp Strict weak ordering on projected values. Defaults to
+ * std::ranges::less.
+ * @param proj Projection applied to each element before comparing.
+ * @return DynamicArray<Index> The sorting permutation, allocated with the
+ * array's allocator (rebound).
+ *
+ * @throws std::length_error If array.size() does not fit into Index.
+ *
+ * @par Complexity
+ * - O(n log n) comparisons, O(n) for presorted input.
+ * - O(n) indices plus an n / 2 index scratch buffer.
+ */
+template <std::unsigned_integral Index = size_t, typename Type, typename Allocator,
+          size_t InlineCapacity, typename CapacityPolicy, typename Compare = std::ranges::less,
+          typename Projection = std::identity>
+    requires SortComparator<Compare, Type, Projection>
+auto ArgSort(const DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array, Compare comp = {},
+             Projection proj = {}) {
+    using IndexAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Index>;
+    using Permutation = DynamicArray<Index, IndexAllocator>;
+
+    const size_t n = array.size();
+    if (n > 0 && n - 1 > std::numeric_limits<Index>::max())
+        throw std::length_error("ArgSort: array too large for the index type");
+
+    const IndexAllocator allocator(array.getAllocator());
+    Permutation permutation(n, allocator);
+    for (size_t i = 0; i < n; ++i)
+        permutation.addLast(static_cast<Index>(i));
+    if (n <= 1)
+        return permutation;
+
+    const auto less = [&](const Index a, const Index b) {
+        return std::invoke(comp, std::invoke(proj, array[a]), std::invoke(proj, array[b]));
+    };
+    if (detail::isSortedBy(permutation, less))
+        return permutation;
+
+    Permutation scratch(n / 2 + 1, allocator);
+    detail::timSortRuns(permutation, scratch, less);
+    return permutation;
+}
+
+
+/**
+ * @brief Reorders the array in place so that array[i] becomes the element
+ * previously at array[permutation[i]].
+ *
+ * The permutation is not modified, so the same ArgSort() result can be
+ * applied to every column of a structure-of-arrays table. Each cycle of the
+ * permutation is followed once: every element is moved exactly once plus one
+ * temporary per cycle, and visited positions are tracked in a bit set of n
+ * bits instead of a second copy of the elements.
+ *
+ * @param array The array to reorder.
+ * @param permutation A permutation of 0, ..., array.size() - 1.
+ *
+ * @throws std::invalid_argument If the sizes differ or permutation is not a
+ * permutation; array is left unchanged in that case.
+ *
+ * @par Complexity
+ * - O(n) element moves.
+ * - O(n / 64) words of extra space.
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy, typename Index,
+          typename IndexAllocator, size_t IndexInlineCapacity>
+void ApplyPermutation(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                      const DynamicArray<Index, IndexAllocator, IndexInlineCapacity>& permutation) {
+    static_assert(std::is_unsigned_v<Index>, "ApplyPermutation requires unsigned indices.");
+
+    const size_t n = array.size();
+    if (permutation.size() != n)
+        throw std::invalid_argument("ApplyPermutation: size mismatch");
+
+    using WordAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<std::uint64_t>;
+    const size_t words = (n + 63) / 64;
+    DynamicArray<std::uint64_t, WordAllocator> visited(words > 0 ? words : 1,
+                                                       WordAllocator(array.getAllocator()));
+    for (size_t w = 0; w < words; ++w)
+        visited.addLast(0);
+
+    auto test_and_set = [&](const size_t i) {
+        const std::uint64_t bit = std::uint64_t{1} << (i % 64);
+        const bool was_set = (visited[i / 64] & bit) != 0;
+        visited[i / 64] |= bit;
+        return was_set;
+    };
+
+    // Validate first so that a bad permutation leaves the array untouched
+    for (size_t i = 0; i < n; ++i)
+        if (permutation[i] >= n || test_and_set(static_cast<size_t>(permutation[i])))
+            throw std::invalid_argument("ApplyPermutation: not a permutation");
+    for (size_t w = 0; w < words; ++w)
+        visited[w] = 0;
+
+    for (size_t start = 0; start < n; ++start) {
+        if (test_and_set(start) || permutation[start] == start)
+            continue;
+
+        Type carried = std::move(array[start]);
+        size_t hole = start;
+        size_t next = static_cast<size_t>(permutation[hole]);
+        while (next != start) {
+            array[hole] = std::move(array[next]);
+            test_and_set(next);
+            hole = next;
+            next = static_cast<size_t>(permutation[hole]);
+        }
+        array[hole] = std::move(carried);
+    }
 }
 
 
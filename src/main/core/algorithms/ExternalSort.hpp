@@ -0,0 +1,587 @@
+/**
+ * @file ExternalSort.hpp
+ *
+ * External merge sort of binary files of fixed-size records that do not fit
+ * in memory.
+ *
+ * The input file is read in chunks that fit the memory budget. Each chunk is
+ * sorted with the in-memory engine of ArrayAlgorithms.hpp (RadixSortLSD for
+ * integers and floating point, HybridSort otherwise) and spilled to a
+ * temporary run file. The runs are then k-way merged with a DaryHeap, in as
+ * many passes as the budget requires, the last pass writing the output.
+ *
+ * All file I/O is done in large sequential blocks, read straight into the
+ * sort and merge buffers, by one background thread while the calling thread
+ * sorts or merges:
+ * - Run formation rotates three chunk buffers: while one chunk is sorted,
+ *   the next is being read and the previous one is being written.
+ * - During a merge every run and the output have two blocks each, one being
+ *   consumed or filled and one being read or written.
+ */
+
+
+#ifndef EXTERNAL_SORT_HPP
+#define EXTERNAL_SORT_HPP
+
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ArrayAlgorithms.hpp"
+#include "DaryHeap.hpp"
+#include "DynamicArray.hpp"
+#include "Queue.hpp"
+
+
+namespace array_algorithms {
+
+
+/// Tuning of ExternalSort().
+struct ExternalSortOptions {
+    /// Upper bound on the buffer memory used, in bytes.
+    size_t memory_budget = size_t{256} << 20;
+
+    /// Directory for the run files; empty for the system temp directory.
+    std::filesystem::path temp_directory{};
+
+    /// Largest size of each read or write during merging, in bytes. Lowered
+    /// to fit the budget, and to merge more runs per pass (down to 64 KiB).
+    size_t io_block_bytes = size_t{4} << 20;
+};
+
+
+/// What ExternalSort() did.
+struct ExternalSortStats {
+    size_t elements = 0;     ///< Records sorted.
+    size_t runs = 0;         ///< Sorted runs spilled by run formation.
+    size_t merge_passes = 0; ///< Passes over the data after run formation.
+};
+
+
+/// Smallest memory budget ExternalSort() accepts.
+inline constexpr size_t EXTERNAL_SORT_MIN_BUDGET = size_t{64} << 10;
+
+
+namespace external_detail {
+
+/// Unbuffered stdio file; the callers do their own block I/O.
+class File {
+    std::unique_ptr<std::FILE, int (*)(std::FILE*)> file_{nullptr, &std::fclose};
+    std::filesystem::path path_;
+
+  public:
+    File(const std::filesystem::path& path, const char* mode) : path_(path) {
+        file_.reset(std::fopen(path.string().c_str(), mode));
+        if (!file_)
+            throw std::system_error(errno, std::generic_category(), "Cannot open '" + path.string() + "'");
+        std::setvbuf(file_.get(), nullptr, _IONBF, 0);
+    }
+
+    /// Reads up to count records; returns how many were read.
+    template <typename Type>
+    size_t read(Type* data, const size_t count) {
+        const size_t got = std::fread(data, sizeof(Type), count, file_.get());
+        if (got < count && std::ferror(file_.get()))
+            throw std::runtime_error("Cannot read '" + path_.string() + "'");
+        return got;
+    }
+
+    template <typename Type>
+    void write(const Type* data, const size_t count) {
+        if (count > 0 && std::fwrite(data, sizeof(Type), count, file_.get()) != count)
+            throw std::runtime_error("Cannot write '" + path_.string() + "'");
+    }
+
+    /// Closes the file, reporting errors of buffered writes.
+    void close() {
+        if (std::fclose(file_.release()) != 0)
+            throw std::runtime_error("Cannot write '" + path_.string() + "'");
+    }
+};
+
+
+/// Replaces the contents of array with up to limit records read from file,
+/// straight into its storage (no reallocation if the capacity suffices).
+template <typename Type>
+void readInto(File& file, DynamicArray<Type>& array, const size_t limit) {
+    array.clear();
+    Type* data = array.appendForOverwrite(limit);
+    array.popBackN(limit - file.read(data, limit));
+}
+
+
+/**
+ * @brief One background thread that runs the reads and writes of a sort in
+ * submission order.
+ *
+ * Keeps the I/O of a merge on a single thread whatever its fan-in: the runs
+ * share one disk, so more threads would only add context switches. Jobs
+ * must not wait for each other. The destructor runs the jobs still queued:
+ * a job's buffers must outlive the worker, or their owner must wait for the
+ * job's future before releasing them, as RunReader and RunWriter do.
+ */
+class IoWorker {
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    containers::Queue<std::packaged_task<void()>> jobs_;
+    bool stopping_ = false;
+    std::thread thread_;
+
+    void loop() {
+        for (;;) {
+            std::packaged_task<void()> job;
+            {
+                std::unique_lock lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !jobs_.isEmpty(); });
+                if (jobs_.isEmpty())
+                    return;
+                job = std::move(jobs_.front());
+                jobs_.dequeue();
+            }
+            job();
+        }
+    }
+
+  public:
+    IoWorker() : thread_([this] { loop(); }) {}
+
+    IoWorker(const IoWorker&) = delete;
+    IoWorker& operator=(const IoWorker&) = delete;
+
+    ~IoWorker() {
+        {
+            std::lock_guard lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_one();
+        thread_.join();
+    }
+
+    /// Queues job; the future reports its completion or exception.
+    template <typename Function>
+    std::future<void> submit(Function&& job) {
+        std::packaged_task<void()> task(std::forward<Function>(job));
+        std::future<void> done = task.get_future();
+        {
+            std::lock_guard lock(mutex_);
+            jobs_.enqueue(std::move(task));
+        }
+        ready_.notify_one();
+        return done;
+    }
+};
+
+
+/// Temporary run files, removed when no longer needed or on destruction.
+class RunFiles {
+    std::filesystem::path directory_;
+    std::string prefix_;
+    size_t next_ = 0;
+
+  public:
+    explicit RunFiles(std::filesystem::path directory) : directory_(std::move(directory)) {
+        if (directory_.empty())
+            directory_ = std::filesystem::temp_directory_path();
+        prefix_ = "external_sort_" + std::to_string(std::random_device{}()) + "_";
+    }
+
+    RunFiles(const RunFiles&) = delete;
+    RunFiles& operator=(const RunFiles&) = delete;
+
+    ~RunFiles() {
+        std::error_code ignored;
+        for (size_t i = 0; i < next_; ++i)
+            std::filesystem::remove(pathOf(i), ignored);
+    }
+
+    [[nodiscard]]
+    std::filesystem::path pathOf(const size_t id) const {
+        return directory_ / (prefix_ + std::to_string(id) + ".run");
+    }
+
+    /// Reserves the name of a new run file.
+    size_t create() noexcept {
+        return next_++;
+    }
+
+    static void remove(const std::filesystem::path& path) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+};
+
+
+/// Sequential reader of one sorted run, prefetching the next block.
+template <typename Type>
+class RunReader {
+    File file_;
+    IoWorker& io_;
+    DynamicArray<Type> current_;
+    DynamicArray<Type> next_;
+    size_t position_ = 0;
+    size_t block_;
+    std::future<void> pending_;
+
+    void prefetch() {
+        pending_ = io_.submit([this] { readInto(file_, next_, block_); });
+    }
+
+  public:
+    RunReader(const std::filesystem::path& path, const size_t block, IoWorker& io)
+        : file_(path, "rb"), io_(io), current_(block), next_(block), block_(block) {
+        readInto(file_, current_, block_);
+        if (current_.size() == block_)
+            prefetch();
+    }
+
+    RunReader(const RunReader&) = delete;
+    RunReader& operator=(const RunReader&) = delete;
+
+    ~RunReader() {
+        if (pending_.valid())
+            pending_.wait();
+    }
+
+    /// Takes the next record; nullptr once the run is exhausted. The record
+    /// stays valid until the following call.
+    const Type* next() {
+        if (position_ == current_.size()) {
+            if (!pending_.valid())
+                return nullptr;
+            pending_.get();
+            std::swap(current_, next_);
+            position_ = 0;
+            if (current_.isEmpty())
+                return nullptr;
+            if (current_.size() == block_)
+                prefetch();
+        }
+        return &current_[position_++];
+    }
+};
+
+
+/// Sequential writer that writes one block while the next is filled.
+template <typename Type>
+class RunWriter {
+    File file_;
+    IoWorker& io_;
+    DynamicArray<Type> filling_;
+    DynamicArray<Type> flushing_;
+    size_t block_;
+    std::future<void> pending_;
+
+  public:
+    RunWriter(const std::filesystem::path& path, const size_t block, IoWorker& io)
+        : file_(path, "wb"), io_(io), filling_(block), flushing_(block), block_(block) {}
+
+    RunWriter(const RunWriter&) = delete;
+    RunWriter& operator=(const RunWriter&) = delete;
+
+    ~RunWriter() {
+        if (pending_.valid())
+            pending_.wait();
+    }
+
+    void push(const Type& value) {
+        filling_.emplaceLastUnchecked(value);
+        if (filling_.size() == block_)
+            flush();
+    }
+
+    /// Starts writing the filled block, after the previous write finished.
+    void flush() {
+        if (pending_.valid())
+            pending_.get();
+        std::swap(filling_, flushing_);
+        filling_.clear();
+        pending_ = io_.submit([this] { file_.write(flushing_.begin(), flushing_.size()); });
+    }
+
+    /// Writes what is left and closes the file.
+    void finish() {
+        flush();
+        pending_.get();
+        file_.close();
+    }
+};
+
+
+/// Sorts one chunk with the in-memory engine.
+template <typename Type>
+void sortChunk(DynamicArray<Type>& chunk) {
+    if constexpr (detail::RadixSortable<Type>)
+        RadixSortLSD(chunk);
+    else
+        HybridSort(chunk);
+}
+
+
+/// Head of a run in the merge heap.
+template <typename Type>
+struct MergeEntry {
+    Type value;
+    std::uint32_t run;
+};
+
+
+/// Heap order putting the smallest head on top.
+template <typename Type>
+struct SmallestOnTop {
+    bool operator()(const MergeEntry<Type>& a, const MergeEntry<Type>& b) const {
+        return b.value < a.value;
+    }
+};
+
+
+/**
+ * @brief Bytes of buffers and bookkeeping a merge of fan_in runs with blocks
+ * of block records holds: the block being consumed and the one being read
+ * ahead for every run, the same two for the output, and the reader and heap
+ * entry of every run.
+ */
+template <typename Type>
+constexpr size_t mergeMemory(const size_t fan_in, const size_t block) noexcept {
+    constexpr size_t PER_RUN = sizeof(RunReader<Type>) + sizeof(std::unique_ptr<RunReader<Type>>) +
+                               sizeof(MergeEntry<Type>);
+    return 2 * (fan_in + 1) * block * sizeof(Type) + fan_in * PER_RUN;
+}
+
+
+/**
+ * @brief Merges the sorted runs into output with a 4-ary min-heap of run
+ * heads: one sift per record, O(n log k) comparisons. Takes
+ * mergeMemory<Type>(runs.size(), block) bytes.
+ */
+template <typename Type>
+void mergeRuns(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output,
+               const size_t block) {
+    IoWorker io;
+    std::vector<std::unique_ptr<RunReader<Type>>> readers;
+    readers.reserve(runs.size());
+    containers::DaryHeap<MergeEntry<Type>, 4, SmallestOnTop<Type>> heap;
+    heap.reserve(runs.size());
+
+    for (const auto& run : runs) {
+        readers.push_back(std::make_unique<RunReader<Type>>(run, block, io));
+        if (const Type* head = readers.back()->next())
+            heap.insert(MergeEntry<Type>{*head, static_cast<std::uint32_t>(readers.size() - 1)});
+    }
+
+    RunWriter<Type> writer(output, block, io);
+    while (!heap.isEmpty()) {
+        const MergeEntry<Type>& top = heap.peekRoot();
+        writer.push(top.value);
+
+        const std::uint32_t run = top.run;
+        if (const Type* head = readers[run]->next())
+            heap.replaceTop(MergeEntry<Type>{*head, run});
+        else
+            heap.extractRoot();
+    }
+    writer.finish();
+}
+
+
+/// Moves a finished file into place, copying across file systems.
+inline void moveFile(const std::filesystem::path& from, const std::filesystem::path& to) {
+    std::error_code error;
+    std::filesystem::rename(from, to, error);
+    if (error) {
+        std::filesystem::copy_file(from, to, std::filesystem::copy_options::overwrite_existing);
+        RunFiles::remove(from);
+    }
+}
+
+} // namespace external_detail
+
+
+/**
+ * @brief Sorts a binary file of Type records into another file, using at
+ * most about options.memory_budget bytes of buffers.
+ *
+ * The files hold the raw bytes of consecutive Type values, as written by
+ * fwrite(array, sizeof(Type), n, file). Records are ordered by operator<.
+ * output may be the same path as input.
+ *
+ * Run formation splits the budget between three chunk buffers, four for
+ * radix-sortable types whose sort needs an equal scratch buffer. Each merge
+ * pass reads every record once and writes it once. It merges as many runs
+ * at a time as fit the budget with two blocks each, two more for the
+ * output, and about 150 bytes of reader and heap entry per run. The merge
+ * block starts at options.io_block_bytes and is lowered, down to 64 KiB,
+ * until all runs fit one merge. Sorting 500 GB with 256 MiB takes about
+ * 7500 runs; at 64 KiB blocks 2044 of them merge at a time, so two merge
+ * passes. All reads and writes run on one background thread.
+ *
+ * Run files are created in options.temp_directory and removed before
+ * returning, also when an exception is thrown.
+ *
+ * @tparam Type Trivially copyable record type with operator<.
+ *
+ * @param input File to sort.
+ * @param output File to write the sorted records to; replaced if it exists.
+ * @param options Memory budget, temporary directory and I/O block size.
+ * @return ExternalSortStats Records, runs and merge passes.
+ *
+ * @throws std::invalid_argument If the budget is below
+ * EXTERNAL_SORT_MIN_BUDGET or the input size is not a multiple of
+ * sizeof(Type).
+ * @throws std::system_error If a file cannot be opened.
+ * @throws std::runtime_error If reading or writing fails.
+ *
+ * @par Complexity
+ * - O(n log n) comparisons, or O(n) radix passes plus O(n log k) merging.
+ * - 2 · (1 + merge passes) · n · sizeof(Type) bytes of sequential I/O.
+ */
+template <typename Type>
+ExternalSortStats ExternalSort(const std::filesystem::path& input, const std::filesystem::path& output,
+                               const ExternalSortOptions& options = {}) {
+    static_assert(std::is_trivially_copyable_v<Type>, "ExternalSort requires a trivially copyable Type.");
+
+    if (options.memory_budget < EXTERNAL_SORT_MIN_BUDGET)
+        throw std::invalid_argument("ExternalSort: memory budget too small");
+
+    const auto bytes = static_cast<size_t>(std::filesystem::file_size(input));
+    if (bytes % sizeof(Type) != 0)
+        throw std::invalid_argument("ExternalSort: file size is not a multiple of the record size");
+
+    ExternalSortStats stats;
+    stats.elements = bytes / sizeof(Type);
+
+    // Reads and writes go through blocks of at least one record, and small
+    // enough that a two-way merge (two blocks per run and for the output)
+    // fits the budget.
+    size_t block_bytes = options.io_block_bytes < options.memory_budget / 6 ? options.io_block_bytes
+                                                                            : options.memory_budget / 6;
+    const size_t block = block_bytes / sizeof(Type) > 0 ? block_bytes / sizeof(Type) : 1;
+    block_bytes = block * sizeof(Type);
+
+    constexpr size_t CHUNK_BUFFERS = detail::RadixSortable<Type> ? 4 : 3;
+    const size_t chunk_bytes = options.memory_budget / CHUNK_BUFFERS;
+    const size_t chunk = chunk_bytes / sizeof(Type) > block ? chunk_bytes / sizeof(Type) : block;
+
+    external_detail::RunFiles files(options.temp_directory);
+    std::vector<std::filesystem::path> runs;
+
+    // Run formation: read chunk i + 1 and write chunk i - 1 while sorting i.
+    {
+        external_detail::File in(input, "rb");
+        DynamicArray<Type> chunks[3] = {DynamicArray<Type>(chunk), DynamicArray<Type>(chunk),
+                                        DynamicArray<Type>(chunk)};
+        // Declared after the buffers: if sorting throws, the worker finishes
+        // the queued reads and writes before the buffers are released.
+        external_detail::IoWorker io;
+        std::future<void> writes[3];
+        auto read = [&](DynamicArray<Type>& buffer) {
+            return io.submit([&in, &buffer, chunk] { external_detail::readInto(in, buffer, chunk); });
+        };
+
+        std::future<void> reading = read(chunks[0]);
+        for (size_t i = 0;; ++i) {
+            reading.get();
+            DynamicArray<Type>& current = chunks[i % 3];
+            if (current.isEmpty())
+                break;
+
+            // A short chunk ends the input.
+            const bool more = current.size() == chunk;
+            const size_t following = (i + 1) % 3;
+            if (writes[following].valid())
+                writes[following].get();
+            if (more)
+                reading = read(chunks[following]);
+
+            external_detail::sortChunk(current);
+            runs.push_back(files.pathOf(files.create()));
+            writes[i % 3] = io.submit([&current, path = runs.back()] {
+                external_detail::File out(path, "wb");
+                out.write(current.begin(), current.size());
+                out.close();
+            });
+            if (!more)
+                break;
+        }
+        for (auto& write : writes)
+            if (write.valid())
+                write.get();
+    }
+    stats.runs = runs.size();
+
+    if (runs.empty()) {
+        external_detail::File(output, "wb").close();
+        return stats;
+    }
+
+    // Merge blocks shrink from block_bytes, down to MIN_MERGE_BLOCK, until
+    // every run fits one merge: a pass over the data costs more than the
+    // extra seeks of smaller blocks. Every run also costs its reader and
+    // heap entry, which come off the budget first.
+    constexpr size_t MIN_MERGE_BLOCK = size_t{64} << 10;
+    const size_t run_overhead = external_detail::mergeMemory<Type>(runs.size(), 0);
+    const size_t one_pass_bytes = run_overhead < options.memory_budget
+                                      ? (options.memory_budget - run_overhead) / (2 * (runs.size() + 1))
+                                      : 0;
+    const size_t floor_bytes = MIN_MERGE_BLOCK < block_bytes ? MIN_MERGE_BLOCK : block_bytes;
+    const size_t merge_bytes = one_pass_bytes < floor_bytes ? floor_bytes
+                               : one_pass_bytes < block_bytes ? one_pass_bytes
+                                                              : block_bytes;
+    const size_t merge_block = merge_bytes / sizeof(Type) > 0 ? merge_bytes / sizeof(Type) : 1;
+
+    // Merge passes, fan_in runs at a time, until one run is left. fan_in is
+    // the most runs whose merge fits the budget.
+    constexpr size_t MAX_FAN_IN = std::numeric_limits<std::uint32_t>::max();
+    const size_t output_bytes = external_detail::mergeMemory<Type>(0, merge_block);
+    const size_t per_run_bytes = external_detail::mergeMemory<Type>(1, merge_block) - output_bytes;
+    const size_t budget_fan_in =
+        options.memory_budget > output_bytes ? (options.memory_budget - output_bytes) / per_run_bytes : 0;
+    const size_t fan_in = budget_fan_in < 2 ? 2 : budget_fan_in < MAX_FAN_IN ? budget_fan_in : MAX_FAN_IN;
+    while (runs.size() > fan_in) {
+        std::vector<std::filesystem::path> merged;
+        for (size_t first = 0; first < runs.size(); first += fan_in) {
+            const size_t last = first + fan_in < runs.size() ? first + fan_in : runs.size();
+            const std::vector<std::filesystem::path> group(runs.begin() + static_cast<std::ptrdiff_t>(first),
+                                                           runs.begin() + static_cast<std::ptrdiff_t>(last));
+            if (group.size() == 1) {
+                merged.push_back(group.front());
+                continue;
+            }
+            merged.push_back(files.pathOf(files.create()));
+            external_detail::mergeRuns<Type>(group, merged.back(), merge_block);
+            for (const auto& run : group)
+                external_detail::RunFiles::remove(run);
+        }
+        runs = std::move(merged);
+        ++stats.merge_passes;
+    }
+
+    if (runs.size() == 1) {
+        external_detail::moveFile(runs.front(), output);
+    } else {
+        external_detail::mergeRuns<Type>(runs, output, merge_block);
+        ++stats.merge_passes;
+    }
+    return stats;
+}
+
+
+} // namespace array_algorithms
+
+
+#endif // EXTERNAL_SORT_HPP
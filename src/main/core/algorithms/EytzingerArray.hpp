@@ -0,0 +1,191 @@
+/**
+ * @file EytzingerArray.hpp
+ *
+ * A read-only search index over a sorted DynamicArray, stored in Eytzinger
+ * (breadth-first binary heap) order.
+ */
+
+
+#ifndef EYTZINGER_ARRAY_HPP
+#define EYTZINGER_ARRAY_HPP
+
+
+#include <bit>
+#include <memory>
+#include <stdexcept>
+
+#include "DynamicArray.hpp"
+#include "SimdSearch.hpp"
+
+
+namespace array_algorithms {
+
+using containers::DynamicArray;
+
+
+/** @class EytzingerArray
+ *
+ * @brief A static sorted set of keys laid out for fast repeated lower-bound
+ * searches.
+ *
+ * The keys of a sorted array are stored in the order of a breadth-first
+ * traversal of the implicit balanced search tree over them: the root at
+ * slot 1, the children of slot k at slots 2k and 2k + 1. A search walks
+ * down from the root with a branchless step, k = 2k + (key[k] < target).
+ * Unlike a binary search on the sorted array, the first levels of the tree
+ * share a few cache lines that stay hot across lookups, and the descendants
+ * of a slot a few levels down are contiguous, so they are prefetched one
+ * cache line ahead of the search.
+ *
+ * Results are reported as ranks, i.e. indices into the sorted array the
+ * index was built from, so the structure can serve as an accelerator next
+ * to that array. Ranks are computed from the slot number rather than looked
+ * up, so a search touches no memory besides the keys. The index is
+ * immutable: rebuild it when the keys change.
+ *
+ * @tparam Type The key type; must be copyable and ordered by operator<.
+ * @tparam Allocator Allocator for the key table.
+ */
+template <typename Type, typename Allocator = std::allocator<Type>>
+class EytzingerArray {
+    /// Slots prefetched ahead: the first descendant four levels down shares
+    /// a cache line with the next 15 descendants.
+    static constexpr size_t PREFETCH_LEVELS = 4;
+
+    DynamicArray<Type, Allocator> keys_; // slot 0 unused
+    size_t size_ = 0;
+    size_t levels_ = 0;          // height of the tree
+    size_t last_level_size_ = 0; // nodes on the deepest level
+
+
+    /// Fills the slots of the subtree rooted at slot from sorted[next ...].
+    template <typename Sorted>
+    void build(const Sorted& sorted, size_t& next, const size_t slot) {
+        if (slot > size_)
+            return;
+        build(sorted, next, 2 * slot);
+        keys_[slot] = sorted[next++];
+        build(sorted, next, 2 * slot + 1);
+    }
+
+
+    /**
+     * @brief In-order position (rank) of a slot.
+     *
+     * In a perfect tree of levels_ levels, slot k on depth d is preceded by
+     * (2 (k - 2^d) + 1) 2^(levels_ - 1 - d) - 1 nodes in order. The deepest
+     * level is filled from the left and occupies the even positions of that
+     * order, so the ones missing after the last_level_size_ present nodes
+     * are subtracted.
+     */
+    size_t rankOf(const size_t slot) const noexcept {
+        const auto depth = static_cast<size_t>(std::bit_width(slot)) - 1;
+        const size_t offset = slot - (size_t{1} << depth);
+        const size_t position = ((2 * offset + 1) << (levels_ - 1 - depth)) - 1;
+
+        const size_t present_end = 2 * last_level_size_;
+        if (position < present_end)
+            return position;
+        return position - (position - present_end + 1) / 2;
+    }
+
+
+    /// Slot of the first key not less than target, or 0 if there is none.
+    size_t lowerBoundSlot(const Type& target) const {
+        const Type* keys = keys_.begin();
+        size_t slot = 1;
+        while (slot <= size_) {
+            const size_t ahead = slot << PREFETCH_LEVELS;
+            detail::prefetch(keys + (ahead <= size_ ? ahead : 0));
+            slot = 2 * slot + static_cast<size_t>(keys[slot] < target);
+        }
+        // Undo the trailing "went right" steps and the final "went left" one.
+        return slot >> (std::countr_one(slot) + 1);
+    }
+
+
+  public:
+    /**
+     * @brief Builds the index from an array sorted in ascending order.
+     *
+     * @param sorted The sorted keys; copied, not referenced.
+     * @param allocator Allocator for the tables.
+     *
+     * @throws std::invalid_argument If sorted is not in ascending order.
+     *
+     * @par Complexity
+     * O(n) time, n + 1 keys of space.
+     */
+    template <typename SortedAllocator, size_t InlineCapacity>
+    explicit EytzingerArray(const DynamicArray<Type, SortedAllocator, InlineCapacity>& sorted,
+                            const Allocator& allocator = Allocator())
+        : keys_(sorted.size() + 1, allocator), size_(sorted.size()) {
+        for (size_t i = 1; i < size_; ++i)
+            if (sorted[i] < sorted[i - 1])
+                throw std::invalid_argument("EytzingerArray: input is not sorted");
+
+        if (size_ == 0)
+            return;
+
+        levels_ = static_cast<size_t>(std::bit_width(size_));
+        last_level_size_ = size_ - ((size_t{1} << (levels_ - 1)) - 1);
+
+        // Slots are assigned in tree order, so fill the table first.
+        for (size_t i = 0; i <= size_; ++i)
+            keys_.addLast(sorted[0]);
+        size_t next = 0;
+        build(sorted, next, 1);
+    }
+
+
+    /// Returns the number of keys.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the index holds no keys.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+
+    /**
+     * @brief Rank of the first key that is not less than target
+     * (std::lower_bound), or size() if every key is less.
+     *
+     * @par Complexity
+     * O(log n) comparisons, without data-dependent branches.
+     */
+    [[nodiscard]]
+    size_t lowerBound(const Type& target) const {
+        const size_t slot = lowerBoundSlot(target);
+        return slot == 0 ? size_ : rankOf(slot);
+    }
+
+
+    /**
+     * @brief Rank of the first key equal to target, or size() if absent.
+     */
+    [[nodiscard]]
+    size_t find(const Type& target) const {
+        const size_t slot = lowerBoundSlot(target);
+        if (slot == 0 || target < keys_[slot])
+            return size_;
+        return rankOf(slot);
+    }
+
+
+    /// Checks if the index contains a key equal to target.
+    [[nodiscard]]
+    bool contains(const Type& target) const {
+        return find(target) != size_;
+    }
+};
+
+
+} // namespace array_algorithms
+
+
+#endif // EYTZINGER_ARRAY_HPP
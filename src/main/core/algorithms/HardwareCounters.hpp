@@ -0,0 +1,364 @@
+/**
+ * @file HardwareCounters.hpp
+ *
+ * Hardware performance counters around a region of code, for explaining
+ * why a kernel is slow rather than only counting its logical events.
+ *
+ * The instrumentation policies of Instrumentation.hpp count what an
+ * algorithm does (compares, swaps, probes); HardwareCounters measures what
+ * the CPU did meanwhile: cycles, instructions, branch misses and L1 data /
+ * last-level cache misses. On Linux the counters are read with
+ * perf_event_open as one group, so they cover exactly the same interval.
+ * Where that is unavailable (another OS, a container without the syscall,
+ * or kernel.perf_event_paranoid forbidding user-space counting) only cycles
+ * are measured, from the time-stamp counter: those are reference cycles at
+ * the nominal frequency, not core cycles.
+ *
+ * Counters are opened once and then started and stopped around each
+ * measured region, so a benchmark can exclude its setup:
+ *
+ * @code
+ * HardwareCounters counters;
+ * CounterReading total;
+ * for (auto _ : state) {
+ *     DynamicArray<int> data(input);
+ *     counters.start();
+ *     HybridSort(data);
+ *     total += counters.stop();
+ * }
+ * log(total.perElement(total.llc_misses, n * state.iterations()));
+ * @endcode
+ */
+
+
+#ifndef HARDWARE_COUNTERS_HPP
+#define HARDWARE_COUNTERS_HPP
+
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HARDWARE_COUNTERS_PERF_EVENTS 1
+#else
+#define HARDWARE_COUNTERS_PERF_EVENTS 0
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+namespace array_algorithms {
+
+using std::size_t;
+
+
+/// Hardware events that can be counted; combine them with |.
+enum class HardwareEvent : unsigned {
+    None = 0,
+    Cycles = 1u << 0,          ///< Core cycles (reference cycles with the time-stamp fallback).
+    Instructions = 1u << 1,    ///< Retired instructions.
+    BranchMisses = 1u << 2,    ///< Mispredicted branches.
+    L1DataMisses = 1u << 3,    ///< L1 data cache read misses.
+    LastLevelMisses = 1u << 4, ///< Last-level cache misses.
+    All = (1u << 5) - 1
+};
+
+constexpr HardwareEvent operator|(const HardwareEvent a, const HardwareEvent b) noexcept {
+    return static_cast<HardwareEvent>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+
+constexpr HardwareEvent operator&(const HardwareEvent a, const HardwareEvent b) noexcept {
+    return static_cast<HardwareEvent>(static_cast<unsigned>(a) & static_cast<unsigned>(b));
+}
+
+
+/// Where the counts of a HardwareCounters come from.
+enum class CounterSource {
+    PerfEvents, ///< Linux perf_event_open: every event the CPU and kernel support.
+    Timestamp   ///< Time-stamp counter (or a steady clock off x86): cycles only.
+};
+
+
+/** @struct CounterReading
+ *
+ * @brief Event counts of one or more measured intervals.
+ *
+ * Readings of the same counters can be summed with +=. Events that were not
+ * measured (see has()) read as zero.
+ */
+struct CounterReading {
+    std::uint64_t cycles = 0;
+    std::uint64_t instructions = 0;
+    std::uint64_t branch_misses = 0;
+    std::uint64_t l1d_misses = 0;
+    std::uint64_t llc_misses = 0;
+
+    /// The events actually counted.
+    HardwareEvent measured = HardwareEvent::None;
+
+    CounterSource source = CounterSource::Timestamp;
+
+
+    /// Checks if event was counted.
+    [[nodiscard]]
+    constexpr bool has(const HardwareEvent event) const noexcept {
+        return (measured & event) == event && event != HardwareEvent::None;
+    }
+
+    /// Returns count divided by elements, e.g. cache misses per sorted element.
+    [[nodiscard]]
+    static constexpr double perElement(const std::uint64_t count, const size_t elements) noexcept {
+        return elements == 0 ? 0.0 : static_cast<double>(count) / static_cast<double>(elements);
+    }
+
+    /// Instructions per cycle, or 0 if either was not counted.
+    [[nodiscard]]
+    constexpr double instructionsPerCycle() const noexcept {
+        return has(HardwareEvent::Instructions | HardwareEvent::Cycles) && cycles != 0
+                   ? static_cast<double>(instructions) / static_cast<double>(cycles)
+                   : 0.0;
+    }
+
+    /// Adds the counts of another interval measured by the same counters.
+    constexpr CounterReading& operator+=(const CounterReading& other) noexcept {
+        cycles += other.cycles;
+        instructions += other.instructions;
+        branch_misses += other.branch_misses;
+        l1d_misses += other.l1d_misses;
+        llc_misses += other.llc_misses;
+        measured = other.measured;
+        source = other.source;
+        return *this;
+    }
+};
+
+
+/** @class HardwareCounters
+ *
+ * @brief A group of hardware counters for the calling thread, started and
+ * stopped around a region of code.
+ *
+ * The constructor opens the requested events; events the CPU or kernel
+ * does not offer are left out (see events()), and if none can be opened
+ * the counters fall back to the time-stamp counter. Only user-space
+ * activity of the calling thread is counted. When the kernel has to
+ * multiplex more events than the CPU has counters, the counts are scaled
+ * by the share of time each was active.
+ *
+ * Opening counters costs a few system calls; start() and stop() cost one
+ * each (perf events) or a few cycles (time-stamp counter).
+ */
+class HardwareCounters {
+  public:
+    /**
+     * @brief Opens counters for events.
+     *
+     * @param events The events to count.
+     * @param preferred CounterSource::Timestamp skips perf events and only
+     * counts cycles, at the lowest cost.
+     */
+    explicit HardwareCounters(const HardwareEvent events = HardwareEvent::All,
+                              const CounterSource preferred = CounterSource::PerfEvents) {
+        if (preferred == CounterSource::PerfEvents)
+            openPerfEvents(events);
+    }
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    ~HardwareCounters() { closePerfEvents(); }
+
+
+    /// Where the counts come from.
+    [[nodiscard]]
+    CounterSource source() const noexcept {
+        return open_count_ > 0 ? CounterSource::PerfEvents : CounterSource::Timestamp;
+    }
+
+    /// The events that are counted.
+    [[nodiscard]]
+    HardwareEvent events() const noexcept {
+        if (open_count_ == 0)
+            return HardwareEvent::Cycles;
+        HardwareEvent events = HardwareEvent::None;
+        for (size_t i = 0; i < open_count_; ++i)
+            events = events | slots_[i].event;
+        return events;
+    }
+
+
+    /// Resets the counts and starts counting.
+    void start() noexcept {
+#if HARDWARE_COUNTERS_PERF_EVENTS
+        if (open_count_ > 0) {
+            ioctl(slots_[0].fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(slots_[0].fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+            return;
+        }
+#endif
+        start_ticks_ = timestamp();
+    }
+
+    /// Stops counting and returns the counts since start().
+    CounterReading stop() noexcept {
+        CounterReading reading;
+        reading.measured = events();
+        reading.source = source();
+
+#if HARDWARE_COUNTERS_PERF_EVENTS
+        if (open_count_ > 0) {
+            ioctl(slots_[0].fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            // PERF_FORMAT_GROUP layout: nr, time_enabled, time_running, value[nr].
+            std::uint64_t data[3 + MAX_EVENTS] = {};
+            if (read(slots_[0].fd, data, sizeof(data)) < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) {
+                reading.measured = HardwareEvent::None;
+                return reading;
+            }
+            const std::uint64_t enabled = data[1];
+            const std::uint64_t running = data[2];
+            if (running == 0 && enabled != 0) { // The group never got a turn on the PMU.
+                reading.measured = HardwareEvent::None;
+                return reading;
+            }
+            for (size_t i = 0; i < open_count_ && i < data[0]; ++i) {
+                std::uint64_t value = data[3 + i];
+                if (running != 0 && running < enabled)
+                    value = static_cast<std::uint64_t>(static_cast<double>(value) *
+                                                       static_cast<double>(enabled) /
+                                                       static_cast<double>(running));
+                field(reading, slots_[i].event) = value;
+            }
+            return reading;
+        }
+#endif
+        reading.cycles = timestamp() - start_ticks_;
+        return reading;
+    }
+
+  private:
+    static constexpr size_t MAX_EVENTS = 5;
+
+    struct Slot {
+        int fd = -1;
+        HardwareEvent event = HardwareEvent::None;
+    };
+
+    Slot slots_[MAX_EVENTS];
+    size_t open_count_ = 0;
+    std::uint64_t start_ticks_ = 0;
+
+
+    static std::uint64_t& field(CounterReading& reading, const HardwareEvent event) noexcept {
+        switch (event) {
+        case HardwareEvent::Instructions:
+            return reading.instructions;
+        case HardwareEvent::BranchMisses:
+            return reading.branch_misses;
+        case HardwareEvent::L1DataMisses:
+            return reading.l1d_misses;
+        case HardwareEvent::LastLevelMisses:
+            return reading.llc_misses;
+        default:
+            return reading.cycles;
+        }
+    }
+
+    /// Time-stamp counter ticks, or steady-clock nanoseconds where there is none.
+    static std::uint64_t timestamp() noexcept {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+#endif
+    }
+
+
+#if HARDWARE_COUNTERS_PERF_EVENTS
+    void openPerfEvents(const HardwareEvent events) noexcept {
+        constexpr std::uint64_t L1D_READ_MISS = PERF_COUNT_HW_CACHE_L1D |
+                                                (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const struct {
+            HardwareEvent event;
+            std::uint32_t type;
+            std::uint64_t config;
+        } candidates[MAX_EVENTS] = {
+            {HardwareEvent::Cycles, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {HardwareEvent::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {HardwareEvent::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {HardwareEvent::L1DataMisses, PERF_TYPE_HW_CACHE, L1D_READ_MISS},
+            {HardwareEvent::LastLevelMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        };
+
+        for (const auto& candidate : candidates) {
+            if ((events & candidate.event) == HardwareEvent::None)
+                continue;
+
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = candidate.type;
+            attr.config = candidate.config;
+            attr.disabled = open_count_ == 0 ? 1 : 0; // The leader starts and stops the group.
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            const int leader = open_count_ == 0 ? -1 : slots_[0].fd;
+            const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fd >= 0)
+                slots_[open_count_++] = Slot{static_cast<int>(fd), candidate.event};
+        }
+    }
+
+    void closePerfEvents() noexcept {
+        // Members first, the leader last.
+        while (open_count_ > 0)
+            close(slots_[--open_count_].fd);
+    }
+#else
+    void openPerfEvents(HardwareEvent) noexcept {}
+    void closePerfEvents() noexcept {}
+#endif
+};
+
+
+/**
+ * @brief Runs body once between start() and stop() of fresh counters.
+ *
+ * Convenient for one-off measurements; in a loop, open the counters once
+ * and reuse them instead.
+ *
+ * @code
+ * const CounterReading reading = MeasureHardwareCounters([&] { HybridSort(array); });
+ * @endcode
+ */
+template <typename Body>
+CounterReading MeasureHardwareCounters(Body&& body, const HardwareEvent events = HardwareEvent::All) {
+    HardwareCounters counters(events);
+    counters.start();
+    std::forward<Body>(body)();
+    return counters.stop();
+}
+
+
+} // namespace array_algorithms
+
+
+#undef HARDWARE_COUNTERS_PERF_EVENTS
+
+
+#endif // HARDWARE_COUNTERS_HPP
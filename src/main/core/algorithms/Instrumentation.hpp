@@ -0,0 +1,111 @@
+/**
+ * @file Instrumentation.hpp
+ *
+ * Instrumentation policies for the sorts and searches of
+ * ArrayAlgorithms.hpp.
+ *
+ * Every instrumented algorithm takes its callback as a template parameter
+ * and invokes it for each operation: sorts as callback(code, a, b) with the
+ * event codes below, searches as callback(index) for every probed index.
+ * The policy type is therefore known at compile time, so the default,
+ * NoInstrumentation, inlines to nothing. Kernels are chosen by element type
+ * alone: an instrumented run executes the same kernel as an uninstrumented
+ * one and reports its events. CountingInstrumentation tallies the events,
+ * for profiling algorithm choice on real data without the animation hooks.
+ */
+
+
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace array_algorithms {
+
+using std::size_t;
+
+
+/// Sort event: a and b are compared.
+inline constexpr size_t SORT_EVENT_COMPARE = 0;
+/// Sort event: the elements at a and b are swapped.
+inline constexpr size_t SORT_EVENT_SWAP = 1;
+/// Sort event: the element at a is in its final place (b is ignored).
+inline constexpr size_t SORT_EVENT_MARK_SORTED = 2;
+
+
+/// Policy that ignores every event; the default of all algorithms.
+struct NoInstrumentation {
+    template <typename... Args>
+    constexpr void operator()(Args&&...) const noexcept {}
+};
+
+
+/// Satisfied by NoInstrumentation in any value category.
+template <typename Callback>
+concept Uninstrumented = std::same_as<std::remove_cvref_t<Callback>, NoInstrumentation>;
+
+
+/** @struct CountingInstrumentation
+ *
+ * @brief Policy that counts the events reported by an algorithm.
+ *
+ * Pass it by reference to keep the counts; an rvalue is counted into a
+ * temporary. Events with unknown codes are ignored.
+ *
+ * @code
+ * CountingInstrumentation counts;
+ * QuickSort(array, counts);
+ * log(counts.compares, counts.swaps, counts.moves());
+ * @endcode
+ */
+struct CountingInstrumentation {
+    size_t compares = 0;     ///< Compare events.
+    size_t swaps = 0;        ///< Swap events.
+    size_t sorted_marks = 0; ///< MarkSorted events.
+    size_t probes = 0;       ///< Indices probed by a search.
+
+
+    /// Counts one sort event.
+    constexpr void operator()(const size_t code, size_t, size_t) noexcept {
+        switch (code) {
+        case SORT_EVENT_COMPARE:
+            ++compares;
+            break;
+        case SORT_EVENT_SWAP:
+            ++swaps;
+            break;
+        case SORT_EVENT_MARK_SORTED:
+            ++sorted_marks;
+            break;
+        default:
+            break;
+        }
+    }
+
+    /// Counts one probe of a search.
+    constexpr void operator()(size_t) noexcept {
+        ++probes;
+    }
+
+
+    /// Element moves performed by the swaps, three per swap.
+    [[nodiscard]]
+    constexpr size_t moves() const noexcept {
+        return 3 * swaps;
+    }
+
+    /// Sets every counter back to zero.
+    constexpr void reset() noexcept {
+        *this = CountingInstrumentation{};
+    }
+};
+
+
+} // namespace array_algorithms
+
+
+#endif // INSTRUMENTATION_HPP
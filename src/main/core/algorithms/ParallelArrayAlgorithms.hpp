@@ -0,0 +1,460 @@
+/**
+ * @file ParallelArrayAlgorithms.hpp
+ *
+ * Multi-threaded counterparts of the QuickSort, MergeSort and RadixSortLSD
+ * routines in ArrayAlgorithms.hpp, for sorting large DynamicArrays of
+ * built-in numeric types.
+ *
+ * Every routine takes the number of threads to use (defaulting to the
+ * hardware concurrency) and sorts on the calling thread when the input is
+ * below PARALLEL_THRESHOLD elements or only one thread is requested. The
+ * work runs as tasks on a TaskScheduler: the process-wide
+ * TaskScheduler::shared() pool, or the one passed in, in which case the
+ * thread count defaults to the scheduler's. Concurrent sorts therefore share
+ * one set of threads instead of each starting its own. Unlike the serial
+ * versions these functions do not report operations through a callback: the
+ * visualizer replays serial algorithms only.
+ */
+
+
+#ifndef PARALLEL_ARRAY_ALGORITHMS_HPP
+#define PARALLEL_ARRAY_ALGORITHMS_HPP
+
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ArrayAlgorithms.hpp"
+#include "DynamicArray.hpp"
+#include "TaskScheduler.hpp"
+
+
+namespace array_algorithms {
+
+using containers::TaskScheduler;
+
+
+/// Inputs smaller than this are sorted on the calling thread.
+inline constexpr size_t PARALLEL_THRESHOLD = size_t{1} << 15;
+
+
+/// Number of threads used when none is requested (at least 1).
+inline size_t defaultThreadCount() noexcept {
+    return TaskScheduler::hardwareThreads();
+}
+
+
+namespace detail {
+
+/// Ranges shorter than this are finished by insertion sort.
+inline constexpr std::ptrdiff_t INSERTION_CUTOFF = 24;
+
+
+/// Returns [begin, end) of the given chunk when n elements are split into
+/// `chunks` nearly equal parts.
+inline std::pair<size_t, size_t> chunkBounds(const size_t n, const size_t chunks,
+                                             const size_t chunk) noexcept {
+    const size_t base = n / chunks;
+    const size_t extra = n % chunks;
+    const size_t begin = chunk * base + std::min(chunk, extra);
+    return {begin, begin + base + (chunk < extra ? 1 : 0)};
+}
+
+
+/// Stable insertion sort of [first, last).
+template <typename Type>
+void insertionSortRange(Type* first, Type* last) {
+    for (Type* it = first + 1; it < last; ++it) {
+        Type value = std::move(*it);
+        Type* hole = it;
+        while (hole > first && value < *(hole - 1)) {
+            *hole = std::move(*(hole - 1));
+            --hole;
+        }
+        *hole = std::move(value);
+    }
+}
+
+
+/**
+ * @brief Hoare partition of [first, last) (at least 3 elements) around the
+ * median of the first, middle and last elements.
+ *
+ * @return Pointer mid with first < mid < last such that every element of
+ * [first, mid) is <= every element of [mid, last).
+ */
+template <typename Type>
+Type* partitionRange(Type* first, Type* last) {
+    Type* middle = first + (last - first) / 2;
+    Type* back = last - 1;
+    if (*middle < *first)
+        swap(*middle, *first);
+    if (*back < *middle) {
+        swap(*back, *middle);
+        if (*middle < *first)
+            swap(*middle, *first);
+    }
+
+    const Type pivot = *middle;
+    std::ptrdiff_t i = -1;
+    std::ptrdiff_t j = last - first;
+    while (true) {
+        do ++i; while (first[i] < pivot);
+        do --j; while (pivot < first[j]);
+        if (i >= j)
+            return first + j + 1;
+        swap(first[i], first[j]);
+    }
+}
+
+
+/// Single-threaded quicksort of [first, last): recurses into the smaller
+/// side and finishes short ranges with insertion sort.
+template <typename Type>
+void quickSortRange(Type* first, Type* last) {
+    while (last - first > INSERTION_CUTOFF) {
+        Type* mid = partitionRange(first, last);
+        if (mid - first < last - mid) {
+            quickSortRange(first, mid);
+            first = mid;
+        } else {
+            quickSortRange(mid, last);
+            last = mid;
+        }
+    }
+    insertionSortRange(first, last);
+}
+
+
+/// Quicksort of [first, last) that sorts both partitions as parallel tasks
+/// while depth > 0 and the range is large enough.
+template <typename Type>
+void parallelQuickSortRange(TaskScheduler& scheduler, Type* first, Type* last, const int depth) {
+    if (depth <= 0 || static_cast<size_t>(last - first) < PARALLEL_THRESHOLD) {
+        quickSortRange(first, last);
+        return;
+    }
+
+    Type* mid = partitionRange(first, last);
+    scheduler.parallelInvoke([&] { parallelQuickSortRange(scheduler, mid, last, depth - 1); },
+                             [&] { parallelQuickSortRange(scheduler, first, mid, depth - 1); });
+}
+
+
+/**
+ * @brief Merge-path split: the number of elements taken from a when the
+ * first k elements of the stable merge of a and b are produced.
+ *
+ * Ties are resolved in favour of a, matching mergeRanges().
+ */
+template <typename Type>
+size_t mergePathSplit(const Type* a, const size_t na, const Type* b, const size_t nb,
+                      const size_t k) noexcept {
+    size_t lo = k > nb ? k - nb : 0;
+    size_t hi = std::min(k, na);
+    while (lo < hi) {
+        const size_t i = lo + (hi - lo) / 2;
+        const size_t j = k - i;
+        if (j > 0 && i < na && !(b[j - 1] < a[i]))
+            lo = i + 1;
+        else
+            hi = i;
+    }
+    return lo;
+}
+
+
+/// Stable merge of the sorted ranges a and b into out.
+template <typename Type>
+void mergeRanges(const Type* a, const size_t na, const Type* b, const size_t nb, Type* out) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb)
+        *out++ = b[j] < a[i] ? b[j++] : a[i++];
+    while (i < na)
+        *out++ = a[i++];
+    while (j < nb)
+        *out++ = b[j++];
+}
+
+
+/// Stable single-threaded merge sort of data[0, n) using scratch[0, n).
+template <typename Type>
+void mergeSortRange(Type* data, const size_t n, Type* scratch) {
+    if (n <= static_cast<size_t>(INSERTION_CUTOFF)) {
+        insertionSortRange(data, data + n);
+        return;
+    }
+    const size_t half = n / 2;
+    mergeSortRange(data, half, scratch);
+    mergeSortRange(data + half, n - half, scratch + half);
+    if (!(data[half] < data[half - 1]))
+        return; // halves are already in order
+    mergeRanges(data, half, data + half, n - half, scratch);
+    std::copy(scratch, scratch + n, data);
+}
+
+} // namespace detail
+
+
+/**
+ * @brief Sorts the array in ascending order with a multi-threaded quicksort.
+ *
+ * Partitions use a median-of-three Hoare scheme. After each partition of a
+ * large range both sides become parallel tasks, down to a recursion depth of
+ * log2(thread_count) + 1 (twice as many leaves as threads, to even out
+ * unbalanced splits). Below that depth, or below PARALLEL_THRESHOLD
+ * elements, ranges are sorted serially. Not stable.
+ *
+ * @par Complexity
+ * - O(n log n) average work, O(n log n / p) average time on p threads.
+ * - O(log n) stack per thread.
+ *
+ * @param array The array to sort.
+ * @param scheduler The scheduler whose threads run the sort.
+ * @param thread_count Upper bound on the number of threads (0 means
+ * scheduler.threadCount()).
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelQuickSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                       TaskScheduler& scheduler, size_t thread_count = 0) {
+    const size_t n = array.size();
+    if (n <= 1)
+        return;
+    if (thread_count == 0)
+        thread_count = scheduler.threadCount();
+
+    Type* data = array.begin();
+    if (thread_count == 1 || n < PARALLEL_THRESHOLD) {
+        detail::quickSortRange(data, data + n);
+        return;
+    }
+
+    const int depth = std::bit_width(thread_count - 1) + 1;
+    detail::parallelQuickSortRange(scheduler, data, data + n, depth);
+}
+
+
+/// ParallelQuickSort() on TaskScheduler::shared() with at most thread_count
+/// threads (0 means defaultThreadCount()).
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelQuickSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                       const size_t thread_count = defaultThreadCount()) {
+    ParallelQuickSort(array, TaskScheduler::shared(),
+                      thread_count == 0 ? defaultThreadCount() : thread_count);
+}
+
+
+/**
+ * @brief Sorts the array in ascending order with a multi-threaded, stable
+ * merge sort.
+ *
+ * The array is cut into thread_count chunks that are sorted independently.
+ * The sorted runs are then merged pairwise in log2(thread_count) rounds,
+ * ping-ponging between the array and one scratch buffer. Within each round
+ * every merge is divided among the threads by merge-path splitting, so all
+ * threads stay busy even in the final merge of two halves.
+ *
+ * @par Complexity
+ * - O(n log n) work, O(n log n / p + n log p / p) time on p threads.
+ * - O(n) additional space for the scratch buffer.
+ *
+ * @param array The array to sort.
+ * @param scheduler The scheduler whose threads run the sort.
+ * @param thread_count Number of threads (0 means scheduler.threadCount()).
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelMergeSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                       TaskScheduler& scheduler, size_t thread_count = 0) {
+    const size_t n = array.size();
+    if (n <= 1)
+        return;
+    if (thread_count == 0)
+        thread_count = scheduler.threadCount();
+
+    DynamicArray<Type, Allocator> scratch_array(n, array.getAllocator());
+    for (size_t i = 0; i < n; ++i)
+        scratch_array.addLast(Type());
+
+    Type* data = array.begin();
+    Type* scratch = scratch_array.begin();
+    if (thread_count == 1 || n < PARALLEL_THRESHOLD) {
+        detail::mergeSortRange(data, n, scratch);
+        return;
+    }
+
+    const size_t chunks = thread_count;
+    scheduler.parallelFor(0, chunks, [&](const size_t chunk) {
+        const auto [begin, end] = detail::chunkBounds(n, chunks, chunk);
+        detail::mergeSortRange(data + begin, end - begin, scratch + begin);
+    });
+
+    // Run boundaries: run r covers [bounds[r], bounds[r + 1]).
+    std::vector<size_t> bounds;
+    for (size_t chunk = 0; chunk < chunks; ++chunk)
+        bounds.push_back(detail::chunkBounds(n, chunks, chunk).first);
+    bounds.push_back(n);
+
+    Type* source = data;
+    Type* destination = scratch;
+    while (bounds.size() > 2) {
+        const size_t runs = bounds.size() - 1;
+        std::vector<size_t> merged_bounds;
+        for (size_t r = 0; r < runs; r += 2)
+            merged_bounds.push_back(bounds[r]);
+        merged_bounds.push_back(n);
+
+        // Each thread produces an equal slice of the whole round's output.
+        scheduler.parallelFor(0, thread_count, [&](const size_t task) {
+            const auto [out_begin, out_end] = detail::chunkBounds(n, thread_count, task);
+            for (size_t r = 0; r < runs; r += 2) {
+                const size_t lo = bounds[r];
+                const size_t mid = bounds[r + 1];
+                const size_t hi = r + 2 <= runs ? bounds[r + 2] : mid;
+                const size_t begin = std::max(lo, out_begin);
+                const size_t end = std::min(hi, out_end);
+                if (begin >= end)
+                    continue;
+
+                const Type* a = source + lo;
+                const Type* b = source + mid;
+                const size_t na = mid - lo;
+                const size_t nb = hi - mid;
+                const size_t ai = detail::mergePathSplit(a, na, b, nb, begin - lo);
+                const size_t aj = detail::mergePathSplit(a, na, b, nb, end - lo);
+                const size_t bi = begin - lo - ai;
+                const size_t bj = end - lo - aj;
+                detail::mergeRanges(a + ai, aj - ai, b + bi, bj - bi, destination + begin);
+            }
+        });
+
+        bounds = std::move(merged_bounds);
+        std::swap(source, destination);
+    }
+
+    if (source != data)
+        scheduler.parallelFor(0, thread_count, [&](const size_t task) {
+            const auto [begin, end] = detail::chunkBounds(n, thread_count, task);
+            std::copy(source + begin, source + end, data + begin);
+        });
+}
+
+
+/// ParallelMergeSort() on TaskScheduler::shared() with thread_count threads
+/// (0 means defaultThreadCount()).
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelMergeSort(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                       const size_t thread_count = defaultThreadCount()) {
+    ParallelMergeSort(array, TaskScheduler::shared(),
+                      thread_count == 0 ? defaultThreadCount() : thread_count);
+}
+
+
+/**
+ * @brief Sorts the array in ascending order with a multi-threaded LSD radix
+ * sort (base 256).
+ *
+ * Each pass splits the input into thread_count chunks. Every thread builds
+ * the byte histogram of its chunk; a prefix sum over (digit, thread) then
+ * gives each thread its own output offsets per digit, and the threads
+ * scatter their chunks in parallel. Chunks are scattered in order, so the
+ * sort stays stable. Key mapping (signed and floating-point values) and
+ * skipping of passes over a byte shared by all keys match RadixSortLSD().
+ *
+ * Note for float/double: Arrays containing NaN are unsupported for ordering;
+ * results are unspecified.
+ *
+ * @par Constraints
+ * - Type must be an integral type, float or double.
+ * - Uses an O(n) temporary buffer and O(256 · p) counters.
+ *
+ * @param array The array to sort.
+ * @param scheduler The scheduler whose threads run the sort.
+ * @param thread_count Number of threads (0 means scheduler.threadCount()).
+ */
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelRadixSortLSD(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                          TaskScheduler& scheduler, size_t thread_count = 0) {
+    static_assert(detail::RadixSortable<Type>,
+                  "ParallelRadixSortLSD requires an integral or IEEE floating-point Type.");
+
+    const size_t n = array.size();
+    if (thread_count == 0)
+        thread_count = scheduler.threadCount();
+    if (thread_count == 1 || n < PARALLEL_THRESHOLD) {
+        RadixSortLSD(array);
+        return;
+    }
+
+    constexpr size_t RADIX = 256;
+    constexpr size_t BYTES = sizeof(Type);
+
+    DynamicArray<Type, Allocator> temp(n, array.getAllocator());
+    for (size_t i = 0; i < n; ++i)
+        temp.addLast(Type());
+
+    // offsets[t * RADIX + d]: next output slot of digit d for thread t.
+    std::vector<size_t> offsets(thread_count * RADIX);
+    Type* source = array.begin();
+    Type* destination = temp.begin();
+
+    for (size_t pass = 0; pass < BYTES; ++pass) {
+        auto digit_of = [pass](const Type value) {
+            return static_cast<size_t>((detail::radixKey(value) >> (8 * pass)) & 0xFFu);
+        };
+
+        scheduler.parallelFor(0, thread_count, [&](const size_t task) {
+            size_t* count = offsets.data() + task * RADIX;
+            std::fill(count, count + RADIX, 0);
+            const auto [begin, end] = detail::chunkBounds(n, thread_count, task);
+            for (size_t i = begin; i < end; ++i)
+                ++count[digit_of(source[i])];
+        });
+
+        const size_t first_digit = digit_of(source[0]);
+        size_t first_digit_count = 0;
+        for (size_t t = 0; t < thread_count; ++t)
+            first_digit_count += offsets[t * RADIX + first_digit];
+        if (first_digit_count == n)
+            continue; // every key has the same byte here
+
+        size_t position = 0;
+        for (size_t d = 0; d < RADIX; ++d)
+            for (size_t t = 0; t < thread_count; ++t) {
+                const size_t count = offsets[t * RADIX + d];
+                offsets[t * RADIX + d] = position;
+                position += count;
+            }
+
+        scheduler.parallelFor(0, thread_count, [&](const size_t task) {
+            size_t* next = offsets.data() + task * RADIX;
+            const auto [begin, end] = detail::chunkBounds(n, thread_count, task);
+            for (size_t i = begin; i < end; ++i)
+                destination[next[digit_of(source[i])]++] = source[i];
+        });
+
+        std::swap(source, destination);
+    }
+
+    if (source != array.begin())
+        std::copy(source, source + n, array.begin());
+}
+
+
+/// ParallelRadixSortLSD() on TaskScheduler::shared() with thread_count
+/// threads (0 means defaultThreadCount()).
+template <typename Type, typename Allocator, size_t InlineCapacity, typename CapacityPolicy>
+void ParallelRadixSortLSD(DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>& array,
+                          const size_t thread_count = defaultThreadCount()) {
+    ParallelRadixSortLSD(array, TaskScheduler::shared(),
+                         thread_count == 0 ? defaultThreadCount() : thread_count);
+}
+
+
+} // namespace array_algorithms
+
+
+#endif // PARALLEL_ARRAY_ALGORITHMS_HPP
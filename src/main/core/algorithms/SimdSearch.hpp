@@ -0,0 +1,249 @@
+/**
+ * @file SimdSearch.hpp
+ *
+ * Search kernels over contiguous arrays of built-in numeric types, used by
+ * LinearSearch() and BinarySearch() in ArrayAlgorithms.hpp.
+ *
+ * The equality scan compares a whole vector register of elements at once:
+ * 32 bytes with AVX2, 16 bytes with SSE2 (always available on x86-64) or
+ * NEON (AArch64). The instruction set is chosen at compile time from the
+ * target macros, so building with -mavx2 or -march=native enables the
+ * wider kernel; other targets fall back to a plain loop. The lower-bound
+ * kernel is branchless and prefetches both candidates of the next step.
+ */
+
+
+#ifndef SIMD_SEARCH_HPP
+#define SIMD_SEARCH_HPP
+
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Instrumentation.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+
+namespace array_algorithms::detail {
+
+using std::size_t;
+
+
+/// Element types handled by the vectorized equality scan.
+template <typename Type>
+concept SimdSearchable =
+    std::is_arithmetic_v<Type> && !std::same_as<Type, bool> &&
+    (sizeof(Type) == 1 || sizeof(Type) == 2 || sizeof(Type) == 4 || sizeof(Type) == 8) &&
+    (!std::floating_point<Type> || std::same_as<Type, float> || std::same_as<Type, double>);
+
+
+/// Hints the CPU to fetch the cache line holding address; a no-op where the
+/// compiler offers no prefetch intrinsic.
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+
+#if defined(__AVX2__)
+
+/// Bytes compared per vector.
+inline constexpr size_t SIMD_VECTOR_BYTES = 32;
+/// Mask bits produced per compared byte.
+inline constexpr size_t SIMD_MASK_BITS_PER_BYTE = 1;
+using SimdMask = std::uint32_t;
+
+/// Bit mask of the bytes of data[0 .. 32) that belong to elements == target.
+template <SimdSearchable Type>
+SimdMask equalMask(const Type* data, const Type target) noexcept {
+    __m256i equal;
+    if constexpr (std::same_as<Type, float>) {
+        equal = _mm256_castps_si256(
+            _mm256_cmp_ps(_mm256_loadu_ps(data), _mm256_set1_ps(target), _CMP_EQ_OQ));
+    } else if constexpr (std::same_as<Type, double>) {
+        equal = _mm256_castpd_si256(
+            _mm256_cmp_pd(_mm256_loadu_pd(data), _mm256_set1_pd(target), _CMP_EQ_OQ));
+    } else {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        if constexpr (sizeof(Type) == 1)
+            equal = _mm256_cmpeq_epi8(values, _mm256_set1_epi8(static_cast<char>(target)));
+        else if constexpr (sizeof(Type) == 2)
+            equal = _mm256_cmpeq_epi16(values, _mm256_set1_epi16(static_cast<short>(target)));
+        else if constexpr (sizeof(Type) == 4)
+            equal = _mm256_cmpeq_epi32(values, _mm256_set1_epi32(static_cast<int>(target)));
+        else
+            equal = _mm256_cmpeq_epi64(values,
+                                       _mm256_set1_epi64x(static_cast<long long>(target)));
+    }
+    return static_cast<SimdMask>(_mm256_movemask_epi8(equal));
+}
+
+#elif defined(__SSE2__) || defined(_M_X64)
+
+inline constexpr size_t SIMD_VECTOR_BYTES = 16;
+inline constexpr size_t SIMD_MASK_BITS_PER_BYTE = 1;
+using SimdMask = std::uint32_t;
+
+template <SimdSearchable Type>
+SimdMask equalMask(const Type* data, const Type target) noexcept {
+    __m128i equal;
+    if constexpr (std::same_as<Type, float>) {
+        equal = _mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(data), _mm_set1_ps(target)));
+    } else if constexpr (std::same_as<Type, double>) {
+        equal = _mm_castpd_si128(_mm_cmpeq_pd(_mm_loadu_pd(data), _mm_set1_pd(target)));
+    } else {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        if constexpr (sizeof(Type) == 1) {
+            equal = _mm_cmpeq_epi8(values, _mm_set1_epi8(static_cast<char>(target)));
+        } else if constexpr (sizeof(Type) == 2) {
+            equal = _mm_cmpeq_epi16(values, _mm_set1_epi16(static_cast<short>(target)));
+        } else if constexpr (sizeof(Type) == 4) {
+            equal = _mm_cmpeq_epi32(values, _mm_set1_epi32(static_cast<int>(target)));
+        } else {
+            // SSE2 has no 64-bit compare: both 32-bit halves must match.
+            const __m128i halves =
+                _mm_cmpeq_epi32(values, _mm_set1_epi64x(static_cast<long long>(target)));
+            equal = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+    return static_cast<SimdMask>(_mm_movemask_epi8(equal));
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+inline constexpr size_t SIMD_VECTOR_BYTES = 16;
+inline constexpr size_t SIMD_MASK_BITS_PER_BYTE = 4;
+using SimdMask = std::uint64_t;
+
+template <SimdSearchable Type>
+SimdMask equalMask(const Type* data, const Type target) noexcept {
+    uint8x16_t equal;
+    if constexpr (std::same_as<Type, float>) {
+        equal = vreinterpretq_u8_u32(vceqq_f32(vld1q_f32(data), vdupq_n_f32(target)));
+    } else if constexpr (std::same_as<Type, double>) {
+        equal = vreinterpretq_u8_u64(vceqq_f64(vld1q_f64(data), vdupq_n_f64(target)));
+    } else {
+        const auto* bytes = reinterpret_cast<const std::uint8_t*>(data);
+        if constexpr (sizeof(Type) == 1)
+            equal = vceqq_u8(vld1q_u8(bytes), vdupq_n_u8(static_cast<std::uint8_t>(target)));
+        else if constexpr (sizeof(Type) == 2)
+            equal = vreinterpretq_u8_u16(
+                vceqq_u16(vreinterpretq_u16_u8(vld1q_u8(bytes)),
+                          vdupq_n_u16(static_cast<std::uint16_t>(target))));
+        else if constexpr (sizeof(Type) == 4)
+            equal = vreinterpretq_u8_u32(
+                vceqq_u32(vreinterpretq_u32_u8(vld1q_u8(bytes)),
+                          vdupq_n_u32(static_cast<std::uint32_t>(target))));
+        else
+            equal = vreinterpretq_u8_u64(
+                vceqq_u64(vreinterpretq_u64_u8(vld1q_u8(bytes)),
+                          vdupq_n_u64(static_cast<std::uint64_t>(target))));
+    }
+    // Narrow every byte to a nibble: a 64-bit mask with 4 bits per byte.
+    const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0);
+}
+
+#else
+
+/// No vector unit known: findEqual() uses the scalar loop only.
+inline constexpr size_t SIMD_VECTOR_BYTES = 0;
+
+#endif
+
+
+/**
+ * @brief Index of the first element of data[0 .. size) equal to target, or
+ * size if there is none.
+ *
+ * Four vectors are compared per iteration and their masks OR-ed, so the
+ * loop has a single, rarely taken branch per 64-128 bytes. Equality follows
+ * operator==: NaN matches nothing and -0.0 matches +0.0.
+ */
+template <SimdSearchable Type>
+size_t findEqual(const Type* data, const size_t size, const Type target) noexcept {
+    size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || \
+    (defined(__ARM_NEON) && defined(__aarch64__))
+    constexpr size_t LANES = SIMD_VECTOR_BYTES / sizeof(Type);
+    constexpr size_t BITS_PER_LANE = SIMD_MASK_BITS_PER_BYTE * sizeof(Type);
+
+    auto first_lane = [](const SimdMask mask) {
+        return static_cast<size_t>(std::countr_zero(mask)) / BITS_PER_LANE;
+    };
+
+    for (; i + 4 * LANES <= size; i += 4 * LANES) {
+        const SimdMask m0 = equalMask(data + i, target);
+        const SimdMask m1 = equalMask(data + i + LANES, target);
+        const SimdMask m2 = equalMask(data + i + 2 * LANES, target);
+        const SimdMask m3 = equalMask(data + i + 3 * LANES, target);
+        if ((m0 | m1 | m2 | m3) != 0) {
+            if (m0 != 0)
+                return i + first_lane(m0);
+            if (m1 != 0)
+                return i + LANES + first_lane(m1);
+            if (m2 != 0)
+                return i + 2 * LANES + first_lane(m2);
+            return i + 3 * LANES + first_lane(m3);
+        }
+    }
+    for (; i + LANES <= size; i += LANES)
+        if (const SimdMask mask = equalMask(data + i, target); mask != 0)
+            return i + first_lane(mask);
+#endif
+
+    for (; i < size; ++i)
+        if (data[i] == target)
+            return i;
+    return size;
+}
+
+
+/**
+ * @brief Index of the first element of the sorted data[0 .. size) that is
+ * not less than target (std::lower_bound), without data-dependent branches.
+ *
+ * Each step halves the candidate range with a conditional move instead of a
+ * branch, so there are no mispredictions. The two positions the next step
+ * can probe are prefetched, which hides part of the cache-miss latency on
+ * large arrays. Every index compared against target is passed to probe.
+ */
+template <typename Type, typename Probe = NoInstrumentation>
+size_t branchlessLowerBound(const Type* data, const size_t size, const Type& target,
+                            Probe&& probe = NoInstrumentation{}) {
+    if (size == 0)
+        return 0;
+
+    const Type* base = data;
+    size_t length = size;
+    while (length > 1) {
+        const size_t half = length / 2;
+        const size_t next_half = (length - half) / 2;
+        prefetch(base + next_half);
+        prefetch(base + half + next_half);
+        probe(static_cast<size_t>(base - data) + half);
+        base = base[half] < target ? base + half : base;
+        length -= half;
+    }
+    probe(static_cast<size_t>(base - data));
+    return static_cast<size_t>(base - data) + static_cast<size_t>(*base < target);
+}
+
+} // namespace array_algorithms::detail
+
+
+#endif // SIMD_SEARCH_HPP
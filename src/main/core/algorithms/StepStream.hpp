@@ -0,0 +1,411 @@
+/**
+ * @file StepStream.hpp
+ *
+ * Streaming, compactly encoded event logs of the instrumented sorts and
+ * searches of ArrayAlgorithms.hpp, for the animators.
+ *
+ * Recording every event of a quadratic sort before playing it back needs
+ * hundreds of millions of steps for a few thousand elements. A StepStream
+ * instead runs the algorithm on a producer thread and hands its events to
+ * the consumer through a small, fixed ring of CompactStepBlocks: the
+ * producer blocks while the ring is full, so memory stays bounded however
+ * long the run, and the first step is available as soon as the first block
+ * (or the whole run, if shorter) is complete.
+ *
+ * The producer has to be a thread rather than a coroutine: the events are
+ * raised from inside the algorithm's callback, several calls deep, where a
+ * stackless coroutine cannot suspend.
+ */
+
+
+#ifndef STEP_STREAM_HPP
+#define STEP_STREAM_HPP
+
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Instrumentation.hpp"
+
+
+namespace array_algorithms {
+
+using std::size_t;
+
+
+/// Kind of an animation step; fits the 2-bit opcode of CompactStepBlock.
+enum class StepOp : std::uint8_t {
+    Compare = 0,    ///< Indices first and second are compared.
+    Swap = 1,       ///< The elements at first and second are swapped.
+    MarkSorted = 2, ///< The element at first is in its final place.
+    Visit = 3       ///< A search probes index first.
+};
+
+
+/// One decoded step. second is 0 for MarkSorted and Visit.
+struct Step {
+    StepOp op;
+    size_t first;
+    size_t second;
+};
+
+
+/** @class CompactStepBlock
+ *
+ * @brief Fixed-capacity block of encoded steps.
+ *
+ * Opcodes are packed 2 bits each, 32 to a word; operands are 32-bit
+ * indices in a separate array: two for Compare and Swap, one for Visit.
+ * Consecutive MarkSorted events on adjacent indices (in either direction)
+ * are run-length coded as a single record holding the run's first and
+ * last index. A compare or swap takes 8.25 bytes instead of the 24 of an
+ * uncompressed step.
+ */
+class CompactStepBlock {
+  public:
+    /// Records per block.
+    static constexpr size_t CAPACITY = 4096;
+
+  private:
+    std::uint64_t ops_[CAPACITY / 32] = {};
+    std::uint32_t operands_[2 * CAPACITY] = {};
+    size_t records_ = 0;
+    size_t operand_count_ = 0;
+
+    // Decoding cursor.
+    size_t read_record_ = 0;
+    size_t read_operand_ = 0;
+    size_t run_next_ = 0;
+    bool in_run_ = false;
+
+    StepOp opAt(const size_t record) const noexcept {
+        return static_cast<StepOp>((ops_[record / 32] >> (2 * (record % 32))) & 3);
+    }
+
+    void pushOp(const StepOp op) noexcept {
+        ops_[records_ / 32] |= static_cast<std::uint64_t>(op) << (2 * (records_ % 32));
+        ++records_;
+    }
+
+  public:
+    /**
+     * @brief Appends a step, extending the last MarkSorted run if possible.
+     *
+     * @return false if the block is full and the step was not stored.
+     */
+    bool append(const StepOp op, const std::uint32_t first, const std::uint32_t second) noexcept {
+        if (op == StepOp::MarkSorted && records_ > 0 && opAt(records_ - 1) == StepOp::MarkSorted) {
+            const std::uint32_t run_first = operands_[operand_count_ - 2];
+            std::uint32_t& run_last = operands_[operand_count_ - 1];
+            const bool ascending = run_last >= run_first && run_last < std::numeric_limits<std::uint32_t>::max() &&
+                                   first == run_last + 1;
+            const bool descending = run_last <= run_first && run_last > 0 && first == run_last - 1;
+            if (ascending || descending) {
+                run_last = first;
+                return true;
+            }
+        }
+        if (records_ == CAPACITY)
+            return false;
+
+        pushOp(op);
+        operands_[operand_count_++] = first;
+        if (op != StepOp::Visit)
+            operands_[operand_count_++] = op == StepOp::MarkSorted ? first : second;
+        return true;
+    }
+
+    /// Number of records stored; a MarkSorted run counts once.
+    [[nodiscard]]
+    size_t records() const noexcept {
+        return records_;
+    }
+
+    /// Checks if nothing was appended.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return records_ == 0;
+    }
+
+    /// Empties the block and rewinds the decoding cursor.
+    void clear() noexcept {
+        for (size_t i = 0; i < (records_ + 31) / 32; ++i)
+            ops_[i] = 0;
+        records_ = 0;
+        operand_count_ = 0;
+        read_record_ = 0;
+        read_operand_ = 0;
+        in_run_ = false;
+    }
+
+    /**
+     * @brief Decodes the next step, expanding MarkSorted runs.
+     *
+     * @return false once every step has been read.
+     */
+    bool next(Step& step) noexcept {
+        if (in_run_) {
+            const std::uint32_t run_last = operands_[read_operand_ - 1];
+            step = {StepOp::MarkSorted, run_next_, 0};
+            if (run_next_ == run_last)
+                in_run_ = false;
+            else
+                run_next_ = run_last > run_next_ ? run_next_ + 1 : run_next_ - 1;
+            return true;
+        }
+        if (read_record_ == records_)
+            return false;
+
+        switch (const StepOp op = opAt(read_record_++); op) {
+        case StepOp::Compare:
+        case StepOp::Swap:
+            step = {op, operands_[read_operand_], operands_[read_operand_ + 1]};
+            read_operand_ += 2;
+            return true;
+        case StepOp::Visit:
+            step = {op, operands_[read_operand_++], 0};
+            return true;
+        case StepOp::MarkSorted:
+            run_next_ = operands_[read_operand_];
+            read_operand_ += 2;
+            in_run_ = true;
+            return next(step);
+        }
+        return false;
+    }
+};
+
+
+/** @class StepStream
+ *
+ * @brief Runs an instrumented algorithm on a producer thread and streams
+ * its steps to a single consumer.
+ *
+ * The producer is called once, on its own thread, with a StepSink&; the
+ * sink implements the instrumentation callback protocol of
+ * Instrumentation.hpp, so it can be passed directly to any sort or search:
+ *
+ * @code
+ * StepStream stream([copy = array](StepSink& sink) mutable { QuickSort(copy, sink); });
+ * Step step;
+ * while (!stream.isFinished())
+ *     if (stream.tryNext(step))
+ *         draw(step);
+ * @endcode
+ *
+ * tryNext() never blocks, so it can be called from a GUI timer. The
+ * producer blocks whenever all blocks of the ring are filled and unread.
+ * Destroying the stream early stops the producer: its next event throws an
+ * internal exception that unwinds the algorithm. Anything the algorithm
+ * works on should therefore be owned by the producer (captured by value).
+ */
+class StepStream {
+    struct Cancelled {};
+
+  public:
+    /// Default number of blocks in the ring (about 270 KB).
+    static constexpr size_t DEFAULT_BLOCKS = 8;
+
+    /// Largest index a step can carry.
+    static constexpr size_t MAX_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+
+    /** @class StepSink
+     *
+     * @brief Instrumentation callback handed to the producer.
+     */
+    class StepSink {
+        friend class StepStream;
+
+        StepStream& stream_;
+        CompactStepBlock* block_;
+
+        explicit StepSink(StepStream& stream) noexcept
+            : stream_(stream), block_(&stream.blocks_[0]) {}
+
+        void append(const StepOp op, const size_t first, const size_t second) {
+            if (stream_.cancelled_.load(std::memory_order_relaxed))
+                throw Cancelled{};
+            if (first > MAX_INDEX || second > MAX_INDEX)
+                throw std::out_of_range("Index out of range");
+            const auto a = static_cast<std::uint32_t>(first);
+            const auto b = static_cast<std::uint32_t>(second);
+            if (!block_->append(op, a, b)) {
+                block_ = stream_.publish();
+                block_->append(op, a, b);
+            }
+        }
+
+      public:
+        /// The producer holds the only sink: a copy would write through a
+        /// stale block_ once the original moves on to the next block.
+        StepSink(const StepSink&) = delete;
+        StepSink& operator=(const StepSink&) = delete;
+
+
+        /// Sort event with a code of Instrumentation.hpp; unknown codes are
+        /// ignored.
+        void operator()(const size_t code, const size_t a, const size_t b) {
+            switch (code) {
+            case SORT_EVENT_COMPARE:
+                append(StepOp::Compare, a, b);
+                break;
+            case SORT_EVENT_SWAP:
+                append(StepOp::Swap, a, b);
+                break;
+            case SORT_EVENT_MARK_SORTED:
+                append(StepOp::MarkSorted, a, 0);
+                break;
+            default:
+                break;
+            }
+        }
+
+        /// Search event: index probed.
+        void operator()(const size_t index) { append(StepOp::Visit, index, 0); }
+    };
+
+
+  private:
+    std::unique_ptr<CompactStepBlock[]> blocks_;
+    size_t block_count_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable space_available_;
+    size_t produced_ = 0;    // Blocks published by the producer.
+    size_t consumed_ = 0;    // Blocks fully read by the consumer.
+    bool done_ = false;      // The producer returned or threw.
+    std::exception_ptr error_;
+    // The stream is being destroyed. Set under mutex_, but also polled by
+    // the sink on every event.
+    std::atomic<bool> cancelled_{false};
+
+    CompactStepBlock* reading_ = nullptr; // Consumer's block; only touched by the consumer.
+    std::thread producer_;
+
+
+    /// Producer side: hands over the current block and returns the next
+    /// one to fill, waiting for the consumer to free it.
+    CompactStepBlock* publish() {
+        std::unique_lock lock(mutex_);
+        ++produced_;
+        space_available_.wait(lock, [this] {
+            return cancelled_ || produced_ - consumed_ < block_count_;
+        });
+        if (cancelled_)
+            throw Cancelled{};
+        CompactStepBlock* block = &blocks_[produced_ % block_count_];
+        block->clear();
+        return block;
+    }
+
+    template <typename Producer>
+    void run(Producer& produce) {
+        StepSink sink(*this);
+        std::exception_ptr error;
+        try {
+            produce(sink);
+        } catch (const Cancelled&) {
+            return;
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        const std::scoped_lock lock(mutex_);
+        if (!sink.block_->isEmpty())
+            ++produced_;
+        error_ = std::move(error);
+        done_ = true;
+    }
+
+  public:
+    /**
+     * @brief Starts the producer thread.
+     *
+     * @param produce Callable invoked once as produce(StepSink&).
+     * @param blocks Blocks in the ring; at least 2.
+     * @throws std::invalid_argument if blocks is less than 2.
+     */
+    template <typename Producer>
+    explicit StepStream(Producer produce, const size_t blocks = DEFAULT_BLOCKS)
+        : block_count_(blocks) {
+        if (blocks < 2)
+            throw std::invalid_argument("StepStream needs at least two blocks");
+        blocks_ = std::make_unique<CompactStepBlock[]>(blocks);
+        producer_ = std::thread([this, produce = std::move(produce)]() mutable { run(produce); });
+    }
+
+    StepStream(const StepStream&) = delete;
+    StepStream& operator=(const StepStream&) = delete;
+
+    /// Stops the producer if it is still running and waits for it.
+    ~StepStream() {
+        {
+            const std::scoped_lock lock(mutex_);
+            cancelled_ = true;
+        }
+        space_available_.notify_one();
+        producer_.join();
+    }
+
+
+    /**
+     * @brief Fetches the next step without blocking.
+     *
+     * @return false if no step is available yet, or none is left.
+     * @throws Whatever the producer threw, once every step published before
+     * the exception has been read.
+     */
+    bool tryNext(Step& step) {
+        for (;;) {
+            if (reading_ != nullptr && reading_->next(step))
+                return true;
+
+            std::unique_lock lock(mutex_);
+            if (reading_ != nullptr) {
+                reading_ = nullptr;
+                ++consumed_;
+                lock.unlock();
+                space_available_.notify_one();
+                lock.lock();
+            }
+            if (consumed_ == produced_) {
+                if (done_ && error_)
+                    std::rethrow_exception(std::exchange(error_, nullptr));
+                return false;
+            }
+            reading_ = &blocks_[consumed_ % block_count_];
+        }
+    }
+
+    /// True once the producer has finished and every step has been read.
+    [[nodiscard]]
+    bool isFinished() const {
+        const std::scoped_lock lock(mutex_);
+        return done_ && consumed_ == produced_ && !error_;
+    }
+
+    /// Number of blocks in the ring, which bounds the memory in use.
+    [[nodiscard]]
+    size_t blockCount() const noexcept {
+        return block_count_;
+    }
+};
+
+
+using StepSink = StepStream::StepSink;
+
+
+} // namespace array_algorithms
+
+
+#endif // STEP_STREAM_HPP
@@ -0,0 +1,227 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "NodePool.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/// A snapshot of an AllocationCounter.
+struct AllocationCounts {
+    size_t allocations = 0;     ///< Allocations made.
+    size_t deallocations = 0;   ///< Allocations returned.
+    size_t bytes_allocated = 0; ///< Bytes requested by all allocations.
+    size_t live_bytes = 0;      ///< Bytes allocated and not yet returned.
+    size_t peak_bytes = 0;      ///< Highest live_bytes seen.
+};
+
+
+/** @class AllocationCounter
+ *
+ * @brief Counts the allocations of one or more containers.
+ *
+ * Fed by CountingAllocator (DynamicArray, Stack, Queue and any other
+ * allocator-aware container) and by the CountingNodes node policy (the
+ * linked lists, trees and heaps), so the memory traffic of a container can
+ * be read next to its timings. HashMap counts its own bucket array
+ * rebuilds, see HashMap::rehashCount().
+ *
+ * The counters are relaxed atomics: containers on several threads may share
+ * one counter, and counts() is exact once they are done.
+ */
+class AllocationCounter {
+    std::atomic<size_t> allocations_{0};
+    std::atomic<size_t> deallocations_{0};
+    std::atomic<size_t> bytes_allocated_{0};
+    std::atomic<size_t> live_bytes_{0};
+    std::atomic<size_t> peak_bytes_{0};
+
+  public:
+    AllocationCounter() noexcept = default;
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+
+    /// Records an allocation of bytes bytes.
+    void recordAllocation(const size_t bytes) noexcept {
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        bytes_allocated_.fetch_add(bytes, std::memory_order_relaxed);
+        const size_t live = live_bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        size_t peak = peak_bytes_.load(std::memory_order_relaxed);
+        while (live > peak && !peak_bytes_.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Records that an allocation of bytes bytes was returned.
+    void recordDeallocation(const size_t bytes) noexcept {
+        deallocations_.fetch_add(1, std::memory_order_relaxed);
+        live_bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+
+    /// Returns the current counts.
+    [[nodiscard]]
+    AllocationCounts counts() const noexcept {
+        return AllocationCounts{allocations_.load(std::memory_order_relaxed),
+                                deallocations_.load(std::memory_order_relaxed),
+                                bytes_allocated_.load(std::memory_order_relaxed),
+                                live_bytes_.load(std::memory_order_relaxed),
+                                peak_bytes_.load(std::memory_order_relaxed)};
+    }
+
+    /// Starts a new measurement: zeroes the totals and lowers the peak to
+    /// the bytes still live, which keep being tracked.
+    void reset() noexcept {
+        allocations_.store(0, std::memory_order_relaxed);
+        deallocations_.store(0, std::memory_order_relaxed);
+        bytes_allocated_.store(0, std::memory_order_relaxed);
+        peak_bytes_.store(live_bytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+};
+
+
+/**
+ * @brief The process-wide counter for Tag.
+ *
+ * Default-constructed CountingAllocators and every CountingNodes container
+ * report here; give unrelated containers distinct tag types to count them
+ * apart.
+ */
+template <typename Tag = void>
+AllocationCounter& allocationCounter() noexcept {
+    static AllocationCounter counter;
+    return counter;
+}
+
+
+/** @class CountingAllocator
+ *
+ * @brief std::allocator that reports every allocation to an
+ * AllocationCounter.
+ *
+ * A default-constructed allocator reports to allocationCounter<Tag>();
+ * one constructed from a counter reports to that counter, which must
+ * outlive the containers using it. The counter travels with the contents
+ * on container copy and move assignment and on swap.
+ *
+ * @code
+ * AllocationCounter counter;
+ * DynamicArray<int, CountingAllocator<int>> array{CountingAllocator<int>(counter)};
+ * for (int i = 0; i < 1000; ++i)
+ *     array.addLast(i);
+ * log(counter.counts().allocations);
+ * @endcode
+ *
+ * @tparam Type The allocated type.
+ * @tparam Tag Selects the default counter.
+ */
+template <typename Type, typename Tag = void>
+class CountingAllocator {
+    AllocationCounter* counter_;
+
+    template <typename, typename>
+    friend class CountingAllocator;
+
+  public:
+    using value_type = Type;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /// Reports to allocationCounter<Tag>().
+    CountingAllocator() noexcept : counter_(&allocationCounter<Tag>()) {}
+
+    /// Reports to counter.
+    explicit CountingAllocator(AllocationCounter& counter) noexcept : counter_(&counter) {}
+
+    /// Rebinding copy; reports to the same counter.
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other, Tag>& other) noexcept : counter_(other.counter_) {}
+
+
+    [[nodiscard]]
+    Type* allocate(const size_t n) {
+        Type* storage = std::allocator<Type>().allocate(n);
+        counter_->recordAllocation(n * sizeof(Type));
+        return storage;
+    }
+
+    void deallocate(Type* storage, const size_t n) noexcept {
+        std::allocator<Type>().deallocate(storage, n);
+        counter_->recordDeallocation(n * sizeof(Type));
+    }
+
+
+    /// The counter this allocator reports to.
+    [[nodiscard]]
+    AllocationCounter& counter() const noexcept {
+        return *counter_;
+    }
+
+    friend bool operator==(const CountingAllocator& a, const CountingAllocator& b) noexcept {
+        return a.counter_ == b.counter_;
+    }
+};
+
+
+/** @struct CountingNodes
+ *
+ * @brief Node allocation policy that counts the nodes created and destroyed
+ * by another policy.
+ *
+ * Every node reports sizeof(Node) bytes to allocationCounter<Tag>(). With
+ * PooledNodes or ThreadPooledNodes these are hand-outs from the slabs
+ * rather than calls to the system allocator (NodePool::slabCount() has
+ * those); with HeapNodes each one is a new/delete. Since every node has to
+ * be accounted for, clear() destroys pooled nodes one by one instead of
+ * dropping the slabs in bulk.
+ *
+ * @code
+ * LinkedList<int, CountingNodes<PooledNodes<>>> list;
+ * @endcode
+ *
+ * @tparam Policy The policy that allocates the nodes. Defaults to HeapNodes.
+ * @tparam Tag Selects the counter.
+ */
+template <typename Policy = HeapNodes, typename Tag = void>
+struct CountingNodes {};
+
+
+namespace node_pool_detail {
+
+template <typename Node, typename Policy, typename Tag>
+class NodeStore<Node, CountingNodes<Policy, Tag>> : public NodeStore<Node, Policy> {
+    using Base = NodeStore<Node, Policy>;
+
+  public:
+    static constexpr bool RELEASES_IN_BULK = false;
+    static constexpr bool OWNS_NODES = Base::OWNS_NODES;
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        Node* node = Base::create(std::forward<Args>(args)...);
+        allocationCounter<Tag>().recordAllocation(sizeof(Node));
+        return node;
+    }
+
+    void destroy(Node* node) noexcept {
+        Base::destroy(node);
+        allocationCounter<Tag>().recordDeallocation(sizeof(Node));
+    }
+};
+
+} // namespace node_pool_detail
+
+} // namespace containers
+
+#endif // ALLOCATION_COUNTER_HPP
@@ -0,0 +1,930 @@
+#ifndef BPLUSTREE_HPP
+#define BPLUSTREE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "SimdSearch.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace bplus_detail {
+
+/// Bytes of keys per node: four cache lines, so the binary search inside a
+/// node touches at most four lines and the adjacent-line prefetcher helps.
+inline constexpr size_t NODE_KEY_BYTES = 256;
+
+/// Keys per node for Key: NODE_KEY_BYTES worth, but at least 8.
+template <typename Key>
+constexpr size_t defaultFanout() {
+    return std::max<size_t>(8, NODE_KEY_BYTES / sizeof(Key));
+}
+
+} // namespace bplus_detail
+
+
+/**
+ * @class BPlusTree
+ * @brief Ordered map whose nodes are sorted key arrays, for read- and
+ * scan-heavy workloads.
+ *
+ * Every node holds up to Fanout keys in a DynamicArray with inline storage,
+ * so a node is one contiguous block and a lookup costs one cache miss per
+ * level instead of one per comparison; with the default fanout a million
+ * keys fit in four levels. Inside a node the position is found with the
+ * branchless lower-bound kernel that BinarySearch uses.
+ *
+ * Values live only in the leaves, which are linked in key order, so a range
+ * scan is a sequential walk over contiguous arrays. A tree can be bulk-loaded
+ * in O(n) from sorted keys, e.g. the output of RadixSortLSD, which packs the
+ * leaves nearly full.
+ *
+ * insert() and remove() split, borrow and merge nodes on the way down, so
+ * both are single top-down passes of O(log n). They invalidate iterators;
+ * assigning through an iterator does not. Keys are ordered by operator<.
+ *
+ * @tparam Key Key type; must be copyable and ordered by operator<.
+ * @tparam Value Mapped type.
+ * @tparam Fanout Maximum number of keys per node, at least 4. The default
+ * fills NODE_KEY_BYTES (256 bytes) with keys.
+ */
+template <typename Key, typename Value, size_t Fanout = bplus_detail::defaultFanout<Key>()>
+class BPlusTree {
+    static_assert(Fanout >= 4, "A B+ tree node needs room for at least four keys.");
+
+    /// Fewest keys a leaf other than the root may hold.
+    static constexpr size_t MIN_LEAF_KEYS = Fanout / 2;
+    /// Fewest keys an inner node other than the root may hold.
+    static constexpr size_t MIN_INNER_KEYS = (Fanout - 1) / 2;
+
+    struct NodeBase {
+        DynamicArray<Key, std::allocator<Key>, Fanout> keys;
+        const bool is_leaf;
+
+        explicit NodeBase(const bool is_leaf) : is_leaf(is_leaf) {}
+    };
+
+    struct Leaf : NodeBase {
+        DynamicArray<Value, std::allocator<Value>, Fanout> values;
+        Leaf* prev = nullptr;
+        Leaf* next = nullptr;
+
+        Leaf() : NodeBase(true) {}
+    };
+
+    /// Child i holds the keys in [keys[i - 1], keys[i]).
+    struct Inner : NodeBase {
+        DynamicArray<NodeBase*, std::allocator<NodeBase*>, Fanout + 1> children;
+
+        Inner() : NodeBase(false) {}
+    };
+
+    NodeBase* root_ = nullptr;
+    Leaf* head_ = nullptr; // leftmost leaf
+    Leaf* tail_ = nullptr; // rightmost leaf
+    size_t size_ = 0;
+    size_t height_ = 0;
+
+
+    static Leaf* asLeaf(NodeBase* node) noexcept { return static_cast<Leaf*>(node); }
+    static const Leaf* asLeaf(const NodeBase* node) noexcept { return static_cast<const Leaf*>(node); }
+    static Inner* asInner(NodeBase* node) noexcept { return static_cast<Inner*>(node); }
+    static const Inner* asInner(const NodeBase* node) noexcept {
+        return static_cast<const Inner*>(node);
+    }
+
+
+    static void destroyNode(NodeBase* node) noexcept {
+        if (node->is_leaf)
+            delete asLeaf(node);
+        else
+            delete asInner(node);
+    }
+
+    /// Frees a subtree; the recursion depth is the tree height.
+    static void destroySubtree(NodeBase* node) noexcept {
+        if (!node->is_leaf)
+            for (NodeBase* child : asInner(node)->children)
+                destroySubtree(child);
+        destroyNode(node);
+    }
+
+
+    /// Position of the first key of node not less than key.
+    static size_t lowerIndex(const NodeBase* node, const Key& key) noexcept {
+        return array_algorithms::detail::branchlessLowerBound(node->keys.begin(),
+                                                              node->keys.size(), key);
+    }
+
+    /// Index of the child of inner whose key range contains key.
+    static size_t childIndex(const Inner* inner, const Key& key) noexcept {
+        const size_t i = lowerIndex(inner, key);
+        return i + static_cast<size_t>(i < inner->keys.size() && !(key < inner->keys.begin()[i]));
+    }
+
+    /// Leaf whose key range contains key.
+    const Leaf* findLeaf(const Key& key) const noexcept {
+        const NodeBase* node = root_;
+        while (!node->is_leaf) {
+            const Inner* inner = asInner(node);
+            node = inner->children.begin()[childIndex(inner, key)];
+        }
+        return asLeaf(node);
+    }
+
+
+    /// Moves elements [from, size) of source to the end of target.
+    template <typename Array, typename TargetArray>
+    static void moveTail(Array& source, const size_t from, TargetArray& target) {
+        for (size_t i = from; i < source.size(); ++i)
+            target.addLast(std::move(source.begin()[i]));
+        while (source.size() > from)
+            source.popBack();
+    }
+
+
+    /// Splits the full child i of parent in two and adds the separator.
+    void splitChild(Inner* parent, const size_t i) {
+        NodeBase* child = parent->children.begin()[i];
+
+        if (child->is_leaf) {
+            Leaf* left = asLeaf(child);
+            auto right = std::make_unique<Leaf>();
+            const size_t half = left->keys.size() / 2;
+            moveTail(left->keys, half, right->keys);
+            moveTail(left->values, half, right->values);
+
+            parent->keys.insert(right->keys.getFirst(), i);
+            parent->children.insert(right.get(), i + 1);
+
+            right->prev = left;
+            right->next = left->next;
+            if (left->next != nullptr)
+                left->next->prev = right.get();
+            else
+                tail_ = right.get();
+            left->next = right.release();
+        } else {
+            Inner* left = asInner(child);
+            auto right = std::make_unique<Inner>();
+            const size_t middle = left->keys.size() / 2;
+            moveTail(left->keys, middle + 1, right->keys);
+            moveTail(left->children, middle + 1, right->children);
+
+            parent->keys.insert(std::move(left->keys.getLast()), i);
+            left->keys.popBack();
+            parent->children.insert(right.release(), i + 1);
+        }
+    }
+
+
+    /// Merges child j + 1 of parent into child j and drops their separator.
+    void mergeChildren(Inner* parent, const size_t j) {
+        NodeBase* left = parent->children.begin()[j];
+        NodeBase* right = parent->children.begin()[j + 1];
+
+        if (left->is_leaf) {
+            Leaf* left_leaf = asLeaf(left);
+            Leaf* right_leaf = asLeaf(right);
+            moveTail(right_leaf->keys, 0, left_leaf->keys);
+            moveTail(right_leaf->values, 0, left_leaf->values);
+
+            left_leaf->next = right_leaf->next;
+            if (right_leaf->next != nullptr)
+                right_leaf->next->prev = left_leaf;
+            else
+                tail_ = left_leaf;
+        } else {
+            left->keys.addLast(std::move(parent->keys.begin()[j]));
+            moveTail(right->keys, 0, left->keys);
+            moveTail(asInner(right)->children, 0, asInner(left)->children);
+        }
+
+        parent->keys.removeAt(j);
+        parent->children.removeAt(j + 1);
+        destroyNode(right);
+    }
+
+
+    /**
+     * Gives child i of parent, which holds the minimum number of keys, one
+     * more: borrowed from a sibling that can spare one, or else by merging
+     * with a sibling.
+     *
+     * @return The index of the child that now covers child i's key range.
+     */
+    size_t fillChild(Inner* parent, const size_t i) {
+        NodeBase** children = parent->children.begin();
+        NodeBase* child = children[i];
+        const size_t min_keys = child->is_leaf ? MIN_LEAF_KEYS : MIN_INNER_KEYS;
+
+        if (i > 0 && children[i - 1]->keys.size() > min_keys) {
+            NodeBase* left = children[i - 1];
+            if (child->is_leaf) {
+                asLeaf(child)->keys.addFirst(std::move(left->keys.getLast()));
+                asLeaf(child)->values.addFirst(std::move(asLeaf(left)->values.getLast()));
+                asLeaf(left)->values.popBack();
+                parent->keys.begin()[i - 1] = child->keys.getFirst();
+            } else {
+                child->keys.addFirst(std::move(parent->keys.begin()[i - 1]));
+                asInner(child)->children.addFirst(asInner(left)->children.getLast());
+                asInner(left)->children.popBack();
+                parent->keys.begin()[i - 1] = std::move(left->keys.getLast());
+            }
+            left->keys.popBack();
+            return i;
+        }
+
+        if (i + 1 < parent->children.size() && children[i + 1]->keys.size() > min_keys) {
+            NodeBase* right = children[i + 1];
+            if (child->is_leaf) {
+                child->keys.addLast(right->keys.removeFirst());
+                asLeaf(child)->values.addLast(asLeaf(right)->values.removeFirst());
+                parent->keys.begin()[i] = right->keys.getFirst();
+            } else {
+                child->keys.addLast(std::move(parent->keys.begin()[i]));
+                asInner(child)->children.addLast(asInner(right)->children.removeFirst());
+                parent->keys.begin()[i] = right->keys.removeFirst();
+            }
+            return i;
+        }
+
+        if (i > 0) {
+            mergeChildren(parent, i - 1);
+            return i - 1;
+        }
+        mergeChildren(parent, i);
+        return i;
+    }
+
+
+    /**
+     * Builds the tree bottom-up from count entries in ascending key order.
+     *
+     * Each level is split into as few nodes as fit and the entries spread
+     * evenly over them, so every node is at least half full.
+     *
+     * @param fill Called as fill(leaf, m) to append the next m entries.
+     */
+    template <typename Fill>
+    void build(const size_t count, Fill fill) {
+        if (count == 0)
+            return;
+
+        DynamicArray<NodeBase*> level;
+        DynamicArray<const Key*> level_min; // least key below each node
+        try {
+            const size_t leaves = (count + Fanout - 1) / Fanout;
+            Leaf* previous = nullptr;
+            for (size_t k = 0; k < leaves; ++k) {
+                auto leaf = std::make_unique<Leaf>();
+                level.addLast(leaf.get());
+                Leaf* current = leaf.release();
+                fill(current, count * (k + 1) / leaves - count * k / leaves);
+
+                current->prev = previous;
+                if (previous != nullptr)
+                    previous->next = current;
+                previous = current;
+                level_min.addLast(current->keys.begin());
+            }
+            head_ = asLeaf(level.getFirst());
+            tail_ = previous;
+            height_ = 1;
+
+            while (level.size() > 1) {
+                DynamicArray<NodeBase*> parents;
+                DynamicArray<const Key*> parents_min;
+                const size_t nodes = level.size();
+                const size_t groups = (nodes + Fanout) / (Fanout + 1);
+                try {
+                    for (size_t g = 0; g < groups; ++g) {
+                        auto inner = std::make_unique<Inner>();
+                        const size_t first = nodes * g / groups;
+                        const size_t last = nodes * (g + 1) / groups;
+                        for (size_t c = first; c < last; ++c) {
+                            if (c > first)
+                                inner->keys.addLast(*level_min[c]);
+                            inner->children.addLast(level[c]);
+                        }
+                        parents_min.addLast(level_min[first]);
+                        parents.addLast(inner.release());
+                    }
+                } catch (...) {
+                    // The children are still owned by level.
+                    for (NodeBase* parent : parents) {
+                        asInner(parent)->children.clear();
+                        destroyNode(parent);
+                    }
+                    throw;
+                }
+                level = std::move(parents);
+                level_min = std::move(parents_min);
+                ++height_;
+            }
+        } catch (...) {
+            for (NodeBase* node : level)
+                destroySubtree(node);
+            head_ = tail_ = nullptr;
+            height_ = 0;
+            throw;
+        }
+
+        root_ = level.getFirst();
+        size_ = count;
+    }
+
+
+    /// Checks a subtree against the bounds [low, high) set by its ancestors
+    /// and returns its height, or 0 if an invariant is broken.
+    size_t checkedHeight(const NodeBase* node, const Key* low, const Key* high,
+                         const Leaf*& expected_leaf) const {
+        const Key* keys = node->keys.begin();
+        const size_t count = node->keys.size();
+        if (count > Fanout)
+            return 0;
+        for (size_t i = 0; i < count; ++i) {
+            if ((i > 0 && !(keys[i - 1] < keys[i])) || (low && keys[i] < *low) ||
+                (high && !(keys[i] < *high)))
+                return 0;
+        }
+
+        if (node->is_leaf) {
+            const Leaf* leaf = asLeaf(node);
+            if (leaf != expected_leaf || leaf->values.size() != count ||
+                (node != root_ && count < MIN_LEAF_KEYS))
+                return 0;
+            expected_leaf = leaf->next;
+            return 1;
+        }
+
+        const Inner* inner = asInner(node);
+        if (inner->children.size() != count + 1 ||
+            (node != root_ && count < MIN_INNER_KEYS) || count == 0)
+            return 0;
+
+        size_t height = 0;
+        for (size_t i = 0; i <= count; ++i) {
+            const size_t child_height = checkedHeight(
+                inner->children.begin()[i], i == 0 ? low : keys + i - 1,
+                i == count ? high : keys + i, expected_leaf);
+            if (child_height == 0 || (height != 0 && child_height != height))
+                return 0;
+            height = child_height;
+        }
+        return height + 1;
+    }
+
+
+  public:
+    /**
+     * @class Iterator
+     * Bidirectional iterator over the entries in key order, yielding
+     * (key, value) reference pairs like HashMap's iterators. Decrementing
+     * end() yields the last entry.
+     */
+    template <bool Const>
+    class Iterator {
+        friend class BPlusTree;
+        template <bool> friend class Iterator;
+
+        using Tree = std::conditional_t<Const, const BPlusTree, BPlusTree>;
+        using LeafPtr = std::conditional_t<Const, const Leaf*, Leaf*>;
+        using ValueRef = std::conditional_t<Const, const Value&, Value&>;
+
+        Tree* tree_ = nullptr;
+        LeafPtr leaf_ = nullptr;
+        size_t idx_ = 0;
+
+        Iterator(Tree* tree, LeafPtr leaf, const size_t idx)
+            : tree_(tree), leaf_(leaf), idx_(idx) {
+            // A position past the last key of a leaf is the next leaf's first.
+            if (leaf_ != nullptr && idx_ == leaf_->keys.size()) {
+                leaf_ = leaf_->next;
+                idx_ = 0;
+            }
+        }
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+
+        /// Proxy structure for arrow (->) operator support
+        struct Proxy {
+            std::pair<const Key&, ValueRef> pair_ref;
+            std::pair<const Key&, ValueRef>* operator->() { return &pair_ref; }
+        };
+
+        Iterator() = default;
+
+        /// Conversion from a mutable to a const iterator.
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        Iterator(const Iterator<OtherConst>& other)
+            : tree_(other.tree_), leaf_(other.leaf_), idx_(other.idx_) {}
+
+        std::pair<const Key&, ValueRef> operator*() const {
+            return {leaf_->keys.begin()[idx_], leaf_->values.begin()[idx_]};
+        }
+
+        Proxy operator->() const { return Proxy{**this}; }
+
+        /// The key of the current entry.
+        const Key& key() const { return leaf_->keys.begin()[idx_]; }
+
+        /// The value of the current entry.
+        ValueRef value() const { return leaf_->values.begin()[idx_]; }
+
+        Iterator& operator++() {
+            if (++idx_ == leaf_->keys.size()) {
+                leaf_ = leaf_->next;
+                idx_ = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        Iterator& operator--() {
+            if (leaf_ == nullptr) {
+                leaf_ = tree_->tail_;
+                idx_ = leaf_->keys.size() - 1;
+            } else if (idx_ == 0) {
+                leaf_ = leaf_->prev;
+                idx_ = leaf_->keys.size() - 1;
+            } else {
+                --idx_;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        template <bool OtherConst>
+        bool operator==(const Iterator<OtherConst>& other) const {
+            return leaf_ == other.leaf_ && idx_ == other.idx_;
+        }
+
+        template <bool OtherConst>
+        bool operator!=(const Iterator<OtherConst>& other) const {
+            return !(*this == other);
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+
+    /// A [first, last) slice of the tree, usable in range-based for loops.
+    template <typename It>
+    struct Range {
+        It first;
+        It last;
+
+        [[nodiscard]] It begin() const { return first; }
+        [[nodiscard]] It end() const { return last; }
+        [[nodiscard]] bool isEmpty() const { return first == last; }
+    };
+
+
+    /// Default constructor
+    BPlusTree() noexcept = default;
+
+    /**
+     * @brief Bulk-loads the tree from keys sorted in strictly ascending order
+     * and the values that belong to them.
+     *
+     * The leaves are filled nearly completely and the inner levels are built
+     * on top, without a single split.
+     *
+     * @throws std::invalid_argument If the keys are not strictly ascending or
+     * the two arrays differ in length.
+     *
+     * @complexity Time: O(n); Space: O(n).
+     */
+    template <typename KeyAllocator, size_t KeyInline, typename ValueAllocator, size_t ValueInline>
+    BPlusTree(const DynamicArray<Key, KeyAllocator, KeyInline>& sorted_keys,
+              const DynamicArray<Value, ValueAllocator, ValueInline>& values) {
+        if (sorted_keys.size() != values.size())
+            throw std::invalid_argument("BPlusTree: keys and values differ in length");
+        const Key* keys = sorted_keys.begin();
+        for (size_t i = 1; i < sorted_keys.size(); ++i)
+            if (!(keys[i - 1] < keys[i]))
+                throw std::invalid_argument("BPlusTree: keys are not strictly ascending");
+
+        size_t next = 0;
+        build(sorted_keys.size(), [&](Leaf* leaf, const size_t count) {
+            for (const size_t end = next + count; next < end; ++next) {
+                leaf->keys.addLast(keys[next]);
+                leaf->values.addLast(values.begin()[next]);
+            }
+        });
+    }
+
+    /// Copy constructor; the copy is bulk-loaded, so its leaves are packed.
+    BPlusTree(const BPlusTree& other) {
+        const Leaf* source = other.head_;
+        size_t idx = 0;
+        build(other.size_, [&](Leaf* leaf, size_t count) {
+            for (; count > 0; --count) {
+                if (idx == source->keys.size()) {
+                    source = source->next;
+                    idx = 0;
+                }
+                leaf->keys.addLast(source->keys.begin()[idx]);
+                leaf->values.addLast(source->values.begin()[idx]);
+                ++idx;
+            }
+        });
+    }
+
+    /// Move constructor
+    BPlusTree(BPlusTree&& other) noexcept
+        : root_(std::exchange(other.root_, nullptr)),
+          head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          height_(std::exchange(other.height_, 0)) {}
+
+    /// Copy assignment operator
+    BPlusTree& operator=(const BPlusTree& other) {
+        if (this != &other) {
+            BPlusTree copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator
+    BPlusTree& operator=(BPlusTree&& other) noexcept {
+        if (this != &other) {
+            clear();
+            root_ = std::exchange(other.root_, nullptr);
+            head_ = std::exchange(other.head_, nullptr);
+            tail_ = std::exchange(other.tail_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            height_ = std::exchange(other.height_, 0);
+        }
+        return *this;
+    }
+
+
+    /// Returns the number of entries.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the tree holds no entries.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of levels; 0 for an empty tree.
+    [[nodiscard]]
+    size_t getHeight() const noexcept {
+        return height_;
+    }
+
+    /// Returns the maximum number of keys per node.
+    [[nodiscard]]
+    static constexpr size_t fanout() noexcept {
+        return Fanout;
+    }
+
+
+    /**
+     * @brief Verify node occupancy, key order, separators, equal leaf depth
+     * and the leaf links.
+     */
+    [[nodiscard]]
+    bool isValidBPlusTree() const {
+        if (root_ == nullptr)
+            return size_ == 0 && height_ == 0 && head_ == nullptr && tail_ == nullptr;
+
+        const Leaf* expected_leaf = head_;
+        if (checkedHeight(root_, nullptr, nullptr, expected_leaf) != height_ ||
+            expected_leaf != nullptr)
+            return false;
+
+        size_t count = 0;
+        const Leaf* last = nullptr;
+        for (const Leaf* leaf = head_; leaf != nullptr; leaf = leaf->next) {
+            if (leaf->prev != last)
+                return false;
+            if (last != nullptr && !(last->keys.getLast() < leaf->keys.getFirst()))
+                return false;
+            count += leaf->keys.size();
+            last = leaf;
+        }
+        return last == tail_ && count == size_;
+    }
+
+
+    /**
+     * @brief Inserts a key-value pair, or assigns the value if the key is
+     * already present.
+     *
+     * Full nodes met on the way down are split first, so the leaf always has
+     * room and no split has to travel back up.
+     *
+     * @return true if a new entry was added, false if an existing value was
+     * assigned.
+     *
+     * @complexity Time: O(Fanout * log n); Space: O(1).
+     */
+    template <typename K, typename V>
+    bool insert(K&& key, V&& value) {
+        static_assert(std::is_constructible_v<Key, K&&>, "Key must be constructible from K");
+        static_assert(std::is_constructible_v<Value, V&&>, "Value must be constructible from V");
+
+        if (root_ == nullptr) {
+            auto leaf = std::make_unique<Leaf>();
+            leaf->keys.addLast(std::forward<K>(key));
+            leaf->values.addLast(std::forward<V>(value));
+            root_ = head_ = tail_ = leaf.release();
+            size_ = height_ = 1;
+            return true;
+        }
+
+        const Key& lookup = key;
+        if (root_->keys.size() == Fanout) {
+            auto new_root = std::make_unique<Inner>();
+            new_root->children.addLast(root_);
+            splitChild(new_root.get(), 0);
+            root_ = new_root.release();
+            ++height_;
+        }
+
+        NodeBase* node = root_;
+        while (!node->is_leaf) {
+            Inner* inner = asInner(node);
+            size_t i = childIndex(inner, lookup);
+            if (inner->children.begin()[i]->keys.size() == Fanout) {
+                splitChild(inner, i);
+                if (!(lookup < inner->keys.begin()[i]))
+                    ++i;
+            }
+            node = inner->children.begin()[i];
+        }
+
+        Leaf* leaf = asLeaf(node);
+        const size_t i = lowerIndex(leaf, lookup);
+        if (i < leaf->keys.size() && !(lookup < leaf->keys.begin()[i])) {
+            leaf->values.begin()[i] = std::forward<V>(value);
+            return false;
+        }
+
+        leaf->values.insert(std::forward<V>(value), i);
+        try {
+            leaf->keys.insert(std::forward<K>(key), i);
+        } catch (...) {
+            leaf->values.removeAt(i);
+            throw;
+        }
+        ++size_;
+        return true;
+    }
+
+
+    /**
+     * @brief Removes the entry with the given key, if present.
+     *
+     * Nodes with the minimum number of keys met on the way down first borrow
+     * a key from a sibling or are merged with it, so the removal never has to
+     * travel back up.
+     *
+     * @return true if an entry was removed.
+     *
+     * @complexity Time: O(Fanout * log n); Space: O(1).
+     */
+    bool remove(const Key& key) {
+        if (root_ == nullptr)
+            return false;
+
+        NodeBase* node = root_;
+        while (!node->is_leaf) {
+            Inner* inner = asInner(node);
+            size_t i = childIndex(inner, key);
+            const NodeBase* child = inner->children.begin()[i];
+            if (child->keys.size() <= (child->is_leaf ? MIN_LEAF_KEYS : MIN_INNER_KEYS))
+                i = fillChild(inner, i);
+
+            if (inner == root_ && inner->keys.isEmpty()) {
+                // The root's last two children were merged: drop a level.
+                root_ = inner->children.getFirst();
+                inner->children.clear();
+                destroyNode(inner);
+                --height_;
+                node = root_;
+                continue;
+            }
+            node = inner->children.begin()[i];
+        }
+
+        Leaf* leaf = asLeaf(node);
+        const size_t i = lowerIndex(leaf, key);
+        if (i == leaf->keys.size() || key < leaf->keys.begin()[i])
+            return false;
+
+        leaf->keys.removeAt(i);
+        leaf->values.removeAt(i);
+        if (--size_ == 0) {
+            destroyNode(root_);
+            root_ = head_ = tail_ = nullptr;
+            height_ = 0;
+        }
+        return true;
+    }
+
+
+    /// @brief Checks whether an entry with the given key exists.
+    [[nodiscard]]
+    bool contains(const Key& key) const {
+        return find(key) != end();
+    }
+
+
+    /// @brief Returns an iterator to the entry with the given key, or end().
+    [[nodiscard]]
+    iterator find(const Key& key) {
+        const_iterator it = std::as_const(*this).find(key);
+        return iterator(this, const_cast<Leaf*>(it.leaf_), it.idx_);
+    }
+
+    /// @copydoc find
+    [[nodiscard]]
+    const_iterator find(const Key& key) const {
+        if (root_ == nullptr)
+            return end();
+        const Leaf* leaf = findLeaf(key);
+        const size_t i = lowerIndex(leaf, key);
+        if (i == leaf->keys.size() || key < leaf->keys.begin()[i])
+            return end();
+        return const_iterator(this, leaf, i);
+    }
+
+
+    /**
+     * @brief Returns the value of the entry with the given key.
+     * @throws std::out_of_range If the key is not present.
+     */
+    Value& at(const Key& key) {
+        return const_cast<Value&>(std::as_const(*this).at(key));
+    }
+
+    /// @copydoc at
+    const Value& at(const Key& key) const {
+        const const_iterator it = find(key);
+        if (it == end())
+            throw std::out_of_range("Key not found");
+        return it.value();
+    }
+
+
+    /// @brief Returns an iterator to the first entry whose key is not less
+    /// than key.
+    [[nodiscard]]
+    iterator lowerBound(const Key& key) {
+        const_iterator it = std::as_const(*this).lowerBound(key);
+        return iterator(this, const_cast<Leaf*>(it.leaf_), it.idx_);
+    }
+
+    /// @copydoc lowerBound
+    [[nodiscard]]
+    const_iterator lowerBound(const Key& key) const {
+        if (root_ == nullptr)
+            return end();
+        const Leaf* leaf = findLeaf(key);
+        return const_iterator(this, leaf, lowerIndex(leaf, key));
+    }
+
+
+    /// @brief Returns an iterator to the first entry whose key is greater
+    /// than key.
+    [[nodiscard]]
+    iterator upperBound(const Key& key) {
+        const_iterator it = std::as_const(*this).upperBound(key);
+        return iterator(this, const_cast<Leaf*>(it.leaf_), it.idx_);
+    }
+
+    /// @copydoc upperBound
+    [[nodiscard]]
+    const_iterator upperBound(const Key& key) const {
+        const_iterator it = lowerBound(key);
+        if (it != end() && !(key < it.key()))
+            ++it;
+        return it;
+    }
+
+
+    /**
+     * @brief The entries whose keys lie in the half-open interval
+     * [low, high), empty when high is not greater than low.
+     */
+    [[nodiscard]]
+    Range<iterator> range(const Key& low, const Key& high) {
+        if (!(low < high))
+            return {end(), end()};
+        return {lowerBound(low), lowerBound(high)};
+    }
+
+    /// @copydoc range
+    [[nodiscard]]
+    Range<const_iterator> range(const Key& low, const Key& high) const {
+        if (!(low < high))
+            return {end(), end()};
+        return {lowerBound(low), lowerBound(high)};
+    }
+
+
+    /**
+     * @brief Calls visit(key, value) for every entry with a key in
+     * [low, high), in key order.
+     *
+     * The tight loop over each leaf's arrays makes this the fastest way to
+     * aggregate over a key range.
+     *
+     * @return The number of entries visited.
+     * @complexity Time: O(log n + k) for k entries visited.
+     */
+    template <typename Visitor>
+    size_t scan(const Key& low, const Key& high, Visitor visit) const {
+        if (root_ == nullptr || !(low < high))
+            return 0;
+
+        const Leaf* leaf = findLeaf(low);
+        size_t i = lowerIndex(leaf, low);
+        size_t visited = 0;
+        for (; leaf != nullptr; leaf = leaf->next, i = 0) {
+            const Key* keys = leaf->keys.begin();
+            const Value* values = leaf->values.begin();
+            const size_t count = leaf->keys.size();
+            for (; i < count; ++i) {
+                if (!(keys[i] < high))
+                    return visited;
+                visit(keys[i], values[i]);
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+
+    [[nodiscard]]
+    iterator begin() noexcept {
+        return iterator(this, head_, 0);
+    }
+
+    [[nodiscard]]
+    const_iterator begin() const noexcept {
+        return const_iterator(this, head_, 0);
+    }
+
+    [[nodiscard]]
+    iterator end() noexcept {
+        return iterator(this, nullptr, 0);
+    }
+
+    [[nodiscard]]
+    const_iterator end() const noexcept {
+        return const_iterator(this, nullptr, 0);
+    }
+
+
+    /// Removes every entry and frees all nodes.
+    void clear() noexcept {
+        if (root_ != nullptr)
+            destroySubtree(root_);
+        root_ = head_ = tail_ = nullptr;
+        size_ = height_ = 0;
+    }
+
+
+    ~BPlusTree() noexcept { clear(); }
+};
+
+} // namespace containers
+
+#endif // BPLUSTREE_HPP
@@ -19,102 +19,99 @@ using std::size_t;
  * @class BinarySearchTree
  * @brief Unbalanced binary search tree storing elements of type `Type`.
  *
+ * Sorted insertion order degrades it into a linked list; RedBlackTree is the
+ * balanced alternative with guaranteed O(log n) operations.
+ *
  * Each node has up to two children. The BST invariant is strict ordering:
  * for every node N, all values in N->left are < N->data and all values in
  * N->right are > N->data. Equal values are ignored (no duplicate insert).
  *
  * @tparam Type Element type.
+ * @tparam NodePolicy Where nodes are allocated, see BinaryTree.
  */
-template <typename Type>
-class BinarySearchTree : private BinaryTree<Type> {
+template <typename Type, typename NodePolicy = HeapNodes>
+class BinarySearchTree : private BinaryTree<Type, NodePolicy> {
 
     /**
-     * Recursively inserts an element into a binary search tree.
+     * Inserts an element into the binary search tree without recursion.
      *
-     * Traverses from `node` to find the proper spot: values less than go left,
-     * greater go right. Equal values are ignored (no duplicate insert). If
-     * `node` is null, creates a new node and links its parent.
+     * Descends from the root to find the proper spot: values less than go
+     * left, greater go right. Equal values are ignored (no duplicate insert).
+     * The new node is linked below the last node visited.
      *
      * @tparam U  Value type constructible into `Type`.
-     * @param node    Reference to the current child pointer being examined.
      * @param element Value to insert.
-     * @param parent  Parent of the current node (used when creating a child).
      *
      * @complexity Time: O(h) where h is the tree height (avg ~ O(log n), worst
-     * O(n)); Space: O(h) recursion depth.
+     * O(n)); Space: O(1).
      */
     template <typename U>
-    void recursiveInsert(Node<Type>*& node, U&& element,
-                         Node<Type>* parent = nullptr) {
+    void insertNode(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
 
-        if (node == nullptr) {
-            node = new Node<Type>(std::forward<U>(element));
-            node->parent = parent;
-            ++this->size_;
-            return;
+        Node<Type>* parent = nullptr;
+        Node<Type>** link = &this->root_;
+        while (*link != nullptr) {
+            parent = *link;
+            if (element < parent->data)
+                link = &parent->left;
+            else if (element > parent->data)
+                link = &parent->right;
+            else
+                return;
         }
 
-        if (element < node->data)
-            recursiveInsert(node->left, std::forward<U>(element), node);
-        else if (element > node->data)
-            recursiveInsert(node->right, std::forward<U>(element), node);
+        *link = this->nodes_.create(std::forward<U>(element));
+        (*link)->parent = parent;
+        ++this->size_;
     }
 
 
     /**
-     * Recursively removes an element from a BST.
+     * Removes an element from the BST without recursion.
      *
      * Cases:
-     * - Leaf: delete node.
-     * - One child: splice child up, fix parent pointer.
-     * - Two children: replace with in-order successor (min of right subtree),
-     *   then erase that successor from the right subtree.
+     * - Two children: swap the value with the in-order successor (min of
+     *   right subtree), which has no left child, and unlink that node instead.
+     * - At most one child: splice the child up and fix its parent pointer.
      *
-     * @param node    Reference to the current child pointer being examined.
      * @param element Value to remove.
      *
-     * @complexity Time: O(h) (avg ~ O(log n), worst O(n)); Space: O(h)
-     * recursion.
+     * @complexity Time: O(h) (avg ~ O(log n), worst O(n)); Space: O(1).
      */
-    void recursiveRemove(Node<Type>*& node, const Type& element) {
+    void removeNode(const Type& element) {
+        Node<Type>* node = this->root_;
+        while (node != nullptr) {
+            if (element < node->data)
+                node = node->left;
+            else if (element > node->data)
+                node = node->right;
+            else
+                break;
+        }
         if (node == nullptr)
             return;
 
-        if (element < node->data) {
-            recursiveRemove(node->left, element);
-        } else if (element > node->data) {
-            recursiveRemove(node->right, element);
-        } else {
-            if (node->left == nullptr && node->right == nullptr) {
-                --this->size_;
-                delete node;
-                node = nullptr;
-            } else if (node->left == nullptr) {
-                --this->size_;
-                Node<Type>* temp = node;
-                node = node->right;
-                if (node)
-                    node->parent = temp->parent;
-                temp->left = nullptr;
-                temp->right = nullptr;
-                delete temp;
-            } else if (node->right == nullptr) {
-                --this->size_;
-                Node<Type>* temp = node;
-                node = node->left;
-                if (node)
-                    node->parent = temp->parent;
-                temp->left = nullptr;
-                temp->right = nullptr;
-                delete temp;
-            } else {
-                Node<Type>* temp = findMinNode(node->right);
-                std::swap(node->data, temp->data);
-                recursiveRemove(node->right, temp->data);
-            }
+        if (node->left != nullptr && node->right != nullptr) {
+            Node<Type>* successor = findMinNode(node->right);
+            std::swap(node->data, successor->data);
+            node = successor;
         }
+
+        Node<Type>* child = node->left != nullptr ? node->left : node->right;
+        if (child != nullptr)
+            child->parent = node->parent;
+
+        if (node->parent == nullptr)
+            this->root_ = child;
+        else if (node == node->parent->left)
+            node->parent->left = child;
+        else
+            node->parent->right = child;
+
+        this->nodes_.destroy(node);
+        --this->size_;
     }
 
 
@@ -218,37 +215,25 @@ class BinarySearchTree : private BinaryTree<Type> {
     }
 
 
-    /// Checks if the binary tree is a valid BST.
-    bool isValidBSTHelper(Node<Type>* node, const Type* minVal = nullptr,
-                          const Type* maxVal = nullptr) const {
-        if (node == nullptr)
-            return true;
-
-        if ((minVal && !(*minVal < node->data)) ||
-            (maxVal && !(node->data < *maxVal)))
-            return false;
-
-        return isValidBSTHelper(node->left, minVal, &node->data) &&
-               isValidBSTHelper(node->right, &node->data, maxVal);
-    }
-
-
   public:
     /// Expose base class methods that are still valid for BSTs.
-    using BinaryTree<Type>::isEmpty;
-    using BinaryTree<Type>::size;
-    using BinaryTree<Type>::getRoot;
-    using BinaryTree<Type>::getHeight;
-    using BinaryTree<Type>::clear;
-    using BinaryTree<Type>::levelOrder;
+    using BinaryTree<Type, NodePolicy>::isEmpty;
+    using BinaryTree<Type, NodePolicy>::size;
+    using BinaryTree<Type, NodePolicy>::getRoot;
+    using BinaryTree<Type, NodePolicy>::getHeight;
+    using BinaryTree<Type, NodePolicy>::clear;
+    using BinaryTree<Type, NodePolicy>::preOrder;
+    using BinaryTree<Type, NodePolicy>::inOrder;
+    using BinaryTree<Type, NodePolicy>::postOrder;
+    using BinaryTree<Type, NodePolicy>::levelOrder;
 
 
     /// Default constructor
-    BinarySearchTree() noexcept : BinaryTree<Type>() {}
+    BinarySearchTree() noexcept : BinaryTree<Type, NodePolicy>() {}
 
     /// Constructor for braced-init-lists
     BinarySearchTree(std::initializer_list<Type> initial_data)
-        : BinaryTree<Type>() {
+        : BinaryTree<Type, NodePolicy>() {
         for (const Type& element : initial_data)
             this->insert(element);
     }
@@ -266,27 +251,27 @@ class BinarySearchTree : private BinaryTree<Type> {
      * @param size The number of elements in the array.
      */
     BinarySearchTree(const Type* array, const size_t size)
-        : BinaryTree<Type>() {
+        : BinaryTree<Type, NodePolicy>() {
         for (size_t i = 0; i < size; ++i)
             this->insert(array[i]);
     }
 
     /// Copy constructor
-    BinarySearchTree(const BinarySearchTree& other) : BinaryTree<Type>(other) {}
+    BinarySearchTree(const BinarySearchTree& other) : BinaryTree<Type, NodePolicy>(other) {}
 
     /// Move constructor
     BinarySearchTree(BinarySearchTree&& other) noexcept
-        : BinaryTree<Type>(std::move(other)) {}
+        : BinaryTree<Type, NodePolicy>(std::move(other)) {}
 
     /// Copy assignment operator
     BinarySearchTree& operator=(const BinarySearchTree& other) {
-        BinaryTree<Type>::operator=(other);
+        BinaryTree<Type, NodePolicy>::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
     BinarySearchTree& operator=(BinarySearchTree&& other) noexcept {
-        BinaryTree<Type>::operator=(std::move(other));
+        BinaryTree<Type, NodePolicy>::operator=(std::move(other));
         return *this;
     }
 
@@ -300,14 +285,30 @@ class BinarySearchTree : private BinaryTree<Type> {
      */
     [[nodiscard]]
     bool isValidBST() const {
-        return isValidBSTHelper(this->root_);
+        // In-order walk along the parent pointers: O(1) space even for a
+        // degenerate tree, checking that each value exceeds its predecessor.
+        const Node<Type>* previous = nullptr;
+        for (const Node<Type>* node = findMinNode(this->root_); node != nullptr;) {
+            if (previous != nullptr && !(previous->data < node->data))
+                return false;
+            previous = node;
+
+            if (node->right != nullptr) {
+                node = findMinNode(node->right);
+            } else {
+                while (node->parent != nullptr && node == node->parent->right)
+                    node = node->parent;
+                node = node->parent;
+            }
+        }
+        return true;
     }
 
 
     /**
      * @brief Insert a value while maintaining the BST invariant.
      *
-     * Recursively descends from the root: values less than the current node go
+     * Descends iteratively from the root: values less than the current node go
      * left, greater values go right. Equal values are ignored (no duplicate
      * insert). If the tree is empty, the new node becomes the root.
      *
@@ -319,7 +320,7 @@ class BinarySearchTree : private BinaryTree<Type> {
      */
     template <typename U>
     void insert(U&& element) {
-        recursiveInsert(this->root_, std::forward<U>(element));
+        insertNode(std::forward<U>(element));
     }
 
 
@@ -334,7 +335,7 @@ class BinarySearchTree : private BinaryTree<Type> {
      *
      * @param element  The value to erase (if present).
      */
-    void remove(const Type& element) { recursiveRemove(this->root_, element); }
+    void remove(const Type& element) { removeNode(element); }
 
 
     /**
@@ -2,13 +2,17 @@
 #define BINARYTREE_HPP
 
 
+#include <bit>
 #include <cassert>
+#include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <memory>
 
+#include "NodePool.hpp"
 #include "Queue.hpp"
 
 
@@ -23,6 +27,7 @@ using std::size_t;
  *
  * Each node contains data of type `Type`, pointers to its parent, left child,
  * and right child. The `Node` class is templated to allow for any data type.
+ * A node does not own its children; the tree that holds it tears it down.
  * The constructor allows for constructing a node with any type `U` that is
  * constructible from `Type`, while preventing direct instantiation of `Node`
  * with `Node` itself.
@@ -42,11 +47,6 @@ struct Node {
     explicit Node(U&& data)
         : data(std::forward<U>(data)), parent(nullptr), left(nullptr), right(nullptr) {}
 
-    ~Node() {
-        delete left;
-        delete right;
-    }
-
     Node(const Node&) = delete;
     Node& operator=(const Node&) = delete;
 
@@ -55,150 +55,360 @@ struct Node {
 };
 
 
+/// Depth-first visiting orders walked by `DepthFirstIterator`.
+enum class TraversalOrder { PreOrder, InOrder, PostOrder };
+
+
 /**
- * @class BinaryTree
- * @brief A generic binary tree storing elements of type `Type`.
+ * @class DepthFirstIterator
+ * @brief Lazy pre-, in- or post-order walk over a tree of `Node`s.
  *
- * @tparam Type Element type stored by the tree.
+ * Steps from node to node along the parent pointers, so it holds a single
+ * pointer, allocates nothing and yields references to the stored values.
+ * Each step is amortized O(1); a whole walk touches every edge twice.
+ *
+ * @tparam Type Element type stored in the nodes.
+ * @tparam Order Visiting order.
  */
-template <typename Type>
-class BinaryTree {
+template <typename Type, TraversalOrder Order>
+class DepthFirstIterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
 
-  protected:
-    Node<Type>* root_ = nullptr;
-    size_t size_ = 0;
+    /// The past-the-end iterator.
+    DepthFirstIterator() noexcept = default;
 
+    /// Positions the iterator on the first node of the subtree at `root`.
+    explicit DepthFirstIterator(const Node<Type>* root) noexcept : current_(first(root)) {}
 
-    /**
-     * Recursively copies a subtree rooted at `otherNode`, creating new nodes
-     * with the same data and structure. The `parent` parameter is used to set
-     * the parent pointer of the newly created node.
-     *
-     * @param otherNode Pointer to the root of the subtree to copy.
-     * @param parent Pointer to the parent node for the new subtree (default nullptr).
-     * @return Pointer to the root of the newly copied subtree.
-     */
-    Node<Type>* recursiveCopyNode(const Node<Type>* otherNode,
-                                  Node<Type>* parent = nullptr) {
-        if (otherNode == nullptr)
+    reference operator*() const noexcept { return current_->data; }
+    pointer operator->() const noexcept { return &current_->data; }
+
+    /// The node under the iterator, nullptr past the end.
+    [[nodiscard]] const Node<Type>* node() const noexcept { return current_; }
+
+    DepthFirstIterator& operator++() noexcept {
+        current_ = next(current_);
+        return *this;
+    }
+
+    DepthFirstIterator operator++(int) noexcept {
+        DepthFirstIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    bool operator==(const DepthFirstIterator&) const noexcept = default;
+
+  private:
+    const Node<Type>* current_ = nullptr;
+
+    static const Node<Type>* leftmost(const Node<Type>* node) noexcept {
+        while (node->left != nullptr)
+            node = node->left;
+        return node;
+    }
+
+    /// The first leaf reached preferring left children, i.e. the post-order start.
+    static const Node<Type>* firstLeaf(const Node<Type>* node) noexcept {
+        while (true) {
+            if (node->left != nullptr)
+                node = node->left;
+            else if (node->right != nullptr)
+                node = node->right;
+            else
+                return node;
+        }
+    }
+
+    static const Node<Type>* first(const Node<Type>* root) noexcept {
+        if (root == nullptr)
             return nullptr;
+        if constexpr (Order == TraversalOrder::PreOrder)
+            return root;
+        else if constexpr (Order == TraversalOrder::InOrder)
+            return leftmost(root);
+        else
+            return firstLeaf(root);
+    }
 
-        std::unique_ptr<Node<Type>> newNode(new Node<Type>(otherNode->data));
-        newNode->parent = parent;
+    static const Node<Type>* next(const Node<Type>* node) noexcept {
+        if constexpr (Order == TraversalOrder::PreOrder) {
+            if (node->left != nullptr)
+                return node->left;
+            if (node->right != nullptr)
+                return node->right;
+            // Climb to the nearest ancestor with an unvisited right subtree.
+            for (const Node<Type>* parent = node->parent; parent != nullptr;
+                 node = parent, parent = parent->parent) {
+                if (node == parent->left && parent->right != nullptr)
+                    return parent->right;
+            }
+            return nullptr;
+        } else if constexpr (Order == TraversalOrder::InOrder) {
+            if (node->right != nullptr)
+                return leftmost(node->right);
+            const Node<Type>* parent = node->parent;
+            while (parent != nullptr && node == parent->right) {
+                node = parent;
+                parent = parent->parent;
+            }
+            return parent;
+        } else {
+            const Node<Type>* parent = node->parent;
+            if (parent != nullptr && node == parent->left && parent->right != nullptr)
+                return firstLeaf(parent->right);
+            return parent;
+        }
+    }
+};
 
-        newNode->left = recursiveCopyNode(otherNode->left, newNode.get());
-        newNode->right = recursiveCopyNode(otherNode->right, newNode.get());
 
-        return newNode.release();
+/**
+ * @class LevelOrderIterator
+ * @brief Lazy breadth-first walk over a tree of `Node`s.
+ *
+ * Keeps the pending frontier as node pointers, at most about one level of the
+ * tree, and yields references to the stored values. Compares equal to
+ * `std::default_sentinel` once the walk is over.
+ *
+ * @tparam Type Element type stored in the nodes.
+ */
+template <typename Type>
+class LevelOrderIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Type*;
+    using reference = const Type&;
+
+    /// Positions the iterator on `root`.
+    explicit LevelOrderIterator(const Node<Type>* root) {
+        if (root != nullptr)
+            frontier_.enqueue(root);
     }
 
+    reference operator*() const { return frontier_.front()->data; }
+    pointer operator->() const { return &frontier_.front()->data; }
 
-    /**
-     * Recursively copies all elements from another binary tree into the current
-     * tree.
-     *
-     * @param other The binary tree whose elements are to be copied into the
-     * current tree.
-     */
-    void recursiveCopy(const BinaryTree& other) {
-        root_ = recursiveCopyNode(other.root_);
+    LevelOrderIterator& operator++() {
+        const Node<Type>* node = frontier_.front();
+        frontier_.dequeue();
+        if (node->left != nullptr)
+            frontier_.enqueue(node->left);
+        if (node->right != nullptr)
+            frontier_.enqueue(node->right);
+        return *this;
+    }
+
+    void operator++(int) { ++*this; }
+
+    bool operator==(std::default_sentinel_t) const noexcept {
+        return frontier_.isEmpty();
     }
 
+  private:
+    Queue<const Node<Type>*> frontier_;
+};
+
+
+/**
+ * @class TreeTraversal
+ * @brief Range over one traversal of a tree, as returned by
+ * `BinaryTree::preOrder()` and friends.
+ *
+ * Only remembers the root; every `begin()` starts a fresh walk. The view is
+ * invalidated by any change to the tree's shape.
+ */
+template <typename Type, typename Iterator, typename Sentinel = Iterator>
+class TreeTraversal {
+  public:
+    explicit TreeTraversal(const Node<Type>* root) noexcept : root_(root) {}
+
+    [[nodiscard]] Iterator begin() const { return Iterator(root_); }
+    [[nodiscard]] Sentinel end() const noexcept { return Sentinel{}; }
+    [[nodiscard]] bool isEmpty() const noexcept { return root_ == nullptr; }
+
+  private:
+    const Node<Type>* root_;
+};
+
+
+/**
+ * @class BinaryTree
+ * @brief A generic binary tree storing elements of type `Type`.
+ *
+ * @tparam Type Element type stored by the tree.
+ * @tparam NodePolicy Where nodes are allocated: HeapNodes (default),
+ * PooledNodes<N> or ThreadPooledNodes<N>, see NodePool.hpp.
+ */
+template <typename Type, typename NodePolicy = HeapNodes>
+class BinaryTree {
+
+  protected:
+    Node<Type>* root_ = nullptr;
+    size_t size_ = 0;
+    /// True while the nodes fill level-order positions 1..size_ with no gaps,
+    /// which lets `insert` find the next free position by index.
+    bool complete_ = true;
+    [[no_unique_address]] node_pool_detail::NodeStore<Node<Type>, NodePolicy> nodes_;
+
 
     /**
-     * Recursively calculates the height of the binary tree.
+     * Destroys every node of the subtree rooted at `node` without recursion.
+     *
+     * Each left child is rotated above its parent on the way down, so the
+     * subtree unrolls into a right spine that is freed node by node. Needs
+     * O(1) extra space however degenerate the tree is.
      *
-     * @param node Pointer to the current node being visited.
-     * @return Height using the convention: empty subtree => 0; leaf => 1.
+     * @param node Root of the subtree; it must already be unlinked.
+     *
+     * @complexity Time: O(n); Space: O(1).
      */
-    size_t recursiveHeight(Node<Type>* node) const {
-        if (node == nullptr)
-            return 0;
-
-        const size_t leftHeight = recursiveHeight(node->left);
-        const size_t rightHeight = recursiveHeight(node->right);
-        return 1 + (leftHeight > rightHeight ? leftHeight : rightHeight);
+    void destroySubtree(Node<Type>* node) noexcept {
+        while (node != nullptr) {
+            if (Node<Type>* left = node->left; left != nullptr) {
+                node->left = left->right;
+                left->right = node;
+                node = left;
+            } else {
+                Node<Type>* right = node->right;
+                nodes_.destroy(node);
+                node = right;
+            }
+        }
     }
 
 
     /**
-     * Recursively checks if a binary tree contains a node with a specific
-     * value.
+     * Copies the subtree rooted at `otherNode`, creating new nodes with the
+     * same data and structure.
      *
-     * @param node Pointer to the current node being visited in the recursive
-     * process.
-     * @param value The value to search for in the binary tree.
-     * @return True if the value is found in the binary tree, false otherwise.
+     * The source is walked in pre-order along its parent pointers while the
+     * copy is built in lockstep, so the depth of the tree costs no stack.
+     *
+     * @param otherNode Pointer to the root of the subtree to copy.
+     * @return Pointer to the root of the newly copied subtree.
+     *
+     * @complexity Time: O(n); Space: O(1) besides the new nodes.
      */
-    bool recursiveContainsNode(const Node<Type>* node,
-                               const Type& value) const {
-        if (node == nullptr)
-            return false;
-
-        if (node->data == value)
-            return true;
+    Node<Type>* copySubtree(const Node<Type>* otherNode) {
+        if (otherNode == nullptr)
+            return nullptr;
 
-        return recursiveContainsNode(node->left, value) ||
-               recursiveContainsNode(node->right, value);
+        Node<Type>* copyRoot = nodes_.create(otherNode->data);
+        const Node<Type>* source = otherNode;
+        Node<Type>* target = copyRoot;
+
+        try {
+            while (true) {
+                if (source->left != nullptr) {
+                    target->left = nodes_.create(source->left->data);
+                    target->left->parent = target;
+                    source = source->left;
+                    target = target->left;
+                    continue;
+                }
+
+                // Climb to the nearest ancestor whose right subtree is still
+                // to be copied (it may be `source` itself).
+                while (source->right == nullptr) {
+                    while (source != otherNode && source == source->parent->right) {
+                        source = source->parent;
+                        target = target->parent;
+                    }
+                    if (source == otherNode)
+                        return copyRoot;
+                    source = source->parent;
+                    target = target->parent;
+                }
+
+                target->right = nodes_.create(source->right->data);
+                target->right->parent = target;
+                source = source->right;
+                target = target->right;
+            }
+        } catch (...) {
+            destroySubtree(copyRoot);
+            throw;
+        }
     }
 
 
     /**
-     * Recursively searches for a node with a specific value in the binary tree.
+     * @brief Find a node by its 1-based level-order index, assuming the tree
+     * is complete.
      *
-     * @param node Pointer to the current node being visited in the recursive
-     * process.
-     * @param value The value to search for in the binary tree.
-     * @return A pointer to the node containing the value, or nullptr if not
-     * found.
+     * Interprets `index` in binary, skips the most-significant bit (the root),
+     * then walks remaining bits high→low: bit 0 = go left, bit 1 = go right.
+     *
+     * @param idx 1-based index (1 = root).
+     * @return Pointer to the node at that index, or nullptr if the path is
+     * invalid.
+     *
+     * @complexity Time: O(log n); Space: O(1).
      */
-    const Node<Type>* recursiveFindNode(const Node<Type>* node,
-                                        const Type& value) const {
-        if (node == nullptr)
+    Node<Type>* findNodeByPath(const size_t idx) const noexcept {
+        if (isEmpty() || idx == 0)
             return nullptr;
 
-        if (node->data == value)
-            return node;
-
-        if (const Node<Type>* leftResult = recursiveFindNode(node->left, value);
-            leftResult != nullptr)
-            return leftResult;
-
-        return recursiveFindNode(node->right, value);
+        Node<Type>* current = root_;
+        for (size_t bit = std::bit_floor(idx) >> 1; bit != 0 && current != nullptr; bit >>= 1)
+            current = (idx & bit) ? current->right : current->left;
+        return current;
     }
 
 
     /**
-     * Performs a level-order traversal and returns node values in BFS order.
-     *
-     * @return A `Queue<Type>` containing a snapshot of the tree's values from
-     *         the current root, level by level, left-to-right.
+     * Appends a node at the end of the leftmost or rightmost chain; shared by
+     * `insertLeft` and `insertRight`.
      *
-     * @note The returned queue is a copy of values, not a live view.
+     * The new node lands at level-order index 2^d or 2^(d+1) - 1 for depth d,
+     * so the tree stays complete only if that index is exactly size().
      */
-    Queue<Type> levelOrder() const {
-        if (isEmpty())
-            return Queue<Type>{};
+    template <typename U>
+    void insertAtEdge(U&& element, const bool rightmost) {
+        if (isEmpty()) {
+            root_ = nodes_.create(std::forward<U>(element));
+            size_++;
+            complete_ = true;
+            return;
+        }
 
-        Queue<Node<Type>*> queue;
-        queue.enqueue(root_);
-        Queue<Type> result;
+        Node<Type>* current = root_;
+        size_t index = 1;
+        while ((rightmost ? current->right : current->left) != nullptr) {
+            current = rightmost ? current->right : current->left;
+            if (index <= size_)
+                index = 2 * index + rightmost;
+        }
 
-        while (!queue.isEmpty()) {
-            Node<Type>* current = queue.front();
-            queue.dequeue();
-            result.enqueue(current->data);
+        attach(current, nodes_.create(std::forward<U>(element)), rightmost);
+        if (index <= size_)
+            index = 2 * index + rightmost;
+        complete_ = complete_ && index == size_;
+    }
 
-            if (current->left != nullptr)
-                queue.enqueue(current->left);
-            if (current->right != nullptr)
-                queue.enqueue(current->right);
-        }
-        return result;
+
+    /// Links `node` as the left (`asRight` false) or right child of `parent`.
+    void attach(Node<Type>* parent, Node<Type>* node, const bool asRight) noexcept {
+        node->parent = parent;
+        (asRight ? parent->right : parent->left) = node;
+        size_++;
     }
 
 
   public:
+    using PreOrderIterator = DepthFirstIterator<Type, TraversalOrder::PreOrder>;
+    using InOrderIterator = DepthFirstIterator<Type, TraversalOrder::InOrder>;
+    using PostOrderIterator = DepthFirstIterator<Type, TraversalOrder::PostOrder>;
+
+
     /// Default constructor
     BinaryTree() noexcept : root_() {}
 
@@ -222,16 +432,19 @@ class BinaryTree {
             this->insert(array[i]);
     }
 
-    /// Copy constructor
-    BinaryTree(const BinaryTree& other) : root_(), size_(other.size_) {
-        recursiveCopy(other);
+    /// Copy constructor; the copy allocates from a node store of its own.
+    BinaryTree(const BinaryTree& other)
+        : root_(), size_(other.size_), complete_(other.complete_), nodes_() {
+        root_ = copySubtree(other.root_);
     }
 
     /// Move constructor
     BinaryTree(BinaryTree&& other) noexcept
-        : root_(other.root_), size_(other.size_) {
+        : root_(other.root_), size_(other.size_), complete_(other.complete_),
+          nodes_(std::move(other.nodes_)) {
         other.root_ = nullptr;
         other.size_ = 0;
+        other.complete_ = true;
     }
 
 
@@ -240,11 +453,9 @@ class BinaryTree {
         if (this == &other)
             return *this;
 
-        Node<Type>* new_root = recursiveCopyNode(other.root_);
-        clear();
-        root_ = new_root;
-        size_ = other.size_;
-        return *this;
+        // Copy aside first: clear() may release the slabs of a pooled store.
+        BinaryTree copy(other);
+        return *this = std::move(copy);
     }
 
 
@@ -256,8 +467,11 @@ class BinaryTree {
         clear();
         root_ = other.root_;
         size_ = other.size_;
+        complete_ = other.complete_;
+        nodes_ = std::move(other.nodes_);
         other.root_ = nullptr;
         other.size_ = 0;
+        other.complete_ = true;
         return *this;
     }
 
@@ -282,10 +496,35 @@ class BinaryTree {
         return root_;
     }
 
-    /// Returns the height of the binary tree.
+    /**
+     * Returns the height of the binary tree: empty => 0, single node => 1.
+     *
+     * @complexity Time: O(n); Space: O(1), the walk follows parent pointers.
+     */
     [[nodiscard]]
     size_t getHeight() const noexcept {
-        return recursiveHeight(root_);
+        size_t height = 0;
+        size_t depth = 1;
+        const Node<Type>* node = root_;
+
+        while (node != nullptr) {
+            height = depth > height ? depth : height;
+            if (node->left != nullptr || node->right != nullptr) {
+                node = node->left != nullptr ? node->left : node->right;
+                ++depth;
+                continue;
+            }
+
+            // Climb to the nearest ancestor with an unvisited right subtree
+            // and step across to it, which keeps the depth.
+            while (node->parent != nullptr &&
+                   (node == node->parent->right || node->parent->right == nullptr)) {
+                node = node->parent;
+                --depth;
+            }
+            node = node->parent != nullptr ? node->parent->right : nullptr;
+        }
+        return height;
     }
 
 
@@ -296,33 +535,31 @@ class BinaryTree {
      * the last, and all nodes at the last level are as far left as possible.
      *
      * @return true if the tree is complete, false otherwise.
+     *
+     * @complexity Time: O(n); Space: O(1).
      */
     [[nodiscard]]
-    bool isCompleteTree() const {
-        if (this->isEmpty())
-            return true;
-
-        Queue<Node<Type>*> queue;
-        queue.enqueue(this->root_);
-        bool foundMissingChild = false;
-
-        while (!queue.isEmpty()) {
-            Node<Type>* current = queue.front();
-            queue.dequeue();
-
-            if (current->left != nullptr) {
-                if (foundMissingChild) return false;
-                queue.enqueue(current->left);
-            } else {
-                foundMissingChild = true;
+    bool isCompleteTree() const noexcept {
+        // Complete exactly when no node's level-order index exceeds size().
+        size_t index = 1;
+        const Node<Type>* node = root_;
+
+        while (node != nullptr) {
+            if (index > size_)
+                return false;
+            if (node->left != nullptr || node->right != nullptr) {
+                index = 2 * index + (node->left == nullptr);
+                node = node->left != nullptr ? node->left : node->right;
+                continue;
             }
 
-            if (current->right != nullptr) {
-                if (foundMissingChild) return false;
-                queue.enqueue(current->right);
-            } else {
-                foundMissingChild = true;
+            while (node->parent != nullptr &&
+                   (node == node->parent->right || node->parent->right == nullptr)) {
+                node = node->parent;
+                index >>= 1;
             }
+            node = node->parent != nullptr ? node->parent->right : nullptr;
+            ++index;
         }
         return true;
     }
@@ -342,21 +579,7 @@ class BinaryTree {
     void insertRight(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Only types constructible into Type are allowed");
-
-        if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
-            size_++;
-            return;
-        }
-
-        Node<Type>* current = root_;
-        while (current->right != nullptr)
-            current = current->right;
-
-        auto* newNode = new Node<Type>(std::forward<U>(element));
-        newNode->parent = current;
-        current->right = newNode;
-        size_++;
+        insertAtEdge(std::forward<U>(element), true);
     }
 
 
@@ -374,34 +597,26 @@ class BinaryTree {
     void insertLeft(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Only types constructible into Type are allowed");
-
-        if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
-            size_++;
-            return;
-        }
-
-        Node<Type>* current = root_;
-        while (current->left != nullptr)
-            current = current->left;
-
-        auto* newNode = new Node<Type>(std::forward<U>(element));
-        newNode->parent = current;
-        current->left = newNode;
-        size_++;
+        insertAtEdge(std::forward<U>(element), false);
     }
 
 
     /**
      * @brief Insert at the first available position in level-order (BFS).
      *
-     * The tree is traversed breadth-first; the new node becomes the left child
-     * of the first node missing a left child, otherwise the right child of the
-     * first node missing a right child. If the tree is empty, the new node
-     * becomes root.
+     * The new node becomes the left child of the first node missing a left
+     * child, otherwise the right child of the first node missing a right
+     * child. If the tree is empty, the new node becomes root.
+     *
+     * While the tree is complete, which holds for trees built by `insert`
+     * alone, that position is level-order index size() + 1 and is reached by
+     * following the bits of the index. Once `insertLeft` / `insertRight` have
+     * left gaps, the position is found breadth-first instead.
      *
      * @tparam U  A type that can construct `Type` (perfect-forwarded).
      * @param element  The value to insert.
+     *
+     * @complexity O(log n) on a complete tree; O(n) otherwise.
      */
     template <typename U>
     void insert(U&& element) {
@@ -409,8 +624,16 @@ class BinaryTree {
                       "Element must be constructible into Type");
 
         if (this->isEmpty()) {
-            root_ = new Node<Type>(std::forward<U>(element));
+            root_ = nodes_.create(std::forward<U>(element));
             size_++;
+            complete_ = true;
+            return;
+        }
+
+        if (complete_) {
+            const size_t index = size_ + 1;
+            attach(findNodeByPath(index >> 1), nodes_.create(std::forward<U>(element)),
+                   (index & 1) != 0);
             return;
         }
 
@@ -421,21 +644,9 @@ class BinaryTree {
             Node<Type>* current = queue.front();
             queue.dequeue();
 
-            // Check if left child is available
-            if (current->left == nullptr) {
-                auto* newNode = new Node<Type>(std::forward<U>(element));
-                newNode->parent = current;
-                current->left = newNode;
-                size_++;
-                return;
-            }
-
-            // Check if right child is available
-            if (current->right == nullptr) {
-                auto* newNode = new Node<Type>(std::forward<U>(element));
-                newNode->parent = current;
-                current->right = newNode;
-                size_++;
+            if (current->left == nullptr || current->right == nullptr) {
+                attach(current, nodes_.create(std::forward<U>(element)),
+                       current->left != nullptr);
                 return;
             }
 
@@ -446,6 +657,38 @@ class BinaryTree {
     }
 
 
+    /**
+     * Lazy pre-order (node, left, right) walk yielding references to the
+     * values; it allocates nothing. Invalidated by any insertion or removal.
+     */
+    [[nodiscard]]
+    TreeTraversal<Type, PreOrderIterator> preOrder() const noexcept {
+        return TreeTraversal<Type, PreOrderIterator>(root_);
+    }
+
+    /// Lazy in-order (left, node, right) walk, see `preOrder()`.
+    [[nodiscard]]
+    TreeTraversal<Type, InOrderIterator> inOrder() const noexcept {
+        return TreeTraversal<Type, InOrderIterator>(root_);
+    }
+
+    /// Lazy post-order (left, right, node) walk, see `preOrder()`.
+    [[nodiscard]]
+    TreeTraversal<Type, PostOrderIterator> postOrder() const noexcept {
+        return TreeTraversal<Type, PostOrderIterator>(root_);
+    }
+
+    /**
+     * Lazy level-order walk, level by level and left-to-right, yielding
+     * references to the values. Each walk buffers up to one level of node
+     * pointers, never the values. Invalidated by any insertion or removal.
+     */
+    [[nodiscard]]
+    TreeTraversal<Type, LevelOrderIterator<Type>, std::default_sentinel_t> levelOrder() const noexcept {
+        return TreeTraversal<Type, LevelOrderIterator<Type>, std::default_sentinel_t>(root_);
+    }
+
+
     /**
      * Checks if the binary tree contains a node with a specific value.
      *
@@ -454,7 +697,7 @@ class BinaryTree {
      */
     [[nodiscard]]
     virtual bool contains(const Type& value) const {
-        return recursiveContainsNode(root_, value);
+        return findNode(value) != nullptr;
     }
 
 
@@ -464,10 +707,15 @@ class BinaryTree {
      * @param value The value to search for in the binary tree.
      * @return A const pointer to the first matching node found, or nullptr if
      * none.
+     *
+     * @complexity Time: O(n); Space: O(1).
      */
     [[nodiscard]]
     const Node<Type>* findNode(const Type& value) const {
-        return recursiveFindNode(root_, value);
+        for (PreOrderIterator it(root_); it != PreOrderIterator(); ++it)
+            if (*it == value)
+                return it.node();
+        return nullptr;
     }
 
 
@@ -535,12 +783,20 @@ class BinaryTree {
     /**
      * Clears the binary tree by deallocating all nodes and resetting to empty.
      *
+     * Nodes are destroyed iteratively, so even a degenerate tree cannot
+     * overflow the stack. With PooledNodes the slabs are released as a whole,
+     * and nodes of trivially destructible types are not visited at all.
+     *
      * Exception safety: No-throw.
      */
     void clear() noexcept {
-        delete root_;
+        using Store = node_pool_detail::NodeStore<Node<Type>, NodePolicy>;
+        if constexpr (!Store::RELEASES_IN_BULK || !std::is_trivially_destructible_v<Node<Type>>)
+            destroySubtree(root_);
+        nodes_.releaseAll();
         root_ = nullptr;
         size_ = 0;
+        complete_ = true;
     }
 
 
@@ -0,0 +1,239 @@
+#ifndef BLOCKED_BLOOM_FILTER_HPP
+#define BLOCKED_BLOOM_FILTER_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "DefaultHash.hpp"
+#include "DynamicArray.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @class BlockedBloomFilter
+ *
+ * @brief An approximate set that answers "definitely absent" or "maybe
+ * present" with one cache-line access per query.
+ *
+ * A split-block Bloom filter: the bit array is divided into 32-byte blocks
+ * of eight 32-bit words, and a key sets exactly one bit in every word of a
+ * single block. The high bits of the key's hash select the block, and the
+ * low 32 bits, multiplied by a different odd constant per word, select the
+ * bit within each word. A query therefore touches one block, which never
+ * straddles a cache line, and with AVX2 the eight bit positions are
+ * computed and tested with a handful of vector instructions; elsewhere a
+ * scalar loop stops at the first clear bit.
+ *
+ * Blocking costs some accuracy over a classic Bloom filter (about 10.5
+ * instead of 9.6 bits per key for 1% false positives); the constructor
+ * sizes the filter with the exact false-positive rate of the blocked
+ * layout, so the requested rate holds once the expected number of keys is
+ * inserted. Keys cannot be removed.
+ *
+ * insertHash() and mayContainHash() take a hash computed elsewhere, so a
+ * filter can sit in front of a HashMap with the same Hash and reuse its
+ * hashOf() value (see FilteredHashMap).
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ */
+template <typename Key, typename Hash = DefaultHash<Key>>
+class BlockedBloomFilter {
+  public:
+    /// Bytes per block; each query reads exactly one block.
+    static constexpr size_t BLOCK_BYTES = 32;
+
+  private:
+    struct alignas(BLOCK_BYTES) Block {
+        std::uint32_t words[8];
+    };
+
+    /// Odd multipliers that pick the bit of each word.
+    static constexpr std::uint32_t SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                              0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    DynamicArray<Block> blocks_;
+    size_t count_ = 0;
+    Hash hasher_;
+
+
+    /// Maps the hash uniformly onto [0, blockCount()) without a division.
+    [[nodiscard]]
+    size_t blockIndex(const size_t hash) const noexcept {
+        std::uint64_t low = hash;
+        std::uint64_t high = blocks_.size();
+        hash_detail::multiply128(low, high);
+        return static_cast<size_t>(high);
+    }
+
+
+    /// Smallest number of blocks whose false-positive rate with keys keys
+    /// does not exceed rate.
+    static size_t blocksFor(const size_t keys, const double rate) {
+        // Start from the size of a classic Bloom filter, which the blocked
+        // layout needs slightly more than; search in (low, high].
+        const double classic_bits = -static_cast<double>(keys) * std::log(rate) / (std::log(2.0) * std::log(2.0));
+        size_t high = static_cast<size_t>(classic_bits / (8.0 * BLOCK_BYTES)) + 1;
+        size_t low = 0;
+        while (falsePositiveRate(keys, high) > rate) {
+            low = high;
+            high *= 2;
+        }
+        while (high - low > 1) {
+            const size_t mid = low + (high - low) / 2;
+            (falsePositiveRate(keys, mid) > rate ? low : high) = mid;
+        }
+        return high;
+    }
+
+  public:
+    /**
+     * @brief Computes the false-positive rate of a filter of the given
+     * number of blocks holding keys distinct keys.
+     *
+     * The keys per block follow a Poisson distribution; a block holding i
+     * keys has a given bit of a word set with probability 1 − (31/32)^i, and
+     * a false positive needs all eight probed bits set.
+     */
+    [[nodiscard]]
+    static double falsePositiveRate(const size_t keys, const size_t blocks) {
+        if (keys == 0)
+            return 0.0;
+        const double load = static_cast<double>(keys) / static_cast<double>(blocks);
+        const double spread = 12.0 * std::sqrt(load) + 24.0;
+        const auto first = static_cast<size_t>(load > spread ? load - spread : 0.0);
+        const auto last = static_cast<size_t>(load + spread);
+
+        // Poisson terms in log space: exp(-load) alone underflows for large loads.
+        double rate = 0.0;
+        for (size_t i = first; i <= last; ++i) {
+            const auto x = static_cast<double>(i);
+            const double probability = std::exp(x * std::log(load) - load - std::lgamma(x + 1.0));
+            rate += probability * std::pow(1.0 - std::pow(31.0 / 32.0, x), 8.0);
+        }
+        return rate;
+    }
+
+
+    /**
+     * @brief Creates an empty filter sized for expected_keys keys.
+     *
+     * @param expected_keys The number of keys to be inserted.
+     * @param false_positive_rate The largest acceptable rate of false
+     * positives once expected_keys keys are inserted.
+     * @throws std::invalid_argument If false_positive_rate is not in (0, 1).
+     */
+    explicit BlockedBloomFilter(const size_t expected_keys, const double false_positive_rate = 0.01)
+        : hasher_() {
+        if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+            throw std::invalid_argument("False positive rate must be in (0, 1)");
+
+        const size_t blocks = blocksFor(expected_keys, false_positive_rate);
+        blocks_ = DynamicArray<Block>(blocks);
+        for (size_t i = 0; i < blocks; ++i)
+            blocks_.addLast(Block{});
+    }
+
+
+    /// Adds a key.
+    void insert(const Key& key) { insertHash(hasher_(key)); }
+
+    /**
+     * @brief Adds a key given its hash.
+     *
+     * @return bool Always true; a Bloom filter cannot run out of room, it
+     * only gets less accurate. (The return value mirrors
+     * CuckooFilter::insertHash().)
+     */
+    bool insertHash(const size_t hash) noexcept {
+        Block& block = blocks_[blockIndex(hash)];
+        const auto key = static_cast<std::uint32_t>(hash);
+#if defined(__AVX2__)
+        const __m256i salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SALT));
+        const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)), salt), 27);
+        const __m256i bits = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+        auto* words = reinterpret_cast<__m256i*>(block.words);
+        _mm256_store_si256(words, _mm256_or_si256(_mm256_load_si256(words), bits));
+#else
+        for (size_t i = 0; i < 8; ++i)
+            block.words[i] |= std::uint32_t{1} << ((key * SALT[i]) >> 27);
+#endif
+        ++count_;
+        return true;
+    }
+
+
+    /// Checks if key may have been inserted; false means it definitely was not.
+    [[nodiscard]]
+    bool mayContain(const Key& key) const {
+        return mayContainHash(hasher_(key));
+    }
+
+    /// mayContain() for a hash computed elsewhere.
+    [[nodiscard]]
+    bool mayContainHash(const size_t hash) const noexcept {
+        const Block& block = blocks_[blockIndex(hash)];
+        const auto key = static_cast<std::uint32_t>(hash);
+#if defined(__AVX2__)
+        const __m256i salt = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SALT));
+        const __m256i shifts = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(key)), salt), 27);
+        const __m256i bits = _mm256_sllv_epi32(_mm256_set1_epi32(1), shifts);
+        // testc is 1 when every bit of bits is also set in the block.
+        return _mm256_testc_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(block.words)), bits) != 0;
+#else
+        // Without vector shifts, stopping at the first clear bit is faster:
+        // for an absent key each word has its bit set only about half the time.
+        for (size_t i = 0; i < 8; ++i)
+            if ((block.words[i] & (std::uint32_t{1} << ((key * SALT[i]) >> 27))) == 0)
+                return false;
+        return true;
+#endif
+    }
+
+
+    /// Removes every key, keeping the size of the filter.
+    void clear() noexcept {
+        for (Block& block : blocks_)
+            block = Block{};
+        count_ = 0;
+    }
+
+    /// Returns the number of insertions (duplicates included).
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return count_;
+    }
+
+    /// Returns the number of blocks.
+    [[nodiscard]]
+    size_t blockCount() const noexcept {
+        return blocks_.size();
+    }
+
+    /// Returns the memory used by the bit array.
+    [[nodiscard]]
+    size_t byteSize() const noexcept {
+        return blocks_.size() * BLOCK_BYTES;
+    }
+
+    /// Returns the expected false-positive rate at the current size,
+    /// assuming distinct keys.
+    [[nodiscard]]
+    double falsePositiveRate() const {
+        return falsePositiveRate(count_, blocks_.size());
+    }
+};
+
+
+} // namespace containers
+
+
+#endif // BLOCKED_BLOOM_FILTER_HPP
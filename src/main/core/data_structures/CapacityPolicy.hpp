@@ -0,0 +1,116 @@
+#ifndef CAPACITY_POLICY_HPP
+#define CAPACITY_POLICY_HPP
+
+#include <cstddef>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/*
+ * Capacity policies decide how DynamicArray and Queue grow and when they give
+ * memory back. A policy provides:
+ *
+ *   static size_t grow(size_t capacity, size_t max) noexcept
+ *       The capacity to move to when full; greater than `capacity` unless
+ *       `capacity == max`, and never above `max`.
+ *   bool shouldShrink(size_t size, size_t capacity) noexcept
+ *       Asked after removals; true asks the container to halve its capacity.
+ *       May keep state, so the container stores one policy object.
+ *   static constexpr bool SHRINKS_ON_REQUEST
+ *       Whether shrinkToFit() releases memory at all.
+ *
+ * ShrinkWhenSparse<> is the default and keeps the historic behaviour: double
+ * when full, halve once only a quarter of the capacity is in use. Under
+ * bursty traffic that can grow and shrink the same buffer over and over; the
+ * other policies trade memory for fewer copies.
+ */
+
+
+namespace capacity_detail {
+
+/// Geometric growth by GrowthPercent percent, clamped to the maximum.
+template <unsigned GrowthPercent>
+struct Growth {
+    static_assert(GrowthPercent > 100, "GrowthPercent must exceed 100");
+
+    static constexpr unsigned GROWTH_PERCENT = GrowthPercent;
+
+    static constexpr size_t grow(const size_t capacity, const size_t max) noexcept {
+        if (capacity >= max / GrowthPercent * 100)
+            return max;
+        const size_t grown = capacity / 100 * GrowthPercent + capacity % 100 * GrowthPercent / 100;
+        return grown > capacity ? grown : capacity + 1;
+    }
+};
+
+/// A container counts as sparse once no more than a quarter of it is used.
+constexpr bool isSparse(const size_t size, const size_t capacity) noexcept {
+    return size <= capacity / 4;
+}
+
+} // namespace capacity_detail
+
+
+/// Halves the capacity as soon as only a quarter of it is in use (default).
+template <unsigned GrowthPercent = 200>
+struct ShrinkWhenSparse : capacity_detail::Growth<GrowthPercent> {
+    static constexpr bool SHRINKS_ON_REQUEST = true;
+
+    bool shouldShrink(const size_t size, const size_t capacity) noexcept {
+        return capacity_detail::isSparse(size, capacity);
+    }
+};
+
+
+/**
+ * Halves the capacity only after the container has been sparse for
+ * DecayChecks consecutive shrink checks. Any check that finds it busier
+ * restarts the countdown, so a burst that drains and refills the container
+ * keeps its buffer. The countdown counts checks rather than wall-clock time,
+ * which keeps the behaviour deterministic.
+ */
+template <size_t DecayChecks = 64, unsigned GrowthPercent = 200>
+struct HysteresisShrink : capacity_detail::Growth<GrowthPercent> {
+    static_assert(DecayChecks > 0, "DecayChecks must be positive");
+
+    static constexpr bool SHRINKS_ON_REQUEST = true;
+
+    bool shouldShrink(const size_t size, const size_t capacity) noexcept {
+        if (!capacity_detail::isSparse(size, capacity)) {
+            sparse_checks_ = 0;
+            return false;
+        }
+        if (++sparse_checks_ < DecayChecks)
+            return false;
+        sparse_checks_ = 0;
+        return true;
+    }
+
+  private:
+    size_t sparse_checks_ = 0;
+};
+
+
+/// Never shrinks on its own; shrinkToFit() still releases memory.
+template <unsigned GrowthPercent = 200>
+struct ShrinkOnRequest : capacity_detail::Growth<GrowthPercent> {
+    static constexpr bool SHRINKS_ON_REQUEST = true;
+
+    bool shouldShrink(size_t, size_t) noexcept { return false; }
+};
+
+
+/// Capacity only ever grows; shrinkToFit() is a no-op.
+template <unsigned GrowthPercent = 200>
+struct NeverShrink : capacity_detail::Growth<GrowthPercent> {
+    static constexpr bool SHRINKS_ON_REQUEST = false;
+
+    bool shouldShrink(size_t, size_t) noexcept { return false; }
+};
+
+} // namespace containers
+
+#endif // CAPACITY_POLICY_HPP
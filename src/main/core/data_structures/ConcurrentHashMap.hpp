@@ -0,0 +1,311 @@
+#ifndef CONCURRENT_HASH_MAP_HPP
+#define CONCURRENT_HASH_MAP_HPP
+
+#include <bit>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "DefaultHash.hpp"
+#include "HashMap.hpp"
+
+
+namespace containers {
+
+
+/** @class ConcurrentHashMap
+ *
+ * @brief A thread-safe hash map made of independently locked HashMap shards.
+ *
+ * Keys are striped across ShardCount shards by the high bits of their hash,
+ * so the low bits (used by each shard's HashMap for bucket indexing) stay
+ * independent of the shard choice. Every key is hashed once per operation and
+ * the hash is handed to the shard's precomputed-hash overloads. Each shard is guarded by its own
+ * std::shared_mutex: lookups take a shared lock and run in parallel with
+ * each other, writers only serialize with operations on the same shard.
+ *
+ * Because values may be modified or erased by other threads at any time, no
+ * references into the map are handed out. Lookups return copies, and
+ * in-place access is done through callbacks (visit(), update(),
+ * computeIfAbsent()) that run while the shard lock is held. Callbacks must
+ * not call back into the same map.
+ *
+ * @tparam Key The type of the keys in the map.
+ * @tparam Value The type of the values in the map.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ * @tparam ShardCount Number of shards, a power of two. Defaults to 64.
+ * @tparam LoadFactorPercent The maximum load factor of each shard.
+ */
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>,
+          size_t ShardCount = 64, size_t LoadFactorPercent = 70>
+class ConcurrentHashMap {
+    static_assert(ShardCount > 0 && std::has_single_bit(ShardCount),
+                  "ShardCount must be a power of two.");
+
+    using Map = HashMap<Key, Value, Hash, LoadFactorPercent>;
+
+    /// Number of hash bits used to select a shard.
+    static constexpr int SHARD_BITS = std::countr_zero(ShardCount);
+
+    /// Assumed cache line size. std::hardware_destructive_interference_size
+    /// is avoided because its value may differ between compiler flags.
+    static constexpr size_t CACHE_LINE = 64;
+
+
+    /// A shard owns its own lock and map, padded to avoid false sharing.
+    struct alignas(CACHE_LINE) Shard {
+        mutable std::shared_mutex mutex;
+        Map map;
+    };
+
+
+    Shard shards_[ShardCount];
+    Hash hasher_;
+
+
+    /// Selects the shard responsible for a hash from its top bits.
+    Shard& shardFor(const size_t hash) {
+        return shards_[shardIndex(hash)];
+    }
+
+    /// Const overload of shardFor().
+    const Shard& shardFor(const size_t hash) const {
+        return shards_[shardIndex(hash)];
+    }
+
+    static size_t shardIndex(const size_t hash) noexcept {
+        if constexpr (SHARD_BITS == 0)
+            return 0;
+        else
+            return hash >> (sizeof(size_t) * 8 - SHARD_BITS);
+    }
+
+
+  public:
+    /// Default constructor creates empty shards.
+    ConcurrentHashMap() = default;
+
+    /// Copying or moving would need every shard lock; neither is supported.
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+
+    /// Returns the number of shards.
+    [[nodiscard]]
+    static constexpr size_t shardCount() noexcept {
+        return ShardCount;
+    }
+
+
+    /**
+     * @brief Returns the number of key-value pairs in the map.
+     *
+     * Shards are locked one after another, so under concurrent writes the
+     * result is only a snapshot of each shard taken at a slightly different
+     * time.
+     */
+    [[nodiscard]]
+    size_t size() const {
+        size_t total = 0;
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            total += shard.map.size();
+        }
+        return total;
+    }
+
+    /// Checks if the map is empty (same snapshot semantics as size()).
+    [[nodiscard]]
+    bool isEmpty() const {
+        return size() == 0;
+    }
+
+
+    /**
+     * @brief Inserts or updates a key-value pair.
+     *
+     * @tparam V The type of the value (can be a reference or rvalue).
+     *
+     * @param key The key to be inserted or updated.
+     * @param value The value to be associated with the key.
+     */
+    template <typename V>
+    void insert(const Key& key, V&& value) {
+        const size_t hash = hasher_(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock lock(shard.mutex);
+        shard.map.insertOrAssign(key, std::forward<V>(value), hash);
+    }
+
+    /// Overload of insert() that moves the key into the map.
+    template <typename V>
+    void insert(Key&& key, V&& value) {
+        const size_t hash = hasher_(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock lock(shard.mutex);
+        shard.map.insertOrAssign(std::move(key), std::forward<V>(value), hash);
+    }
+
+
+    /**
+     * @brief Returns the value mapped to key, inserting factory() first if the
+     * key is absent.
+     *
+     * The check and the insertion happen atomically with respect to other
+     * writers: factory is invoked at most once, and only by the thread that
+     * actually inserts. Present keys are served under a shared lock.
+     *
+     * @tparam Factory A callable returning something convertible to Value.
+     * @param key The key to look up or insert.
+     * @param factory Produces the value for a missing key.
+     * @return Value A copy of the (existing or newly inserted) value.
+     */
+    template <typename Factory>
+    Value computeIfAbsent(const Key& key, Factory&& factory) {
+        const size_t hash = hasher_(key);
+        Shard& shard = shardFor(hash);
+        {
+            std::shared_lock lock(shard.mutex);
+            const auto it = std::as_const(shard.map).find(key, hash);
+            if (it != shard.map.cend())
+                return it->second;
+        }
+
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.map.find(key, hash);
+        if (it == shard.map.end())
+            it = shard.map.insertOrAssign(key, std::forward<Factory>(factory)(), hash).first;
+        return it->second;
+    }
+
+
+    /**
+     * @brief Applies fn to the value mapped to key under the shard's write
+     * lock.
+     *
+     * @tparam Function A callable accepting Value&.
+     * @return true If the key was present and fn was applied.
+     * @return false If the key was not found.
+     */
+    template <typename Function>
+    bool update(const Key& key, Function&& fn) {
+        const size_t hash = hasher_(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock lock(shard.mutex);
+        const auto it = shard.map.find(key, hash);
+        if (it == shard.map.end())
+            return false;
+        std::forward<Function>(fn)(it->second);
+        return true;
+    }
+
+
+    /**
+     * @brief Applies fn to the value mapped to key under the shard's read
+     * lock, avoiding a copy.
+     *
+     * @tparam Function A callable accepting const Value&.
+     * @return true If the key was present and fn was applied.
+     * @return false If the key was not found.
+     */
+    template <typename Function>
+    bool visit(const Key& key, Function&& fn) const {
+        const size_t hash = hasher_(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock lock(shard.mutex);
+        const auto it = shard.map.find(key, hash);
+        if (it == shard.map.cend())
+            return false;
+        std::forward<Function>(fn)(it->second);
+        return true;
+    }
+
+
+    /**
+     * @brief Looks up the value mapped to key.
+     *
+     * @return std::optional<Value> A copy of the value, or std::nullopt if the
+     * key is absent.
+     */
+    std::optional<Value> find(const Key& key) const {
+        const size_t hash = hasher_(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock lock(shard.mutex);
+        const auto it = shard.map.find(key, hash);
+        if (it == shard.map.cend())
+            return std::nullopt;
+        return it->second;
+    }
+
+
+    /**
+     * @brief Returns a copy of the value mapped to key.
+     *
+     * @throws std::out_of_range If the key is not found in the map.
+     */
+    Value at(const Key& key) const {
+        const size_t hash = hasher_(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock lock(shard.mutex);
+        return shard.map.at(key, hash);
+    }
+
+
+    /// Checks if the map contains the given key.
+    bool contains(const Key& key) const {
+        const size_t hash = hasher_(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock lock(shard.mutex);
+        return shard.map.contains(key, hash);
+    }
+
+
+    /**
+     * @brief Removes the key-value pair associated with the given key.
+     *
+     * @return true If the key was found and removed.
+     * @return false If the key was not found in the map.
+     */
+    bool remove(const Key& key) {
+        const size_t hash = hasher_(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock lock(shard.mutex);
+        return shard.map.remove(key, hash);
+    }
+
+
+    /// Removes all key-value pairs, one shard at a time.
+    void clear() {
+        for (Shard& shard : shards_) {
+            std::unique_lock lock(shard.mutex);
+            shard.map.clear();
+        }
+    }
+
+
+    /**
+     * @brief Calls fn(key, value) for every pair, holding each shard's read
+     * lock while that shard is visited.
+     *
+     * Pairs inserted or removed concurrently in shards not yet visited may or
+     * may not be seen.
+     *
+     * @tparam Function A callable accepting (const Key&, const Value&).
+     */
+    template <typename Function>
+    void forEach(Function&& fn) const {
+        for (const Shard& shard : shards_) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [key, value] : shard.map)
+                fn(key, value);
+        }
+    }
+};
+
+
+} // namespace containers
+
+
+#endif // CONCURRENT_HASH_MAP_HPP
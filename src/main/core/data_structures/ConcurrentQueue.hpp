@@ -0,0 +1,471 @@
+#ifndef CONCURRENT_QUEUE_HPP
+#define CONCURRENT_QUEUE_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace ring_queue_detail {
+
+/// Assumed cache line size. std::hardware_destructive_interference_size
+/// is avoided because its value may differ between compiler flags.
+inline constexpr size_t CACHE_LINE = 64;
+
+
+/// Rounds a requested capacity up to the power of two the ring works with.
+inline size_t ringCapacity(const size_t requested) {
+    if (requested == 0)
+        throw std::invalid_argument("Queue capacity must be positive");
+    if (requested > (size_t{1} << (sizeof(size_t) * 8 - 2)))
+        throw std::length_error("Queue capacity exceeded");
+    return std::bit_ceil(requested < 2 ? size_t{2} : requested);
+}
+
+
+/// Uninitialized storage for one element; the queue decides when it is live.
+template <typename Type>
+struct Slot {
+    alignas(Type) std::byte storage[sizeof(Type)];
+
+    template <typename... Args>
+    void construct(Args&&... args) {
+        ::new (static_cast<void*>(storage)) Type(std::forward<Args>(args)...);
+    }
+
+    Type& value() noexcept {
+        return *std::launder(reinterpret_cast<Type*>(storage));
+    }
+
+    /// Moves the element out and ends its lifetime.
+    Type take() noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        Type result(std::move(value()));
+        value().~Type();
+        return result;
+    }
+};
+
+} // namespace ring_queue_detail
+
+
+/**
+ * @class SpscQueue
+ * @brief Bounded wait-free queue for exactly one producer and one consumer
+ * thread.
+ *
+ * A ring of `capacity()` slots indexed like `Queue`: the power-of-two
+ * capacity turns the circular index into a bitwise AND. Head and tail are
+ * free-running counters, each on its own cache line and each written by one
+ * side only, so every operation finishes in a bounded number of steps.
+ * Each side also caches the last index it read from the other side and only
+ * reloads it when the ring looks full (or empty), which keeps the two cache
+ * lines from bouncing on every call.
+ *
+ * `enqueueBulk` / `dequeueBulk` move a run of elements with a single index
+ * publication, paying the cross-core handoff once per batch.
+ *
+ * @tparam Type Element type; moved out on dequeue.
+ */
+template <typename Type>
+class SpscQueue {
+    static_assert(std::is_nothrow_destructible_v<Type>, "Type must be nothrow destructible");
+
+    static constexpr size_t CACHE_LINE = ring_queue_detail::CACHE_LINE;
+    using Slot = ring_queue_detail::Slot<Type>;
+
+    /// Consumer side: next index to read, and the producer's tail as last seen.
+    alignas(CACHE_LINE) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    /// Producer side: next index to write, and the consumer's head as last seen.
+    alignas(CACHE_LINE) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+
+    /// Read-only after construction, shared by both sides.
+    alignas(CACHE_LINE) size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+
+
+    /// Free slots as seen by the producer, refreshing the head if needed.
+    size_t freeSlots(const size_t tail, const size_t wanted) noexcept {
+        size_t free = capacity() - (tail - cached_head_);
+        if (free < wanted) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free = capacity() - (tail - cached_head_);
+        }
+        return free;
+    }
+
+    /// Filled slots as seen by the consumer, refreshing the tail if needed.
+    size_t filledSlots(const size_t head, const size_t wanted) noexcept {
+        size_t filled = cached_tail_ - head;
+        if (filled < wanted) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            filled = cached_tail_ - head;
+        }
+        return filled;
+    }
+
+
+  public:
+    /**
+     * Creates an empty queue holding at least `capacity` elements.
+     *
+     * @throws std::invalid_argument if `capacity` is zero.
+     */
+    explicit SpscQueue(const size_t capacity)
+        : mask_(ring_queue_detail::ringCapacity(capacity) - 1),
+          slots_(std::make_unique<Slot[]>(mask_ + 1)) {}
+
+    /// The ring is shared by two threads; it is neither copied nor moved.
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// Destroys the elements still queued. No other thread may be using it.
+    ~SpscQueue() noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        for (size_t head = head_.load(std::memory_order_relaxed); head != tail; ++head)
+            slots_[head & mask_].value().~Type();
+    }
+
+
+    /// Number of slots, a power of two.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    /// Number of queued elements; exact only while neither side is running.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    /// Checks if the queue is empty (same snapshot semantics as size()).
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size() == 0;
+    }
+
+
+    /**
+     * Producer only: constructs an element at the back if there is room.
+     *
+     * @return false if the queue is full; `args` are then left untouched.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (freeSlots(tail, 1) == 0)
+            return false;
+
+        slots_[tail & mask_].construct(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Producer only: enqueues `element` if there is room, see tryEmplace().
+    template <typename U>
+    bool tryEnqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        return tryEmplace(std::forward<U>(element));
+    }
+
+
+    /**
+     * Producer only: enqueues up to `count` elements read from `first`, as
+     * many as fit, and publishes them to the consumer at once.
+     *
+     * @return The number of elements taken from `first`. Pass a move
+     * iterator to move them in.
+     */
+    template <typename InputIt>
+    size_t enqueueBulk(InputIt first, const size_t count) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t free = freeSlots(tail, count);
+        const size_t n = count < free ? count : free;
+
+        size_t done = 0;
+        try {
+            for (; done < n; ++done, ++first)
+                slots_[(tail + done) & mask_].construct(*first);
+        } catch (...) {
+            tail_.store(tail + done, std::memory_order_release);
+            throw;
+        }
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+
+    /**
+     * Consumer only: removes the front element.
+     *
+     * @return The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<Type> tryDequeue() noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (filledSlots(head, 1) == 0)
+            return std::nullopt;
+
+        std::optional<Type> result(slots_[head & mask_].take());
+        head_.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+
+    /**
+     * Consumer only: moves up to `maxCount` elements to `out` and frees
+     * their slots for the producer at once.
+     *
+     * @return The number of elements written to `out`.
+     */
+    template <typename OutputIt>
+    size_t dequeueBulk(OutputIt out, const size_t maxCount) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t filled = filledSlots(head, maxCount);
+        const size_t n = maxCount < filled ? maxCount : filled;
+
+        for (size_t i = 0; i < n; ++i, ++out)
+            *out = slots_[(head + i) & mask_].take();
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+};
+
+
+/**
+ * @class MpmcQueue
+ * @brief Bounded lock-free queue for any number of producer and consumer
+ * threads (Dmitry Vyukov's array-based design).
+ *
+ * Every slot carries a sequence number telling which lap of the ring it is
+ * ready for: a producer may fill the slot for position p once its sequence is
+ * p, and a consumer may empty it once the sequence is p + 1. Producers and
+ * consumers claim positions with a CAS on their own cache-line-padded
+ * counter and never touch the other side's counter, so the two sides only
+ * meet on the slots themselves.
+ *
+ * `enqueueBulk` / `dequeueBulk` claim a run of consecutive ready slots with
+ * one CAS. Each slot is still published on its own, so the other side can
+ * start on the first elements while the rest are being written.
+ *
+ * @tparam Type Element type; moved out on dequeue. Constructing it should
+ * not throw, as a claimed slot cannot be given back (see tryEmplace()).
+ */
+template <typename Type>
+class MpmcQueue {
+    static_assert(std::is_nothrow_destructible_v<Type>, "Type must be nothrow destructible");
+
+    static constexpr size_t CACHE_LINE = ring_queue_detail::CACHE_LINE;
+
+    struct Cell {
+        std::atomic<size_t> sequence;
+        ring_queue_detail::Slot<Type> slot;
+    };
+
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue_pos_{0};
+    alignas(CACHE_LINE) size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+
+    /// Distance between a slot's sequence and the one a side is waiting for.
+    static std::ptrdiff_t lag(const size_t sequence, const size_t expected) noexcept {
+        return static_cast<std::ptrdiff_t>(sequence - expected);
+    }
+
+    /**
+     * Claims up to `wanted` consecutive positions starting at the current
+     * value of `counter`, each of whose cells has sequence `position + offset`.
+     *
+     * @return The first claimed position and how many were claimed (0 when
+     * the first cell is not ready, i.e. the queue is full or empty).
+     */
+    std::pair<size_t, size_t> claim(std::atomic<size_t>& counter, const size_t offset,
+                                    const size_t wanted) noexcept {
+        size_t position = counter.load(std::memory_order_relaxed);
+        while (true) {
+            size_t ready = 0;
+            bool stale = false;
+            for (; ready < wanted; ++ready) {
+                const size_t expected = position + ready + offset;
+                const size_t sequence =
+                    cells_[(position + ready) & mask_].sequence.load(std::memory_order_acquire);
+                if (sequence != expected) {
+                    // A lagging first cell means the ring is full (or empty);
+                    // one that is ahead means another thread already took
+                    // `position` and the counter has moved on.
+                    stale = ready == 0 && lag(sequence, expected) > 0;
+                    break;
+                }
+            }
+
+            if (stale) {
+                position = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (ready == 0)
+                return {position, 0};
+            if (counter.compare_exchange_weak(position, position + ready,
+                                              std::memory_order_relaxed))
+                return {position, ready};
+        }
+    }
+
+
+  public:
+    /**
+     * Creates an empty queue holding at least `capacity` elements.
+     *
+     * @throws std::invalid_argument if `capacity` is zero.
+     */
+    explicit MpmcQueue(const size_t capacity)
+        : mask_(ring_queue_detail::ringCapacity(capacity) - 1),
+          cells_(std::make_unique<Cell[]>(mask_ + 1)) {
+        for (size_t i = 0; i <= mask_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /// The ring is shared between threads; it is neither copied nor moved.
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /// Destroys the elements still queued. No other thread may be using it.
+    ~MpmcQueue() noexcept {
+        const size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+        for (size_t head = dequeue_pos_.load(std::memory_order_relaxed); head != tail; ++head)
+            cells_[head & mask_].slot.value().~Type();
+    }
+
+
+    /// Number of slots, a power of two.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return mask_ + 1;
+    }
+
+    /**
+     * Number of claimed but not yet dequeued positions. Under concurrent use
+     * this is only a snapshot and may count elements still being written.
+     */
+    [[nodiscard]]
+    size_t size() const noexcept {
+        const size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        const size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    /// Checks if the queue is empty (same snapshot semantics as size()).
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size() == 0;
+    }
+
+
+    /**
+     * Constructs an element at the back if there is room.
+     *
+     * @return false if the queue is full; `args` are then left untouched.
+     *
+     * @warning If the constructor of `Type` throws after the slot has been
+     * claimed, the slot can never be published and consumers will stop at it.
+     * Use types that are nothrow constructible from `args`.
+     */
+    template <typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const auto [position, claimed] = claim(enqueue_pos_, 0, 1);
+        if (claimed == 0)
+            return false;
+
+        Cell& cell = cells_[position & mask_];
+        cell.slot.construct(std::forward<Args>(args)...);
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Enqueues `element` if there is room, see tryEmplace().
+    template <typename U>
+    bool tryEnqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        return tryEmplace(std::forward<U>(element));
+    }
+
+
+    /**
+     * Enqueues up to `count` elements read from `first` into a run of
+     * consecutive slots claimed at once.
+     *
+     * @return The number of elements taken from `first`, fewer than `count`
+     * when the ring has less room. Pass a move iterator to move them in.
+     */
+    template <typename InputIt>
+    size_t enqueueBulk(InputIt first, const size_t count) {
+        if (count == 0)
+            return 0;
+
+        const auto [position, claimed] = claim(enqueue_pos_, 0, count);
+        for (size_t i = 0; i < claimed; ++i, ++first) {
+            Cell& cell = cells_[(position + i) & mask_];
+            cell.slot.construct(*first);
+            cell.sequence.store(position + i + 1, std::memory_order_release);
+        }
+        return claimed;
+    }
+
+
+    /**
+     * Removes the front element.
+     *
+     * @return The element, or std::nullopt if the queue is empty.
+     */
+    std::optional<Type> tryDequeue() noexcept(std::is_nothrow_move_constructible_v<Type>) {
+        const auto [position, claimed] = claim(dequeue_pos_, 1, 1);
+        if (claimed == 0)
+            return std::nullopt;
+
+        Cell& cell = cells_[position & mask_];
+        std::optional<Type> result(cell.slot.take());
+        cell.sequence.store(position + capacity(), std::memory_order_release);
+        return result;
+    }
+
+
+    /**
+     * Moves up to `maxCount` elements from a run of consecutive slots claimed
+     * at once to `out`.
+     *
+     * @return The number of elements written to `out`.
+     */
+    template <typename OutputIt>
+    size_t dequeueBulk(OutputIt out, const size_t maxCount) {
+        if (maxCount == 0)
+            return 0;
+
+        const auto [position, claimed] = claim(dequeue_pos_, 1, maxCount);
+        for (size_t i = 0; i < claimed; ++i, ++out) {
+            Cell& cell = cells_[(position + i) & mask_];
+            *out = cell.slot.take();
+            cell.sequence.store(position + i + capacity(), std::memory_order_release);
+        }
+        return claimed;
+    }
+};
+
+} // namespace containers
+
+#endif // CONCURRENT_QUEUE_HPP
@@ -0,0 +1,292 @@
+#ifndef CUCKOO_FILTER_HPP
+#define CUCKOO_FILTER_HPP
+
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+#include "DefaultHash.hpp"
+#include "DynamicArray.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @class CuckooFilter
+ *
+ * @brief An approximate set like BlockedBloomFilter that also supports
+ * removal.
+ *
+ * Stores a 16-bit fingerprint of every key in one of two candidate buckets
+ * of four slots (partial-key cuckoo hashing): the two buckets are a hash of
+ * the fingerprint apart (modulo the bucket count), so either bucket can be
+ * computed from the other and a fingerprint can be moved without knowing
+ * its key. Buckets are chosen by multiply-shift rather than a mask, so the
+ * table need not be a power of two and stays close to 2.1 bytes per key.
+ * A bucket is a single 64-bit word, and a query compares all four slots of
+ * both buckets at once with word-wide (SWAR) arithmetic.
+ *
+ * With 16-bit fingerprints the false-positive rate is at most 8 / 65535
+ * (about 0.012%) at full load, for 2 bytes per slot; the table is sized for
+ * a 95% load. When no slot can be freed within MAX_KICKS relocations, the
+ * displaced fingerprint is kept aside and further inserts fail until a
+ * removal lets it back in: insertHash() returns false instead of losing a
+ * key.
+ *
+ * Inserting the same key again stores another copy of its fingerprint
+ * (at most 2 · SLOTS fit), so each insert can be undone by one removal.
+ * Removing a key that was never inserted may remove another key's
+ * matching fingerprint and cause a false negative for it.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ */
+template <typename Key, typename Hash = DefaultHash<Key>>
+class CuckooFilter {
+  public:
+    /// Fingerprints per bucket.
+    static constexpr size_t SLOTS = 4;
+
+    /// Relocations tried before an insert gives up.
+    static constexpr size_t MAX_KICKS = 500;
+
+  private:
+    static constexpr std::uint64_t LANES = 0x0001000100010001ull;
+    static constexpr std::uint64_t HIGH_BITS = 0x8000800080008000ull;
+
+    DynamicArray<std::uint64_t> buckets_;
+    size_t count_ = 0;
+    std::uint16_t victim_ = 0; // Fingerprint that could not be placed, or 0.
+    size_t victim_bucket_ = 0;
+    std::uint64_t random_ = 0x9e3779b97f4a7c15ull; // xorshift state for choosing victims.
+    Hash hasher_;
+
+
+    /// Non-zero fingerprint from the low 16 bits of the hash (0 marks an empty slot).
+    static std::uint16_t fingerprintOf(const size_t hash) noexcept {
+        const auto fp = static_cast<std::uint16_t>(hash);
+        return fp != 0 ? fp : 1;
+    }
+
+    /// Maps value uniformly onto [0, bucket count) without a division.
+    [[nodiscard]]
+    size_t reduce(const std::uint64_t value) const noexcept {
+        std::uint64_t low = value;
+        std::uint64_t high = buckets_.size();
+        hash_detail::multiply128(low, high);
+        return static_cast<size_t>(high);
+    }
+
+    /// The first candidate bucket, from the high bits of the hash (the
+    /// fingerprint uses the low ones).
+    [[nodiscard]]
+    size_t bucketOf(const size_t hash) const noexcept {
+        return reduce(hash);
+    }
+
+    /// The other candidate bucket of a fingerprint stored in bucket: the
+    /// pair sums to an offset derived from fp, so applying this twice
+    /// returns to bucket.
+    [[nodiscard]]
+    size_t alternateOf(const size_t bucket, const std::uint16_t fp) const noexcept {
+        const size_t offset = reduce(fp * 0x9e3779b97f4a7c15ull);
+        return offset >= bucket ? offset - bucket : offset + buckets_.size() - bucket;
+    }
+
+    /// One high bit per 16-bit lane of word that equals zero; the lowest set
+    /// bit is exact, higher ones may be spurious.
+    static std::uint64_t zeroLanes(const std::uint64_t word) noexcept {
+        return (word - LANES) & ~word & HIGH_BITS;
+    }
+
+    static std::uint64_t matchingLanes(const std::uint64_t bucket, const std::uint16_t fp) noexcept {
+        return zeroLanes(bucket ^ (fp * LANES));
+    }
+
+    /// Bit offset of the lane flagged by the lowest bit of lanes.
+    static int laneShift(const std::uint64_t lanes) noexcept {
+        return std::countr_zero(lanes) & ~15;
+    }
+
+    /// Puts fp into a free slot of bucket, if there is one.
+    bool tryPlace(const size_t bucket, const std::uint16_t fp) noexcept {
+        const std::uint64_t empty = zeroLanes(buckets_[bucket]);
+        if (empty == 0)
+            return false;
+        buckets_[bucket] |= static_cast<std::uint64_t>(fp) << laneShift(empty);
+        return true;
+    }
+
+    /// Removes one copy of fp from bucket, if present.
+    bool tryErase(const size_t bucket, const std::uint16_t fp) noexcept {
+        const std::uint64_t match = matchingLanes(buckets_[bucket], fp);
+        if (match == 0)
+            return false;
+        buckets_[bucket] &= ~(std::uint64_t{0xffff} << laneShift(match));
+        return true;
+    }
+
+    /**
+     * @brief Stores fp in bucket or its alternate, relocating fingerprints
+     * if both are full.
+     *
+     * After MAX_KICKS relocations the fingerprint left homeless becomes the
+     * victim.
+     */
+    void place(size_t bucket, std::uint16_t fp) noexcept {
+        if (tryPlace(bucket, fp) || tryPlace(bucket = alternateOf(bucket, fp), fp))
+            return;
+
+        // Evict a random fingerprint of bucket and move it to its other bucket.
+        for (size_t kick = 0; kick < MAX_KICKS; ++kick) {
+            const int shift = static_cast<int>(nextRandom() % SLOTS) * 16;
+            const auto evicted = static_cast<std::uint16_t>(buckets_[bucket] >> shift);
+            buckets_[bucket] = (buckets_[bucket] & ~(std::uint64_t{0xffff} << shift)) |
+                               (static_cast<std::uint64_t>(fp) << shift);
+            fp = evicted;
+            bucket = alternateOf(bucket, fp);
+            if (tryPlace(bucket, fp))
+                return;
+        }
+        victim_ = fp;
+        victim_bucket_ = bucket;
+    }
+
+    std::uint64_t nextRandom() noexcept {
+        random_ ^= random_ << 13;
+        random_ ^= random_ >> 7;
+        random_ ^= random_ << 17;
+        return random_;
+    }
+
+  public:
+    /**
+     * @brief Creates an empty filter with room for at least capacity keys.
+     *
+     * @param capacity The number of keys to be inserted.
+     */
+    explicit CuckooFilter(const size_t capacity) : hasher_() {
+        const size_t buckets = capacity / SLOTS + capacity / (SLOTS * 19) + 1; // 95% load
+        buckets_ = DynamicArray<std::uint64_t>(buckets);
+        for (size_t i = 0; i < buckets; ++i)
+            buckets_.addLast(0);
+    }
+
+
+    /**
+     * @brief Adds a key.
+     *
+     * @return bool true if the key was added, false if the filter is full.
+     */
+    bool insert(const Key& key) { return insertHash(hasher_(key)); }
+
+    /**
+     * @brief Adds a key given its hash.
+     *
+     * @return bool true if the key was added, false if the filter is full.
+     */
+    bool insertHash(const size_t hash) noexcept {
+        if (victim_ != 0)
+            return false;
+
+        // The key is always stored; if the table is too full, some
+        // fingerprint is left over as the victim.
+        place(bucketOf(hash), fingerprintOf(hash));
+        ++count_;
+        return true;
+    }
+
+
+    /// Checks if key may have been inserted; false means it definitely was
+    /// not (or was removed).
+    [[nodiscard]]
+    bool mayContain(const Key& key) const {
+        return mayContainHash(hasher_(key));
+    }
+
+    /// mayContain() for a hash computed elsewhere.
+    [[nodiscard]]
+    bool mayContainHash(const size_t hash) const noexcept {
+        const std::uint16_t fp = fingerprintOf(hash);
+        const size_t first = bucketOf(hash);
+        const size_t second = alternateOf(first, fp);
+        if ((matchingLanes(buckets_[first], fp) | matchingLanes(buckets_[second], fp)) != 0)
+            return true;
+        return victim_ == fp && (victim_bucket_ == first || victim_bucket_ == second);
+    }
+
+
+    /**
+     * @brief Removes a key that was inserted.
+     *
+     * @return bool true if a matching fingerprint was removed.
+     */
+    bool remove(const Key& key) { return removeHash(hasher_(key)); }
+
+    /// remove() for a hash computed elsewhere.
+    bool removeHash(const size_t hash) noexcept {
+        const std::uint16_t fp = fingerprintOf(hash);
+        const size_t first = bucketOf(hash);
+        const size_t second = alternateOf(first, fp);
+
+        if (victim_ == fp && (victim_bucket_ == first || victim_bucket_ == second)) {
+            victim_ = 0;
+            --count_;
+            return true;
+        }
+        if (!tryErase(first, fp) && !tryErase(second, fp))
+            return false;
+        --count_;
+
+        // Give the fingerprint kept aside another chance to find a slot.
+        if (victim_ != 0) {
+            const std::uint16_t fp_aside = std::exchange(victim_, 0);
+            place(victim_bucket_, fp_aside);
+        }
+        return true;
+    }
+
+
+    /// Removes every key, keeping the size of the filter.
+    void clear() noexcept {
+        for (std::uint64_t& bucket : buckets_)
+            bucket = 0;
+        count_ = 0;
+        victim_ = 0;
+    }
+
+    /// Returns the number of keys stored.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return count_;
+    }
+
+    /// Returns the number of fingerprint slots.
+    [[nodiscard]]
+    size_t slotCount() const noexcept {
+        return buckets_.size() * SLOTS;
+    }
+
+    /// Returns the memory used by the table.
+    [[nodiscard]]
+    size_t byteSize() const noexcept {
+        return buckets_.size() * sizeof(std::uint64_t);
+    }
+
+    /// Returns the expected false-positive rate at the current load: a
+    /// query compares against 2 · SLOTS slots, each occupied with
+    /// probability load and matching with probability 1 / 65535.
+    [[nodiscard]]
+    double falsePositiveRate() const noexcept {
+        const double load = static_cast<double>(count_) / static_cast<double>(slotCount());
+        return 2.0 * SLOTS * load / 65535.0;
+    }
+};
+
+
+} // namespace containers
+
+
+#endif // CUCKOO_FILTER_HPP
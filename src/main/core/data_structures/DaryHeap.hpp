@@ -0,0 +1,378 @@
+#ifndef DARY_HEAP_HPP
+#define DARY_HEAP_HPP
+
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "Instrumentation.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace heap_detail {
+
+using array_algorithms::SORT_EVENT_COMPARE;
+using array_algorithms::SORT_EVENT_SWAP;
+
+
+/**
+ * @brief Sift kernels of an implicit d-ary heap stored in data[0 .. size).
+ *
+ * The children of slot i are the slots Arity * i + 1 .. Arity * i + Arity.
+ * The top is the greatest element with respect to less (a max-heap for
+ * std::less, as with std::priority_queue). Values move through a "hole"
+ * instead of being swapped, so each level costs one move rather than three.
+ *
+ * The kernels are shared by DaryHeap and array_algorithms::HeapSort(), and
+ * report what they do to callback in the event convention of the sort
+ * callbacks (see Instrumentation.hpp), with indices offset by base:
+ * SORT_EVENT_COMPARE for comparing slots a and b, SORT_EVENT_SWAP for the swap
+ * that moving the hole from a to b is equivalent to. Replaying the swaps
+ * reproduces the final contents. Pass a no-op callable to report nothing.
+ */
+
+/// Places value at slot i and moves it towards the top while it is greater
+/// than its parent. Returns the slot it ends up in.
+template <size_t Arity, typename Type, typename Less, typename Callback>
+size_t siftUp(Type* data, size_t i, Type value, Less& less, Callback& callback,
+              const size_t base = 0) {
+    while (i > 0) {
+        const size_t parent = (i - 1) / Arity;
+        callback(SORT_EVENT_COMPARE, base + parent, base + i);
+        if (!less(data[parent], value))
+            break;
+        callback(SORT_EVENT_SWAP, base + parent, base + i);
+        data[i] = std::move(data[parent]);
+        i = parent;
+    }
+    data[i] = std::move(value);
+    return i;
+}
+
+
+/// Places value at slot i of a heap of size elements and moves it away from
+/// the top while one of its children is greater. Returns the final slot.
+template <size_t Arity, typename Type, typename Less, typename Callback>
+size_t siftDown(Type* data, const size_t size, size_t i, Type value, Less& less,
+                Callback& callback, const size_t base = 0) {
+    while (true) {
+        const size_t first = Arity * i + 1;
+        if (first >= size)
+            break;
+
+        // Greatest child; a full node is scanned without early exits.
+        const size_t last = size - first < Arity ? size : first + Arity;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; ++child) {
+            callback(SORT_EVENT_COMPARE, base + child, base + best);
+            best = less(data[best], data[child]) ? child : best;
+        }
+
+        callback(SORT_EVENT_COMPARE, base + i, base + best);
+        if (!less(value, data[best]))
+            break;
+        callback(SORT_EVENT_SWAP, base + i, base + best);
+        data[i] = std::move(data[best]);
+        i = best;
+    }
+    data[i] = std::move(value);
+    return i;
+}
+
+
+/// Rearranges data[0 .. size) into a heap bottom-up (Floyd), in O(n).
+template <size_t Arity, typename Type, typename Less, typename Callback>
+void makeHeap(Type* data, const size_t size, Less& less, Callback& callback,
+              const size_t base = 0) {
+    if (size <= 1)
+        return;
+    for (size_t i = (size - 2) / Arity + 1; i-- > 0;)
+        siftDown<Arity>(data, size, i, std::move(data[i]), less, callback, base);
+}
+
+
+/// Moves the top of the heap data[0 .. size) to data[size - 1] and restores
+/// the heap on the remaining size - 1 elements.
+template <size_t Arity, typename Type, typename Less, typename Callback>
+void popHeap(Type* data, const size_t size, Less& less, Callback& callback,
+             const size_t base = 0) {
+    if (size <= 1)
+        return;
+    callback(SORT_EVENT_SWAP, base, base + size - 1);
+    Type value = std::move(data[size - 1]);
+    data[size - 1] = std::move(data[0]);
+    siftDown<Arity>(data, size - 1, 0, std::move(value), less, callback, base);
+}
+
+
+/// Callback of the container operations, which report nothing.
+struct Silent {
+    template <typename... Args>
+    constexpr void operator()(Args&&...) const noexcept {}
+};
+
+} // namespace heap_detail
+
+
+/**
+ * @class DaryHeap
+ * @brief Array-backed implicit d-ary heap, usable as a priority queue.
+ *
+ * The elements live contiguously in a DynamicArray in level order; the
+ * children of slot i are slots Arity * i + 1 .. Arity * i + Arity. Compared
+ * with the pointer-based MinHeap/MaxHeap there are no nodes to allocate, no
+ * path walk to find the last slot, and with the default 4-ary layout the
+ * children of a node usually share one cache line while the tree is half as
+ * deep as a binary one.
+ *
+ * The top is the greatest element according to Compare, so the default
+ * std::less gives a max-heap and std::greater a min-heap (see MinDaryHeap
+ * and MaxDaryHeap).
+ *
+ * @tparam Type Element type. Must be move constructible and assignable.
+ * @tparam Arity Number of children per node, at least 2. Defaults to 4.
+ * @tparam Compare Strict weak ordering. Defaults to std::less<Type>.
+ * @tparam Allocator Allocator of the underlying DynamicArray.
+ */
+template <typename Type, size_t Arity = 4, typename Compare = std::less<Type>,
+          typename Allocator = std::allocator<Type>>
+class DaryHeap {
+    static_assert(Arity >= 2, "A heap node needs at least two children.");
+
+    DynamicArray<Type, Allocator> data_;
+    [[no_unique_address]] Compare compare_;
+
+
+    /// Restores the heap property over all elements.
+    void heapify() {
+        heap_detail::Silent silent;
+        heap_detail::makeHeap<Arity>(data_.begin(), data_.size(), compare_, silent);
+    }
+
+
+    /// Checks the heap property of every parent against its children.
+    bool holdsHeapProperty() const {
+        const Type* data = data_.begin();
+        for (size_t child = 1; child < data_.size(); ++child)
+            if (compare_(data[(child - 1) / Arity], data[child]))
+                return false;
+        return true;
+    }
+
+
+  public:
+    /// Default constructor creates an empty heap.
+    DaryHeap() = default;
+
+    /// Creates an empty heap with the given ordering and allocator.
+    explicit DaryHeap(const Compare& compare, const Allocator& allocator = Allocator())
+        : data_(allocator), compare_(compare) {}
+
+    /**
+     * @brief Builds a heap from the elements of an array in O(n).
+     *
+     * The array is taken over (moved in or copied) and rearranged bottom-up,
+     * which is cheaper than n insertions.
+     *
+     * @param elements The initial elements, in any order.
+     * @param compare The ordering.
+     */
+    explicit DaryHeap(DynamicArray<Type, Allocator> elements, const Compare& compare = Compare())
+        : data_(std::move(elements)), compare_(compare) {
+        heapify();
+    }
+
+    /// Constructor for braced-init-lists; heapifies in O(n).
+    DaryHeap(std::initializer_list<Type> initial_data, const Compare& compare = Compare())
+        : data_(initial_data.size()), compare_(compare) {
+        for (const Type& element : initial_data)
+            data_.addLast(element);
+        heapify();
+    }
+
+    /**
+     * @brief Builds a heap from a C array of elements in O(n).
+     *
+     * @param array Pointer to the elements to copy.
+     * @param size The number of elements in the array.
+     */
+    DaryHeap(const Type* array, const size_t size) : data_(size) {
+        for (size_t i = 0; i < size; ++i)
+            data_.addLast(array[i]);
+        heapify();
+    }
+
+
+    /// Returns the number of elements in the heap.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return data_.size();
+    }
+
+    /// Checks if the heap is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return data_.isEmpty();
+    }
+
+    /// Removes every element; the storage is kept.
+    void clear() noexcept {
+        data_.removeAll();
+    }
+
+    /// Ensures room for at least capacity elements without reallocation.
+    void reserve(const size_t capacity) {
+        data_.reserve(capacity);
+    }
+
+    /// Number of children per node.
+    [[nodiscard]]
+    static constexpr size_t arity() noexcept {
+        return Arity;
+    }
+
+
+    /**
+     * @brief Access the top element without removing it.
+     * @throws std::out_of_range if the heap is empty.
+     * @complexity O(1).
+     */
+    [[nodiscard]]
+    const Type& peekRoot() const {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+        return data_.begin()[0];
+    }
+
+
+    /**
+     * @brief Inserts an element.
+     *
+     * @tparam U The type of the element, constructible into Type.
+     * @param element The element to insert.
+     *
+     * @complexity Time: O(log_d n) comparisons, amortized O(1) growth.
+     */
+    template <typename U>
+    void insert(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        emplace(std::forward<U>(element));
+    }
+
+    /// Constructs an element in place from args and inserts it.
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        Type value(std::forward<Args>(args)...);
+        data_.emplaceLast(std::move(value));
+        heap_detail::Silent silent;
+        heap_detail::siftUp<Arity>(data_.begin(), data_.size() - 1,
+                                   std::move(data_.begin()[data_.size() - 1]), compare_,
+                                   silent);
+    }
+
+
+    /**
+     * @brief Removes and returns the top element.
+     *
+     * @return The former top (moved).
+     * @throws std::out_of_range if the heap is empty.
+     *
+     * @complexity Time: O(d log_d n) comparisons.
+     */
+    Type extractRoot() {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+
+        Type* data = data_.begin();
+        Type out = std::move(data[0]);
+        Type last = std::move(data[data_.size() - 1]);
+        data_.popBack();
+        if (!data_.isEmpty()) {
+            heap_detail::Silent silent;
+            heap_detail::siftDown<Arity>(data_.begin(), data_.size(), 0, std::move(last),
+                                         compare_, silent);
+        }
+        return out;
+    }
+
+
+    /**
+     * @brief Inserts element, then removes and returns the top; fused into
+     * one sift.
+     *
+     * If element would become the new top it is returned right away and the
+     * heap is left untouched. Useful for keeping the k best of a stream in a
+     * heap of k elements.
+     *
+     * @return The top of the heap after inserting element, removed.
+     * @complexity Time: O(1) if element is the greatest, else O(d log_d n).
+     */
+    template <typename U>
+    Type pushPop(U&& element) {
+        Type value(std::forward<U>(element));
+        if (isEmpty() || !compare_(value, data_.begin()[0]))
+            return value;
+
+        Type* data = data_.begin();
+        Type out = std::move(data[0]);
+        heap_detail::Silent silent;
+        heap_detail::siftDown<Arity>(data, data_.size(), 0, std::move(value), compare_, silent);
+        return out;
+    }
+
+
+    /**
+     * @brief Removes and returns the top, then inserts element; fused into
+     * one sift.
+     *
+     * Unlike pushPop() the old top is returned even if element is greater.
+     *
+     * @return The former top (moved).
+     * @throws std::out_of_range if the heap is empty.
+     * @complexity Time: O(d log_d n).
+     */
+    template <typename U>
+    Type replaceTop(U&& element) {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+
+        Type value(std::forward<U>(element));
+        Type* data = data_.begin();
+        Type out = std::move(data[0]);
+        heap_detail::Silent silent;
+        heap_detail::siftDown<Arity>(data, data_.size(), 0, std::move(value), compare_, silent);
+        return out;
+    }
+
+
+    /// Checks the heap property of every node.
+    [[nodiscard]]
+    bool isValidHeap() const {
+        return holdsHeapProperty();
+    }
+};
+
+
+/// 4-ary array-backed min-heap.
+template <typename Type, size_t Arity = 4, typename Allocator = std::allocator<Type>>
+using MinDaryHeap = DaryHeap<Type, Arity, std::greater<Type>, Allocator>;
+
+/// 4-ary array-backed max-heap.
+template <typename Type, size_t Arity = 4, typename Allocator = std::allocator<Type>>
+using MaxDaryHeap = DaryHeap<Type, Arity, std::less<Type>, Allocator>;
+
+
+} // namespace containers
+
+
+#endif // DARY_HEAP_HPP
@@ -0,0 +1,493 @@
+#ifndef DEFAULT_HASH_HPP
+#define DEFAULT_HASH_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace hash_detail {
+
+/// Non-string keys have no transparent lookup types.
+template <typename Key>
+struct TransparentKey {};
+
+/// String keys can be looked up by anything convertible to a string view of
+/// the same character type; both hash the same characters.
+template <typename CharT, typename Alloc>
+struct TransparentKey<std::basic_string<CharT, std::char_traits<CharT>, Alloc>> {
+    using is_transparent = void;
+    using view_type = std::basic_string_view<CharT>;
+};
+
+
+/// Strings and string views with the standard character traits, which are
+/// hashed by their characters.
+template <typename Key>
+struct IsStringLike : std::false_type {};
+
+template <typename CharT, typename Alloc>
+struct IsStringLike<std::basic_string<CharT, std::char_traits<CharT>, Alloc>> : std::true_type {};
+
+template <typename CharT>
+struct IsStringLike<std::basic_string_view<CharT, std::char_traits<CharT>>> : std::true_type {};
+
+
+/// Loads 8 bytes (4 for read32) in native byte order.
+inline std::uint64_t read64(const unsigned char* p) noexcept {
+    std::uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline std::uint64_t read32(const unsigned char* p) noexcept {
+    std::uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+
+/// Full 64 x 64 -> 128-bit product: low half into a, high half into b.
+inline void multiply128(std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+    const uint128 r = static_cast<uint128>(a) * b;
+    a = static_cast<std::uint64_t>(r);
+    b = static_cast<std::uint64_t>(r >> 64);
+#else
+    const std::uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<std::uint32_t>(a),
+                        lb = static_cast<std::uint32_t>(b);
+    const std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t carry = t < rl;
+    const std::uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+/// Multiplies and folds the 128-bit product to 64 bits.
+inline std::uint64_t mix128(std::uint64_t a, std::uint64_t b) noexcept {
+    multiply128(a, b);
+    return a ^ b;
+}
+
+
+/**
+ * @brief Hashes a byte sequence (wyhash, final version 4).
+ *
+ * Consumes 48 bytes per iteration in three independent multiply chains,
+ * so long keys run at several bytes per cycle; keys of up to 16 bytes
+ * take two overlapping loads and two multiplications, with no loop.
+ *
+ * @param data The bytes to hash.
+ * @param len The number of bytes.
+ * @param seed Seed mixed into the result.
+ * @return std::uint64_t The hash value.
+ */
+inline std::uint64_t hashBytes(const void* data, const size_t len, std::uint64_t seed) noexcept {
+    constexpr std::uint64_t SECRET[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+                                         0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+    const auto* p = static_cast<const unsigned char*>(data);
+    seed ^= mix128(seed ^ SECRET[0], SECRET[1]);
+
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (len <= 16) {
+        if (len >= 4) {
+            // Two pairs of possibly overlapping 4-byte loads cover 4..16 bytes.
+            const size_t shift = (len >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + shift);
+            b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+        } else if (len > 0) {
+            a = (static_cast<std::uint64_t>(p[0]) << 16) | (static_cast<std::uint64_t>(p[len >> 1]) << 8) |
+                p[len - 1];
+        }
+    } else {
+        size_t remaining = len;
+        if (remaining > 48) {
+            std::uint64_t seed1 = seed;
+            std::uint64_t seed2 = seed;
+            do {
+                seed = mix128(read64(p) ^ SECRET[1], read64(p + 8) ^ seed);
+                seed1 = mix128(read64(p + 16) ^ SECRET[2], read64(p + 24) ^ seed1);
+                seed2 = mix128(read64(p + 32) ^ SECRET[3], read64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = mix128(read64(p) ^ SECRET[1], read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        // The last 16 bytes, overlapping what was already consumed.
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+
+    a ^= SECRET[1];
+    b ^= seed;
+    multiply128(a, b);
+    return mix128(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+
+} // namespace hash_detail
+
+
+/** @class DefaultHash
+ *
+ * @brief A universal hash functor that works with any hashable type.
+ *
+ * This hash functor provides automatic compile-time dispatch to appropriate
+ * hashing strategies based on the key type:
+ *
+ * - Integral types (int, char, bool, etc.): Uses SplitMix64 mixing for
+ * excellent distribution
+ * - Pointer types: Removes alignment bits and applies SplitMix64 mixing
+ * - Enumeration types: Hashes via underlying integral type
+ * - Strings and string views: Hashes the characters with wyhash
+ * - Other standard library types: Delegates to std::hash<T> with
+ * additional mixing
+ * - User-defined types: Uses std::hash<T> if specialized; otherwise
+ * trivially copyable types without padding are hashed by their bytes
+ * (SplitMix64 up to 8 bytes, wyhash beyond)
+ *
+ * For integral and enumeration keys, hashBatch() hashes a whole array in a
+ * loop the compiler can vectorize.
+ *
+ * The hash function incorporates an optional random seed to provide protection
+ * against hash collision attacks while maintaining deterministic behavior when
+ * needed.
+ *
+ * For std::basic_string keys the functor is transparent (it defines
+ * is_transparent): string views and C strings hash to the same value as the
+ * equivalent string, so containers can look them up without building a
+ * temporary key.
+ *
+ * @tparam Key The type of the key to be hashed.
+ * @tparam UseRandomSeed Whether to use a random seed (true) or deterministic seed (false).
+ */
+template <typename Key, bool UseRandomSeed = true>
+struct DefaultHash : hash_detail::TransparentKey<Key> {
+    /**
+     * @brief Computes the hash value for the given key.
+     *
+     * This operator automatically selects the most appropriate hashing strategy
+     * for the key type at compile time. The hash value incorporates mixing to
+     * ensure good distribution properties.
+     *
+     * @param key The key to be hashed.
+     * @return size_t A well-distributed hash value for the key.
+     */
+    [[nodiscard]]
+    constexpr size_t operator()(const Key& key) const noexcept {
+        return hash_dispatch(key);
+    }
+
+
+    /**
+     * @brief Hashes a string-like value as if it were the equivalent string
+     * key (only available for string keys).
+     *
+     * @tparam K A type convertible to the key's string view type.
+     * @param key The value to be hashed.
+     * @return size_t The hash the equivalent Key would have.
+     */
+    template <typename K>
+        requires(!std::is_same_v<K, Key> &&
+                 std::is_convertible_v<const K&, typename hash_detail::TransparentKey<Key>::view_type>)
+    [[nodiscard]]
+    constexpr size_t operator()(const K& key) const noexcept {
+        using view_type = typename hash_detail::TransparentKey<Key>::view_type;
+        return hash_string(view_type(key));
+    }
+
+
+    /**
+     * @brief Hashes an array of integral or enumeration keys.
+     *
+     * out[i] receives exactly operator()(keys[i]). The loop has no
+     * dependencies between keys, so the compiler vectorizes the SplitMix64
+     * mixing, which makes bulk loads and hash partitioning of large key
+     * arrays several times faster than hashing one key per call.
+     *
+     * @param keys The keys to hash.
+     * @param count The number of keys.
+     * @param out Receives count hash values.
+     */
+    static void hashBatch(const Key* keys, const size_t count, size_t* out) noexcept
+        requires(std::is_integral_v<Key> || std::is_enum_v<Key>)
+    {
+        const size_t seed = seed_;
+        for (size_t i = 0; i < count; ++i) {
+            if constexpr (std::is_enum_v<Key>)
+                out[i] = splitmix64(static_cast<size_t>(static_cast<std::underlying_type_t<Key>>(keys[i])) ^ seed);
+            else
+                out[i] = splitmix64(static_cast<size_t>(keys[i]) ^ seed);
+        }
+    }
+
+
+  private:
+    /**
+     * @brief Dispatches to the appropriate hash function based on the key type.
+     *
+     * This method uses compile-time type traits and constexpr if to select
+     * the optimal hashing strategy for each type category. The dispatch is
+     * resolved at compile time with zero runtime overhead.
+     *
+     * @param key The key to be hashed.
+     * @return size_t The computed hash value.
+     */
+    [[nodiscard]]
+    static constexpr size_t hash_dispatch(const Key& key) noexcept {
+        if constexpr (std::is_integral_v<Key>)
+            return hash_integral(static_cast<size_t>(key));
+
+        else if constexpr (std::is_pointer_v<Key>)
+            return hash_pointer(reinterpret_cast<uintptr_t>(key));
+
+        else if constexpr (std::is_enum_v<Key>)
+            return hash_enum(key);
+
+        else if constexpr (hash_detail::IsStringLike<Key>::value)
+            return hash_string(key);
+
+        else if constexpr (has_std_hash_v<Key>)
+            return hash_with_std_hash(key);
+
+        else if constexpr (std::is_trivially_copyable_v<Key> && std::has_unique_object_representations_v<Key>)
+            return hash_object(key);
+
+        else {
+            static_assert(always_false_v<Key>,
+                          "No hash function available for this type. "
+                          "Please specialize std::hash<YourType> or provide a "
+                          "custom Hash functor. "
+                          "See documentation for examples.");
+        }
+        return 0; // Unreachable, but required to satisfy compiler
+    }
+
+
+    /// SFINAE-based detection of std::hash availability
+    template <typename T>
+    class has_std_hash {
+        /// Test function that checks if std::hash<T> is valid
+        template <typename U>
+        static auto test(int)
+            -> decltype(std::hash<U>{}(std::declval<const U&>()),
+                        std::true_type{});
+
+        /// Fallback if std::hash<T> is not valid
+        template <typename>
+        static std::false_type test(...);
+
+      public:
+        static constexpr bool value = decltype(test<T>(0))::value;
+    };
+
+
+    /// Helper variable template for std::hash detection
+    template <typename T>
+    static constexpr bool has_std_hash_v = has_std_hash<T>::value;
+
+    /// Helper for static_assert in template else branch (dependent, so it
+    /// only fires when the branch is actually instantiated)
+    template <typename>
+    static constexpr bool always_false_v = false;
+
+
+    /**
+     * @brief Hashes integral types using SplitMix64 mixing.
+     *
+     * Applies high-quality bit mixing to prevent clustering that occurs
+     * with identity hashing of sequential integers. Uses the SplitMix64
+     * finalizer which provides excellent avalanche properties.
+     *
+     * @param key The integral key cast to size_t.
+     * @return size_t Well-distributed hash value.
+     */
+    [[nodiscard]]
+    static constexpr size_t hash_integral(const size_t key) noexcept {
+        return splitmix64(key ^ seed_);
+    }
+
+
+    /**
+     * @brief Hashes pointer types with alignment-aware processing.
+     *
+     * Removes the lower bits that are typically zero due to memory alignment,
+     * then applies SplitMix64 mixing. This approach works well for both
+     * heap pointers and stack pointers.
+     *
+     * @param ptr The pointer address as uintptr_t.
+     * @return size_t Well-distributed hash value.
+     */
+    [[nodiscard]]
+    static constexpr size_t hash_pointer(uintptr_t ptr) noexcept {
+        // Remove lower 3 bits (assumes 8-byte alignment)
+        ptr >>= 3;
+        return splitmix64(ptr ^ seed_);
+    }
+
+
+    /**
+     * @brief Hashes enumeration types via their underlying integral type.
+     *
+     * Converts the enum to its underlying type and delegates to integral
+     * hashing. This works for both scoped (enum class) and unscoped enums.
+     *
+     * @tparam Enum The enumeration type.
+     * @param e The enumeration value to hash.
+     * @return size_t Well-distributed hash value.
+     */
+    template <typename Enum>
+    [[nodiscard]]
+    static constexpr size_t hash_enum(const Enum& e) noexcept {
+        using underlying_t = std::underlying_type_t<Enum>;
+        return hash_integral(static_cast<size_t>(static_cast<underlying_t>(e)));
+    }
+
+
+    /**
+     * @brief Hashes types with std::hash specialization.
+     *
+     * Delegates to std::hash<T> and then applies additional SplitMix64 mixing
+     * to ensure consistent quality across different std::hash implementations.
+     * This handles std::string, std::vector, and other standard library types.
+     *
+     * @tparam T The type to hash (must have std::hash specialization).
+     * @param value The value to hash.
+     * @return size_t Well-distributed hash value.
+     */
+    template <typename T>
+    [[nodiscard]]
+    static constexpr size_t hash_with_std_hash(const T& value) noexcept {
+        const size_t base_hash = std::hash<T>{}(value);
+        return splitmix64(base_hash ^ seed_);
+    }
+
+
+    /**
+     * @brief Hashes the characters of a string or string view.
+     *
+     * wyhash over the character bytes replaces std::hash, which costs a
+     * second mixing step on top of its own byte hash. Strings and their
+     * views hash alike, which transparent lookups rely on.
+     *
+     * @tparam String A std::basic_string or std::basic_string_view.
+     * @param value The string to hash.
+     * @return size_t Well-distributed hash value.
+     */
+    template <typename String>
+    [[nodiscard]]
+    static size_t hash_string(const String& value) noexcept {
+        using CharT = typename String::value_type;
+        return static_cast<size_t>(hash_detail::hashBytes(value.data(), value.size() * sizeof(CharT), seed_));
+    }
+
+
+    /**
+     * @brief Hashes a trivially copyable object by its bytes.
+     *
+     * Only used for types without padding, where equal values have equal
+     * bytes. Objects of up to 8 bytes are loaded as one integer and mixed
+     * with SplitMix64.
+     *
+     * @param value The object to hash.
+     * @return size_t Well-distributed hash value.
+     */
+    [[nodiscard]]
+    static size_t hash_object(const Key& value) noexcept {
+        if constexpr (sizeof(Key) <= sizeof(std::uint64_t)) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(Key));
+            return hash_integral(static_cast<size_t>(bits));
+        } else {
+            return static_cast<size_t>(hash_detail::hashBytes(&value, sizeof(Key), seed_));
+        }
+    }
+
+
+    /**
+     * @brief SplitMix64 mixing function for high-quality hash distribution.
+     *
+     * This is the finalizer from the SplitMix64 algorithm, known for excellent
+     * avalanche properties. Each input bit influences approximately half of the
+     * output bits, providing strong mixing that eliminates patterns in input
+     * data.
+     *
+     * The constants used are:
+     * - 0x9e3779b97f4a7c15: The golden ratio * 2^64, provides good stepping
+     * - 0xbf58476d1ce4e5b9, 0x94d049bb133111eb: Large odd multipliers with good
+     * bit mixing
+     *
+     * @param x The input value to mix.
+     * @return size_t The mixed hash value with excellent distribution
+     * properties.
+     */
+    [[nodiscard]]
+    static constexpr size_t splitmix64(size_t x) noexcept {
+        x += 0x9e3779b97f4a7c15ull; // Golden ratio * 2^64
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+
+    /**
+     * @brief Initializes a cryptographically random seed.
+     *
+     * Uses std::random_device to generate a high-quality random seed.
+     * The seed is combined from two 32-bit values to ensure full 64-bit entropy
+     * even on platforms where std::random_device returns 32-bit values.
+     *
+     * @return size_t A random seed value.
+     */
+    static size_t init_random_seed() {
+        std::random_device rd;
+        return (static_cast<size_t>(rd()) << 32) ^ static_cast<size_t>(rd());
+    }
+
+
+    /**
+     * @brief Returns the seed based on the UseRandomSeed template parameter.
+     *
+     * When UseRandomSeed is true, generates a random seed for hash collision
+     * resistance. When false, uses a fixed seed for deterministic behavior
+     * (useful for testing).
+     *
+     * @return size_t The seed value to use for hashing.
+     */
+    static constexpr size_t get_seed() {
+        if constexpr (UseRandomSeed) {
+            return init_random_seed();
+        } else {
+            // Fixed seed derived from golden ratio for deterministic behavior
+            return 0x9e3779b97f4a7c15ull;
+        }
+    }
+
+    /// Static seed shared by all instances of this hash specialization
+    inline static const size_t seed_ = get_seed();
+};
+
+
+} // namespace containers
+
+
+#endif // DEFAULT_HASH_HPP
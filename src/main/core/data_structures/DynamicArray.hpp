@@ -3,13 +3,18 @@
 
 
 #include <cassert>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <new>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
-#include <memory>
+
+#include "CapacityPolicy.hpp"
 
 
 namespace containers {
@@ -17,6 +22,46 @@ namespace containers {
 using std::size_t;
 
 
+/**
+ * @brief Marks types whose objects can be moved to a new address by copying
+ * their bytes, without running the move constructor and the destructor.
+ *
+ * Trivially copyable types qualify automatically. Other types may opt in by
+ * specializing this trait as std::true_type, provided an object does not
+ * keep pointers into itself and nothing else tracks its address (e.g. types
+ * that only own heap memory through a std::unique_ptr).
+ *
+ * @tparam Type The type to query.
+ */
+template <typename Type>
+struct is_trivially_relocatable : std::is_trivially_copyable<Type> {};
+
+/// Shorthand for is_trivially_relocatable<Type>::value.
+template <typename Type>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+
+namespace detail {
+
+/// Raw, suitably aligned in-object storage for Capacity elements.
+template <typename Type, size_t Capacity>
+struct InlineStorage {
+    alignas(Type) unsigned char bytes[sizeof(Type) * Capacity];
+
+    Type* data() noexcept { return reinterpret_cast<Type*>(bytes); }
+    const Type* data() const noexcept { return reinterpret_cast<const Type*>(bytes); }
+};
+
+/// No inline storage: the array always lives on the heap.
+template <typename Type>
+struct InlineStorage<Type, 0> {
+    Type* data() noexcept { return nullptr; }
+    const Type* data() const noexcept { return nullptr; }
+};
+
+} // namespace detail
+
+
 /**
  * @class DynamicArray
  * @brief A vector-like, resizable, contiguous container with explicit lifetime
@@ -29,24 +74,64 @@ using std::size_t;
  *   - Support appends, prepends, middle inserts, and removals.
  *   - Offer strong exception safety for the operations that change capacity or
  * rebuild storage.
- *   - Correctly handle over-aligned types by using the aligned forms of
- * ::operator new/delete.
+ *   - Obtain its storage from a pluggable allocator, so arenas and monotonic
+ * buffers (e.g. through std::pmr::polymorphic_allocator) can back it.
  *
  * Elements are only constructed for the logical size; capacity refers to the
  * amount of raw storage available to hold additional elements without
  * reallocation. The container manually manages object lifetimes
  * (construct/destroy) independently from raw storage (allocate/deallocate).
+ * The allocator only supplies the raw storage; elements are constructed with
+ * placement new. std::allocator (the default) honours over-aligned types.
+ *
+ * Allocators follow the usual allocator-aware container rules: copies use
+ * select_on_container_copy_construction, and assignment propagates the
+ * allocator only when the allocator traits ask for it. Move assignment
+ * between unequal, non-propagating allocators moves element by element.
+ *
+ * With a non-zero InlineCapacity the first InlineCapacity elements live in a
+ * buffer inside the object itself (small-buffer optimization); the allocator
+ * is only used once the array grows beyond that, and shrinking back to
+ * InlineCapacity returns to the inline buffer. Moving an array that is using
+ * its inline buffer moves the elements rather than the storage.
+ *
+ * CapacityPolicy picks the growth factor and when removals give memory back
+ * (see CapacityPolicy.hpp). The default doubles when full and halves the
+ * capacity once only a quarter of it is in use.
  *
  * @tparam Type The element type stored by the container.
+ * @tparam Allocator The allocator providing raw storage. Defaults to
+ * std::allocator<Type>.
+ * @tparam InlineCapacity Number of elements stored inside the object before
+ * spilling to the allocator. Defaults to 0 (no inline storage).
+ * @tparam CapacityPolicy Growth and shrink policy. Defaults to
+ * ShrinkWhenSparse<>.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>,
+          size_t InlineCapacity = 0, typename CapacityPolicy = ShrinkWhenSparse<>>
 class DynamicArray {
 
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename AllocTraits::value_type, Type>,
+                  "Allocator::value_type must be the element type");
+
     Type* data_;
     size_t size_;
     size_t capacity_;
+    [[no_unique_address]] Allocator allocator_;
+    [[no_unique_address]] detail::InlineStorage<Type, InlineCapacity> inline_;
+    [[no_unique_address]] CapacityPolicy capacity_policy_;
+
+    static constexpr size_t DEFAULT_CAPACITY = InlineCapacity > 0 ? InlineCapacity : 5;
 
-    static constexpr size_t DEFAULT_CAPACITY = 5;
+    /// Whether elements are relocated with memcpy/memmove rather than by
+    /// per-element move construction and destruction.
+    static constexpr bool RELOCATE_BITWISE = is_trivially_relocatable_v<Type>;
+
+    /// Whether moving the storage of another array may have to move elements.
+    static constexpr bool NOTHROW_STEAL = InlineCapacity == 0 || RELOCATE_BITWISE ||
+                                          std::is_nothrow_move_constructible_v<Type>;
 
     static constexpr size_t MAX_CAPACITY =
         std::numeric_limits<size_t>::max() / sizeof(Type);
@@ -57,12 +142,14 @@ class DynamicArray {
 
     /**
      * @brief Allocate raw, uninitialized storage for a given number of elements
-     * with correct alignment.
+     * from the allocator.
+     *
+     * Allocates a single contiguous block sufficient to hold the requested
+     * number of objects of Type. No constructors are run here; the caller is
+     * responsible for constructing elements via placement new.
      *
-     * Allocates a single contiguous block of bytes sufficient to hold the
-     * requested number of objects of Type, aligned to alignof(Type). No
-     * constructors are run here; the caller is responsible for constructing
-     * elements via placement new.
+     * Requests that fit into the inline buffer are served from it, unless the
+     * buffer currently holds the live elements.
      *
      * @param storage_size Number of elements' worth of storage to allocate. May
      * be zero.
@@ -72,32 +159,34 @@ class DynamicArray {
      * @throws std::bad_alloc If storage_size > MAX_CAPACITY or the allocation
      * fails.
      */
-    static Type* allocate(const size_t storage_size) {
+    Type* allocate(const size_t storage_size) {
         if (storage_size == 0)
             return nullptr;
 
+        if constexpr (InlineCapacity > 0)
+            if (storage_size <= InlineCapacity && !usesInlineStorage())
+                return inline_.data();
+
         if (storage_size > MAX_CAPACITY)
             throw std::bad_alloc();
 
-        return static_cast<Type*>(operator new(
-            sizeof(Type) * storage_size,
-            static_cast<std::align_val_t>(alignof(Type))));
+        return std::to_address(AllocTraits::allocate(allocator_, storage_size));
     }
 
 
     /**
      * @brief Deallocate raw storage previously obtained via allocate.
      *
-     * Calls the aligned form of ::operator delete. Passing nullptr is allowed
-     * and is a no-op. The caller must ensure that all constructed objects in
-     * the storage have been destroyed prior to deallocation.
+     * Returns the block to the allocator. Passing nullptr or the inline buffer
+     * is allowed and is a no-op. The caller must ensure that all constructed
+     * objects in the storage have been destroyed prior to deallocation.
      *
      * @param storage Pointer returned by allocate. May be nullptr.
+     * @param storage_size The element count passed to allocate.
      */
-    static void deallocate(Type* storage) noexcept {
-        if (storage != nullptr)
-            ::operator delete(storage,
-                              static_cast<std::align_val_t>(alignof(Type)));
+    void deallocate(Type* storage, const size_t storage_size) noexcept {
+        if (storage != nullptr && storage != inline_.data())
+            AllocTraits::deallocate(allocator_, storage, storage_size);
     }
 
 
@@ -114,18 +203,52 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Relocate count elements into non-overlapping uninitialized storage
+     * by copying their bytes.
+     *
+     * Only valid for trivially relocatable types. The source objects' lifetimes
+     * end without their destructors running; the destination now owns them.
+     */
+    static void relocateBytes(Type* source, const size_t count, Type* destination) noexcept {
+        static_assert(RELOCATE_BITWISE);
+        if (count > 0)
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source),
+                        count * sizeof(Type));
+    }
+
+
+    /**
+     * @brief Relocate count elements within the buffer (ranges may overlap).
+     *
+     * Same lifetime rules as relocateBytes().
+     */
+    static void relocateBytesOverlapping(Type* source, const size_t count,
+                                         Type* destination) noexcept {
+        static_assert(RELOCATE_BITWISE);
+        if (count > 0)
+            std::memmove(static_cast<void*>(destination), static_cast<const void*>(source),
+                         count * sizeof(Type));
+    }
+
+
     /**
      * @brief Internal helper to erase an element and shift the suffix left.
      *
      * Destroys the element and performs the shift without extracting the value,
      * avoiding unnecessary moves for operations that discard the erased element.
+     * Trivially relocatable suffixes are shifted with a single memmove.
      */
     void eraseInternal(const size_t idx) {
         if (idx == size_ - 1) {
             std::destroy_at(&data_[idx]);
             --size_;
         } else {
-            if constexpr (std::is_move_assignable_v<Type> || std::is_copy_assignable_v<Type>)
+            if constexpr (RELOCATE_BITWISE) {
+                std::destroy_at(&data_[idx]);
+                relocateBytesOverlapping(data_ + idx + 1, size_ - idx - 1, data_ + idx);
+                --size_;
+            } else if constexpr (std::is_move_assignable_v<Type> || std::is_copy_assignable_v<Type>)
                 shiftLeftAssignables(idx);
             else
                 shiftLeftNonassignables(idx);
@@ -138,7 +261,8 @@ class DynamicArray {
      * @brief Copy-construct elements from a source range into a destination
      * buffer.
      *
-     * Constructs each element in order using Type's copy constructor. If
+     * Constructs each element in order using Type's copy constructor, or
+     * copies the whole range with memcpy for trivially copyable types. If
      * construction throws partway, already-constructed destination elements are
      * destroyed and the exception is rethrown.
      *
@@ -154,16 +278,29 @@ class DynamicArray {
                                 const Type* source_end, Type* destination) const
         noexcept(std::is_nothrow_copy_constructible_v<Type>) {
         assert(destination != nullptr);
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            const size_t count = source_end - source_begin;
+            if (count > 0)
+                std::memcpy(static_cast<void*>(destination),
+                            static_cast<const void*>(source_begin), count * sizeof(Type));
+            return destination + count;
+        }
         Type* current = destination;
-        try {
-            for (const Type* it = source_begin; it != source_end;
-                 ++it, ++current)
+        if constexpr (std::is_nothrow_copy_constructible_v<Type>) {
+            for (const Type* it = source_begin; it != source_end; ++it, ++current)
                 std::construct_at(current, *it);
             return current;
-        } catch (...) {
-            for (Type* it = destination; it != current; ++it)
-                std::destroy_at(it);
-            throw;
+        } else {
+            try {
+                for (const Type* it = source_begin; it != source_end;
+                     ++it, ++current)
+                    std::construct_at(current, *it);
+                return current;
+            } catch (...) {
+                for (Type* it = destination; it != current; ++it)
+                    std::destroy_at(it);
+                throw;
+            }
         }
     }
 
@@ -172,7 +309,8 @@ class DynamicArray {
      * @brief Move-construct elements from a source range into a destination
      * buffer.
      *
-     * Constructs each element in order using Type's move constructor. If
+     * Constructs each element in order using Type's move constructor, or
+     * copies the whole range with memcpy for trivially copyable types. If
      * construction throws partway, already-constructed destination elements are
      * destroyed and the exception is rethrown. The sources remain valid but are
      * moved-from.
@@ -190,15 +328,28 @@ class DynamicArray {
                             Type* destination) const
     noexcept(std::is_nothrow_move_constructible_v<Type>) {
         assert(destination != nullptr);
+        if constexpr (std::is_trivially_copyable_v<Type>) {
+            const size_t count = source_end - source_begin;
+            if (count > 0)
+                std::memcpy(static_cast<void*>(destination),
+                            static_cast<const void*>(source_begin), count * sizeof(Type));
+            return destination + count;
+        }
         Type* current = destination;
-        try {
+        if constexpr (std::is_nothrow_move_constructible_v<Type>) {
             for (Type* it = source_begin; it != source_end; ++it, ++current)
                 std::construct_at(current, std::move(*it));
             return current;
-        } catch (...) {
-            for (Type* it = destination; it != current; ++it)
-                std::destroy_at(it);
-            throw;
+        } else {
+            try {
+                for (Type* it = source_begin; it != source_end; ++it, ++current)
+                    std::construct_at(current, std::move(*it));
+                return current;
+            } catch (...) {
+                for (Type* it = destination; it != current; ++it)
+                    std::destroy_at(it);
+                throw;
+            }
         }
     }
 
@@ -209,7 +360,8 @@ class DynamicArray {
      * If the requested capacity differs from the current capacity, this
      * function allocates a new buffer, move-/copy-constructs all existing
      * elements into it (preferring nothrow-move where available), destroys the
-     * old elements, and then replaces the old storage. The logical size is
+     * old elements, and then replaces the old storage. Trivially relocatable
+     * elements are instead moved over with one memcpy. The logical size is
      * preserved.
      *
      * @param new_capacity Requested capacity in elements.
@@ -232,6 +384,14 @@ class DynamicArray {
             throw std::bad_alloc();
 
         Type* new_data = allocate(new_capacity);
+        if constexpr (RELOCATE_BITWISE) {
+            relocateBytes(data_, size_, new_data);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            return;
+        }
+
         Type* new_data_end = new_data;
         try {
             if constexpr (std::is_nothrow_move_constructible_v<Type> ||
@@ -244,51 +404,43 @@ class DynamicArray {
         } catch (...) {
             for (Type* it = new_data; it != new_data_end; ++it)
                 it->~Type();
-            deallocate(new_data);
+            deallocate(new_data, new_capacity);
             throw;
         }
 
         destroyArrayElements();
-        deallocate(data_);
+        deallocate(data_, capacity_);
         data_ = new_data;
         capacity_ = new_capacity;
     }
 
 
     /**
-     * @brief Shrink capacity by half when the array becomes sparse.
+     * @brief Shrink capacity by half when the capacity policy asks for it.
      *
-     * If size() <= capacity()/4 and capacity() > DEFAULT_CAPACITY, the capacity
-     * is reduced by half (not below the default). This reallocation is
-     * performed with the same strong exception-safety as resize.
+     * Called after removals. With the default policy the capacity is halved
+     * once size() <= capacity()/4; it never drops below DEFAULT_CAPACITY.
+     * This reallocation is performed with the same strong exception-safety
+     * as resize.
      */
     void shrinkIfNecessary() {
-        if (size_ <= capacity_ / 4 && capacity_ > DEFAULT_CAPACITY)
+        if (capacity_ > DEFAULT_CAPACITY && capacity_policy_.shouldShrink(size_, capacity_))
             resize(capacity_ / 2);
     }
 
 
     /**
-     * @brief Ensure there is room for more elements (grow by doubling if
-     * full).
-     *
-     * If size() == capacity(), this doubles capacity (clamped to MAX_CAPACITY).
-     * The growth uses resize, preserving the strong exception guarantee.
+     * @brief Capacity to grow to when the array is full (by the policy's
+     * growth factor, clamped to MAX_CAPACITY).
      *
      * @throws std::length_error If already at MAX_CAPACITY.
      */
-    void ensureCapacity() {
-        if (capacity_ == 0) {
-            resize(DEFAULT_CAPACITY);
-            return;
-        }
-
-        if (size_ == capacity_) {
-            if (capacity_ == MAX_CAPACITY)
-                throw std::length_error("DynamicArray capacity limit");
-            resize(capacity_ > MAX_SAFE_CAPACITY ? MAX_CAPACITY
-                                                 : capacity_ * 2);
-        }
+    size_t grownCapacity() const {
+        if (capacity_ == 0)
+            return DEFAULT_CAPACITY;
+        if (capacity_ == MAX_CAPACITY)
+            throw std::length_error("DynamicArray capacity limit");
+        return CapacityPolicy::grow(capacity_, MAX_CAPACITY);
     }
 
 
@@ -296,53 +448,64 @@ class DynamicArray {
      * @brief Build a fresh buffer with a new element placed at a given index,
      * then commit.
      *
-     * Implements the "fresh buffer then commit" insert/emplace strategy for
-     * middle inserts. It allocates a new buffer (same capacity), constructs the
-     * prefix [0, idx), then the new element at idx, then the suffix [idx,
-     * size()). On any failure, all partially constructed elements in the new
-     * buffer are destroyed and the original array is left unchanged.
+     * Implements the "fresh buffer then commit" insert/emplace strategy used
+     * when the array is full. It allocates a new buffer of new_capacity,
+     * constructs the new element at idx first (so arguments referring to
+     * elements of this array are still valid), then the prefix [0, idx) and
+     * the suffix [idx, size()). Growth and insertion thus cost one allocation
+     * and one pass over the elements. On any failure, all partially
+     * constructed elements in the new buffer are destroyed and the original
+     * array is left unchanged.
      *
      * @tparam CtorArgs Argument types forwarded to Type's constructor for the
      * inserted element.
-     * @param idx Insertion index (must satisfy 0 <= idx < size() when called
-     * from insert/emplace paths).
+     * @param new_capacity Capacity of the new buffer (must exceed size()).
+     * @param idx Insertion index (must satisfy 0 <= idx <= size()).
      * @param args Constructor arguments forwarded to Type for the new element.
      */
     template <typename... CtorArgs>
-    void rebuildBuffer(const size_t idx, CtorArgs&&... args) {
+    void rebuildBuffer(const size_t new_capacity, const size_t idx, CtorArgs&&... args) {
         static_assert(std::is_constructible_v<Type, CtorArgs&&...>);
-        Type* new_data = allocate(capacity_);
-        Type* constructed_end = new_data;
-
+        Type* new_data = allocate(new_capacity);
         try {
-            if constexpr (std::is_nothrow_move_constructible_v<Type> ||
-                          !std::is_copy_constructible_v<Type>)
-                constructed_end =
-                    moveConstructElements(data_, data_ + idx, new_data);
-            else
-                constructed_end =
-                    copyConstructElements(data_, data_ + idx, new_data);
-
             std::construct_at(new_data + idx, std::forward<CtorArgs>(args)...);
-            constructed_end = new_data + idx + 1;
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
+        }
 
+        if constexpr (RELOCATE_BITWISE) {
+            relocateBytes(data_, idx, new_data);
+            relocateBytes(data_ + idx, size_ - idx, new_data + idx + 1);
+            deallocate(data_, capacity_);
+            data_ = new_data;
+            capacity_ = new_capacity;
+            ++size_;
+            return;
+        }
+
+        Type* prefix_end = new_data;
+        try {
             if constexpr (std::is_nothrow_move_constructible_v<Type> ||
-                          !std::is_copy_constructible_v<Type>)
-                constructed_end = moveConstructElements(
-                    data_ + idx, data_ + size_, constructed_end);
-            else
-                constructed_end = copyConstructElements(
-                    data_ + idx, data_ + size_, constructed_end);
+                          !std::is_copy_constructible_v<Type>) {
+                prefix_end = moveConstructElements(data_, data_ + idx, new_data);
+                moveConstructElements(data_ + idx, data_ + size_, new_data + idx + 1);
+            } else {
+                prefix_end = copyConstructElements(data_, data_ + idx, new_data);
+                copyConstructElements(data_ + idx, data_ + size_, new_data + idx + 1);
+            }
         } catch (...) {
-            for (Type* it = new_data; it != constructed_end; ++it)
+            for (Type* it = new_data; it != prefix_end; ++it)
                 std::destroy_at(it);
-            deallocate(new_data);
+            std::destroy_at(new_data + idx);
+            deallocate(new_data, new_capacity);
             throw;
         }
 
         destroyArrayElements();
-        deallocate(data_);
+        deallocate(data_, capacity_);
         data_ = new_data;
+        capacity_ = new_capacity;
         ++size_;
     }
 
@@ -399,12 +562,78 @@ class DynamicArray {
     }
 
 
+    /// Points the array at its inline buffer (nullptr without one), empty.
+    void resetToInlineStorage() noexcept {
+        data_ = inline_.data();
+        size_ = 0;
+        capacity_ = InlineCapacity;
+    }
+
+
+    /**
+     * @brief Takes over the storage of other (allocators must already match)
+     * and leaves other empty.
+     *
+     * Heap storage changes hands. If other is using its inline buffer, its
+     * elements are moved into this array's inline buffer instead; should one
+     * of those moves throw, this array is left empty and other unchanged.
+     * The previous storage of *this must already have been released.
+     */
+    void stealStorage(DynamicArray& other) noexcept(NOTHROW_STEAL) {
+        if constexpr (InlineCapacity > 0) {
+            if (other.usesInlineStorage()) {
+                resetToInlineStorage();
+                if constexpr (RELOCATE_BITWISE) {
+                    relocateBytes(other.data_, other.size_, data_);
+                    size_ = other.size_;
+                    other.size_ = 0;
+                    return;
+                }
+                if constexpr (std::is_nothrow_move_constructible_v<Type>) {
+                    for (; size_ < other.size_; ++size_)
+                        std::construct_at(data_ + size_, std::move(other.data_[size_]));
+                } else {
+                    try {
+                        for (; size_ < other.size_; ++size_)
+                            std::construct_at(data_ + size_, std::move(other.data_[size_]));
+                    } catch (...) {
+                        destroyArrayElements();
+                        size_ = 0;
+                        throw;
+                    }
+                }
+                other.destroyArrayElements();
+                other.size_ = 0;
+                return;
+            }
+        }
+
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.resetToInlineStorage();
+    }
+
+
   public:
+    using allocator_type = Allocator;
+
+
     /**
      * Default constructor that initializes the dynamic array with a default
      * capacity.
      */
-    DynamicArray() : data_(nullptr), size_(0), capacity_(DEFAULT_CAPACITY) {
+    DynamicArray() : DynamicArray(Allocator()) {}
+
+    /**
+     * Constructor that initializes an empty dynamic array with the default
+     * capacity, drawing its storage from the given allocator.
+     *
+     * @param allocator The allocator to obtain storage from.
+     */
+    explicit DynamicArray(const Allocator& allocator)
+        : data_(nullptr), size_(0), capacity_(DEFAULT_CAPACITY),
+          allocator_(allocator) {
         data_ = allocate(capacity_);
     }
 
@@ -413,10 +642,10 @@ class DynamicArray {
      * the given capacity.
      *
      * @param capacity The number of elements to allocate memory for.
+     * @param allocator The allocator to obtain storage from.
      */
-    explicit DynamicArray(size_t capacity)
-        : data_(nullptr), size_(0),
-          capacity_(capacity < DEFAULT_CAPACITY ? DEFAULT_CAPACITY : capacity) {
+    explicit DynamicArray(size_t capacity, const Allocator& allocator = Allocator())
+        : data_(nullptr), size_(0), capacity_(0), allocator_(allocator) {
         if (capacity < DEFAULT_CAPACITY)
             capacity = DEFAULT_CAPACITY;
 
@@ -424,6 +653,7 @@ class DynamicArray {
             capacity = MAX_CAPACITY;
 
         data_ = allocate(capacity);
+        capacity_ = capacity;
     }
 
     /**
@@ -433,14 +663,17 @@ class DynamicArray {
      * and copy-constructs the elements in order.
      *
      * @param initial_data The initializer list providing elements to copy.
+     * @param allocator The allocator to obtain storage from.
      *
      * @throws std::bad_alloc On allocation failure.
      */
-    DynamicArray(std::initializer_list<Type> initial_data)
+    DynamicArray(std::initializer_list<Type> initial_data,
+                 const Allocator& allocator = Allocator())
         : data_(nullptr), size_(initial_data.size()),
           capacity_(initial_data.size() < DEFAULT_CAPACITY
                         ? DEFAULT_CAPACITY
-                        : initial_data.size()) {
+                        : initial_data.size()),
+          allocator_(allocator) {
         data_ = allocate(capacity_);
         Type* constructed_end = data_;
         try {
@@ -450,7 +683,7 @@ class DynamicArray {
         } catch (...) {
             for (Type* it = data_; it != constructed_end; ++it)
                 it->~Type();
-            deallocate(data_);
+            deallocate(data_, capacity_);
             throw;
         }
     }
@@ -463,11 +696,14 @@ class DynamicArray {
      * @param initial_data Pointer to the initial data to be copied into the
      * dynamic array.
      * @param initial_size The number of elements in the initial data.
+     * @param allocator The allocator to obtain storage from.
      */
-    DynamicArray(const Type* initial_data, const size_t initial_size)
+    DynamicArray(const Type* initial_data, const size_t initial_size,
+                 const Allocator& allocator = Allocator())
         : data_(nullptr), size_(initial_size),
           capacity_(initial_size < DEFAULT_CAPACITY ? DEFAULT_CAPACITY
-                                                    : initial_size) {
+                                                    : initial_size),
+          allocator_(allocator) {
         if (initial_size > 0 && initial_data == nullptr)
             throw std::invalid_argument("Initial data cannot be null if "
                                         "initial size is greater than zero");
@@ -478,29 +714,34 @@ class DynamicArray {
                 copyConstructElements(initial_data, initial_data + size_,
                                       data_);
         } catch (...) {
-            deallocate(data_);
+            deallocate(data_, capacity_);
             throw;
         }
     }
 
     /// Copy constructor
     DynamicArray(const DynamicArray& other)
-        : data_(allocate(other.capacity_)), size_(other.size_),
-          capacity_(other.capacity_) {
+        : DynamicArray(other, AllocTraits::select_on_container_copy_construction(
+                                  other.allocator_)) {}
+
+    /// Copy constructor using the given allocator for the new storage.
+    DynamicArray(const DynamicArray& other, const Allocator& allocator)
+        : data_(nullptr), size_(other.size_), capacity_(other.capacity_),
+          allocator_(allocator) {
+        data_ = allocate(capacity_);
         try {
             copyConstructElements(other.data_, other.data_ + size_, data_);
         } catch (...) {
-            deallocate(data_);
+            deallocate(data_, capacity_);
             throw;
         }
     }
 
     /// Move constructor
-    DynamicArray(DynamicArray&& other) noexcept
-        : data_(other.data_), size_(other.size_), capacity_(other.capacity_) {
-        other.data_ = nullptr;
-        other.size_ = 0;
-        other.capacity_ = 0;
+    DynamicArray(DynamicArray&& other) noexcept(NOTHROW_STEAL)
+        : data_(nullptr), size_(0), capacity_(0),
+          allocator_(std::move(other.allocator_)) {
+        stealStorage(other);
     }
 
     /// Copy assignment operator
@@ -508,8 +749,22 @@ class DynamicArray {
         if (this == &other)
             return *this;
 
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            if (allocator_ != other.allocator_) {
+                // Storage must come from the incoming allocator.
+                DynamicArray copy(other, other.allocator_);
+                destroyArrayElements();
+                deallocate(data_, capacity_);
+                allocator_ = other.allocator_;
+                stealStorage(copy);
+                return *this;
+            }
+            allocator_ = other.allocator_;
+        }
+
         if (capacity_ >= other.size_) {
             destroyArrayElements();
+            size_ = 0;
             copyConstructElements(other.data_, other.data_ + other.size_, data_);
             size_ = other.size_;
         } else {
@@ -517,12 +772,12 @@ class DynamicArray {
             try {
                 copyConstructElements(other.data_, other.data_ + other.size_, new_data);
             } catch (...) {
-                deallocate(new_data);
+                deallocate(new_data, other.capacity_);
                 throw;
             }
 
             destroyArrayElements();
-            deallocate(data_);
+            deallocate(data_, capacity_);
             data_ = new_data;
             size_ = other.size_;
             capacity_ = other.capacity_;
@@ -532,24 +787,44 @@ class DynamicArray {
     }
 
     /// Move assignment operator
-    DynamicArray& operator=(DynamicArray&& other) noexcept {
-        if (this != &other) {
-            destroyArrayElements();
-            deallocate(data_);
-
-            data_ = other.data_;
-            size_ = other.size_;
-            capacity_ = other.capacity_;
+    DynamicArray& operator=(DynamicArray&& other) noexcept(
+        NOTHROW_STEAL && (AllocTraits::propagate_on_container_move_assignment::value ||
+                          AllocTraits::is_always_equal::value)) {
+        if (this == &other)
+            return *this;
 
-            other.data_ = nullptr;
-            other.size_ = 0;
-            other.capacity_ = 0;
+        if constexpr (!AllocTraits::propagate_on_container_move_assignment::value &&
+                      !AllocTraits::is_always_equal::value) {
+            if (allocator_ != other.allocator_) {
+                // The storage cannot change hands; move the elements instead.
+                DynamicArray moved(other.capacity_, allocator_);
+                moveConstructElements(other.data_, other.data_ + other.size_, moved.data_);
+                moved.size_ = other.size_;
+                other.clear();
+                destroyArrayElements();
+                deallocate(data_, capacity_);
+                stealStorage(moved);
+                return *this;
+            }
         }
 
+        destroyArrayElements();
+        deallocate(data_, capacity_);
+        if constexpr (AllocTraits::propagate_on_container_move_assignment::value)
+            allocator_ = std::move(other.allocator_);
+        stealStorage(other);
+
         return *this;
     }
 
 
+    /// Returns a copy of the allocator used for the storage.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return allocator_;
+    }
+
+
     /// Returns the current size of the dynamic array.
     [[nodiscard]]
     size_t size() const noexcept {
@@ -562,6 +837,18 @@ class DynamicArray {
         return capacity_;
     }
 
+    /// Returns the number of elements that fit into the inline buffer.
+    [[nodiscard]]
+    static constexpr size_t inlineCapacity() noexcept {
+        return InlineCapacity;
+    }
+
+    /// Checks if the elements currently live in the inline buffer.
+    [[nodiscard]]
+    bool usesInlineStorage() const noexcept {
+        return InlineCapacity > 0 && data_ == inline_.data();
+    }
+
     /// Checks if the dynamic array is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
@@ -663,8 +950,7 @@ class DynamicArray {
             throw std::out_of_range("Index out of range");
 
         if (size_ == capacity_) {
-            ensureCapacity();
-            rebuildBuffer(idx, std::forward<Args>(args)...);
+            rebuildBuffer(grownCapacity(), idx, std::forward<Args>(args)...);
             return;
         }
 
@@ -674,6 +960,18 @@ class DynamicArray {
             return;
         }
 
+        if constexpr (RELOCATE_BITWISE) {
+            // Build the element aside (args may refer into the array), open
+            // the gap with one memmove and relocate the element into it.
+            alignas(Type) unsigned char slot[sizeof(Type)];
+            Type* element = std::construct_at(reinterpret_cast<Type*>(slot),
+                                              std::forward<Args>(args)...);
+            relocateBytesOverlapping(data_ + idx, size_ - idx, data_ + idx + 1);
+            relocateBytes(element, 1, data_ + idx);
+            ++size_;
+            return;
+        }
+
         Type temp(std::forward<Args>(args)...);
 
         std::construct_at(&data_[size_], std::move(data_[size_ - 1]));
@@ -719,6 +1017,109 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Emplace-construct an element at the end without a capacity check.
+     *
+     * For hot loops that reserve() once and then append a known number of
+     * elements. Never reallocates.
+     *
+     * @pre size() < capacity(). Checked by assert only.
+     *
+     * @tparam Args Argument types forwarded to Type's constructor.
+     * @param args Constructor arguments.
+     */
+    template <typename... Args>
+    void emplaceLastUnchecked(Args&&... args) {
+        static_assert(std::is_constructible_v<Type, Args&&...>);
+        assert(size_ < capacity_);
+        std::construct_at(data_ + size_, std::forward<Args>(args)...);
+        ++size_;
+    }
+
+
+    /**
+     * @brief Append every element of [first, last) with a single capacity
+     * check.
+     *
+     * Grows at most once, to the larger of the required size and the
+     * policy's next capacity, then constructs the elements in place (one
+     * memcpy for trivially copyable elements from contiguous storage). If a
+     * constructor throws, the appended elements are destroyed again and the
+     * size is unchanged; the capacity may already have grown.
+     *
+     * @tparam Iterator A forward iterator whose elements construct Type.
+     * @param first Start of the range. The range must not refer into this
+     * array.
+     * @param last End of the range.
+     *
+     * @throws std::length_error If the result would exceed MAX_CAPACITY.
+     * @throws std::bad_alloc If growing fails.
+     */
+    template <std::forward_iterator Iterator>
+    void appendRange(Iterator first, Iterator last) {
+        static_assert(std::is_constructible_v<Type, std::iter_reference_t<Iterator>>);
+        const auto count = static_cast<size_t>(std::distance(first, last));
+        if (count == 0)
+            return;
+        if (count > MAX_CAPACITY - size_)
+            throw std::length_error("DynamicArray capacity limit");
+
+        if (size_ + count > capacity_) {
+            const size_t grown = grownCapacity();
+            resize(size_ + count > grown ? size_ + count : grown);
+        }
+
+        Type* const end = data_ + size_;
+        if constexpr (std::is_trivially_copyable_v<Type> && std::contiguous_iterator<Iterator> &&
+                      std::is_same_v<std::iter_value_t<Iterator>, Type>) {
+            std::memcpy(static_cast<void*>(end), static_cast<const void*>(std::to_address(first)),
+                        count * sizeof(Type));
+        } else {
+            Type* current = end;
+            try {
+                for (; first != last; ++first, ++current)
+                    std::construct_at(current, *first);
+            } catch (...) {
+                std::destroy(end, current);
+                throw;
+            }
+        }
+        size_ += count;
+    }
+
+
+    /**
+     * @brief Append count elements left for the caller to overwrite, and
+     * return a pointer to the first of them.
+     *
+     * No constructor runs: the new elements hold indeterminate bytes until
+     * written, e.g. by fread() or memcpy(). This lets a buffer be filled in
+     * place without a staging copy or a default-constructible Type. Grows like
+     * appendRange(); popBackN() drops elements that were not written.
+     *
+     * @param count Number of elements to append.
+     * @return Pointer to the first appended element.
+     *
+     * @throws std::length_error If the result would exceed MAX_CAPACITY.
+     * @throws std::bad_alloc If growing fails.
+     */
+    Type* appendForOverwrite(const size_t count) {
+        static_assert(std::is_trivially_copyable_v<Type>,
+                      "appendForOverwrite requires a trivially copyable Type.");
+        if (count > MAX_CAPACITY - size_)
+            throw std::length_error("DynamicArray capacity limit");
+
+        if (size_ + count > capacity_) {
+            const size_t grown = grownCapacity();
+            resize(size_ + count > grown ? size_ + count : grown);
+        }
+
+        Type* const first = data_ + size_;
+        size_ += count;
+        return first;
+    }
+
+
     /**
      * @brief Emplace-construct an element at the front (index 0).
      *
@@ -850,6 +1251,24 @@ class DynamicArray {
     }
 
 
+    /**
+     * @brief Remove the last count elements without shrinking.
+     *
+     * Destroys the elements from the back and leaves the capacity alone
+     * regardless of the capacity policy, so a following burst of appends
+     * reuses the storage.
+     *
+     * @param count Number of elements to remove.
+     * @throws std::out_of_range If count > size().
+     */
+    void popBackN(const size_t count) {
+        if (count > size_)
+            throw std::out_of_range("Array holds fewer elements than requested");
+        std::destroy(data_ + size_ - count, data_ + size_);
+        size_ -= count;
+    }
+
+
     /**
      * @brief Destroy all elements (capacity unchanged).
      *
@@ -1038,9 +1457,11 @@ class DynamicArray {
      *
      * If size() < DEFAULT_CAPACITY, capacity is set to DEFAULT_CAPACITY.
      * Otherwise capacity is set to size(). Elements are moved/copied into the
-     * new buffer.
+     * new buffer. Does nothing under the NeverShrink policy.
      */
     void shrinkToFit() {
+        if constexpr (!CapacityPolicy::SHRINKS_ON_REQUEST)
+            return;
         if (capacity_ > size_) {
             if (size_ < DEFAULT_CAPACITY)
                 resize(DEFAULT_CAPACITY);
@@ -1059,7 +1480,8 @@ class DynamicArray {
      * @return A new array equal to *this.
      */
     DynamicArray clone() const {
-        DynamicArray copy(capacity_);
+        DynamicArray copy(capacity_,
+                          AllocTraits::select_on_container_copy_construction(allocator_));
         copyConstructElements(data_, data_ + size_, copy.data_);
         copy.size_ = size_;
         return copy;
@@ -1159,6 +1581,16 @@ class DynamicArray {
         const size_t start_idx = first - begin();
         const size_t count = last - first;
 
+        if constexpr (RELOCATE_BITWISE) {
+            for (size_t i = start_idx; i < start_idx + count; ++i)
+                std::destroy_at(&data_[i]);
+            relocateBytesOverlapping(data_ + start_idx + count, size_ - start_idx - count,
+                                     data_ + start_idx);
+            size_ -= count;
+            shrinkIfNecessary();
+            return begin() + start_idx;
+        }
+
         if constexpr (std::is_move_assignable_v<Type> || std::is_copy_assignable_v<Type>) {
             for (size_t i = start_idx + count; i < size_; ++i)
                 data_[i - count] = std::move(data_[i]);
@@ -1244,11 +1676,25 @@ class DynamicArray {
     ~DynamicArray() noexcept {
         if (data_) {
             destroyArrayElements();
-            deallocate(data_);
+            deallocate(data_, capacity_);
         }
     }
 };
 
+
+/// DynamicArray that keeps up to N elements inside the object.
+template <typename Type, size_t N, typename Allocator = std::allocator<Type>>
+using SmallDynamicArray = DynamicArray<Type, Allocator, N>;
+
+
+namespace pmr {
+
+/// DynamicArray whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using DynamicArray = containers::DynamicArray<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace containers
 
 #endif // DYNAMICARRAY_HPP
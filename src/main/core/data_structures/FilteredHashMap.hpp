@@ -0,0 +1,240 @@
+#ifndef FILTERED_HASH_MAP_HPP
+#define FILTERED_HASH_MAP_HPP
+
+#include <concepts>
+#include <utility>
+
+#include "BlockedBloomFilter.hpp"
+#include "CuckooFilter.hpp"
+#include "DefaultHash.hpp"
+#include "HashMap.hpp"
+
+
+namespace containers {
+
+
+/// Approximate-membership filters that FilteredHashMap can put in front of
+/// its table: built for an expected number of keys, and fed the map's hash
+/// values. insertHash() returns false when the filter is full.
+template <typename Filter>
+concept HashFilter = std::constructible_from<Filter, size_t> &&
+                     requires(Filter& filter, const Filter& cfilter, const size_t hash) {
+                         { filter.insertHash(hash) } -> std::convertible_to<bool>;
+                         { cfilter.mayContainHash(hash) } -> std::convertible_to<bool>;
+                         filter.clear();
+                     };
+
+
+/** @class FilteredHashMap
+ *
+ * @brief A HashMap with an approximate-membership filter in front of it, so
+ * lookups of absent keys rarely touch the table.
+ *
+ * A miss in a large HashMap costs a cache miss to DRAM for the home bucket.
+ * The filter needs about 1.3 bytes (BlockedBloomFilter) or 2.1 bytes
+ * (CuckooFilter) per key instead of a whole bucket, so it stays in L1/L2
+ * far longer than the table does; contains(), find() and remove() consult
+ * it first and skip the table when it rules the key out. Each key is
+ * hashed once: the filter is fed the map's own hashOf() value.
+ *
+ * The filter is sized for the map and rebuilt from the keys at twice the
+ * size whenever the map outgrows it (or a cuckoo filter reports full), so
+ * its false-positive rate stays near the design rate. A Bloom filter
+ * cannot forget removed keys; they only add false positives, and the
+ * filter is rebuilt once they outnumber the live keys. A CuckooFilter
+ * removes them directly.
+ *
+ * Present keys pay for the extra filter probe, so the filter only pays off
+ * when a good share of lookups miss.
+ *
+ * @tparam Key The type of the keys in the map.
+ * @tparam Value The type of the values in the map.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ * @tparam Filter The filter type, BlockedBloomFilter (the default) or
+ * CuckooFilter.
+ */
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>,
+          HashFilter Filter = BlockedBloomFilter<Key, Hash>>
+class FilteredHashMap {
+  public:
+    using Map = HashMap<Key, Value, Hash>;
+
+  private:
+    /// Smallest number of keys the filter is sized for.
+    static constexpr size_t MIN_FILTER_KEYS = 64;
+
+    Map map_;
+    Filter filter_;
+    size_t filter_keys_;
+    size_t stale_ = 0; // Removed keys still present in a filter that cannot remove.
+
+
+    /// Rebuilds the filter for at least keys keys from the map's contents.
+    void rebuildFilter(size_t keys) {
+        for (;; keys *= 2) {
+            Filter filter(keys);
+            bool complete = true;
+            for (auto it = map_.cbegin(); complete && it != map_.cend(); ++it)
+                complete = filter.insertHash(map_.hashOf((*it).first));
+            if (complete) {
+                filter_ = std::move(filter);
+                filter_keys_ = keys;
+                stale_ = 0;
+                return;
+            }
+        }
+    }
+
+    /// Records a key just added to the map.
+    void addToFilter(const size_t hash) {
+        if (map_.size() + stale_ > filter_keys_ || !filter_.insertHash(hash))
+            rebuildFilter(2 * (map_.size() > filter_keys_ ? map_.size() : filter_keys_));
+    }
+
+    /// Records a key just removed from the map.
+    void removeFromFilter(const size_t hash) {
+        if constexpr (requires { filter_.removeHash(hash); }) {
+            filter_.removeHash(hash);
+        } else if (++stale_ > map_.size() && stale_ > MIN_FILTER_KEYS) {
+            rebuildFilter(filter_keys_);
+        }
+    }
+
+  public:
+    /// Creates an empty map.
+    FilteredHashMap() : filter_(MIN_FILTER_KEYS), filter_keys_(MIN_FILTER_KEYS) {}
+
+    /**
+     * @brief Creates an empty map with the table and the filter sized for
+     * expected_keys keys.
+     */
+    explicit FilteredHashMap(const size_t expected_keys)
+        : filter_(expected_keys > MIN_FILTER_KEYS ? expected_keys : MIN_FILTER_KEYS),
+          filter_keys_(expected_keys > MIN_FILTER_KEYS ? expected_keys : MIN_FILTER_KEYS) {
+        map_.reserve(expected_keys);
+    }
+
+
+    /// Checks if the map is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return map_.isEmpty();
+    }
+
+    /// Returns the number of key-value pairs.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return map_.size();
+    }
+
+    /// Makes room for n entries in the table and the filter.
+    void reserve(const size_t n) {
+        map_.reserve(n);
+        if (n > filter_keys_)
+            rebuildFilter(n);
+    }
+
+    /// Removes every pair; the filter keeps its size.
+    void clear() {
+        map_.clear();
+        filter_.clear();
+        stale_ = 0;
+    }
+
+
+    /**
+     * @brief Inserts a pair or replaces the value of an existing key.
+     *
+     * @tparam K Key or a transparent lookup type of the map.
+     * @tparam V The type of the value (perfect-forwarded).
+     */
+    template <typename K, typename V>
+    void insert(K&& key, V&& value) {
+        const size_t hash = map_.hashOf(key);
+        if (map_.insertOrAssign(std::forward<K>(key), std::forward<V>(value), hash).second)
+            addToFilter(hash);
+    }
+
+
+    /// Checks if key is present; absent keys are usually answered by the
+    /// filter alone.
+    template <typename K>
+    [[nodiscard]]
+    bool contains(const K& key) const {
+        const size_t hash = map_.hashOf(key);
+        return filter_.mayContainHash(hash) && map_.contains(key, hash);
+    }
+
+
+    typename Map::iterator begin() { return map_.begin(); }
+    typename Map::iterator end() { return map_.end(); }
+
+    typename Map::const_iterator begin() const { return map_.begin(); }
+    typename Map::const_iterator end() const { return map_.end(); }
+
+
+    /// Returns an iterator to key's pair, or end() if absent.
+    template <typename K>
+    typename Map::iterator find(const K& key) {
+        const size_t hash = map_.hashOf(key);
+        return filter_.mayContainHash(hash) ? map_.find(key, hash) : map_.end();
+    }
+
+    /// Const overload of find().
+    template <typename K>
+    typename Map::const_iterator find(const K& key) const {
+        const size_t hash = map_.hashOf(key);
+        return filter_.mayContainHash(hash) ? map_.find(key, hash) : map_.end();
+    }
+
+
+    /**
+     * @brief Accesses the value of key.
+     *
+     * @throws std::out_of_range If the key is not present.
+     */
+    template <typename K>
+    Value& at(const K& key) {
+        return map_.at(key, map_.hashOf(key));
+    }
+
+    /// Const overload of at().
+    template <typename K>
+    const Value& at(const K& key) const {
+        return map_.at(key, map_.hashOf(key));
+    }
+
+
+    /**
+     * @brief Removes key and its value.
+     *
+     * @return bool true if the key was present.
+     */
+    template <typename K>
+    bool remove(const K& key) {
+        const size_t hash = map_.hashOf(key);
+        if (!filter_.mayContainHash(hash) || !map_.remove(key, hash))
+            return false;
+        removeFromFilter(hash);
+        return true;
+    }
+
+
+    /// The underlying map.
+    [[nodiscard]]
+    const Map& map() const noexcept {
+        return map_;
+    }
+
+    /// The filter in front of the map.
+    [[nodiscard]]
+    const Filter& filter() const noexcept {
+        return filter_;
+    }
+};
+
+
+} // namespace containers
+
+
+#endif // FILTERED_HASH_MAP_HPP
@@ -0,0 +1,848 @@
+#ifndef FLAT_HASH_MAP_HPP
+#define FLAT_HASH_MAP_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FLAT_HASH_MAP_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define FLAT_HASH_MAP_USE_NEON 1
+#endif
+
+#include "DefaultHash.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace flat_hash_detail {
+
+/// One control byte per slot: either a special state or 7 bits of the hash.
+using ctrl_t = std::uint8_t;
+
+/// Slot was never used. Probing stops at a group that contains one.
+constexpr ctrl_t CTRL_EMPTY = 0x80;
+
+/// Slot held an element that was removed. Probing continues past it.
+constexpr ctrl_t CTRL_DELETED = 0xFE;
+
+/// Number of control bytes inspected at once (one SSE2/NEON register).
+constexpr size_t GROUP_WIDTH = 16;
+
+
+/// A full slot stores its 7-bit tag, so its high bit is always clear.
+constexpr bool isFull(const ctrl_t ctrl) noexcept { return (ctrl & 0x80) == 0; }
+
+
+/**
+ * @class BitMask
+ * @brief The set of matching slots within one group.
+ *
+ * SSE2 and the scalar fallback produce one bit per slot; NEON produces one
+ * nibble per slot, of which only the top bit is kept. SHIFT converts a bit
+ * position back into a slot offset.
+ */
+class BitMask {
+#if defined(FLAT_HASH_MAP_USE_NEON)
+    static constexpr int SHIFT = 2;
+#else
+    static constexpr int SHIFT = 0;
+#endif
+
+    std::uint64_t bits_;
+
+  public:
+    explicit constexpr BitMask(const std::uint64_t bits) noexcept : bits_(bits) {}
+
+    /// True if at least one slot matched.
+    explicit constexpr operator bool() const noexcept { return bits_ != 0; }
+
+    /// Offset (0..GROUP_WIDTH-1) of the first matching slot.
+    [[nodiscard]]
+    constexpr size_t lowest() const noexcept {
+        return static_cast<size_t>(std::countr_zero(bits_)) >> SHIFT;
+    }
+
+    /// Drops the first matching slot from the set.
+    constexpr void clearLowest() noexcept { bits_ &= bits_ - 1; }
+};
+
+
+/**
+ * @class Group
+ * @brief GROUP_WIDTH consecutive control bytes, compared in parallel.
+ */
+class Group {
+#if defined(FLAT_HASH_MAP_USE_SSE2)
+    __m128i ctrl_;
+
+    static BitMask toMask(const __m128i eq) noexcept {
+        return BitMask(static_cast<std::uint32_t>(_mm_movemask_epi8(eq)));
+    }
+
+  public:
+    explicit Group(const ctrl_t* pos) noexcept
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+    [[nodiscard]]
+    BitMask match(const ctrl_t tag) const noexcept {
+        return toMask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), ctrl_));
+    }
+
+    [[nodiscard]]
+    BitMask matchEmpty() const noexcept { return match(CTRL_EMPTY); }
+
+    /// Empty and deleted are the only states with the high bit set.
+    [[nodiscard]]
+    BitMask matchEmptyOrDeleted() const noexcept { return toMask(ctrl_); }
+
+#elif defined(FLAT_HASH_MAP_USE_NEON)
+    uint8x16_t ctrl_;
+
+    static BitMask toMask(const uint8x16_t eq) noexcept {
+        const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+        return BitMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) &
+                       0x8888888888888888ull);
+    }
+
+  public:
+    explicit Group(const ctrl_t* pos) noexcept : ctrl_(vld1q_u8(pos)) {}
+
+    [[nodiscard]]
+    BitMask match(const ctrl_t tag) const noexcept {
+        return toMask(vceqq_u8(ctrl_, vdupq_n_u8(tag)));
+    }
+
+    [[nodiscard]]
+    BitMask matchEmpty() const noexcept { return match(CTRL_EMPTY); }
+
+    [[nodiscard]]
+    BitMask matchEmptyOrDeleted() const noexcept {
+        return toMask(vcltq_s8(vreinterpretq_s8_u8(ctrl_), vdupq_n_s8(0)));
+    }
+
+#else
+    const ctrl_t* ctrl_;
+
+    template <typename Predicate>
+    BitMask collect(Predicate&& predicate) const noexcept {
+        std::uint64_t bits = 0;
+        for (size_t i = 0; i < GROUP_WIDTH; ++i)
+            if (predicate(ctrl_[i]))
+                bits |= std::uint64_t{1} << i;
+        return BitMask(bits);
+    }
+
+  public:
+    explicit Group(const ctrl_t* pos) noexcept : ctrl_(pos) {}
+
+    [[nodiscard]]
+    BitMask match(const ctrl_t tag) const noexcept {
+        return collect([tag](const ctrl_t c) { return c == tag; });
+    }
+
+    [[nodiscard]]
+    BitMask matchEmpty() const noexcept { return match(CTRL_EMPTY); }
+
+    [[nodiscard]]
+    BitMask matchEmptyOrDeleted() const noexcept {
+        return collect([](const ctrl_t c) { return !isFull(c); });
+    }
+#endif
+};
+
+} // namespace flat_hash_detail
+
+
+
+/** @class FlatHashMap
+ * @brief An open-addressing hash map with Swiss-table style control bytes.
+ *
+ * Unlike HashMap, which keeps the bucket state inline next to the key and
+ * value, FlatHashMap stores one control byte per slot in a separate array.
+ * A control byte is either Empty, Deleted, or the low 7 bits of the key's hash
+ * (the "tag"). Slots are grouped into aligned runs of 16; a lookup loads the
+ * 16 control bytes of a group into one SSE2/NEON register, compares them
+ * against the tag in a single instruction, and only touches key storage for
+ * the few slots whose tag matched. Groups are visited with triangular
+ * probing, and a lookup stops at the first group that still has an Empty slot.
+ *
+ * The public interface mirrors HashMap, so the two can be swapped freely.
+ *
+ * @par Complexity
+ * - O(1) expected time for insert, lookup and remove.
+ * - One byte of metadata per slot; key/value storage is only read on a tag
+ *   match (a false tag match happens with probability 1/128 per full slot).
+ *
+ * @tparam Key The type of the keys in the map.
+ * @tparam Value The type of the values in the map.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ * @tparam LoadFactorPercent The maximum load factor percentage (including
+ * deleted slots) before resizing. Defaults to 70.
+ */
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>,
+          size_t LoadFactorPercent = 70>
+class FlatHashMap {
+    static_assert(LoadFactorPercent > 0 && LoadFactorPercent < 100,
+                  "LoadFactorPercent must be between 1 and 99.");
+
+    using ctrl_t = flat_hash_detail::ctrl_t;
+    using Group = flat_hash_detail::Group;
+    using BitMask = flat_hash_detail::BitMask;
+
+    static constexpr ctrl_t CTRL_EMPTY = flat_hash_detail::CTRL_EMPTY;
+    static constexpr ctrl_t CTRL_DELETED = flat_hash_detail::CTRL_DELETED;
+    static constexpr size_t GROUP_WIDTH = flat_hash_detail::GROUP_WIDTH;
+
+
+    /** @struct Slot
+     *
+     * @brief Uninitialized storage for one key-value pair.
+     *
+     * Whether the slot holds a live pair is recorded only in the control
+     * array, so a Slot carries no state of its own.
+     */
+    struct Slot {
+        alignas(Key) unsigned char key_storage[sizeof(Key)];
+        alignas(Value) unsigned char value_storage[sizeof(Value)];
+
+        /// Returns a pointer to the key stored in the slot.
+        Key* key() { return std::launder(reinterpret_cast<Key*>(key_storage)); }
+
+        /// Returns a const pointer to the key stored in the slot.
+        const Key* key() const {
+            return std::launder(reinterpret_cast<const Key*>(key_storage));
+        }
+
+        /// Returns a pointer to the value stored in the slot.
+        Value* value() {
+            return std::launder(reinterpret_cast<Value*>(value_storage));
+        }
+
+        /// Returns a const pointer to the value stored in the slot.
+        const Value* value() const {
+            return std::launder(reinterpret_cast<const Value*>(value_storage));
+        }
+
+        /// Constructs the key and value; destroys the key again if the value
+        /// constructor throws.
+        template <typename K, typename V>
+        void construct(K&& k, V&& v) {
+            new (key_storage) Key(std::forward<K>(k));
+            try {
+                new (value_storage) Value(std::forward<V>(v));
+            } catch (...) {
+                key()->~Key();
+                throw;
+            }
+        }
+
+        /// Destroys the key and value. The caller updates the control byte.
+        void destroy() noexcept {
+            key()->~Key();
+            value()->~Value();
+        }
+    };
+
+
+    ctrl_t* ctrl_;
+    Slot* slots_;
+    size_t size_;
+    size_t tombstones_;
+    size_t capacity_;
+    Hash hasher_;
+
+    static constexpr float LOAD_FACTOR =
+        static_cast<float>(LoadFactorPercent) / 100.0f;
+    static constexpr size_t DEFAULT_CAPACITY = GROUP_WIDTH;
+
+
+    /// Rounds up to the next power of two, and to at least one group.
+    static size_t roundUpToPowerOfTwo(const size_t n) {
+        size_t cap = GROUP_WIDTH;
+        while (cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    /// Upper 57 bits of the hash select the starting group.
+    static size_t h1(const size_t hash) noexcept { return hash >> 7; }
+
+    /// Lower 7 bits of the hash are stored in the control byte.
+    static ctrl_t h2(const size_t hash) noexcept {
+        return static_cast<ctrl_t>(hash & 0x7F);
+    }
+
+    /// Maximum number of full plus deleted slots before a resize.
+    size_t maxOccupancy() const noexcept {
+        return static_cast<size_t>(static_cast<float>(capacity_) * LOAD_FACTOR);
+    }
+
+
+    /**
+     * @brief Finds the first Empty or Deleted slot on the probe sequence of
+     * the given hash.
+     *
+     * The load factor guarantees that such a slot exists.
+     */
+    static size_t findInsertSlot(const ctrl_t* ctrl, const size_t capacity,
+                                 const size_t hash) noexcept {
+        const size_t group_mask = capacity / GROUP_WIDTH - 1;
+        size_t group = h1(hash) & group_mask;
+        for (size_t step = 1;; ++step) {
+            const size_t base = group * GROUP_WIDTH;
+            if (const BitMask free = Group(ctrl + base).matchEmptyOrDeleted())
+                return base + free.lowest();
+            group = (group + step) & group_mask;
+        }
+    }
+
+
+    /**
+     * @brief Locates the slot holding the given key.
+     *
+     * @param key The key to look for.
+     * @param hash The precomputed hash of the key.
+     * @return size_t The slot index, or capacity_ if the key is absent.
+     */
+    size_t findIndex(const Key& key, const size_t hash) const {
+        if (size_ == 0)
+            return capacity_;
+
+        const size_t group_mask = capacity_ / GROUP_WIDTH - 1;
+        const ctrl_t tag = h2(hash);
+        size_t group = h1(hash) & group_mask;
+
+        for (size_t step = 1; step <= group_mask + 1; ++step) {
+            const size_t base = group * GROUP_WIDTH;
+            const Group g(ctrl_ + base);
+
+            for (BitMask m = g.match(tag); m; m.clearLowest()) {
+                const size_t idx = base + m.lowest();
+                if (*slots_[idx].key() == key)
+                    return idx;
+            }
+
+            if (g.matchEmpty())
+                return capacity_;
+
+            group = (group + step) & group_mask;
+        }
+        return capacity_;
+    }
+
+
+    /**
+     * @brief Rebuilds the table with the given capacity.
+     *
+     * Every live pair is moved into a fresh slot array; deleted slots are
+     * dropped. Also used at the same capacity to purge tombstones.
+     *
+     * @param new_capacity The new capacity (a power of two, >= GROUP_WIDTH).
+     */
+    void rehash(const size_t new_capacity) {
+        ctrl_t* new_ctrl = new ctrl_t[new_capacity];
+        std::memset(new_ctrl, CTRL_EMPTY, new_capacity);
+
+        Slot* new_slots;
+        try {
+            new_slots = new Slot[new_capacity];
+        } catch (...) {
+            delete[] new_ctrl;
+            throw;
+        }
+
+        try {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (!flat_hash_detail::isFull(ctrl_[i]))
+                    continue;
+
+                const size_t hash = hasher_(*slots_[i].key());
+                const size_t idx = findInsertSlot(new_ctrl, new_capacity, hash);
+                new_slots[idx].construct(std::move(*slots_[i].key()),
+                                         std::move(*slots_[i].value()));
+                new_ctrl[idx] = h2(hash);
+            }
+        } catch (...) {
+            for (size_t i = 0; i < new_capacity; ++i)
+                if (flat_hash_detail::isFull(new_ctrl[i]))
+                    new_slots[i].destroy();
+
+            delete[] new_slots;
+            delete[] new_ctrl;
+            throw;
+        }
+
+        destroyAll();
+        delete[] slots_;
+        delete[] ctrl_;
+
+        ctrl_ = new_ctrl;
+        slots_ = new_slots;
+        capacity_ = new_capacity;
+        tombstones_ = 0;
+    }
+
+
+    /**
+     * @brief Makes room for one more pair.
+     *
+     * Grows when live pairs alone would exceed the load factor; if the limit
+     * is reached mostly because of deleted slots, rebuilds at the same
+     * capacity instead.
+     */
+    void ensureCapacity() {
+        if (capacity_ == 0) {
+            rehash(DEFAULT_CAPACITY);
+            return;
+        }
+
+        const size_t limit = maxOccupancy();
+        if (size_ + tombstones_ + 1 <= limit)
+            return;
+
+        rehash(size_ + 1 <= limit / 2 ? capacity_ : capacity_ * 2);
+    }
+
+
+    /// Destroys every live pair without touching the control bytes.
+    void destroyAll() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<Key> ||
+                      !std::is_trivially_destructible_v<Value>) {
+            for (size_t i = 0; i < capacity_; ++i)
+                if (flat_hash_detail::isFull(ctrl_[i]))
+                    slots_[i].destroy();
+        }
+    }
+
+
+    /// Places a new pair into a free slot on the probe sequence of hash.
+    template <typename K, typename V>
+    size_t insertNew(const size_t hash, K&& key, V&& value) {
+        const size_t idx = findInsertSlot(ctrl_, capacity_, hash);
+        slots_[idx].construct(std::forward<K>(key), std::forward<V>(value));
+
+        if (ctrl_[idx] == CTRL_DELETED)
+            --tombstones_;
+        ctrl_[idx] = h2(hash);
+        ++size_;
+        return idx;
+    }
+
+
+  public:
+    /// Default constructor initializes the map with one group of slots.
+    FlatHashMap() : FlatHashMap(DEFAULT_CAPACITY) {}
+
+    /// Constructor with specified initial capacity (rounded up to a power of
+    /// two, and at least one group).
+    explicit FlatHashMap(const size_t capacity)
+        : ctrl_(nullptr), slots_(nullptr), size_(0), tombstones_(0),
+          capacity_(roundUpToPowerOfTwo(capacity)), hasher_() {
+        ctrl_ = new ctrl_t[capacity_];
+        std::memset(ctrl_, CTRL_EMPTY, capacity_);
+        try {
+            slots_ = new Slot[capacity_];
+        } catch (...) {
+            delete[] ctrl_;
+            throw;
+        }
+    }
+
+    /// Copy constructor. Keeps the exact slot layout of the source.
+    FlatHashMap(const FlatHashMap& other)
+        : ctrl_(nullptr), slots_(nullptr), size_(0),
+          tombstones_(other.tombstones_), capacity_(other.capacity_),
+          hasher_(other.hasher_) {
+        if (capacity_ == 0)
+            return;
+
+        ctrl_ = new ctrl_t[capacity_];
+        std::memset(ctrl_, CTRL_EMPTY, capacity_);
+        try {
+            slots_ = new Slot[capacity_];
+        } catch (...) {
+            delete[] ctrl_;
+            throw;
+        }
+
+        try {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (flat_hash_detail::isFull(other.ctrl_[i])) {
+                    slots_[i].construct(*other.slots_[i].key(),
+                                        *other.slots_[i].value());
+                    ++size_;
+                }
+                ctrl_[i] = other.ctrl_[i];
+            }
+        } catch (...) {
+            destroyAll();
+            delete[] slots_;
+            delete[] ctrl_;
+            throw;
+        }
+    }
+
+    /// Move constructor. The source is left empty, with no storage.
+    FlatHashMap(FlatHashMap&& other) noexcept
+        : ctrl_(other.ctrl_), slots_(other.slots_), size_(other.size_),
+          tombstones_(other.tombstones_), capacity_(other.capacity_),
+          hasher_(std::move(other.hasher_)) {
+        other.ctrl_ = nullptr;
+        other.slots_ = nullptr;
+        other.size_ = 0;
+        other.tombstones_ = 0;
+        other.capacity_ = 0;
+    }
+
+    /// Copy-and-swap assignment operator.
+    FlatHashMap& operator=(FlatHashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /// Destructor cleans up allocated resources.
+    ~FlatHashMap() {
+        if (capacity_ != 0)
+            destroyAll();
+        delete[] slots_;
+        delete[] ctrl_;
+    }
+
+
+    /// Swaps the contents of this map with another.
+    void swap(FlatHashMap& other) noexcept {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(size_, other.size_);
+        std::swap(tombstones_, other.tombstones_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(hasher_, other.hasher_);
+    }
+
+    /// Checks if the map is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of key-value pairs in the map.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Returns the number of slots currently allocated.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Clears the map, removing all key-value pairs. Capacity is kept.
+    void clear() noexcept {
+        if (capacity_ == 0)
+            return;
+        destroyAll();
+        std::memset(ctrl_, CTRL_EMPTY, capacity_);
+        size_ = 0;
+        tombstones_ = 0;
+    }
+
+
+    /**
+     * @brief Inserts or updates a key-value pair in the map.
+     *
+     * If the key already exists, its value is replaced. Otherwise a new pair
+     * is inserted, resizing first if the load factor would be exceeded.
+     *
+     * @tparam K The type of the key (can be a reference or rvalue).
+     * @tparam V The type of the value (can be a reference or rvalue).
+     *
+     * @param key The key to be inserted or updated.
+     * @param value The value to be associated with the key.
+     */
+    template <typename K, typename V>
+    void insert(K&& key, V&& value) {
+        const size_t hash = hasher_(key);
+
+        if (const size_t idx = findIndex(key, hash); idx != capacity_) {
+            Value* stored = slots_[idx].value();
+            stored->~Value();
+            try {
+                new (stored) Value(std::forward<V>(value));
+            } catch (...) {
+                // The slot no longer holds a complete pair: retire it.
+                slots_[idx].key()->~Key();
+                ctrl_[idx] = CTRL_DELETED;
+                ++tombstones_;
+                --size_;
+                throw;
+            }
+            return;
+        }
+
+        ensureCapacity();
+        insertNew(hash, std::forward<K>(key), std::forward<V>(value));
+    }
+
+
+    /**
+     * @brief Accesses the value associated with the given key.
+     *
+     * @param key The key whose associated value is to be accessed.
+     * @return Value& A reference to the value associated with the key.
+     *
+     * @throws std::out_of_range If the key is not found in the map.
+     */
+    Value& at(const Key& key) {
+        const size_t idx = findIndex(key, hasher_(key));
+        if (idx == capacity_)
+            throw std::out_of_range("Key not found");
+        return *slots_[idx].value();
+    }
+
+
+    /**
+     * @brief Accesses the value associated with the given key (const version).
+     *
+     * @param key The key whose associated value is to be accessed.
+     * @return const Value& A const reference to the value associated with the
+     * key.
+     *
+     * @throws std::out_of_range If the key is not found in the map.
+     */
+    const Value& at(const Key& key) const {
+        const size_t idx = findIndex(key, hasher_(key));
+        if (idx == capacity_)
+            throw std::out_of_range("Key not found");
+        return *slots_[idx].value();
+    }
+
+
+    /**
+     * @brief Accesses or inserts a default-constructed value for the given key.
+     *
+     * @tparam K The type of the key (perfect-forwarded).
+     * @param key The key to look up or insert.
+     * @return Value& Reference to the associated value.
+     */
+    template <typename K>
+    Value& operator[](K&& key) {
+        const size_t hash = hasher_(key);
+        if (const size_t idx = findIndex(key, hash); idx != capacity_)
+            return *slots_[idx].value();
+
+        ensureCapacity();
+        return *slots_[insertNew(hash, std::forward<K>(key), Value{})].value();
+    }
+
+
+    /**
+     * @brief Removes the key-value pair associated with the given key.
+     *
+     * The slot becomes Empty again if its group still has an Empty slot (no
+     * probe sequence can have continued past such a group), and Deleted
+     * otherwise.
+     *
+     * @param key The key to be removed from the map.
+     * @return true If the key was found and removed.
+     * @return false If the key was not found in the map.
+     */
+    bool remove(const Key& key) {
+        const size_t idx = findIndex(key, hasher_(key));
+        if (idx == capacity_)
+            return false;
+
+        slots_[idx].destroy();
+        const size_t base = idx & ~(GROUP_WIDTH - 1);
+        if (Group(ctrl_ + base).matchEmpty()) {
+            ctrl_[idx] = CTRL_EMPTY;
+        } else {
+            ctrl_[idx] = CTRL_DELETED;
+            ++tombstones_;
+        }
+        --size_;
+        return true;
+    }
+
+
+    /**
+     * @brief Checks if the map contains the given key.
+     *
+     * @param key The key to be checked for existence in the map.
+     * @return true If the key exists in the map.
+     * @return false If the key does not exist in the map.
+     */
+    bool contains(const Key& key) const {
+        return findIndex(key, hasher_(key)) != capacity_;
+    }
+
+
+    /**
+     * @class iterator
+     * @brief Forward iterator over the full slots of the FlatHashMap.
+     */
+    class iterator {
+      private:
+        friend class FlatHashMap;
+        friend class const_iterator;
+
+        FlatHashMap* map_;
+        size_t idx_;
+
+        /// Advances the index to the next full slot (or to capacity).
+        void advanceToNextOccupied() {
+            while (idx_ < map_->capacity_ && !flat_hash_detail::isFull(map_->ctrl_[idx_]))
+                ++idx_;
+        }
+
+      public:
+        /// Proxy structure for arrow (->) operator support with structured bindings
+        struct Proxy {
+            std::pair<const Key&, Value&> pair_ref;
+            std::pair<const Key&, Value&>* operator->() { return &pair_ref; }
+        };
+
+        /// Constructs an iterator pointing to the first full slot starting from idx.
+        iterator(FlatHashMap* map, const size_t idx) : map_(map), idx_(idx) {
+            advanceToNextOccupied();
+        }
+
+        /// Returns references to the key and value of the current slot.
+        std::pair<const Key&, Value&> operator*() const {
+            return { *map_->slots_[idx_].key(), *map_->slots_[idx_].value() };
+        }
+
+        /// Arrow operator returns a proxy object for structured binding support.
+        Proxy operator->() const {
+            return Proxy{ **this };
+        }
+
+        /// Pre-increment operator advances the iterator to the next full slot.
+        iterator& operator++() {
+            ++idx_;
+            advanceToNextOccupied();
+            return *this;
+        }
+
+        /// Post-increment operator advances the iterator and returns the
+        /// previous position.
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// Equality operator checks if two iterators point to the same slot.
+        bool operator==(const iterator& other) const {
+            return map_ == other.map_ && idx_ == other.idx_;
+        }
+
+        /// Inequality operator checks if two iterators are not equal.
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+    };
+
+
+    /**
+     * @class const_iterator
+     * @brief Constant forward iterator for the FlatHashMap.
+     */
+    class const_iterator {
+      private:
+        friend class FlatHashMap;
+
+        const FlatHashMap* map_;
+        size_t idx_;
+
+        /// Advances the index to the next full slot (or to capacity).
+        void advanceToNextOccupied() {
+            while (idx_ < map_->capacity_ && !flat_hash_detail::isFull(map_->ctrl_[idx_]))
+                ++idx_;
+        }
+
+      public:
+        struct Proxy {
+            std::pair<const Key&, const Value&> pair_ref;
+            std::pair<const Key&, const Value&>* operator->() { return &pair_ref; }
+        };
+
+        /// Constructs a const_iterator pointing to the first full slot starting from idx.
+        const_iterator(const FlatHashMap* map, const size_t idx) : map_(map), idx_(idx) {
+            advanceToNextOccupied();
+        }
+
+        /// Constructs a const_iterator from a non-const iterator.
+        explicit const_iterator(const iterator& it) : map_(it.map_), idx_(it.idx_) {}
+
+        /// Returns const references to the key and value of the current slot.
+        std::pair<const Key&, const Value&> operator*() const {
+            return { *map_->slots_[idx_].key(), *map_->slots_[idx_].value() };
+        }
+
+        /// Arrow operator returns a proxy object for structured binding support.
+        Proxy operator->() const {
+            return Proxy{ **this };
+        }
+
+        /// Pre-increment operator advances the iterator to the next full slot.
+        const_iterator& operator++() {
+            ++idx_;
+            advanceToNextOccupied();
+            return *this;
+        }
+
+        /// Post-increment operator advances the iterator and returns the
+        /// previous position.
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// Equality operator checks if two const_iterators point to the same slot.
+        bool operator==(const const_iterator& other) const {
+            return map_ == other.map_ && idx_ == other.idx_;
+        }
+
+        /// Inequality operator checks if two const_iterators are not equal.
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+    };
+
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity_); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity_); }
+
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    const_iterator cend() const { return const_iterator(this, capacity_); }
+};
+
+
+} // namespace containers
+
+
+#endif // FLAT_HASH_MAP_HPP
@@ -0,0 +1,363 @@
+#ifndef FROZEN_HASH_MAP_HPP
+#define FROZEN_HASH_MAP_HPP
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DefaultHash.hpp"
+#include "MappedFile.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @class FrozenHashMap
+ *
+ * @brief Read-only hash map loaded from a memory-mapped image file.
+ *
+ * save() builds an open-addressed table from any map (or range of
+ * key/value pairs) and writes it to an image file; constructing a
+ * FrozenHashMap maps that file and probes the table in place. Opening is
+ * O(1) and allocates nothing, so a map with millions of entries is usable
+ * within milliseconds of process start, where rebuilding a HashMap would
+ * rehash and insert every entry.
+ *
+ * The table stores one control byte per slot (0 for empty, otherwise the
+ * top 7 bits of the hash with the high bit set), followed by the keys and
+ * then the values in separate arrays: a probe scans control bytes and
+ * keys only, and touches a value once, on a hit. Linear probing over a
+ * power-of-two capacity at most 70% full keeps probe sequences short.
+ *
+ * Hashes are stored implicitly in the slot positions, so the hash function
+ * must give the same result in every process: the default is DefaultHash
+ * with a fixed seed. The image records the hash of one stored key, and
+ * opening it with a hash function that disagrees (a different function,
+ * or a per-process random seed) throws instead of silently missing keys.
+ *
+ * @tparam Key Trivially copyable key type, compared with ==.
+ * @tparam Value Trivially copyable value type.
+ * @tparam Hash Hash functor; must be deterministic across processes.
+ */
+template <typename Key, typename Value, typename Hash = DefaultHash<Key, false>>
+class FrozenHashMap {
+    static_assert(std::is_trivially_copyable_v<Key> && std::is_trivially_copyable_v<Value>,
+                  "FrozenHashMap requires trivially copyable Key and Value");
+    static_assert(alignof(Key) <= image_detail::PAYLOAD_ALIGNMENT &&
+                      alignof(Value) <= image_detail::PAYLOAD_ALIGNMENT,
+                  "FrozenHashMap supports alignments of at most 64 bytes");
+
+    using ctrl_t = std::uint8_t;
+
+    static constexpr ctrl_t CTRL_EMPTY = 0;
+    static constexpr size_t MIN_CAPACITY = 8;
+    static constexpr size_t LOAD_FACTOR_PERCENT = 70;
+    static constexpr size_t FIND_MANY_BATCH = 16;
+
+    MappedFile file_;
+    const ctrl_t* ctrl_ = nullptr;
+    const Key* keys_ = nullptr;
+    const Value* values_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+    [[no_unique_address]] Hash hasher_;
+
+
+    /// The control byte of an occupied slot whose key hashes to hash.
+    static constexpr ctrl_t tagOf(const size_t hash) noexcept {
+        return static_cast<ctrl_t>(0x80 | (static_cast<std::uint64_t>(hash) >> 57));
+    }
+
+    /// Smallest power-of-two capacity holding n entries within the load factor.
+    static size_t capacityFor(const size_t n) noexcept {
+        size_t capacity = std::bit_ceil(n < MIN_CAPACITY ? MIN_CAPACITY : n);
+        while (capacity * LOAD_FACTOR_PERCENT / 100 < n)
+            capacity <<= 1;
+        return capacity;
+    }
+
+    /// Byte offsets of the key and value arrays within the payload.
+    static size_t keysOffset(const size_t capacity) noexcept {
+        return image_detail::alignPayload(capacity * sizeof(ctrl_t));
+    }
+
+    static size_t valuesOffset(const size_t capacity) noexcept {
+        return keysOffset(capacity) + image_detail::alignPayload(capacity * sizeof(Key));
+    }
+
+    static image_detail::ImageHeader expectedHeader() noexcept {
+        image_detail::ImageHeader header =
+            image_detail::makeHeader(image_detail::ImageKind::FrozenHashMap);
+        header.key_size = sizeof(Key);
+        header.key_align = alignof(Key);
+        header.value_size = sizeof(Value);
+        header.value_align = alignof(Value);
+        return header;
+    }
+
+
+    /// Hints the CPU to start loading the control byte and key of a slot.
+    static void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#else
+        static_cast<void>(address);
+#endif
+    }
+
+
+    /**
+     * @brief Uninitialized, zero-filled storage for the table being built
+     * by save().
+     *
+     * Zero-filling keeps the bytes of empty slots, and so the image and its
+     * checksum, deterministic.
+     */
+    template <typename T>
+    class Staging {
+        std::allocator<T> allocator_;
+        T* data_;
+        size_t size_;
+
+      public:
+        explicit Staging(const size_t size) : data_(allocator_.allocate(size)), size_(size) {
+            std::memset(static_cast<void*>(data_), 0, size * sizeof(T));
+        }
+        Staging(const Staging&) = delete;
+        Staging& operator=(const Staging&) = delete;
+        ~Staging() { allocator_.deallocate(data_, size_); }
+
+        T* data() const noexcept { return data_; }
+        T& operator[](const size_t idx) const noexcept { return data_[idx]; }
+    };
+
+
+    /// Slot holding key, or capacity_ if it is absent.
+    size_t findSlot(const Key& key, const size_t hash) const noexcept {
+        const size_t mask = capacity_ - 1;
+        const ctrl_t tag = tagOf(hash);
+        for (size_t idx = hash & mask;; idx = (idx + 1) & mask) {
+            const ctrl_t ctrl = ctrl_[idx];
+            if (ctrl == tag && keys_[idx] == key)
+                return idx;
+            if (ctrl == CTRL_EMPTY)
+                return capacity_;
+        }
+    }
+
+  public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using size_type = size_t;
+
+
+    /**
+     * @brief Builds the table for entries and writes it to an image file.
+     *
+     * If a key occurs more than once, the last occurrence wins. The file is
+     * replaced atomically (written aside, then renamed).
+     *
+     * @tparam Map Any range whose elements destructure into a key and a
+     * value, such as a HashMap or a container of std::pair. It is
+     * traversed twice: once to size the table, once to fill it.
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    template <typename Map>
+    static void save(const std::filesystem::path& path, const Map& entries) {
+        size_t n = 0;
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+            ++n;
+
+        const size_t capacity = capacityFor(n);
+        const size_t mask = capacity - 1;
+        const Hash hasher{};
+        Staging<ctrl_t> ctrl(capacity);
+        Staging<Key> keys(capacity);
+        Staging<Value> values(capacity);
+
+        size_t count = 0;
+        size_t check_index = capacity;
+        for (const auto& [key, value] : entries) {
+            const size_t hash = hasher(key);
+            const ctrl_t tag = tagOf(hash);
+            size_t idx = hash & mask;
+            while (ctrl[idx] != CTRL_EMPTY && !(ctrl[idx] == tag && keys[idx] == key))
+                idx = (idx + 1) & mask;
+
+            if (ctrl[idx] == CTRL_EMPTY) {
+                ctrl[idx] = tag;
+                std::construct_at(keys.data() + idx, key);
+                ++count;
+                if (check_index == capacity)
+                    check_index = idx;
+            }
+            std::construct_at(values.data() + idx, value);
+        }
+
+        image_detail::ImageHeader header = expectedHeader();
+        header.count = count;
+        header.capacity = capacity;
+        if (check_index != capacity) {
+            header.check_index = check_index;
+            header.hash_check = hasher(keys[check_index]);
+        }
+        const std::pair<const std::byte*, size_t> sections[] = {
+            {reinterpret_cast<const std::byte*>(ctrl.data()), capacity * sizeof(ctrl_t)},
+            {reinterpret_cast<const std::byte*>(keys.data()), capacity * sizeof(Key)},
+            {reinterpret_cast<const std::byte*>(values.data()), capacity * sizeof(Value)}};
+        image_detail::writeImage(path, header, sections);
+    }
+
+
+    /// Creates an empty map that maps nothing.
+    FrozenHashMap() noexcept = default;
+
+    /**
+     * @brief Maps the image file at path.
+     *
+     * @param path File written by save() for the same Key, Value and Hash.
+     * @param check ImageCheck::Header validates the header only and keeps
+     * the load O(1); ImageCheck::Checksum also reads the whole table once
+     * to verify its checksum.
+     * @throws std::system_error if the file cannot be mapped.
+     * @throws std::runtime_error if it is not a map image of these types,
+     * is truncated or corrupt, or was hashed differently.
+     */
+    explicit FrozenHashMap(const std::filesystem::path& path,
+                           const ImageCheck check = ImageCheck::Header)
+        : file_(path) {
+        const auto& header = image_detail::validateImage(file_, expectedHeader(), check);
+        const size_t capacity = header.capacity;
+        if (capacity < MIN_CAPACITY || !std::has_single_bit(capacity) || header.count >= capacity)
+            throw std::runtime_error("Image holds an invalid table");
+        if (valuesOffset(capacity) + capacity * sizeof(Value) != header.payload_bytes)
+            throw std::runtime_error("Image is truncated");
+
+        const std::byte* payload = file_.data() + sizeof(image_detail::ImageHeader);
+        ctrl_ = reinterpret_cast<const ctrl_t*>(payload);
+        keys_ = reinterpret_cast<const Key*>(payload + keysOffset(capacity));
+        values_ = reinterpret_cast<const Value*>(payload + valuesOffset(capacity));
+        size_ = header.count;
+        capacity_ = capacity;
+
+        if (size_ > 0 && (header.check_index >= capacity_ ||
+                          hasher_(keys_[header.check_index]) != header.hash_check))
+            throw std::runtime_error("Image was built with a different hash function or seed");
+    }
+
+
+    /// Returns the number of entries.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the map is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of slots in the table.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+
+    /**
+     * @brief Looks up key.
+     *
+     * @return const Value* Pointer into the mapping, or nullptr if the key
+     * is absent. Valid as long as the map.
+     */
+    [[nodiscard]]
+    const Value* find(const Key& key) const noexcept {
+        if (capacity_ == 0)
+            return nullptr;
+        const size_t idx = findSlot(key, hasher_(key));
+        return idx != capacity_ ? values_ + idx : nullptr;
+    }
+
+    /// Checks if key is present.
+    [[nodiscard]]
+    bool contains(const Key& key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Returns the value mapped to key.
+     *
+     * @throws std::out_of_range If the key is absent.
+     */
+    const Value& at(const Key& key) const {
+        const Value* value = find(key);
+        if (value == nullptr)
+            throw std::out_of_range("Key not found");
+        return *value;
+    }
+
+
+    /**
+     * @brief Looks up a batch of keys, overlapping their memory accesses.
+     *
+     * Works like HashMap::findMany(): the home slots of FIND_MANY_BATCH keys
+     * are prefetched before any of them is probed, which matters most right
+     * after opening, when the pages are not yet resident.
+     *
+     * @param out Receives, for every key, a pointer to its value or nullptr.
+     * @return size_t The number of keys found.
+     */
+    size_t findMany(const Key* keys, const size_t count, const Value** out) const noexcept {
+        if (capacity_ == 0) {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = nullptr;
+            return 0;
+        }
+
+        size_t found = 0;
+        size_t hashes[FIND_MANY_BATCH];
+        for (size_t base = 0; base < count; base += FIND_MANY_BATCH) {
+            const size_t batch = count - base < FIND_MANY_BATCH ? count - base : FIND_MANY_BATCH;
+
+            if constexpr (requires { hasher_.hashBatch(keys, batch, hashes); })
+                hasher_.hashBatch(keys + base, batch, hashes);
+            else
+                for (size_t i = 0; i < batch; ++i)
+                    hashes[i] = hasher_(keys[base + i]);
+
+            for (size_t i = 0; i < batch; ++i) {
+                const size_t idx = hashes[i] & (capacity_ - 1);
+                prefetch(ctrl_ + idx);
+                prefetch(keys_ + idx);
+            }
+
+            for (size_t i = 0; i < batch; ++i) {
+                const size_t idx = findSlot(keys[base + i], hashes[i]);
+                out[base + i] = idx != capacity_ ? values_ + idx : nullptr;
+                found += idx != capacity_;
+            }
+        }
+        return found;
+    }
+
+
+    /// Calls visit(key, value) for every entry, in table order.
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (size_t idx = 0; idx < capacity_; ++idx)
+            if (ctrl_[idx] != CTRL_EMPTY)
+                visit(keys_[idx], values_[idx]);
+    }
+};
+
+} // namespace containers
+
+#endif // FROZEN_HASH_MAP_HPP
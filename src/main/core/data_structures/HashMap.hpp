@@ -1,254 +1,64 @@
 #ifndef HASHMAP_HPP
 #define HASHMAP_HPP
 
-#include <functional>
+#include <concepts>
+#include <iterator>
 #include <new>
-#include <random>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "DefaultHash.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 
 namespace containers {
 
 using std::size_t;
 
 
-/** @class DefaultHash
+/** @struct BulkRehash
  *
- * @brief A universal hash functor that works with any hashable type.
+ * @brief Rehash policy that moves every bucket in one pass (the default).
  *
- * This hash functor provides automatic compile-time dispatch to appropriate
- * hashing strategies based on the key type:
+ * Gives the lowest total cost and the simplest lookups, but the insert that
+ * triggers a resize pays for the whole table.
+ */
+struct BulkRehash {};
+
+
+/** @struct IncrementalRehash
  *
- * - Integral types (int, char, bool, etc.): Uses SplitMix64 mixing for
- * excellent distribution
- * - Pointer types: Removes alignment bits and applies SplitMix64 mixing
- * - Enumeration types: Hashes via underlying integral type
- * - Standard library types: Delegates to std::hash<T> with additional
- * mixing
- * - User-defined types: Requires std::hash<T> specialization
+ * @brief Rehash policy that spreads a resize over subsequent operations.
  *
- * The hash function incorporates an optional random seed to provide protection
- * against hash collision attacks while maintaining deterministic behavior when
- * needed.
+ * When the load factor is exceeded the old bucket array is kept alive next to
+ * the new one, and every non-const insert, lookup or remove first migrates up
+ * to BucketsPerStep old buckets. Lookups consult both arrays until the
+ * migration completes. The new array is large enough that the migration always
+ * finishes before the next resize is due, so no single operation moves more
+ * than BucketsPerStep entries.
  *
- * @tparam Key The type of the key to be hashed.
- * @tparam UseRandomSeed Whether to use a random seed (true) or deterministic seed (false).
+ * @tparam BucketsPerStep Number of old buckets migrated per operation.
  */
-template <typename Key, bool UseRandomSeed = true>
-struct DefaultHash {
-    /**
-     * @brief Computes the hash value for the given key.
-     *
-     * This operator automatically selects the most appropriate hashing strategy
-     * for the key type at compile time. The hash value incorporates mixing to
-     * ensure good distribution properties.
-     *
-     * @param key The key to be hashed.
-     * @return size_t A well-distributed hash value for the key.
-     */
-    [[nodiscard]]
-    constexpr size_t operator()(const Key& key) const noexcept {
-        return hash_dispatch(key);
-    }
-
-
-  private:
-    /**
-     * @brief Dispatches to the appropriate hash function based on the key type.
-     *
-     * This method uses compile-time type traits and constexpr if to select
-     * the optimal hashing strategy for each type category. The dispatch is
-     * resolved at compile time with zero runtime overhead.
-     *
-     * @param key The key to be hashed.
-     * @return size_t The computed hash value.
-     */
-    [[nodiscard]]
-    static constexpr size_t hash_dispatch(const Key& key) noexcept {
-        if constexpr (std::is_integral_v<Key>)
-            return hash_integral(static_cast<size_t>(key));
-
-        else if constexpr (std::is_pointer_v<Key>)
-            return hash_pointer(reinterpret_cast<uintptr_t>(key));
-
-        else if constexpr (std::is_enum_v<Key>)
-            return hash_enum(key);
-
-        else if constexpr (has_std_hash_v<Key>)
-            return hash_with_std_hash(key);
-
-        else {
-            static_assert(always_false_v,
-                          "No hash function available for this type. "
-                          "Please specialize std::hash<YourType> or provide a "
-                          "custom Hash functor. "
-                          "See documentation for examples.");
-        }
-        return 0; // Unreachable, but required to satisfy compiler
-    }
-
-
-    /// SFINAE-based detection of std::hash availability
-    template <typename T>
-    class has_std_hash {
-        /// Test function that checks if std::hash<T> is valid
-        template <typename U>
-        static auto test(int)
-            -> decltype(std::hash<U>{}(std::declval<const U&>()),
-                        std::true_type{});
-
-        /// Fallback if std::hash<T> is not valid
-        template <typename>
-        static std::false_type test(...);
-
-      public:
-        static constexpr bool value = decltype(test<T>(0))::value;
-    };
-
-
-    /// Helper variable template for std::hash detection
-    template <typename T>
-    static constexpr bool has_std_hash_v = has_std_hash<T>::value;
-
-    /// Helper for static_assert in template else branch
-    static constexpr bool always_false_v = false;
-
-
-    /**
-     * @brief Hashes integral types using SplitMix64 mixing.
-     *
-     * Applies high-quality bit mixing to prevent clustering that occurs
-     * with identity hashing of sequential integers. Uses the SplitMix64
-     * finalizer which provides excellent avalanche properties.
-     *
-     * @param key The integral key cast to size_t.
-     * @return size_t Well-distributed hash value.
-     */
-    [[nodiscard]]
-    static constexpr size_t hash_integral(const size_t key) noexcept {
-        return splitmix64(key ^ seed_);
-    }
-
-
-    /**
-     * @brief Hashes pointer types with alignment-aware processing.
-     *
-     * Removes the lower bits that are typically zero due to memory alignment,
-     * then applies SplitMix64 mixing. This approach works well for both
-     * heap pointers and stack pointers.
-     *
-     * @param ptr The pointer address as uintptr_t.
-     * @return size_t Well-distributed hash value.
-     */
-    [[nodiscard]]
-    static constexpr size_t hash_pointer(uintptr_t ptr) noexcept {
-        // Remove lower 3 bits (assumes 8-byte alignment)
-        ptr >>= 3;
-        return splitmix64(ptr ^ seed_);
-    }
-
-
-    /**
-     * @brief Hashes enumeration types via their underlying integral type.
-     *
-     * Converts the enum to its underlying type and delegates to integral
-     * hashing. This works for both scoped (enum class) and unscoped enums.
-     *
-     * @tparam Enum The enumeration type.
-     * @param e The enumeration value to hash.
-     * @return size_t Well-distributed hash value.
-     */
-    template <typename Enum>
-    [[nodiscard]]
-    static constexpr size_t hash_enum(const Enum& e) noexcept {
-        using underlying_t = std::underlying_type_t<Enum>;
-        return hash_integral(static_cast<size_t>(static_cast<underlying_t>(e)));
-    }
-
-
-    /**
-     * @brief Hashes types with std::hash specialization.
-     *
-     * Delegates to std::hash<T> and then applies additional SplitMix64 mixing
-     * to ensure consistent quality across different std::hash implementations.
-     * This handles std::string, std::vector, and other standard library types.
-     *
-     * @tparam T The type to hash (must have std::hash specialization).
-     * @param value The value to hash.
-     * @return size_t Well-distributed hash value.
-     */
-    template <typename T>
-    [[nodiscard]]
-    static constexpr size_t hash_with_std_hash(const T& value) noexcept {
-        const size_t base_hash = std::hash<T>{}(value);
-        return splitmix64(base_hash ^ seed_);
-    }
-
-
-    /**
-     * @brief SplitMix64 mixing function for high-quality hash distribution.
-     *
-     * This is the finalizer from the SplitMix64 algorithm, known for excellent
-     * avalanche properties. Each input bit influences approximately half of the
-     * output bits, providing strong mixing that eliminates patterns in input
-     * data.
-     *
-     * The constants used are:
-     * - 0x9e3779b97f4a7c15: The golden ratio * 2^64, provides good stepping
-     * - 0xbf58476d1ce4e5b9, 0x94d049bb133111eb: Large odd multipliers with good
-     * bit mixing
-     *
-     * @param x The input value to mix.
-     * @return size_t The mixed hash value with excellent distribution
-     * properties.
-     */
-    [[nodiscard]]
-    static constexpr size_t splitmix64(size_t x) noexcept {
-        x += 0x9e3779b97f4a7c15ull; // Golden ratio * 2^64
-        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
-        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
-        return x ^ (x >> 31);
-    }
-
+template <size_t BucketsPerStep = 8>
+struct IncrementalRehash {
+    static_assert(BucketsPerStep > 0, "BucketsPerStep must be positive.");
+    static constexpr size_t BUCKETS_PER_STEP = BucketsPerStep;
+};
 
-    /**
-     * @brief Initializes a cryptographically random seed.
-     *
-     * Uses std::random_device to generate a high-quality random seed.
-     * The seed is combined from two 32-bit values to ensure full 64-bit entropy
-     * even on platforms where std::random_device returns 32-bit values.
-     *
-     * @return size_t A random seed value.
-     */
-    static size_t init_random_seed() {
-        std::random_device rd;
-        return (static_cast<size_t>(rd()) << 32) ^ static_cast<size_t>(rd());
-    }
 
+/// Detects IncrementalRehash<N> policies.
+template <typename Policy>
+struct is_incremental_rehash : std::false_type {};
 
-    /**
-     * @brief Returns the seed based on the UseRandomSeed template parameter.
-     *
-     * When UseRandomSeed is true, generates a random seed for hash collision
-     * resistance. When false, uses a fixed seed for deterministic behavior
-     * (useful for testing).
-     *
-     * @return size_t The seed value to use for hashing.
-     */
-    static constexpr size_t get_seed() {
-        if constexpr (UseRandomSeed) {
-            return init_random_seed();
-        } else {
-            // Fixed seed derived from golden ratio for deterministic behavior
-            return 0x9e3779b97f4a7c15ull;
-        }
-    }
+template <size_t BucketsPerStep>
+struct is_incremental_rehash<IncrementalRehash<BucketsPerStep>> : std::true_type {};
 
-    /// Static seed shared by all instances of this hash specialization
-    inline static const size_t seed_ = get_seed();
-};
+template <typename Policy>
+inline constexpr bool is_incremental_rehash_v = is_incremental_rehash<Policy>::value;
 
 
 
@@ -258,21 +68,30 @@ struct DefaultHash {
  *
  * This class provides a hash map that supports insertion, deletion, and lookup
  * operations. It uses open addressing with linear probing for collision
- * resolution. The map automatically resizes when the load factor exceeds a
- * predefined threshold.
+ * resolution. The map automatically resizes when the load factor (counting
+ * both live entries and tombstones) exceeds a predefined threshold; a table
+ * that is full mostly because of tombstones is rebuilt at the same capacity.
  *
  * @tparam Key The type of the keys in the map.
  * @tparam Value The type of the values in the map.
  * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
  * @tparam LoadFactorPercent The maximum load factor percentage before resizing.
  * Defaults to 70.
+ * @tparam RehashPolicy BulkRehash (default) or IncrementalRehash<N>. With the
+ * incremental policy, non-const at(), insert, operator[] and remove may move
+ * entries and therefore invalidate iterators.
  */
 template <typename Key, typename Value, typename Hash = DefaultHash<Key>,
-          size_t LoadFactorPercent = 70>
+          size_t LoadFactorPercent = 70, typename RehashPolicy = BulkRehash>
 class HashMap {
     static_assert(LoadFactorPercent > 0 && LoadFactorPercent < 100,
                   "LoadFactorPercent must be between 1 and 99.");
 
+    static constexpr bool INCREMENTAL = is_incremental_rehash_v<RehashPolicy>;
+
+    static_assert(INCREMENTAL || std::is_same_v<RehashPolicy, BulkRehash>,
+                  "RehashPolicy must be BulkRehash or IncrementalRehash<N>.");
+
     /// State of a bucket in the hash map.
     enum class State : unsigned char { Empty, Occupied, Tombstone };
 
@@ -318,16 +137,23 @@ class HashMap {
          *
          * This method uses placement new to construct the key and value
          * in the aligned storage. It also sets the bucket state to Occupied.
+         * If the value constructor throws, the key is destroyed again and the
+         * bucket keeps its previous state.
          *
          * @tparam K The type of the key (can be a reference or rvalue).
-         * @tparam V The type of the value (can be a reference or rvalue).
+         * @tparam Args The types of the value constructor arguments.
          * @param k The key to be constructed.
-         * @param v The value to be constructed.
+         * @param args The arguments the value is constructed from.
          */
-        template <typename K, typename V>
-        void construct(K&& k, V&& v) {
+        template <typename K, typename... Args>
+        void construct(K&& k, Args&&... args) {
             new (key_storage) Key(std::forward<K>(k));
-            new (value_storage) Value(std::forward<V>(v));
+            try {
+                new (value_storage) Value(std::forward<Args>(args)...);
+            } catch (...) {
+                key()->~Key();
+                throw;
+            }
             state = State::Occupied;
         }
 
@@ -342,18 +168,64 @@ class HashMap {
     };
 
 
+    /// True for types that may be used directly for lookups: Key itself, or
+    /// any type the hash functor accepts when it declares is_transparent and
+    /// that compares equal to Key with operator==.
+    template <typename K>
+    static constexpr bool is_lookup_key_v =
+        std::is_same_v<std::remove_cvref_t<K>, Key> ||
+        (requires { typename Hash::is_transparent; } &&
+         requires(const Hash& hash, const Key& stored, const K& key) {
+             { hash(key) } -> std::convertible_to<size_t>;
+             { stored == key } -> std::convertible_to<bool>;
+         });
+
+
+    /// Result of a combined lookup / insertion-slot search.
+    struct Probe {
+        size_t index;
+        bool found;
+    };
+
+
     Bucket* buckets_;
     size_t size_;
     size_t capacity_;
     Hash hasher_;
+    size_t tombstones_ = 0;
+
+    // Incremental rehash state: the array being drained and the next old
+    // bucket to migrate. old_buckets_ is nullptr when no migration is running.
+    Bucket* old_buckets_ = nullptr;
+    size_t old_capacity_ = 0;
+    size_t migrate_cursor_ = 0;
+
+    size_t rehashes_ = 0; // Rebuilds that moved entries into a new array.
 
     static constexpr float LOAD_FACTOR =
         static_cast<float>(LoadFactorPercent) / 100.0f;
     static constexpr size_t DEFAULT_CAPACITY = 8;
+    static constexpr size_t FIND_MANY_BATCH = 16;
+
+
+    /// Hashes count lookup keys into out, through the hash functor's
+    /// hashBatch() when it has one for Key.
+    template <typename K>
+    void hashMany(const K* keys, const size_t count, size_t* out) const {
+        if constexpr (std::is_same_v<K, Key> &&
+                      requires(const Hash& hash) { hash.hashBatch(keys, count, out); }) {
+            hasher_.hashBatch(keys, count, out);
+        } else {
+            for (size_t i = 0; i < count; ++i)
+                out[i] = hasher_(keys[i]);
+        }
+    }
 
 
     /// Computes the next capacity (double the current).
-    static size_t nextCapacity(const size_t current) { return current * 2; }
+    static size_t nextCapacity(const size_t current) {
+        return current == 0 ? DEFAULT_CAPACITY : current * 2;
+    }
 
     /// Rounds up to the next power of two.
     static size_t roundUpToPowerOfTwo(const size_t n) {
@@ -363,9 +235,224 @@ class HashMap {
         return cap;
     }
 
-    /// Computes the index for a given key.
-    size_t indexFor(const Key& key) const {
-        return hasher_(key) & (capacity_ - 1);
+    /// Maximum number of occupied plus tombstone buckets for a capacity.
+    static size_t maxOccupancy(const size_t capacity) {
+        return static_cast<size_t>(static_cast<float>(capacity) * LOAD_FACTOR);
+    }
+
+
+    /// Smallest power-of-two capacity that holds n entries without exceeding
+    /// the load factor.
+    static size_t capacityFor(const size_t n) {
+        size_t capacity = roundUpToPowerOfTwo(n);
+        if (capacity < DEFAULT_CAPACITY)
+            capacity = DEFAULT_CAPACITY;
+        while (maxOccupancy(capacity) < n)
+            capacity <<= 1;
+        return capacity;
+    }
+
+
+    /// Hints the CPU to start loading a bucket into the cache.
+    static void prefetch(const Bucket* bucket) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(bucket, 0, 3);
+        if constexpr (sizeof(Bucket) > 64)
+            __builtin_prefetch(&bucket->state, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_prefetch(reinterpret_cast<const char*>(bucket), _MM_HINT_T0);
+        if constexpr (sizeof(Bucket) > 64)
+            _mm_prefetch(reinterpret_cast<const char*>(&bucket->state), _MM_HINT_T0);
+#else
+        static_cast<void>(bucket);
+#endif
+    }
+
+
+    /**
+     * @brief Finds the bucket holding key in the given bucket array.
+     *
+     * @return size_t The bucket index, or capacity if the key is absent.
+     */
+    template <typename K>
+    static size_t findIn(const Bucket* buckets, const size_t capacity,
+                         const K& key, const size_t hash) {
+        size_t idx = hash & (capacity - 1);
+        for (size_t probes = 0; probes < capacity; ++probes) {
+            const Bucket& bucket = buckets[idx];
+            if (bucket.state == State::Empty)
+                return capacity;
+            if (bucket.state == State::Occupied && *bucket.key() == key)
+                return idx;
+            idx = (idx + 1) & (capacity - 1);
+        }
+        return capacity;
+    }
+
+
+    /// Returns the first non-occupied bucket on the probe sequence of hash.
+    static size_t findFreeIn(const Bucket* buckets, const size_t capacity,
+                             const size_t hash) {
+        size_t idx = hash & (capacity - 1);
+        while (buckets[idx].state == State::Occupied)
+            idx = (idx + 1) & (capacity - 1);
+        return idx;
+    }
+
+
+    /**
+     * @brief Looks up key in the current bucket array and, if it is absent,
+     * picks the bucket it should be inserted into (the first tombstone on
+     * its probe sequence, or the terminating empty bucket).
+     *
+     * Requires a prior ensureCapacity() so that a free bucket exists.
+     */
+    template <typename K>
+    Probe locate(const K& key, const size_t hash) const {
+        size_t idx = hash & (capacity_ - 1);
+        size_t first_tombstone = capacity_;
+
+        for (size_t probes = 0; probes < capacity_; ++probes) {
+            const Bucket& bucket = buckets_[idx];
+            if (bucket.state == State::Empty)
+                return {first_tombstone != capacity_ ? first_tombstone : idx, false};
+            if (bucket.state == State::Tombstone) {
+                if (first_tombstone == capacity_)
+                    first_tombstone = idx;
+            } else if (*bucket.key() == key) {
+                return {idx, true};
+            }
+            idx = (idx + 1) & (capacity_ - 1);
+        }
+        return {first_tombstone, false};
+    }
+
+
+    /**
+     * @brief Finds key in either bucket array.
+     *
+     * @return size_t Position of the key in the combined index space used by
+     * the iterators, or endIndex() if the key is absent.
+     */
+    template <typename K>
+    size_t findPosition(const K& key, const size_t hash) const {
+        if (const size_t idx = findIn(buckets_, capacity_, key, hash); idx != capacity_)
+            return idx;
+
+        if constexpr (INCREMENTAL) {
+            if (old_buckets_ != nullptr) {
+                const size_t idx = findIn(old_buckets_, old_capacity_, key, hash);
+                if (idx != old_capacity_)
+                    return capacity_ + idx;
+            }
+        }
+        return endIndex();
+    }
+
+
+    /// Finds the bucket holding key in either bucket array, or nullptr.
+    template <typename K>
+    Bucket* findBucket(const K& key, const size_t hash) const {
+        const size_t pos = findPosition(key, hash);
+        return pos == endIndex() ? nullptr : &bucketAt(pos);
+    }
+
+
+    /**
+     * @brief Stores a new pair in bucket idx of the current array.
+     *
+     * @return Bucket& The bucket that now holds the pair.
+     */
+    template <typename K, typename... Args>
+    Bucket& constructAt(const size_t idx, K&& key, Args&&... args) {
+        Bucket& bucket = buckets_[idx];
+        const bool reuses_tombstone = bucket.state == State::Tombstone;
+        bucket.construct(std::forward<K>(key), std::forward<Args>(args)...);
+        if (reuses_tombstone)
+            --tombstones_;
+        ++size_;
+        return bucket;
+    }
+
+
+    /**
+     * @brief Finds key or inserts it with a value built from args.
+     *
+     * The arguments are only consumed when a new pair is constructed.
+     *
+     * @return std::pair<size_t, bool> The position of the pair in the combined
+     * index space, and whether it was inserted.
+     */
+    template <typename K, typename... Args>
+    std::pair<size_t, bool> emplaceUnique(const size_t hash, K&& key, Args&&... args) {
+        ensureCapacity();
+
+        if constexpr (INCREMENTAL) {
+            if (old_buckets_ != nullptr) {
+                const size_t idx = findIn(old_buckets_, old_capacity_, key, hash);
+                if (idx != old_capacity_)
+                    return {capacity_ + idx, false};
+            }
+        }
+
+        const Probe probe = locate(key, hash);
+        if (!probe.found)
+            constructAt(probe.index, std::forward<K>(key), std::forward<Args>(args)...);
+        return {probe.index, !probe.found};
+    }
+
+
+    /// Inserts key with value, or replaces the value if key is present.
+    template <typename K, typename V>
+    std::pair<size_t, bool> assignUnique(const size_t hash, K&& key, V&& value) {
+        // emplaceUnique() leaves value untouched when the key already exists.
+        const auto result = emplaceUnique(hash, std::forward<K>(key), std::forward<V>(value));
+        if (!result.second)
+            replaceValue(bucketAt(result.first), std::forward<V>(value));
+        return result;
+    }
+
+
+    /// Passes lookup keys through unchanged and converts anything else to a
+    /// Key once, so it is neither hashed nor compared as a foreign type.
+    template <typename K>
+    static decltype(auto) asLookupKey(K&& key) {
+        if constexpr (is_lookup_key_v<K>)
+            return std::forward<K>(key);
+        else
+            return Key(std::forward<K>(key));
+    }
+
+
+    /**
+     * @brief Replaces the value of an occupied bucket.
+     *
+     * If the new value cannot be constructed, the bucket is retired as a
+     * tombstone so the map stays consistent.
+     */
+    template <typename V>
+    void replaceValue(Bucket& bucket, V&& value) {
+        bucket.value()->~Value();
+        try {
+            new (bucket.value_storage) Value(std::forward<V>(value));
+        } catch (...) {
+            bucket.key()->~Key();
+            bucket.state = State::Tombstone;
+            if (&bucket >= buckets_ && &bucket < buckets_ + capacity_)
+                ++tombstones_;
+            --size_;
+            throw;
+        }
+    }
+
+
+    /// Marks an occupied bucket as removed.
+    void eraseBucket(Bucket& bucket) {
+        bucket.destroy();
+        bucket.state = State::Tombstone;
+        if (&bucket >= buckets_ && &bucket < buckets_ + capacity_)
+            ++tombstones_;
+        --size_;
     }
 
 
@@ -380,18 +467,16 @@ class HashMap {
      */
     void rehash(const size_t new_capacity) {
         Bucket* new_buckets = new Bucket[new_capacity];
-        size_t new_size = 0;
+        if (size_ != 0)
+            ++rehashes_;
 
         try {
             for (size_t i = 0; i < capacity_; ++i) {
                 if (buckets_[i].state == State::Occupied) {
-                    size_t idx = hasher_(*buckets_[i].key()) & (new_capacity - 1);
-                    while (new_buckets[idx].state == State::Occupied)
-                        idx = (idx + 1) & (new_capacity - 1);
-
+                    const size_t idx = findFreeIn(new_buckets, new_capacity,
+                                                  hasher_(*buckets_[i].key()));
                     new_buckets[idx].construct(std::move(*buckets_[i].key()),
                                                std::move(*buckets_[i].value()));
-                    ++new_size;
                 }
             }
         } catch (...) {
@@ -409,17 +494,129 @@ class HashMap {
 
         buckets_ = new_buckets;
         capacity_ = new_capacity;
-        size_ = new_size;
+        tombstones_ = 0;
+    }
+
+
+    /**
+     * @brief Starts an incremental migration into a new bucket array.
+     *
+     * The current array becomes the drained one; entries are moved over by
+     * migrateStep().
+     */
+    void beginMigration(const size_t new_capacity) {
+        Bucket* new_buckets = new Bucket[new_capacity];
+        ++rehashes_;
+
+        old_buckets_ = buckets_;
+        old_capacity_ = capacity_;
+        migrate_cursor_ = 0;
+
+        buckets_ = new_buckets;
+        capacity_ = new_capacity;
+        tombstones_ = 0;
+    }
+
+
+    /// Moves up to `budget` buckets of the drained array into the current one.
+    void migrateBuckets(size_t budget) {
+        while (budget-- > 0 && migrate_cursor_ < old_capacity_) {
+            Bucket& from = old_buckets_[migrate_cursor_];
+            if (from.state == State::Occupied) {
+                const size_t idx = findFreeIn(buckets_, capacity_, hasher_(*from.key()));
+                Bucket& to = buckets_[idx];
+                if (to.state == State::Tombstone)
+                    --tombstones_;
+                to.construct(std::move(*from.key()), std::move(*from.value()));
+                // Keep the probe chains of not yet migrated keys intact.
+                from.destroy();
+                from.state = State::Tombstone;
+            }
+            ++migrate_cursor_;
+        }
+
+        if (migrate_cursor_ == old_capacity_) {
+            delete[] old_buckets_;
+            old_buckets_ = nullptr;
+            old_capacity_ = 0;
+            migrate_cursor_ = 0;
+        }
+    }
+
+
+    /// Performs one bounded migration step if a migration is running.
+    void migrateStep() {
+        if constexpr (INCREMENTAL) {
+            if (old_buckets_ != nullptr)
+                migrateBuckets(RehashPolicy::BUCKETS_PER_STEP);
+        }
     }
 
 
-    /// Ensures the hash map has enough capacity, resizing if necessary.
+    /**
+     * @brief Ensures the hash map has room for one more entry, resizing if
+     * necessary.
+     *
+     * Live entries and tombstones both count towards the load factor. When
+     * the limit is reached mostly because of tombstones, the table is rebuilt
+     * at the same capacity instead of growing.
+     */
     void ensureCapacity() {
-        if ((size_ + 1) > static_cast<size_t>(capacity_ * LOAD_FACTOR))
-            rehash(nextCapacity(capacity_));
+        migrateStep();
+
+        if ((size_ + tombstones_ + 1) <= maxOccupancy(capacity_))
+            return;
+
+        if constexpr (INCREMENTAL) {
+            // Only reachable with unusual reserve()/capacity combinations.
+            if (old_buckets_ != nullptr)
+                migrateBuckets(old_capacity_);
+        }
+
+        const size_t new_capacity =
+            (capacity_ != 0 && size_ + 1 <= maxOccupancy(capacity_) / 2)
+                ? capacity_
+                : nextCapacity(capacity_);
+
+        if constexpr (INCREMENTAL) {
+            if (size_ != 0) {
+                beginMigration(new_capacity);
+                migrateStep();
+                return;
+            }
+        }
+        rehash(new_capacity);
     }
 
 
+    /// Destroys every entry in both arrays and releases the drained one.
+    void destroyAll() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            buckets_[i].destroy();
+            buckets_[i].state = State::Empty;
+        }
+
+        if (old_buckets_ != nullptr) {
+            for (size_t i = 0; i < old_capacity_; ++i)
+                old_buckets_[i].destroy();
+            delete[] old_buckets_;
+            old_buckets_ = nullptr;
+            old_capacity_ = 0;
+            migrate_cursor_ = 0;
+        }
+    }
+
+
+    /// Bucket at a position of the combined [current, drained) index space
+    /// used by the iterators.
+    Bucket& bucketAt(const size_t idx) const {
+        return idx < capacity_ ? buckets_[idx] : old_buckets_[idx - capacity_];
+    }
+
+    /// One past the last position of the combined index space.
+    size_t endIndex() const noexcept { return capacity_ + old_capacity_; }
+
+
   public:
     /// Default constructor initializes the hash map with default capacity.
     HashMap()
@@ -433,10 +630,28 @@ class HashMap {
         buckets_ = new Bucket[capacity_];
     }
 
-    /// Copy constructor.
+    /**
+     * @brief Builds a map from a range of key-value pairs.
+     *
+     * Forward ranges are measured first so the buckets are allocated once.
+     * Later duplicates of a key overwrite earlier ones.
+     *
+     * @tparam InputIt An input iterator whose elements provide first and
+     * second (e.g. std::pair<Key, Value>).
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template <std::input_iterator InputIt>
+    HashMap(InputIt first, InputIt last) : HashMap() {
+        insertRange(first, last);
+    }
+
+    /// Copy constructor. An in-progress migration of the source is completed
+    /// in the copy, which starts without one.
     HashMap(const HashMap& other)
         : buckets_(nullptr), size_(0),
-          capacity_(other.capacity_), hasher_(other.hasher_) {
+          capacity_(other.capacity_), hasher_(other.hasher_),
+          tombstones_(other.tombstones_) {
 
         Bucket* new_buckets = new Bucket[capacity_];
         buckets_ = new_buckets;
@@ -450,6 +665,17 @@ class HashMap {
                     new_buckets[i].state = State::Tombstone;
                 }
             }
+
+            for (size_t i = 0; i < other.old_capacity_; ++i) {
+                const Bucket& from = other.old_buckets_[i];
+                if (from.state == State::Occupied) {
+                    const size_t idx = findFreeIn(new_buckets, capacity_, hasher_(*from.key()));
+                    if (new_buckets[idx].state == State::Tombstone)
+                        --tombstones_;
+                    new_buckets[idx].construct(*from.key(), *from.value());
+                    ++size_;
+                }
+            }
         } catch (...) {
             for (size_t i = 0; i < capacity_; ++i)
                 new_buckets[i].destroy();
@@ -465,10 +691,18 @@ class HashMap {
     /// Move constructor.
     HashMap(HashMap&& other) noexcept
         : buckets_(other.buckets_), size_(other.size_),
-          capacity_(other.capacity_), hasher_(std::move(other.hasher_)) {
+          capacity_(other.capacity_), hasher_(std::move(other.hasher_)),
+          tombstones_(other.tombstones_), old_buckets_(other.old_buckets_),
+          old_capacity_(other.old_capacity_), migrate_cursor_(other.migrate_cursor_),
+          rehashes_(other.rehashes_) {
         other.buckets_ = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
+        other.tombstones_ = 0;
+        other.old_buckets_ = nullptr;
+        other.old_capacity_ = 0;
+        other.migrate_cursor_ = 0;
+        other.rehashes_ = 0;
     }
 
     /// Copy-and-swap assignment operator.
@@ -480,19 +714,15 @@ class HashMap {
 
     /// Swaps the contents of this hash map with another.
     void swap(HashMap& other) noexcept {
-        Bucket* tmp_b = buckets_;
-        buckets_ = other.buckets_;
-        other.buckets_ = tmp_b;
-
-        size_t tmp_s = size_;
-        size_ = other.size_;
-        other.size_ = tmp_s;
-
-        size_t tmp_c = capacity_;
-        capacity_ = other.capacity_;
-        other.capacity_ = tmp_c;
-
+        std::swap(buckets_, other.buckets_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
         std::swap(hasher_, other.hasher_);
+        std::swap(tombstones_, other.tombstones_);
+        std::swap(old_buckets_, other.old_buckets_);
+        std::swap(old_capacity_, other.old_capacity_);
+        std::swap(migrate_cursor_, other.migrate_cursor_);
+        std::swap(rehashes_, other.rehashes_);
     }
 
     /// Checks if the hash map is empty.
@@ -507,11 +737,77 @@ class HashMap {
         return size_;
     }
 
+    /// Returns the number of buckets in the current bucket array.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Returns how many times the entries were moved into a new bucket
+     * array (by growth, tombstone cleanup or reserve()) since the map was
+     * created.
+     *
+     * Each rebuild allocates a new array and rehashes every entry; a
+     * reserve() before the first insert keeps this at zero for a known
+     * number of keys.
+     */
+    [[nodiscard]]
+    size_t rehashCount() const noexcept {
+        return rehashes_;
+    }
+
+    /// Returns true while an incremental migration is in progress (always
+    /// false with BulkRehash).
+    [[nodiscard]]
+    bool isRehashing() const noexcept {
+        return old_buckets_ != nullptr;
+    }
+
+    /**
+     * @brief Makes room for at least n entries without further resizing.
+     *
+     * Allocates buckets once for n entries at the configured load factor and
+     * rebuilds the table if it is currently smaller. An in-progress
+     * incremental migration is completed as part of the rebuild.
+     *
+     * @param n The number of entries to make room for.
+     */
+    void reserve(const size_t n) {
+        const size_t needed = capacityFor(n);
+        const size_t additional = n > size_ ? n - size_ : 0;
+        if (needed <= capacity_ && size_ + tombstones_ + additional <= maxOccupancy(capacity_))
+            return;
+
+        if constexpr (INCREMENTAL) {
+            if (old_buckets_ != nullptr)
+                migrateBuckets(old_capacity_);
+        }
+        rehash(needed > capacity_ ? needed : capacity_);
+    }
+
     /// Clears the hash map, removing all key-value pairs.
     void clear() {
-        for (size_t i = 0; i < capacity_; ++i)
-            buckets_[i].destroy();
+        destroyAll();
         size_ = 0;
+        tombstones_ = 0;
+    }
+
+
+    /**
+     * @brief Computes the hash this map uses for key.
+     *
+     * The result can be passed to the precomputed-hash overloads of at(),
+     * contains(), remove(), find() and insertOrAssign() to hash a key only
+     * once across several operations. Passing any other value is undefined.
+     *
+     * @param key The key (or transparent lookup value) to be hashed.
+     * @return size_t The hash value.
+     */
+    template <typename K>
+    [[nodiscard]]
+    size_t hashOf(const K& key) const {
+        return hasher_(key);
     }
 
 
@@ -529,29 +825,63 @@ class HashMap {
      */
     template <typename K, typename V>
     void insert(K&& key, V&& value) {
-        ensureCapacity();
-        size_t idx = indexFor(key);
-        size_t first_tombstone = capacity_;
+        auto&& lookup_key = asLookupKey(std::forward<K>(key));
+        const size_t hash = hasher_(lookup_key);
+        assignUnique(hash, std::forward<decltype(lookup_key)>(lookup_key), std::forward<V>(value));
+    }
 
-        while (true) {
-            Bucket& bucket = buckets_[idx];
-            if (bucket.state == State::Empty) {
-                size_t target =
-                    first_tombstone != capacity_ ? first_tombstone : idx;
-                buckets_[target].construct(std::forward<K>(key),
-                                           std::forward<V>(value));
-                ++size_;
-                return;
-            }
-            if (bucket.state == State::Tombstone) {
-                if (first_tombstone == capacity_)
-                    first_tombstone = idx;
-            } else if (*bucket.key() == key) {
-                bucket.destroy();
-                bucket.construct(std::forward<K>(key), std::forward<V>(value));
-                return;
-            }
-            idx = (idx + 1) & (capacity_ - 1);
+
+    /**
+     * @brief Inserts or updates every key-value pair of a range.
+     *
+     * For forward ranges the table is reserved for all elements up front,
+     * so the range triggers at most one rebuild.
+     *
+     * @tparam InputIt An input iterator whose elements provide first and
+     * second (e.g. std::pair<Key, Value>).
+     * @param first The beginning of the range.
+     * @param last The end of the range.
+     */
+    template <std::input_iterator InputIt>
+    void insertRange(InputIt first, InputIt last) {
+        if constexpr (std::forward_iterator<InputIt>)
+            reserve(size_ + static_cast<size_t>(std::distance(first, last)));
+
+        for (; first != last; ++first) {
+            auto&& entry = *first;
+            insert(std::forward<decltype(entry)>(entry).first,
+                   std::forward<decltype(entry)>(entry).second);
+        }
+    }
+
+
+    /**
+     * @brief Inserts or updates count pairs given as parallel arrays.
+     *
+     * The bulk-load counterpart of findMany(): the table is reserved once,
+     * and keys are hashed in groups of FIND_MANY_BATCH (with the hash
+     * functor's hashBatch() when it provides one) whose home buckets are
+     * prefetched before any of them is inserted.
+     *
+     * @param keys The keys to insert.
+     * @param values The values, values[i] belonging to keys[i].
+     * @param count The number of pairs.
+     */
+    void insertMany(const Key* keys, const Value* values, const size_t count) {
+        if (count == 0)
+            return;
+        reserve(size_ + count);
+
+        size_t hashes[FIND_MANY_BATCH];
+        for (size_t base = 0; base < count; base += FIND_MANY_BATCH) {
+            const size_t batch = count - base < FIND_MANY_BATCH ? count - base : FIND_MANY_BATCH;
+
+            hashMany(keys + base, batch, hashes);
+            for (size_t i = 0; i < batch; ++i)
+                prefetch(&buckets_[hashes[i] & (capacity_ - 1)]);
+
+            for (size_t i = 0; i < batch; ++i)
+                assignUnique(hashes[i], keys[base + i], values[base + i]);
         }
     }
 
@@ -569,15 +899,24 @@ class HashMap {
      * @throws std::out_of_range If the key is not found in the hash map.
      */
     Value& at(const Key& key) {
-        size_t idx = indexFor(key);
-        while (true) {
-            Bucket& bucket = buckets_[idx];
-            if (bucket.state == State::Empty)
-                throw std::out_of_range("Key not found");
-            if (bucket.state == State::Occupied && *bucket.key() == key)
-                return *bucket.value();
-            idx = (idx + 1) & (capacity_ - 1);
-        }
+        return at(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of at() for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    Value& at(const K& key) {
+        return at(key, hasher_(key));
+    }
+
+    /// Overload of at() taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    Value& at(const K& key, const size_t hash) {
+        migrateStep();
+        if (Bucket* bucket = findBucket(key, hash))
+            return *bucket->value();
+        throw std::out_of_range("Key not found");
     }
 
 
@@ -595,15 +934,23 @@ class HashMap {
      * @throws std::out_of_range If the key is not found in the hash map.
      */
     const Value& at(const Key& key) const {
-        size_t idx = indexFor(key);
-        while (true) {
-            const Bucket& bucket = buckets_[idx];
-            if (bucket.state == State::Empty)
-                throw std::out_of_range("Key not found");
-            if (bucket.state == State::Occupied && *bucket.key() == key)
-                return *bucket.value();
-            idx = (idx + 1) & (capacity_ - 1);
-        }
+        return at(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of at() const for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    const Value& at(const K& key) const {
+        return at(key, hasher_(key));
+    }
+
+    /// Overload of at() const taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    const Value& at(const K& key, const size_t hash) const {
+        if (const Bucket* bucket = findBucket(key, hash))
+            return *bucket->value();
+        throw std::out_of_range("Key not found");
     }
 
 
@@ -620,29 +967,11 @@ class HashMap {
      */
     template <typename K>
     Value& operator[](K&& key) {
-        ensureCapacity();
-        size_t idx = indexFor(key);
-        size_t first_tombstone = capacity_;
-
-        while (true) {
-            Bucket& bucket = buckets_[idx];
-
-            if (bucket.state == State::Empty) {
-                size_t target = (first_tombstone != capacity_) ? first_tombstone : idx;
-                buckets_[target].construct(std::forward<K>(key), Value{});
-                ++size_;
-                return *buckets_[target].value();
-            }
-
-            if (bucket.state == State::Tombstone) {
-                if (first_tombstone == capacity_)
-                    first_tombstone = idx;
-            } else if (*bucket.key() == key) {
-                return *bucket.value();
-            }
-
-            idx = (idx + 1) & (capacity_ - 1);
-        }
+        auto&& lookup_key = asLookupKey(std::forward<K>(key));
+        const size_t hash = hasher_(lookup_key);
+        const size_t pos =
+            emplaceUnique(hash, std::forward<decltype(lookup_key)>(lookup_key)).first;
+        return *bucketAt(pos).value();
     }
 
 
@@ -659,19 +988,26 @@ class HashMap {
      * @return false If the key was not found in the hash map.
      */
     bool remove(const Key& key) {
-        size_t idx = indexFor(key);
-        while (true) {
-            Bucket& bucket = buckets_[idx];
-            if (bucket.state == State::Empty)
-                return false;
-            if (bucket.state == State::Occupied && *bucket.key() == key) {
-                bucket.destroy();
-                bucket.state = State::Tombstone;
-                --size_;
-                return true;
-            }
-            idx = (idx + 1) & (capacity_ - 1);
-        }
+        return remove(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of remove() for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    bool remove(const K& key) {
+        return remove(key, hasher_(key));
+    }
+
+    /// Overload of remove() taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    bool remove(const K& key, const size_t hash) {
+        migrateStep();
+        Bucket* bucket = findBucket(key, hash);
+        if (bucket == nullptr)
+            return false;
+        eraseBucket(*bucket);
+        return true;
     }
 
 
@@ -686,20 +1022,66 @@ class HashMap {
      * @return false If the key does not exist in the hash map.
      */
     bool contains(const Key& key) const {
-        size_t idx = indexFor(key);
-        while (true) {
-            const Bucket& bucket = buckets_[idx];
-            if (bucket.state == State::Empty)
-                return false;
-            if (bucket.state == State::Occupied && *bucket.key() == key)
-                return true;
-            idx = (idx + 1) & (capacity_ - 1);
+        return contains(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of contains() for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    bool contains(const K& key) const {
+        return contains(key, hasher_(key));
+    }
+
+    /// Overload of contains() taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    bool contains(const K& key, const size_t hash) const {
+        return findBucket(key, hash) != nullptr;
+    }
+
+
+    /**
+     * @brief Looks up a batch of keys, overlapping their memory accesses.
+     *
+     * Keys are processed in groups of FIND_MANY_BATCH: every hash of a group
+     * is computed and its home bucket prefetched before any of them is
+     * probed, so the cache misses of independent lookups overlap instead of
+     * being paid one after another. While an incremental migration runs,
+     * only the current bucket array is prefetched.
+     *
+     * @tparam K Key or a transparent lookup type.
+     * @param keys The keys to look up.
+     * @param count The number of keys.
+     * @param out Receives, for every key, a pointer to its value or nullptr
+     * if the key is absent. Pointers stay valid until the map is modified.
+     * @return size_t The number of keys found.
+     */
+    template <typename K>
+        requires is_lookup_key_v<K>
+    size_t findMany(const K* keys, const size_t count, const Value** out) const {
+        size_t found = 0;
+        size_t hashes[FIND_MANY_BATCH];
+
+        for (size_t base = 0; base < count; base += FIND_MANY_BATCH) {
+            const size_t batch = count - base < FIND_MANY_BATCH ? count - base : FIND_MANY_BATCH;
+
+            hashMany(keys + base, batch, hashes);
+            if (capacity_ != 0)
+                for (size_t i = 0; i < batch; ++i)
+                    prefetch(&buckets_[hashes[i] & (capacity_ - 1)]);
+
+            for (size_t i = 0; i < batch; ++i) {
+                const Bucket* bucket = findBucket(keys[base + i], hashes[i]);
+                out[base + i] = bucket != nullptr ? bucket->value() : nullptr;
+                found += bucket != nullptr;
+            }
         }
+        return found;
     }
 
     /// Destructor cleans up allocated resources.
     ~HashMap() {
-        clear();
+        destroyAll();
         delete[] buckets_;
     }
 
@@ -724,7 +1106,7 @@ class HashMap {
          * will point to the end iterator.
          */
         void advanceToNextOccupied() {
-            while (idx_ < map_->capacity_ && map_->buckets_[idx_].state != State::Occupied) {
+            while (idx_ < map_->endIndex() && map_->bucketAt(idx_).state != State::Occupied) {
                 ++idx_;
             }
         }
@@ -752,7 +1134,8 @@ class HashMap {
          * @return std::pair<const Key&, Value&> A reference to the key-value pair.
          */
         std::pair<const Key&, Value&> operator*() const {
-            return { *map_->buckets_[idx_].key(), *map_->buckets_[idx_].value() };
+            Bucket& bucket = map_->bucketAt(idx_);
+            return { *bucket.key(), *bucket.value() };
         }
 
 
@@ -823,7 +1206,7 @@ class HashMap {
          * will point to the end iterator.
          */
         void advanceToNextOccupied() {
-            while (idx_ < map_->capacity_ && map_->buckets_[idx_].state != State::Occupied) {
+            while (idx_ < map_->endIndex() && map_->bucketAt(idx_).state != State::Occupied) {
                 ++idx_;
             }
         }
@@ -854,7 +1237,8 @@ class HashMap {
          * key-value pair.
          */
         std::pair<const Key&, const Value&> operator*() const {
-            return { *map_->buckets_[idx_].key(), *map_->buckets_[idx_].value() };
+            const Bucket& bucket = map_->bucketAt(idx_);
+            return { *bucket.key(), *bucket.value() };
         }
 
 
@@ -907,13 +1291,114 @@ class HashMap {
 
 
     iterator begin() { return iterator(this, 0); }
-    iterator end() { return iterator(this, capacity_); }
+    iterator end() { return iterator(this, endIndex()); }
 
     const_iterator begin() const { return const_iterator(this, 0); }
-    const_iterator end() const { return const_iterator(this, capacity_); }
+    const_iterator end() const { return const_iterator(this, endIndex()); }
 
     const_iterator cbegin() const { return const_iterator(this, 0); }
-    const_iterator cend() const { return const_iterator(this, capacity_); }
+    const_iterator cend() const { return const_iterator(this, endIndex()); }
+
+
+    /**
+     * @brief Finds the pair with the given key.
+     *
+     * @param key The key to search for.
+     * @return iterator An iterator to the pair, or end() if the key is absent.
+     */
+    iterator find(const Key& key) {
+        return find(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of find() for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    iterator find(const K& key) {
+        return find(key, hasher_(key));
+    }
+
+    /// Overload of find() taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    iterator find(const K& key, const size_t hash) {
+        migrateStep();
+        return iterator(this, findPosition(key, hash));
+    }
+
+    /// Const overload of find().
+    const_iterator find(const Key& key) const {
+        return find(key, hasher_(key));
+    }
+
+    /// Heterogeneous overload of find() const for transparent hash functors.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    const_iterator find(const K& key) const {
+        return find(key, hasher_(key));
+    }
+
+    /// Overload of find() const taking the key's precomputed hashOf() value.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    const_iterator find(const K& key, const size_t hash) const {
+        return const_iterator(this, findPosition(key, hash));
+    }
+
+
+    /**
+     * @brief Inserts a pair whose value is constructed in place from args,
+     * unless the key is already present.
+     *
+     * When the key exists, nothing is constructed and neither key nor args
+     * are moved from. A transparent lookup key is only converted to Key when
+     * the pair is actually inserted.
+     *
+     * @tparam K The type of the key (perfect-forwarded).
+     * @tparam Args The types of the value constructor arguments.
+     * @param key The key to look up or insert.
+     * @param args The arguments the value is constructed from.
+     * @return std::pair<iterator, bool> An iterator to the pair with the key,
+     * and true if it was inserted.
+     */
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> tryEmplace(K&& key, Args&&... args) {
+        auto&& lookup_key = asLookupKey(std::forward<K>(key));
+        const size_t hash = hasher_(lookup_key);
+        const auto [pos, inserted] = emplaceUnique(
+            hash, std::forward<decltype(lookup_key)>(lookup_key), std::forward<Args>(args)...);
+        return {iterator(this, pos), inserted};
+    }
+
+
+    /**
+     * @brief Inserts a pair or replaces the value of an existing key.
+     *
+     * Equivalent to insert(), but reports where the pair is and whether it
+     * was newly inserted.
+     *
+     * @tparam K The type of the key (perfect-forwarded).
+     * @tparam V The type of the value (perfect-forwarded).
+     * @param key The key to be inserted or updated.
+     * @param value The value to be associated with the key.
+     * @return std::pair<iterator, bool> An iterator to the pair, and true if
+     * the key was not present before.
+     */
+    template <typename K, typename V>
+    std::pair<iterator, bool> insertOrAssign(K&& key, V&& value) {
+        auto&& lookup_key = asLookupKey(std::forward<K>(key));
+        const size_t hash = hasher_(lookup_key);
+        return insertOrAssign(std::forward<decltype(lookup_key)>(lookup_key),
+                              std::forward<V>(value), hash);
+    }
+
+    /// Overload of insertOrAssign() taking the key's precomputed hashOf() value.
+    template <typename K, typename V>
+        requires is_lookup_key_v<K>
+    std::pair<iterator, bool> insertOrAssign(K&& key, V&& value, const size_t hash) {
+        const auto [pos, inserted] =
+            assignUnique(hash, std::forward<K>(key), std::forward<V>(value));
+        return {iterator(this, pos), inserted};
+    }
 
 };
 
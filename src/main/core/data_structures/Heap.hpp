@@ -5,7 +5,6 @@
 #include <limits>
 #include <stdexcept>
 #include <utility>
-#include <bit>
 
 #include "BinaryTree.hpp"
 
@@ -24,58 +23,21 @@ using std::size_t;
  * derived classes via `heapifyUp` / `heapifyDown`.
  *
  * @tparam Type Element type. Must be MoveConstructible or CopyConstructible.
+ * @tparam NodePolicy Where nodes are allocated, see BinaryTree.
  */
-template <typename Type>
-class Heap : protected BinaryTree<Type> {
+template <typename Type, typename NodePolicy = HeapNodes>
+class Heap : protected BinaryTree<Type, NodePolicy> {
 
   protected:
     virtual void heapifyUp(Node<Type>* node) = 0;
     virtual void heapifyDown(Node<Type>* node) = 0;
 
 
-    /**
-     * @brief Find a node by its 1-based array index in the complete tree.
-     *
-     * Interprets `index` in binary, skips the most-significant bit (the root),
-     * then walks remaining bits high→low: bit 0 = go left, bit 1 = go right.
-     *
-     * @param idx 1-based index (1 = root).
-     * @return Pointer to the node at that index, or nullptr if the path is
-     * invalid.
-     *
-     * @complexity Time: O(log n); Space: O(1).
-     */
-    Node<Type>* findNodeByPath(const size_t idx) const noexcept {
-        if (this->isEmpty())
-            return nullptr;
-
-        if (idx == 0)
-            return nullptr;
-
-        if (idx == 1)
-            return this->root_;
-
-        size_t msb = std::bit_floor(idx);
-        Node<Type>* current = this->root_;
-        msb >>= 1;
-
-        while (msb && current) {
-            if (idx & msb)
-                current = current->right;
-            else
-                current = current->left;
-            msb >>= 1;
-        }
-
-        return current;
-    }
-
-
     /**
      * @brief Locate the node representing the last element in level-order.
      *
      * Computes the 1-based index equal to `size()` and delegates to
-     * `findNodeByPath` to follow the corresponding left/right edges. Used by
+     * `BinaryTree::findNodeByPath` to follow the corresponding left/right edges. Used by
      * `extractRoot()` when splicing out the final node.
      *
      * @return Pointer to the last node, or nullptr if the heap is empty.
@@ -83,7 +45,7 @@ class Heap : protected BinaryTree<Type> {
      * @complexity Time: O(log n); Space: O(1).
      */
     Node<Type>* findLastNode() const noexcept {
-        return findNodeByPath(this->size());
+        return this->findNodeByPath(this->size());
     }
 
 
@@ -106,29 +68,29 @@ class Heap : protected BinaryTree<Type> {
 
 
   public:
-    using BinaryTree<Type>::isEmpty;
-    using BinaryTree<Type>::size;
-    using BinaryTree<Type>::clear;
-    using BinaryTree<Type>::getHeight;
+    using BinaryTree<Type, NodePolicy>::isEmpty;
+    using BinaryTree<Type, NodePolicy>::size;
+    using BinaryTree<Type, NodePolicy>::clear;
+    using BinaryTree<Type, NodePolicy>::getHeight;
 
     /// Default constructor
-    Heap() noexcept : BinaryTree<Type>() {}
+    Heap() noexcept : BinaryTree<Type, NodePolicy>() {}
 
     /// Copy constructor
-    Heap(const Heap& other) : BinaryTree<Type>(other) {}
+    Heap(const Heap& other) : BinaryTree<Type, NodePolicy>(other) {}
 
     /// Move constructor
-    Heap(Heap&& other) noexcept : BinaryTree<Type>(std::move(other)) {}
+    Heap(Heap&& other) noexcept : BinaryTree<Type, NodePolicy>(std::move(other)) {}
 
     /// Copy assignment operator
     Heap& operator=(const Heap& other) {
-        BinaryTree<Type>::operator=(other);
+        BinaryTree<Type, NodePolicy>::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
     Heap& operator=(Heap&& other) noexcept {
-        BinaryTree<Type>::operator=(std::move(other));
+        BinaryTree<Type, NodePolicy>::operator=(std::move(other));
         return *this;
     }
 
@@ -155,7 +117,7 @@ class Heap : protected BinaryTree<Type> {
 
         Node<Type>* last = findLastNode();
         if (last == this->root_) {
-            delete this->root_;
+            this->nodes_.destroy(this->root_);
             this->root_ = nullptr;
             this->size_ = 0;
             return out;
@@ -168,7 +130,7 @@ class Heap : protected BinaryTree<Type> {
         else
             last->parent->right = nullptr;
 
-        delete last;
+        this->nodes_.destroy(last);
         --this->size_;
         heapifyDown(this->root_);
         return out;
@@ -0,0 +1,416 @@
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DaryHeap.hpp"
+#include "DynamicArray.hpp"
+
+
+namespace containers {
+
+
+/**
+ * @class IndexedHeap
+ * @brief Addressable d-ary min-heap: insert() returns a handle through which
+ * the element can later be re-prioritised or removed.
+ *
+ * This is the priority queue of Dijkstra- and A*-style searches. Instead of
+ * pushing a duplicate whenever a tentative distance improves, the existing
+ * entry is moved with decreaseKey(), so the heap never holds more than one
+ * entry per element.
+ *
+ * Elements are stored as (value, handle) pairs in an implicit d-ary heap
+ * and sifted by the kernels of DaryHeap. A dense position table, indexed by
+ * handle, records where each element currently sits; the kernels report
+ * every hole move, which is what keeps that table up to date.
+ *
+ * Handles are small integers. A handle stays valid, and keeps referring to
+ * the same element, until that element is extracted or erased; after that
+ * it may be reused by a later insert(). The least element according to
+ * Compare is on top (unlike DaryHeap, whose top is the greatest), so
+ * decreaseKey() has its textbook meaning; pass std::greater for a max-heap.
+ *
+ * @tparam Type The priority type. Must be move constructible and assignable.
+ * @tparam Arity Number of children per node, at least 2. Defaults to 4.
+ * @tparam Compare Strict weak ordering. Defaults to std::less<Type>.
+ * @tparam Allocator Allocator for Type, rebound for the internal tables.
+ */
+template <typename Type, size_t Arity = 4, typename Compare = std::less<Type>,
+          typename Allocator = std::allocator<Type>>
+class IndexedHeap {
+    static_assert(Arity >= 2, "A heap node needs at least two children.");
+
+  public:
+    /// Identifies an element for as long as it is in the heap.
+    using Handle = size_t;
+
+    /// Never returned by insert(); marks handles without an element.
+    static constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+
+
+  private:
+    struct Entry {
+        Type value;
+        Handle handle;
+    };
+
+    using AllocTraits = std::allocator_traits<Allocator>;
+    using EntryAllocator = typename AllocTraits::template rebind_alloc<Entry>;
+    using IndexAllocator = typename AllocTraits::template rebind_alloc<size_t>;
+
+    /// Slot stored in the position table for a handle without an element.
+    static constexpr size_t NO_SLOT = std::numeric_limits<size_t>::max();
+
+    DynamicArray<Entry, EntryAllocator> entries_;   // the heap, in level order
+    DynamicArray<size_t, IndexAllocator> position_; // slot of every handle
+    DynamicArray<Handle, IndexAllocator> free_handles_;
+    [[no_unique_address]] Compare compare_;
+
+
+    /// Kernel ordering: the kernels keep the greatest entry on top, so an
+    /// entry is "less" when it comes after the other one in Compare.
+    struct Later {
+        const Compare& compare;
+
+        bool operator()(const Entry& a, const Entry& b) const {
+            return compare(b.value, a.value);
+        }
+    };
+
+
+    /// Records the moves of a sift towards the top: (SORT_EVENT_SWAP, from,
+    /// to) moves the entry at from into the hole at to.
+    struct TrackUp {
+        const Entry* entries;
+        size_t* position;
+
+        void operator()(const size_t code, const size_t from, const size_t to) const noexcept {
+            if (code == heap_detail::SORT_EVENT_SWAP)
+                position[entries[from].handle] = to;
+        }
+    };
+
+    /// Records the moves of a sift away from the top: (SORT_EVENT_SWAP, to,
+    /// from).
+    struct TrackDown {
+        const Entry* entries;
+        size_t* position;
+
+        void operator()(const size_t code, const size_t to, const size_t from) const noexcept {
+            if (code == heap_detail::SORT_EVENT_SWAP)
+                position[entries[from].handle] = to;
+        }
+    };
+
+
+    /// Reuses a released handle, or grows the position table by one.
+    Handle acquireHandle() {
+        if (!free_handles_.isEmpty()) {
+            const Handle handle = free_handles_.getLast();
+            free_handles_.popBack();
+            return handle;
+        }
+        position_.addLast(NO_SLOT);
+        return position_.size() - 1;
+    }
+
+
+    /// Places entry at slot and restores the heap in whichever direction it
+    /// is out of place.
+    void settle(const size_t slot, Entry entry) {
+        Entry* entries = entries_.begin();
+        size_t* position = position_.begin();
+        Later later{compare_};
+
+        const Handle handle = entry.handle;
+        TrackUp up{entries, position};
+        size_t final_slot = heap_detail::siftUp<Arity>(entries, slot, std::move(entry), later, up);
+        if (final_slot == slot) {
+            TrackDown down{entries, position};
+            final_slot = heap_detail::siftDown<Arity>(entries, entries_.size(), slot,
+                                                      std::move(entries[slot]), later, down);
+        }
+        position[handle] = final_slot;
+    }
+
+
+    /// Removes the entry at slot, fills the gap with the last entry and
+    /// releases the handle. Returns the removed value.
+    Type removeSlot(const size_t slot) {
+        Entry* entries = entries_.begin();
+        const Handle handle = entries[slot].handle;
+        Type out = std::move(entries[slot].value);
+
+        Entry last = std::move(entries[entries_.size() - 1]);
+        entries_.popBack();
+        position_.begin()[handle] = NO_SLOT;
+        free_handles_.addLast(handle);
+
+        if (slot < entries_.size())
+            settle(slot, std::move(last));
+        return out;
+    }
+
+
+    /// Returns the slot of handle.
+    /// @throws std::out_of_range If handle has no element in the heap.
+    size_t slotOf(const Handle handle) const {
+        if (!contains(handle))
+            throw std::out_of_range("IndexedHeap: invalid handle");
+        return position_.begin()[handle];
+    }
+
+
+    /// Moves the element of handle to its new value.
+    template <typename U>
+    void assignValue(const size_t slot, U&& value) {
+        Entry entry{Type(std::forward<U>(value)), entries_.begin()[slot].handle};
+        settle(slot, std::move(entry));
+    }
+
+
+  public:
+    /// Default constructor creates an empty heap.
+    IndexedHeap() = default;
+
+    /// Creates an empty heap with the given ordering and allocator.
+    explicit IndexedHeap(const Compare& compare, const Allocator& allocator = Allocator())
+        : entries_(EntryAllocator(allocator)), position_(IndexAllocator(allocator)),
+          free_handles_(IndexAllocator(allocator)), compare_(compare) {}
+
+
+    /// Returns the number of elements in the heap.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return entries_.size();
+    }
+
+    /// Checks if the heap is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return entries_.isEmpty();
+    }
+
+    /// Removes every element and invalidates every handle.
+    void clear() noexcept {
+        entries_.removeAll();
+        position_.removeAll();
+        free_handles_.removeAll();
+    }
+
+    /// Ensures room for capacity elements without reallocation.
+    void reserve(const size_t capacity) {
+        entries_.reserve(capacity);
+        position_.reserve(capacity);
+    }
+
+
+    /// Checks if handle currently refers to an element of the heap.
+    [[nodiscard]]
+    bool contains(const Handle handle) const noexcept {
+        return handle < position_.size() && position_.begin()[handle] != NO_SLOT;
+    }
+
+    /**
+     * @brief Returns the value of the element referred to by handle.
+     * @throws std::out_of_range If handle has no element in the heap.
+     */
+    [[nodiscard]]
+    const Type& get(const Handle handle) const {
+        return entries_.begin()[slotOf(handle)].value;
+    }
+
+
+    /**
+     * @brief Inserts an element.
+     *
+     * @tparam U The type of the element, constructible into Type.
+     * @return The handle of the new element.
+     *
+     * @complexity Time: O(log_d n), amortized O(1) growth.
+     */
+    template <typename U>
+    Handle insert(U&& value) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+
+        const Handle handle = acquireHandle();
+        const size_t slot = entries_.size();
+        entries_.emplaceLast(Entry{Type(std::forward<U>(value)), handle});
+        settle(slot, std::move(entries_.begin()[slot]));
+        return handle;
+    }
+
+
+    /**
+     * @brief Access the top (least) element without removing it.
+     * @throws std::out_of_range if the heap is empty.
+     */
+    [[nodiscard]]
+    const Type& peekRoot() const {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+        return entries_.begin()[0].value;
+    }
+
+    /**
+     * @brief Handle of the top element.
+     * @throws std::out_of_range if the heap is empty.
+     */
+    [[nodiscard]]
+    Handle peekRootHandle() const {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+        return entries_.begin()[0].handle;
+    }
+
+
+    /**
+     * @brief Removes and returns the top element; its handle becomes invalid.
+     * @throws std::out_of_range if the heap is empty.
+     * @complexity Time: O(d log_d n).
+     */
+    Type extractRoot() {
+        if (isEmpty())
+            throw std::out_of_range("Heap is empty");
+        return removeSlot(0);
+    }
+
+
+    /**
+     * @brief Removes the element referred to by handle and returns it.
+     * @throws std::out_of_range If handle has no element in the heap.
+     * @complexity Time: O(d log_d n).
+     */
+    Type erase(const Handle handle) {
+        return removeSlot(slotOf(handle));
+    }
+
+
+    /**
+     * @brief Lowers the value of an element, moving it towards the top.
+     *
+     * @param handle The element to update.
+     * @param value The new value; must not be greater than the current one.
+     *
+     * @throws std::out_of_range If handle has no element in the heap.
+     * @throws std::invalid_argument If value is greater than the current
+     * value.
+     * @complexity Time: O(log_d n).
+     */
+    template <typename U>
+    void decreaseKey(const Handle handle, U&& value) {
+        const size_t slot = slotOf(handle);
+        if (compare_(entries_.begin()[slot].value, value))
+            throw std::invalid_argument("decreaseKey: new value is greater");
+        assignValue(slot, std::forward<U>(value));
+    }
+
+
+    /**
+     * @brief Raises the value of an element, moving it away from the top.
+     *
+     * @throws std::out_of_range If handle has no element in the heap.
+     * @throws std::invalid_argument If value is less than the current value.
+     * @complexity Time: O(d log_d n).
+     */
+    template <typename U>
+    void increaseKey(const Handle handle, U&& value) {
+        const size_t slot = slotOf(handle);
+        if (compare_(value, entries_.begin()[slot].value))
+            throw std::invalid_argument("increaseKey: new value is less");
+        assignValue(slot, std::forward<U>(value));
+    }
+
+
+    /**
+     * @brief Sets the value of an element, in either direction.
+     * @throws std::out_of_range If handle has no element in the heap.
+     */
+    template <typename U>
+    void update(const Handle handle, U&& value) {
+        assignValue(slotOf(handle), std::forward<U>(value));
+    }
+
+
+    /**
+     * @brief Moves every element of other into this heap.
+     *
+     * Small heaps are inserted one by one; when other is large compared to
+     * this heap, the entries are appended and the whole heap is rebuilt
+     * bottom-up in O(n + m). other is left empty.
+     *
+     * @param other The heap to absorb.
+     * @return For every handle h of other, the element's new handle at index
+     * h, or INVALID_HANDLE where h had no element.
+     */
+    DynamicArray<Handle> merge(IndexedHeap&& other) {
+        DynamicArray<Handle> remap(other.position_.size());
+        for (size_t h = 0; h < other.position_.size(); ++h)
+            remap.addLast(INVALID_HANDLE);
+
+        const size_t n = size(), m = other.size();
+        const size_t height = static_cast<size_t>(std::bit_width(n + m));
+        Entry* theirs = other.entries_.begin();
+
+        if (m * height <= n + m) {
+            for (size_t i = 0; i < m; ++i)
+                remap.begin()[theirs[i].handle] = insert(std::move(theirs[i].value));
+        } else {
+            entries_.reserve(n + m);
+            for (size_t i = 0; i < m; ++i) {
+                const Handle handle = acquireHandle();
+                remap.begin()[theirs[i].handle] = handle;
+                entries_.emplaceLast(Entry{std::move(theirs[i].value), handle});
+            }
+
+            Later later{compare_};
+            heap_detail::Silent silent;
+            heap_detail::makeHeap<Arity>(entries_.begin(), entries_.size(), later, silent);
+
+            const Entry* entries = entries_.begin();
+            for (size_t slot = 0; slot < entries_.size(); ++slot)
+                position_.begin()[entries[slot].handle] = slot;
+        }
+
+        other.clear();
+        return remap;
+    }
+
+
+    /// Checks the heap property and the consistency of the position table.
+    [[nodiscard]]
+    bool isValidHeap() const {
+        const Entry* entries = entries_.begin();
+        for (size_t slot = 0; slot < entries_.size(); ++slot) {
+            if (slot > 0 && compare_(entries[slot].value, entries[(slot - 1) / Arity].value))
+                return false;
+            if (position_[entries[slot].handle] != slot)
+                return false;
+        }
+        return true;
+    }
+};
+
+
+/// 4-ary addressable min-heap (the least element on top).
+template <typename Type, size_t Arity = 4, typename Allocator = std::allocator<Type>>
+using MinIndexedHeap = IndexedHeap<Type, Arity, std::less<Type>, Allocator>;
+
+/// 4-ary addressable max-heap (the greatest element on top).
+template <typename Type, size_t Arity = 4, typename Allocator = std::allocator<Type>>
+using MaxIndexedHeap = IndexedHeap<Type, Arity, std::greater<Type>, Allocator>;
+
+
+} // namespace containers
+
+
+#endif // INDEXED_HEAP_HPP
@@ -3,11 +3,14 @@
 
 
 #include <cassert>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 
+#include "NodePool.hpp"
 
 namespace containers {
 
@@ -19,9 +22,18 @@ using std::size_t;
  * @brief Doubly linked list offering constant-time insert/erase at the ends
  *        and bidirectional traversal.
  *
+ * Iterators are stable handles: insert(pos, x) and erase(pos) are O(1) and
+ * leave every other iterator valid, and splice()/merge() move whole chains
+ * of nodes between lists by relinking them, without copying elements.
+ * Indexed access (get, insert(x, idx), removeAt) walks from the nearer end;
+ * for traversal use the iterators. See UnrolledLinkedList for a variant
+ * that stores several elements per node.
+ *
  * @tparam Type Element type held by the list.
+ * @tparam NodePolicy Where nodes are allocated: HeapNodes (default),
+ * PooledNodes<N> or ThreadPooledNodes<N>, see NodePool.hpp.
  */
-template <typename Type>
+template <typename Type, typename NodePolicy = HeapNodes>
 class LinkedList {
 
     struct Node {
@@ -37,9 +49,12 @@ class LinkedList {
         }
     };
 
+    using Store = node_pool_detail::NodeStore<Node, NodePolicy>;
+
     Node* head_;
     Node* tail_;
     size_t size_;
+    [[no_unique_address]] Store nodes_;
 
 
     /**
@@ -94,7 +109,53 @@ class LinkedList {
     }
 
 
+    /**
+     * @brief Unlink the chain first..last (inclusive) from this list.
+     *
+     * The chain keeps its inner links; size_ is left to the caller.
+     */
+    void unlinkChain(Node* first, Node* last) noexcept {
+        if (first->prev != nullptr)
+            first->prev->next = last->next;
+        else
+            head_ = last->next;
+
+        if (last->next != nullptr)
+            last->next->prev = first->prev;
+        else
+            tail_ = first->prev;
+
+        first->prev = nullptr;
+        last->next = nullptr;
+    }
+
+
+    /**
+     * @brief Link the chain first..last in front of pos (nullptr: at the back).
+     *
+     * size_ is left to the caller.
+     */
+    void linkChainBefore(Node* pos, Node* first, Node* last) noexcept {
+        Node* prev = pos != nullptr ? pos->prev : tail_;
+        first->prev = prev;
+        last->next = pos;
+
+        if (prev != nullptr)
+            prev->next = first;
+        else
+            head_ = first;
+
+        if (pos != nullptr)
+            pos->prev = last;
+        else
+            tail_ = last;
+    }
+
+
   public:
+    class iterator;
+    class const_iterator;
+
     /// Default constructor
     LinkedList() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
 
@@ -138,7 +199,7 @@ class LinkedList {
         }
     }
 
-    /// Copy constructor
+    /// Copy constructor; the copy allocates from a node store of its own.
     LinkedList(const LinkedList& other)
         : head_(nullptr), tail_(nullptr), size_(0) {
         Node* current = other.head_;
@@ -156,7 +217,8 @@ class LinkedList {
 
     /// Move constructor
     LinkedList(LinkedList&& other) noexcept
-        : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+        : head_(other.head_), tail_(other.tail_), size_(other.size_),
+          nodes_(std::move(other.nodes_)) {
         other.head_ = nullptr;
         other.tail_ = nullptr;
         other.size_ = 0;
@@ -167,36 +229,9 @@ class LinkedList {
         if (this == &other)
             return *this;
 
-        Node* new_head = nullptr;
-        Node* new_tail = nullptr;
-        size_t new_size = 0;
-
-        try {
-            for (const Node* cur = other.head_; cur != nullptr;
-                 cur = cur->next) {
-                Node* n = new Node(cur->data);
-                if (!new_head)
-                    new_head = new_tail = n;
-                else {
-                    new_tail->next = n;
-                    n->prev = new_tail;
-                    new_tail = n;
-                }
-                ++new_size;
-            }
-        } catch (...) {
-            for (Node* p = new_head; p != nullptr;) {
-                Node* next = p->next;
-                delete p;
-                p = next;
-            }
-            throw;
-        }
-
-        clear();
-        head_ = new_head;
-        tail_ = new_tail;
-        size_ = new_size;
+        // Copy aside first: clear() may release the slabs of a pooled store.
+        LinkedList copy(other);
+        *this = std::move(copy);
         return *this;
     }
 
@@ -211,6 +246,7 @@ class LinkedList {
         head_ = other.head_;
         tail_ = other.tail_;
         size_ = other.size_;
+        nodes_ = std::move(other.nodes_);
 
         other.head_ = nullptr;
         other.tail_ = nullptr;
@@ -247,7 +283,7 @@ class LinkedList {
     void addFirst(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
-        Node* new_node = new Node(std::forward<U>(element));
+        Node* new_node = nodes_.create(std::forward<U>(element));
 
         if (isEmpty()) {
             head_ = new_node;
@@ -274,7 +310,7 @@ class LinkedList {
     void addLast(U&& element) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
-        Node* new_node = new Node(std::forward<U>(element));
+        Node* new_node = nodes_.create(std::forward<U>(element));
 
         if (head_ == nullptr) {
             head_ = new_node;
@@ -301,6 +337,7 @@ class LinkedList {
      * @throws std::out_of_range If idx > size().
      */
     template <typename U>
+        requires(!std::is_same_v<std::remove_cvref_t<U>, iterator>)
     void insert(U&& element, const size_t idx) {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
@@ -318,7 +355,7 @@ class LinkedList {
             } else {
                 Node* current = getNodeAt(idx);
 
-                new_node = new Node(std::forward<U>(element));
+                new_node = nodes_.create(std::forward<U>(element));
                 new_node->next = current;
                 new_node->prev = current->prev;
 
@@ -327,7 +364,8 @@ class LinkedList {
                 ++size_;
             }
         } catch (...) {
-            delete new_node;
+            if (new_node != nullptr)
+                nodes_.destroy(new_node);
             throw;
         }
     }
@@ -342,7 +380,7 @@ class LinkedList {
         if (head_ == nullptr)
             return;
 
-        const Node* temp = head_;
+        Node* temp = head_;
         head_ = head_->next;
 
         if (head_ != nullptr)
@@ -350,7 +388,7 @@ class LinkedList {
         else
             tail_ = nullptr;
 
-        delete temp;
+        nodes_.destroy(temp);
         --size_;
     }
 
@@ -364,7 +402,7 @@ class LinkedList {
         if (tail_ == nullptr)
             return;
 
-        const Node* temp = tail_;
+        Node* temp = tail_;
         tail_ = tail_->prev;
 
         if (tail_ != nullptr)
@@ -372,7 +410,7 @@ class LinkedList {
         else
             head_ = nullptr;
 
-        delete temp;
+        nodes_.destroy(temp);
         --size_;
     }
 
@@ -396,7 +434,7 @@ class LinkedList {
             Node* cur = getNodeAt(idx);
             cur->prev->next = cur->next;
             cur->next->prev = cur->prev;
-            delete cur;
+            nodes_.destroy(cur);
             --size_;
         }
     }
@@ -408,35 +446,13 @@ class LinkedList {
      * @param element Value to remove (compared via `operator==`).
      */
     void remove(const Type& element) {
-        Node* current = head_;
-
-        while (current != nullptr) {
+        for (Node* current = head_; current != nullptr; current = current->next) {
             if (current->data == element) {
-                const Node* to_delete = current;
-
-                if (current == head_) {
-                    head_ = current->next;
-                    if (head_)
-                        head_->prev = nullptr;
-                    else
-                        tail_ = nullptr; // list is now empty
-                } else if (current == tail_) {
-                    tail_ = current->prev;
-                    if (tail_)
-                        tail_->next = nullptr;
-                    else
-                        head_ = nullptr; // list is now empty
-                } else {
-                    current->prev->next = current->next;
-                    current->next->prev = current->prev;
-                }
-
-                delete to_delete;
+                unlinkChain(current, current);
+                nodes_.destroy(current);
                 --size_;
                 return;
             }
-
-            current = current->next;
         }
     }
 
@@ -448,33 +464,14 @@ class LinkedList {
      * @return Number of removed elements.
      */
     size_t removeAll(const Type& element) {
-        if (isEmpty())
-            return 0;
-
-        Node* current = head_;
         size_t removed_count = 0;
+        Node* current = head_;
 
         while (current != nullptr) {
             Node* next_node = current->next;
             if (current->data == element) {
-                if (current == head_) {
-                    head_ = current->next;
-                    if (head_)
-                        head_->prev = nullptr;
-                    else
-                        tail_ = nullptr;
-                } else if (current == tail_) {
-                    tail_ = current->prev;
-                    if (tail_)
-                        tail_->next = nullptr;
-                    else
-                        head_ = nullptr;
-                } else {
-                    current->prev->next = current->next;
-                    current->next->prev = current->prev;
-                }
-
-                delete current;
+                unlinkChain(current, current);
+                nodes_.destroy(current);
                 --size_;
                 ++removed_count;
             }
@@ -593,14 +590,20 @@ class LinkedList {
 
     /**
      * @brief Remove all elements and reset the list to empty.
+     *
+     * With PooledNodes the slabs are released as a whole, and nodes of
+     * trivially destructible types are not visited at all.
      */
     void clear() noexcept {
-        Node* current = head_;
-        while (current) {
-            Node* next = current->next;
-            delete current;
-            current = next;
+        if constexpr (!Store::RELEASES_IN_BULK || !std::is_trivially_destructible_v<Node>) {
+            Node* current = head_;
+            while (current) {
+                Node* next = current->next;
+                nodes_.destroy(current);
+                current = next;
+            }
         }
+        nodes_.releaseAll();
         head_ = tail_ = nullptr;
         size_ = 0;
     }
@@ -631,10 +634,10 @@ class LinkedList {
 
 
         /// Dereference operator to access the data of the current node
-        Type& operator*() { return current_->data; }
+        Type& operator*() const { return current_->data; }
 
         /// Arrow operator to access the address of the data in the current node
-        Type* operator->() { return &current_->data; }
+        Type* operator->() const { return &current_->data; }
 
         /// Pre-increment operator to move the iterator to the next node
         iterator& operator++() {
@@ -797,30 +800,136 @@ class LinkedList {
         if (!cur) return end();
 
         Node* next = cur->next;
-
-        if (cur == head_) {
-            head_ = cur->next;
-            if (head_)
-                head_->prev = nullptr;
-            else
-                tail_ = nullptr;
-        } else if (cur == tail_) {
-            tail_ = cur->prev;
-            if (tail_)
-                tail_->next = nullptr;
-            else
-                head_ = nullptr;
-        } else {
-            cur->prev->next = cur->next;
-            cur->next->prev = cur->prev;
-        }
-
-        delete cur;
+        unlinkChain(cur, cur);
+        nodes_.destroy(cur);
         --size_;
         return iterator(this, next);
     }
 
 
+    /**
+     * @brief Insert an element in front of `pos` in O(1).
+     *
+     * No iterator is invalidated.
+     *
+     * @tparam U A type that can construct `Type` (enforced at compile time).
+     * @param pos Position to insert before; end() appends.
+     * @param element Value to insert (perfect-forwarded).
+     * @return Iterator to the inserted element.
+     */
+    template <typename U>
+    iterator insert(iterator pos, U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        Node* new_node = nodes_.create(std::forward<U>(element));
+        linkChainBefore(pos.current_, new_node, new_node);
+        ++size_;
+        return iterator(this, new_node);
+    }
+
+
+    /**
+     * @brief Move every element of `other` in front of `pos` in O(1).
+     *
+     * The nodes are relinked, not copied, so iterators into `other` stay
+     * valid and keep pointing at their elements, now in this list. They are
+     * still tied to `other` for end(), though: one that is incremented past
+     * the last element must not be decremented again; use this list's end().
+     * Not available with PooledNodes, whose nodes belong to their list's
+     * slabs.
+     *
+     * @param pos Position in this list to insert before; end() appends.
+     * @param other List to take the elements from; left empty.
+     */
+    void splice(iterator pos, LinkedList& other) noexcept requires(!Store::OWNS_NODES) {
+        if (&other == this || other.isEmpty())
+            return;
+
+        linkChainBefore(pos.current_, other.head_, other.tail_);
+        size_ += other.size_;
+        other.head_ = other.tail_ = nullptr;
+        other.size_ = 0;
+    }
+
+
+    /**
+     * @brief Move the elements [first, last) of `other` in front of `pos`.
+     *
+     * The nodes are relinked, not copied, and iterators to them stay tied to
+     * `other` for end() as with splice(pos, other). `other` may be this list,
+     * in which case the range is moved in O(1) and `pos` must not lie inside
+     * it; between two lists the range is walked once to update the sizes.
+     *
+     * @param pos Position in this list to insert before; end() appends.
+     * @param other List that owns the range.
+     * @param first Start of the range in `other`.
+     * @param last End of the range in `other`.
+     */
+    void splice(iterator pos, LinkedList& other, iterator first, iterator last) noexcept
+        requires(!Store::OWNS_NODES)
+    {
+        if (first == last)
+            return;
+
+        Node* first_node = first.current_;
+        Node* last_node = last.current_ != nullptr ? last.current_->prev : other.tail_;
+
+        size_t count = 0;
+        if (&other != this)
+            for (Node* node = first_node; node != last_node->next; node = node->next)
+                ++count;
+
+        other.unlinkChain(first_node, last_node);
+        other.size_ -= count;
+        linkChainBefore(pos.current_, first_node, last_node);
+        size_ += count;
+    }
+
+
+    /**
+     * @brief Merge the sorted list `other` into this sorted list.
+     *
+     * Runs of `other` are relinked in front of the first element of this list
+     * that compares greater, so the merge moves no elements and is stable:
+     * of two equivalent elements, the one from this list comes first.
+     * Iterators into `other` behave as after splice(pos, other). If `comp`
+     * throws, both lists stay valid and every element is in one of
+     * them. Not available with PooledNodes.
+     *
+     * @param other Sorted list to take the elements from; left empty.
+     * @param comp Strict weak ordering both lists are sorted by.
+     * @complexity O(size() + other.size()) comparisons.
+     */
+    template <typename Compare = std::less<>>
+    void merge(LinkedList& other, Compare comp = Compare()) requires(!Store::OWNS_NODES) {
+        if (&other == this)
+            return;
+
+        Node* current = head_;
+        while (other.head_ != nullptr) {
+            while (current != nullptr && !comp(other.head_->data, current->data))
+                current = current->next;
+            if (current == nullptr) {
+                splice(end(), other);
+                return;
+            }
+
+            Node* first = other.head_;
+            Node* last = first;
+            size_t count = 1;
+            while (last->next != nullptr && comp(last->next->data, current->data)) {
+                last = last->next;
+                ++count;
+            }
+
+            other.unlinkChain(first, last);
+            other.size_ -= count;
+            linkChainBefore(current, first, last);
+            size_ += count;
+        }
+    }
+
+
     /// Destructor
     ~LinkedList() noexcept { clear(); }
 };
@@ -0,0 +1,162 @@
+#ifndef MAPPED_ARRAY_HPP
+#define MAPPED_ARRAY_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DynamicArray.hpp"
+#include "MappedFile.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/**
+ * @class MappedArray
+ * @brief Read-only array backed directly by a memory-mapped image file.
+ *
+ * save() writes the elements of a contiguous range (for example a
+ * DynamicArray) to an image file: a versioned header followed by the raw
+ * elements. Constructing a MappedArray maps that file and uses its pages as
+ * the element storage, so loading costs O(1) regardless of the array's size
+ * and no element is copied; pages are read in on first access and shared
+ * with every other process mapping the same file.
+ *
+ * The elements are the file's bytes reinterpreted, hence the restriction to
+ * trivially copyable types, and an image can only be read on a machine with
+ * the same byte order. Use toDynamicArray() for a mutable copy.
+ *
+ * @tparam Type Element type. Must be trivially copyable and aligned to at
+ * most 64 bytes.
+ */
+template <typename Type>
+class MappedArray {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "MappedArray requires a trivially copyable Type");
+    static_assert(alignof(Type) <= image_detail::PAYLOAD_ALIGNMENT,
+                  "MappedArray supports alignments of at most 64 bytes");
+
+    MappedFile file_;
+    const Type* data_ = nullptr;
+    size_t size_ = 0;
+
+    static image_detail::ImageHeader expectedHeader() noexcept {
+        image_detail::ImageHeader header = image_detail::makeHeader(image_detail::ImageKind::Array);
+        header.key_size = sizeof(Type);
+        header.key_align = alignof(Type);
+        return header;
+    }
+
+  public:
+    using value_type = Type;
+    using const_iterator = const Type*;
+    using iterator = const_iterator;
+    using size_type = size_t;
+
+
+    /**
+     * @brief Writes count elements to an image file at path.
+     *
+     * The file is replaced atomically (written aside, then renamed).
+     *
+     * @throws std::runtime_error if the file cannot be written.
+     */
+    static void save(const std::filesystem::path& path, const Type* data, const size_t count) {
+        image_detail::ImageHeader header = expectedHeader();
+        header.count = count;
+        header.capacity = count;
+        const std::pair<const std::byte*, size_t> sections[] = {
+            {reinterpret_cast<const std::byte*>(data), count * sizeof(Type)}};
+        image_detail::writeImage(path, header, sections);
+    }
+
+    /// Writes the elements of a contiguous range, e.g. a DynamicArray.
+    template <std::ranges::contiguous_range Range>
+        requires std::is_same_v<std::ranges::range_value_t<Range>, Type>
+    static void save(const std::filesystem::path& path, const Range& range) {
+        save(path, std::ranges::data(range), std::ranges::size(range));
+    }
+
+
+    /// Creates an empty array that maps nothing.
+    MappedArray() noexcept = default;
+
+    /**
+     * @brief Maps the image file at path.
+     *
+     * @param path File written by save() for the same element type.
+     * @param check ImageCheck::Header validates the header only and keeps
+     * the load O(1); ImageCheck::Checksum also reads the whole payload once
+     * to verify its checksum.
+     * @throws std::system_error if the file cannot be mapped.
+     * @throws std::runtime_error if it is not an array image of Type, is
+     * truncated, or fails the checksum.
+     */
+    explicit MappedArray(const std::filesystem::path& path,
+                         const ImageCheck check = ImageCheck::Header)
+        : file_(path) {
+        const auto& header = image_detail::validateImage(file_, expectedHeader(), check);
+        if (header.count * sizeof(Type) != header.payload_bytes)
+            throw std::runtime_error("Image is truncated");
+        data_ = reinterpret_cast<const Type*>(file_.data() + sizeof(image_detail::ImageHeader));
+        size_ = header.count;
+    }
+
+
+    /// Returns the number of elements.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the array is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Pointer to the first element, inside the mapping.
+    [[nodiscard]]
+    const Type* data() const noexcept {
+        return data_;
+    }
+
+
+    /**
+     * @brief Bounds-checked element access.
+     *
+     * @throws std::out_of_range If idx >= size().
+     */
+    const Type& get(const size_t idx) const {
+        if (idx >= size_)
+            throw std::out_of_range("Index out of range");
+        return data_[idx];
+    }
+
+    /// Unchecked element access.
+    const Type& operator[](const size_t idx) const noexcept { return data_[idx]; }
+
+
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+
+    /// Copies the elements into a new, mutable DynamicArray.
+    [[nodiscard]]
+    DynamicArray<Type> toDynamicArray() const {
+        DynamicArray<Type> copy(size_);
+        copy.appendRange(begin(), end());
+        return copy;
+    }
+};
+
+} // namespace containers
+
+#endif // MAPPED_ARRAY_HPP
@@ -0,0 +1,405 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @class MappedFile
+ *
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The file's pages are loaded lazily by the operating system on first
+ * access, so opening even a multi-gigabyte file costs a few system calls.
+ * The mapping is private and read-only; it stays valid if the file is
+ * replaced by a rename, but not if it is truncated in place.
+ */
+class MappedFile {
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    HANDLE mapping_ = nullptr;
+#endif
+
+    [[noreturn]] static void fail(const std::filesystem::path& path, const char* what) {
+#if defined(_WIN32)
+        const std::error_code error(static_cast<int>(GetLastError()), std::system_category());
+#else
+        const std::error_code error(errno, std::generic_category());
+#endif
+        throw std::system_error(error, std::string(what) + " '" + path.string() + "'");
+    }
+
+    void unmap() noexcept {
+        if (data_ == nullptr)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+        mapping_ = nullptr;
+#else
+        munmap(const_cast<std::byte*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+  public:
+    /// Creates an empty mapping.
+    MappedFile() noexcept = default;
+
+    /**
+     * @brief Maps the file at path.
+     *
+     * @throws std::system_error if the file cannot be opened or mapped, or
+     * is empty.
+     */
+    explicit MappedFile(const std::filesystem::path& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            fail(path, "Cannot open");
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            CloseHandle(file);
+            fail(path, "Cannot map empty or unreadable file");
+        }
+        mapping_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping_ == nullptr)
+            fail(path, "Cannot map");
+        const void* view = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            CloseHandle(mapping_);
+            mapping_ = nullptr;
+            fail(path, "Cannot map");
+        }
+        data_ = static_cast<const std::byte*>(view);
+        size_ = static_cast<size_t>(size.QuadPart);
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            fail(path, "Cannot open");
+        struct stat info {};
+        if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            fail(path, "Cannot map empty or unreadable file");
+        }
+        void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED)
+            fail(path, "Cannot map");
+        data_ = static_cast<const std::byte*>(view);
+        size_ = static_cast<size_t>(info.st_size);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Move constructor; takes over the mapping.
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+#if defined(_WIN32)
+          , mapping_(std::exchange(other.mapping_, nullptr))
+#endif
+    {}
+
+    /// Move assignment operator
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#if defined(_WIN32)
+            mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    /// Destructor; unmaps the file.
+    ~MappedFile() noexcept { unmap(); }
+
+
+    /// First byte of the file, or nullptr if nothing is mapped.
+    [[nodiscard]]
+    const std::byte* data() const noexcept {
+        return data_;
+    }
+
+    /// Size of the file in bytes.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if a file is mapped.
+    [[nodiscard]]
+    bool isOpen() const noexcept {
+        return data_ != nullptr;
+    }
+};
+
+
+/// How much of an image is validated when it is opened.
+enum class ImageCheck {
+    Header,   ///< Format, version and types only; O(1), touches no payload page.
+    Checksum  ///< Also the payload checksum; reads the whole file once.
+};
+
+
+namespace image_detail {
+
+inline constexpr char MAGIC[8] = {'C', 'N', 'T', 'R', 'I', 'M', 'G', '\0'};
+inline constexpr uint32_t FORMAT_VERSION = 1;
+inline constexpr uint64_t BYTE_ORDER_MARK = 0x0102030405060708ull;
+
+/// Payloads start at this offset, and sections within them at multiples of
+/// it, so any element type aligned to at most 64 bytes can be used in place.
+inline constexpr size_t PAYLOAD_ALIGNMENT = 64;
+
+/// What an image file holds.
+enum class ImageKind : uint32_t { Array = 1, FrozenHashMap = 2 };
+
+
+/**
+ * @brief Fixed 128-byte header at the start of every image file.
+ *
+ * Readers reject files whose magic, version, byte order, kind or type
+ * sizes differ from what they expect, so an image can only be opened as
+ * the type it was written from (up to types of identical size and
+ * alignment).
+ */
+struct ImageHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t kind;
+    uint64_t byte_order;
+    uint64_t key_size;       ///< sizeof the element (arrays) or key (maps).
+    uint64_t key_align;
+    uint64_t value_size;     ///< sizeof the mapped value; 0 for arrays.
+    uint64_t value_align;
+    uint64_t count;          ///< Number of elements or entries.
+    uint64_t capacity;       ///< Number of slots; equals count for arrays.
+    uint64_t payload_bytes;  ///< Bytes following the header.
+    uint64_t checksum;       ///< checksum() of the payload.
+    uint64_t hash_check;     ///< Maps: hash of the key in slot check_index.
+    uint64_t check_index;
+    uint64_t reserved[3];
+};
+static_assert(sizeof(ImageHeader) == 128 && sizeof(ImageHeader) % PAYLOAD_ALIGNMENT == 0);
+
+
+/// Rounds n up to a multiple of PAYLOAD_ALIGNMENT.
+constexpr size_t alignPayload(const size_t n) noexcept {
+    return (n + PAYLOAD_ALIGNMENT - 1) / PAYLOAD_ALIGNMENT * PAYLOAD_ALIGNMENT;
+}
+
+
+/**
+ * @brief Incremental 64-bit checksum of a byte stream.
+ *
+ * Four independent lanes consume 32 bytes per round, so the loop runs at
+ * close to memory bandwidth; the lanes are folded and finalized with the
+ * SplitMix64 mixer. The result depends only on the bytes, not on how they
+ * were split across update() calls. Detects corruption, not tampering.
+ */
+class Checksum {
+    static constexpr uint64_t K1 = 0x9e3779b97f4a7c15ull;
+    static constexpr uint64_t K2 = 0xbf58476d1ce4e5b9ull;
+    static constexpr size_t BLOCK = 32;
+
+    uint64_t lanes_[4] = {K1, K2, ~K1, ~K2};
+    std::byte pending_[BLOCK] = {};
+    size_t pending_size_ = 0;
+    uint64_t total_ = 0;
+
+    void round(const std::byte* block) noexcept {
+        for (size_t lane = 0; lane < 4; ++lane) {
+            uint64_t word;
+            std::memcpy(&word, block + lane * 8, sizeof(word));
+            lanes_[lane] = std::rotl(lanes_[lane] + word * K2, 31) * K1;
+        }
+    }
+
+  public:
+    /// Feeds the next bytes bytes of the stream.
+    void update(const std::byte* data, size_t bytes) noexcept {
+        total_ += bytes;
+        if (pending_size_ > 0) {
+            const size_t take = bytes < BLOCK - pending_size_ ? bytes : BLOCK - pending_size_;
+            std::memcpy(pending_ + pending_size_, data, take);
+            pending_size_ += take;
+            data += take;
+            bytes -= take;
+            if (pending_size_ < BLOCK)
+                return;
+            round(pending_);
+            pending_size_ = 0;
+        }
+        for (; bytes >= BLOCK; data += BLOCK, bytes -= BLOCK)
+            round(data);
+        if (bytes > 0)
+            std::memcpy(pending_, data, bytes);
+        pending_size_ = bytes;
+    }
+
+    /// Checksum of everything fed so far.
+    [[nodiscard]]
+    uint64_t finish() const noexcept {
+        uint64_t hash = total_ * K1;
+        for (const uint64_t lane : lanes_)
+            hash = std::rotl(hash ^ lane, 27) * K2;
+        for (size_t i = 0; i < pending_size_; ++i)
+            hash = (hash ^ static_cast<uint64_t>(pending_[i])) * 0x100000001b3ull;
+
+        hash = (hash ^ (hash >> 30)) * K2;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+        return hash ^ (hash >> 31);
+    }
+};
+
+
+/// Checksum of a byte range in one call.
+inline uint64_t checksum(const std::byte* data, const size_t bytes) noexcept {
+    Checksum sum;
+    sum.update(data, bytes);
+    return sum.finish();
+}
+
+
+/// A header for an image of the given kind with everything else zeroed.
+inline ImageHeader makeHeader(const ImageKind kind) noexcept {
+    ImageHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = FORMAT_VERSION;
+    header.kind = static_cast<uint32_t>(kind);
+    header.byte_order = BYTE_ORDER_MARK;
+    return header;
+}
+
+
+/**
+ * @brief Writes header and payload to path, replacing any existing file.
+ *
+ * The image is written to a temporary file next to path and renamed over
+ * it, so readers never see a half-written image; on failure the temporary
+ * file is removed again. The payload is streamed from the sections without
+ * an intermediate copy; payload_bytes and checksum are filled in here.
+ *
+ * @param sections (pointer, byte count) pairs concatenated into the
+ * payload, each starting at a PAYLOAD_ALIGNMENT boundary.
+ * @throws std::runtime_error if writing fails.
+ */
+template <size_t N>
+void writeImage(const std::filesystem::path& path, ImageHeader header,
+                const std::pair<const std::byte*, size_t> (&sections)[N]) {
+    static constexpr std::byte ZEROS[PAYLOAD_ALIGNMENT] = {};
+
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("Cannot create '" + temporary.string() + "'");
+    try {
+        // Placeholder; rewritten once the checksum is known.
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        Checksum sum;
+        size_t written = 0;
+        for (const auto& [bytes, size] : sections) {
+            const size_t padding = alignPayload(written) - written;
+            out.write(reinterpret_cast<const char*>(ZEROS), static_cast<std::streamsize>(padding));
+            sum.update(ZEROS, padding);
+            if (size > 0) {
+                out.write(reinterpret_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+                sum.update(bytes, size);
+            }
+            written += padding + size;
+        }
+
+        header.payload_bytes = written;
+        header.checksum = sum.finish();
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.close();
+        if (!out)
+            throw std::runtime_error("Cannot write '" + temporary.string() + "'");
+        std::filesystem::rename(temporary, path);
+    } catch (...) {
+        out.close();
+        std::error_code ignored;
+        std::filesystem::remove(temporary, ignored);
+        throw;
+    }
+}
+
+
+/**
+ * @brief Validates the header of a mapped image and returns it.
+ *
+ * @param expected A header with kind and the key/value sizes and
+ * alignments the caller's types require.
+ * @throws std::runtime_error if the file is not an image of that kind and
+ * those types, is truncated, or (with ImageCheck::Checksum) is corrupt.
+ */
+inline const ImageHeader& validateImage(const MappedFile& file, const ImageHeader& expected,
+                                        const ImageCheck check) {
+    if (file.size() < sizeof(ImageHeader))
+        throw std::runtime_error("Image is truncated");
+
+    const auto* header = reinterpret_cast<const ImageHeader*>(file.data());
+    if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0)
+        throw std::runtime_error("Not an image file");
+    if (header->version != FORMAT_VERSION)
+        throw std::runtime_error("Unsupported image version " + std::to_string(header->version));
+    if (header->byte_order != BYTE_ORDER_MARK)
+        throw std::runtime_error("Image was written with a different byte order");
+    if (header->kind != expected.kind || header->key_size != expected.key_size ||
+        header->key_align != expected.key_align || header->value_size != expected.value_size ||
+        header->value_align != expected.value_align)
+        throw std::runtime_error("Image holds a different kind or element type");
+    if (header->payload_bytes != file.size() - sizeof(ImageHeader))
+        throw std::runtime_error("Image is truncated");
+    if (check == ImageCheck::Checksum &&
+        checksum(file.data() + sizeof(ImageHeader), header->payload_bytes) != header->checksum)
+        throw std::runtime_error("Image checksum mismatch");
+    return *header;
+}
+
+} // namespace image_detail
+
+} // namespace containers
+
+#endif // MAPPED_FILE_HPP
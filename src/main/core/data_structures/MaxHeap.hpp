@@ -23,9 +23,10 @@ using std::size_t;
  * tree built with linked nodes (parent/left/right), not an array.
  *
  * @tparam Type Element type.
+ * @tparam NodePolicy Where nodes are allocated, see BinaryTree.
  */
-template <typename Type>
-class MaxHeap final : public Heap<Type> {
+template <typename Type, typename NodePolicy = HeapNodes>
+class MaxHeap final : public Heap<Type, NodePolicy> {
 
     /**
      * @brief Bubble a node toward the root while it violates the max-heap
@@ -94,10 +95,10 @@ class MaxHeap final : public Heap<Type> {
 
   public:
     /// Default constructor
-    MaxHeap() : Heap<Type>() {}
+    MaxHeap() : Heap<Type, NodePolicy>() {}
 
     /// Constructor for braced-init-lists
-    MaxHeap(std::initializer_list<Type> initial_data) : Heap<Type>() {
+    MaxHeap(std::initializer_list<Type> initial_data) : Heap<Type, NodePolicy>() {
         for (const Type& element : initial_data)
             this->insert(element);
     }
@@ -110,26 +111,26 @@ class MaxHeap final : public Heap<Type> {
      * heap.
      * @param size The number of elements in the array.
      */
-    MaxHeap(const Type* array, const size_t size) : Heap<Type>() {
+    MaxHeap(const Type* array, const size_t size) : Heap<Type, NodePolicy>() {
         for (size_t i = 0; i < size; ++i)
             this->insert(array[i]);
     }
 
     /// Copy constructor
-    MaxHeap(const MaxHeap& other) : Heap<Type>(other) {}
+    MaxHeap(const MaxHeap& other) : Heap<Type, NodePolicy>(other) {}
 
     /// Move constructor
-    MaxHeap(MaxHeap&& other) noexcept : Heap<Type>(std::move(other)) {}
+    MaxHeap(MaxHeap&& other) noexcept : Heap<Type, NodePolicy>(std::move(other)) {}
 
     /// Copy assignment operator
     MaxHeap& operator=(const MaxHeap& other) {
-        Heap<Type>::operator=(other);
+        Heap<Type, NodePolicy>::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
     MaxHeap& operator=(MaxHeap&& other) noexcept {
-        Heap<Type>::operator=(std::move(other));
+        Heap<Type, NodePolicy>::operator=(std::move(other));
         return *this;
     }
 
@@ -152,7 +153,7 @@ class MaxHeap final : public Heap<Type> {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = this->nodes_.create(std::forward<U>(element));
 
         if (this->isEmpty()) {
             this->root_ = newNode;
@@ -21,9 +21,10 @@ using std::size_t;
  * Invariant: for every node `N`, `N->data` is **<=** each child's value.
  *
  * @tparam Type Element type.
+ * @tparam NodePolicy Where nodes are allocated, see BinaryTree.
  */
-template <typename Type>
-class MinHeap final : public Heap<Type> {
+template <typename Type, typename NodePolicy = HeapNodes>
+class MinHeap final : public Heap<Type, NodePolicy> {
 
     /**
      * @brief Bubble a node toward the root until the min-heap invariant holds.
@@ -91,11 +92,11 @@ class MinHeap final : public Heap<Type> {
 
   public:
     /// Default constructor
-    MinHeap() : Heap<Type>() {}
+    MinHeap() : Heap<Type, NodePolicy>() {}
 
 
     /// Constructor for braced-init-lists
-    MinHeap(std::initializer_list<Type> initial_data) : Heap<Type>() {
+    MinHeap(std::initializer_list<Type> initial_data) : Heap<Type, NodePolicy>() {
         for (const Type& element : initial_data)
             this->insert(element);
     }
@@ -110,26 +111,26 @@ class MinHeap final : public Heap<Type> {
      * heap.
      * @param size The number of elements in the array.
      */
-    MinHeap(const Type* array, const size_t size) : Heap<Type>() {
+    MinHeap(const Type* array, const size_t size) : Heap<Type, NodePolicy>() {
         for (size_t i = 0; i < size; ++i)
             insert(array[i]);
     }
 
     /// Copy constructor
-    MinHeap(const MinHeap& other) : Heap<Type>(other) {}
+    MinHeap(const MinHeap& other) : Heap<Type, NodePolicy>(other) {}
 
     /// Move constructor
-    MinHeap(MinHeap&& other) noexcept : Heap<Type>(std::move(other)) {}
+    MinHeap(MinHeap&& other) noexcept : Heap<Type, NodePolicy>(std::move(other)) {}
 
     /// Copy assignment operator
     MinHeap& operator=(const MinHeap& other) {
-        Heap<Type>::operator=(other);
+        Heap<Type, NodePolicy>::operator=(other);
         return *this;
     }
 
     /// Move assignment operator
     MinHeap& operator=(MinHeap&& other) noexcept {
-        Heap<Type>::operator=(std::move(other));
+        Heap<Type, NodePolicy>::operator=(std::move(other));
         return *this;
     }
 
@@ -153,7 +154,7 @@ class MinHeap final : public Heap<Type> {
         static_assert(std::is_constructible_v<Type, U&&>,
                       "Element must be constructible into Type");
 
-        auto* newNode = new Node<Type>(std::forward<U>(element));
+        auto* newNode = this->nodes_.create(std::forward<U>(element));
 
         if (this->isEmpty()) {
             this->root_ = newNode;
@@ -0,0 +1,292 @@
+#ifndef NODEPOOL_HPP
+#define NODEPOOL_HPP
+
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @struct HeapNodes
+ *
+ * @brief Node allocation policy that allocates every node with its own
+ * new/delete (the default).
+ *
+ * Simple and thread-agnostic, but one malloc per insert and the nodes of a
+ * container end up scattered over the heap.
+ */
+struct HeapNodes {};
+
+
+/** @struct PooledNodes
+ *
+ * @brief Node allocation policy that carves nodes out of slabs owned by the
+ * container.
+ *
+ * Nodes are handed out consecutively from slabs of NodesPerSlab nodes, so
+ * nodes created together are adjacent in memory, and freed nodes are
+ * recycled through an intrusive free list. clear() and the destructor hand
+ * back whole slabs instead of freeing node by node, and skip visiting the
+ * nodes altogether when the element type is trivially destructible.
+ *
+ * Memory of removed nodes is only returned to the system by clear() or the
+ * destructor. Moving a container moves its slabs; a copy gets its own pool.
+ * Since nodes belong to their container's slabs, operations that relink
+ * nodes into another container (e.g. LinkedList::splice) are unavailable.
+ *
+ * @tparam NodesPerSlab Number of nodes per slab.
+ */
+template <size_t NodesPerSlab = 256>
+struct PooledNodes {
+    static_assert(NodesPerSlab > 0, "NodesPerSlab must be positive.");
+    static constexpr size_t NODES_PER_SLAB = NodesPerSlab;
+};
+
+
+/** @struct ThreadPooledNodes
+ *
+ * @brief Node allocation policy that shares one slab pool per thread and node
+ * type between all containers.
+ *
+ * Like PooledNodes, but nodes freed by one container are reused by the next
+ * one built on the same thread, so short-lived containers stop allocating
+ * once the pool is warm. The slabs are released when the thread exits, so
+ * clear() frees nodes one by one into the pool.
+ *
+ * A container using this policy must not outlive, or be handed off from, the
+ * thread that created it.
+ *
+ * @tparam NodesPerSlab Number of nodes per slab.
+ */
+template <size_t NodesPerSlab = 256>
+struct ThreadPooledNodes {
+    static_assert(NodesPerSlab > 0, "NodesPerSlab must be positive.");
+    static constexpr size_t NODES_PER_SLAB = NodesPerSlab;
+};
+
+
+/** @class NodePool
+ *
+ * @brief Fixed-size slab allocator for raw node storage.
+ *
+ * Storage comes from the free list if it is not empty, otherwise from the
+ * untouched tail of the newest slab; a new slab is allocated when both are
+ * exhausted. The pool never constructs or destroys nodes itself.
+ *
+ * @tparam Node The node type whose storage is pooled.
+ * @tparam NodesPerSlab Number of nodes per slab.
+ */
+template <typename Node, size_t NodesPerSlab>
+class NodePool {
+
+    union Slot {
+        Slot* next;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Slab {
+        Slab* next;
+        Slot slots[NodesPerSlab];
+    };
+
+    Slab* slabs_ = nullptr;
+    Slot* free_ = nullptr;
+    size_t untouched_ = 0; // Slots never handed out in the newest slab.
+    size_t slab_count_ = 0;
+
+
+  public:
+    /// Creates an empty pool; no slab is allocated until the first node.
+    NodePool() noexcept = default;
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /// Move constructor; takes over every slab of other.
+    NodePool(NodePool&& other) noexcept
+        : slabs_(std::exchange(other.slabs_, nullptr)),
+          free_(std::exchange(other.free_, nullptr)),
+          untouched_(std::exchange(other.untouched_, 0)),
+          slab_count_(std::exchange(other.slab_count_, 0)) {}
+
+    /// Move assignment; releases this pool's slabs first.
+    NodePool& operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            release();
+            slabs_ = std::exchange(other.slabs_, nullptr);
+            free_ = std::exchange(other.free_, nullptr);
+            untouched_ = std::exchange(other.untouched_, 0);
+            slab_count_ = std::exchange(other.slab_count_, 0);
+        }
+        return *this;
+    }
+
+    ~NodePool() { release(); }
+
+
+    /**
+     * @brief Returns uninitialized storage for one node.
+     * @throws std::bad_alloc if a new slab cannot be allocated.
+     * @complexity O(1).
+     */
+    [[nodiscard]]
+    void* allocate() {
+        if (free_ != nullptr)
+            return std::exchange(free_, free_->next);
+
+        if (untouched_ == 0) {
+            Slab* slab = std::allocator<Slab>().allocate(1);
+            slab->next = slabs_;
+            slabs_ = slab;
+            untouched_ = NodesPerSlab;
+            ++slab_count_;
+        }
+        return &slabs_->slots[NodesPerSlab - untouched_--];
+    }
+
+
+    /// Puts the storage of a destroyed node on the free list.
+    void deallocate(void* storage) noexcept {
+        Slot* slot = static_cast<Slot*>(storage);
+        slot->next = free_;
+        free_ = slot;
+    }
+
+
+    /**
+     * @brief Returns every slab to the system at once.
+     *
+     * Every node that was allocated from the pool must already be destroyed
+     * or be trivially destructible; their storage becomes invalid.
+     *
+     * @complexity O(number of slabs).
+     */
+    void release() noexcept {
+        while (slabs_ != nullptr) {
+            Slab* next = slabs_->next;
+            std::allocator<Slab>().deallocate(slabs_, 1);
+            slabs_ = next;
+        }
+        free_ = nullptr;
+        untouched_ = 0;
+        slab_count_ = 0;
+    }
+
+
+    /// Number of slabs currently held.
+    [[nodiscard]]
+    size_t slabCount() const noexcept {
+        return slab_count_;
+    }
+};
+
+
+namespace node_pool_detail {
+
+/// Creates and destroys the nodes of a container according to Policy.
+template <typename Node, typename Policy>
+class NodeStore {
+    static_assert(sizeof(Policy) == 0,
+                  "NodePolicy must be HeapNodes, PooledNodes<N> or ThreadPooledNodes<N>.");
+};
+
+
+template <typename Node>
+class NodeStore<Node, HeapNodes> {
+  public:
+    /// clear() has to destroy the nodes one by one.
+    static constexpr bool RELEASES_IN_BULK = false;
+
+    /// Nodes may be handed over to another container of the same type.
+    static constexpr bool OWNS_NODES = false;
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node* node) noexcept { delete node; }
+
+    void releaseAll() noexcept {}
+};
+
+
+/// Storage of NodeStore for PooledNodes and ThreadPooledNodes.
+template <typename Node, typename Derived>
+class PooledStoreBase {
+  public:
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        auto& pool = static_cast<Derived*>(this)->pool();
+        void* storage = pool.allocate();
+        try {
+            return ::new (storage) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            pool.deallocate(storage);
+            throw;
+        }
+    }
+
+    void destroy(Node* node) noexcept {
+        std::destroy_at(node);
+        static_cast<Derived*>(this)->pool().deallocate(node);
+    }
+};
+
+
+template <typename Node, size_t NodesPerSlab>
+class NodeStore<Node, PooledNodes<NodesPerSlab>>
+    : public PooledStoreBase<Node, NodeStore<Node, PooledNodes<NodesPerSlab>>> {
+
+    NodePool<Node, NodesPerSlab> pool_;
+
+  public:
+    /// clear() may skip freeing node by node and call releaseAll() instead.
+    static constexpr bool RELEASES_IN_BULK = true;
+
+    /// Nodes live in this store's slabs and cannot move to another container.
+    static constexpr bool OWNS_NODES = true;
+
+    NodeStore() noexcept = default;
+
+    /// A copied container starts with a pool of its own.
+    NodeStore(const NodeStore&) noexcept {}
+    NodeStore& operator=(const NodeStore&) = delete;
+
+    NodeStore(NodeStore&&) noexcept = default;
+
+    /// Only valid once every node of this store is destroyed.
+    NodeStore& operator=(NodeStore&&) noexcept = default;
+
+    NodePool<Node, NodesPerSlab>& pool() noexcept { return pool_; }
+
+    void releaseAll() noexcept { pool_.release(); }
+};
+
+
+template <typename Node, size_t NodesPerSlab>
+class NodeStore<Node, ThreadPooledNodes<NodesPerSlab>>
+    : public PooledStoreBase<Node, NodeStore<Node, ThreadPooledNodes<NodesPerSlab>>> {
+  public:
+    static constexpr bool RELEASES_IN_BULK = false;
+    static constexpr bool OWNS_NODES = false;
+
+    static NodePool<Node, NodesPerSlab>& pool() noexcept {
+        thread_local NodePool<Node, NodesPerSlab> pool;
+        return pool;
+    }
+
+    void releaseAll() noexcept {}
+};
+
+} // namespace node_pool_detail
+
+} // namespace containers
+
+#endif // NODEPOOL_HPP
@@ -2,13 +2,16 @@
 #define QUEUE_HPP
 
 
+#include <bit>
 #include <limits>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
-#include <bit>
 
 
+#include "CapacityPolicy.hpp"
 #include "DynamicArray.hpp"
 
 
@@ -23,20 +26,32 @@ using std::size_t;
  *
  * Provides efficient enqueue and dequeue operations with amortized O(1) complexity.
  *
+ * The ring indexes its buffer with a mask, so the capacity is always a power
+ * of two and growth always doubles it, whatever the policy's growth factor.
+ * The policy does decide when a sparse queue gives memory back. For a queue
+ * that never copies its elements on growth, see SegmentedQueue.
+ *
  * @tparam Type The type of elements stored in the queue.
+ * @tparam Allocator Allocator of the underlying array. Defaults to
+ * std::allocator<Type>.
+ * @tparam CapacityPolicy When to shrink, see CapacityPolicy.hpp. Defaults to
+ * ShrinkWhenSparse<>, which is asked every SHRINK_CHECK_INTERVAL dequeues.
  */
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>,
+          typename CapacityPolicy = ShrinkWhenSparse<>>
 class Queue {
 
-    DynamicArray<Type> array_;
+    using Array = DynamicArray<Type, Allocator>;
+
+    Array array_;
 
     size_t front_idx_;
     size_t size_;
     size_t shrink_check_counter_ = 0;
+    [[no_unique_address]] CapacityPolicy capacity_policy_;
 
     static constexpr size_t SHRINK_CHECK_INTERVAL = 16;
     static constexpr size_t MIN_SHRINK_CAPACITY = 16;
-    static constexpr size_t SHRINK_THRESHOLD_DIVISOR = 4;
     static constexpr size_t GROWTH_FACTOR = 2;
 
     static constexpr size_t HARD_MAX_ELEMENTS =
@@ -78,26 +93,48 @@ class Queue {
     }
 
 
+    /**
+     * @brief Move the elements, in logical order, into a fresh buffer of
+     * `new_capacity` (a power of two no smaller than size_) and commit it,
+     * resetting `front_idx_` to 0.
+     */
+    void reallocate(const size_t new_capacity) {
+        Array new_array(array_.getAllocator());
+        new_array.reserve(new_capacity);
+
+        for (size_t i = 0; i < size_; ++i) {
+            auto& src = array_[getCircularIndex(i)];
+            if constexpr (std::is_nothrow_move_constructible_v<Type> ||
+                          !std::is_copy_constructible_v<Type>)
+                new_array.emplaceLast(std::move(src));
+            else
+                new_array.emplaceLast(src);
+        }
+
+        array_ = std::move(new_array);
+        front_idx_ = 0;
+    }
+
+
     /**
      * @brief Periodically shrink the underlying buffer when the queue becomes
      * sparse.
      *
      * Increments an internal counter on each call (typically from `dequeue()`),
-     * and every `SHRINK_CHECK_INTERVAL` calls evaluates whether the queue is
-     * sufficiently under-utilized to justify a shrink. If `size_ <=
-     * capacity()/SHRINK_THRESHOLD_DIVISOR` and `capacity() >
-     * MIN_SHRINK_CAPACITY`, it builds a smaller buffer, moves elements in
-     * logical order, and commits the new storage, resetting `front_idx_` to 0.
+     * and every `SHRINK_CHECK_INTERVAL` calls asks the capacity policy whether
+     * the queue is sufficiently under-utilized to justify a shrink; with the
+     * default policy that is `size_ <= capacity()/4`.
+     * Buffers of `MIN_SHRINK_CAPACITY` or less are kept. A shrink halves the
+     * capacity (but keeps room for every element) and moves the elements over
+     * in logical order.
      */
     void autoManageCapacity() {
         shrink_check_counter_++;
         if (shrink_check_counter_ >= SHRINK_CHECK_INTERVAL) {
             shrink_check_counter_ = 0;
 
-            if (size_ <= array_.capacity() / SHRINK_THRESHOLD_DIVISOR &&
-                array_.capacity() > MIN_SHRINK_CAPACITY) {
-
-                DynamicArray<Type> new_array;
+            if (array_.capacity() > MIN_SHRINK_CAPACITY &&
+                capacity_policy_.shouldShrink(size_, array_.capacity())) {
                 const size_t halved = array_.capacity() / GROWTH_FACTOR;
                 const size_t target = size_ > halved ? size_ : halved;
 
@@ -105,19 +142,7 @@ class Queue {
                     ? MIN_SHRINK_CAPACITY
                     : target;
 
-                new_array.reserve(std::bit_ceil(clamped));
-
-                for (size_t i = 0; i < size_; ++i) {
-                    auto& src = array_[getCircularIndex(i)];
-                    if constexpr (std::is_nothrow_move_constructible_v<Type> ||
-                                  !std::is_copy_constructible_v<Type>)
-                        new_array.emplaceLast(std::move(src));
-                    else
-                        new_array.emplaceLast(src);
-                }
-
-                array_ = std::move(new_array);
-                front_idx_ = 0;
+                reallocate(std::bit_ceil(clamped));
             }
         }
     }
@@ -128,7 +153,7 @@ class Queue {
      * strongly-exception-safe step.
      *
      * Computes a larger capacity using `new_cap = min(capacity()*GROWTH_FACTOR,
-     * HARD_MAX_ELEMENTS)`, allocates a fresh `DynamicArray<Type>` with that
+     * HARD_MAX_ELEMENTS)`, allocates a fresh array (same allocator) with that
      * capacity, moves current elements into the new buffer in logical (FIFO)
      * order, then constructs the new element at the back. On success, commits
      * the new storage (`array_ = std::move(new_array)`), resets `front_idx_` to
@@ -150,7 +175,7 @@ class Queue {
                                    ? HARD_MAX_ELEMENTS
                                    : cap * GROWTH_FACTOR;
 
-        DynamicArray<Type> new_array;
+        Array new_array(array_.getAllocator());
         new_array.reserve(new_cap);
 
         for (size_t i = 0; i < size_; ++i) {
@@ -216,8 +241,16 @@ class Queue {
 
   public:
 
+    using allocator_type = Allocator;
+
+
     /// Default constructor
-    Queue() : front_idx_(0), size_(0) {
+    Queue() : Queue(Allocator()) {}
+
+
+    /// Constructor drawing storage from the given allocator.
+    explicit Queue(const Allocator& allocator)
+        : array_(allocator), front_idx_(0), size_(0) {
         array_.reserve(16);
     }
 
@@ -230,9 +263,10 @@ class Queue {
      * `initial_capacity`, with a minimum of 8 to avoid too small buffers.
      *
      * @param initial_capacity The desired initial capacity for the queue.
+     * @param allocator The allocator of the underlying array.
      */
-    explicit Queue(const size_t initial_capacity)
-        : front_idx_(0), size_(0) {
+    explicit Queue(const size_t initial_capacity, const Allocator& allocator = Allocator())
+        : array_(allocator), front_idx_(0), size_(0) {
 
         size_t power_of_two_cap = std::bit_ceil(initial_capacity);
         if (power_of_two_cap < 8) power_of_two_cap = 8;
@@ -251,9 +285,10 @@ class Queue {
      *
      * @param initial_data An initializer list containing the initial elements for
      * the queue.
+     * @param allocator The allocator of the underlying array.
      */
-    Queue(std::initializer_list<Type> initial_data)
-        : front_idx_(0), size_(initial_data.size()) {
+    Queue(std::initializer_list<Type> initial_data, const Allocator& allocator = Allocator())
+        : array_(allocator), front_idx_(0), size_(initial_data.size()) {
 
         size_t cap = std::bit_ceil(initial_data.size());
         if (cap < 16) cap = 16;
@@ -273,11 +308,13 @@ class Queue {
      *
      * @param initial_data Pointer to the first element of the initial data array.
      * @param initial_size The number of elements in the initial data array.
+     * @param allocator The allocator of the underlying array.
      *
      * @throws std::invalid_argument if `initial_data` is null while `initial_size` is greater than 0.
      */
-    Queue(const Type* initial_data, const size_t initial_size)
-        : front_idx_(0), size_(initial_size) {
+    Queue(const Type* initial_data, const size_t initial_size,
+          const Allocator& allocator = Allocator())
+        : array_(allocator), front_idx_(0), size_(initial_size) {
 
         if (initial_size > 0 && initial_data == nullptr)
             throw std::invalid_argument("Initial data cannot be null");
@@ -293,7 +330,10 @@ class Queue {
 
 
     /// Copy constructor
-    Queue(const Queue& other) : array_(), front_idx_(0), size_(0) {
+    Queue(const Queue& other)
+        : array_(std::allocator_traits<Allocator>::select_on_container_copy_construction(
+              other.array_.getAllocator())),
+          front_idx_(0), size_(0) {
         size_t cap = std::bit_ceil(other.size_);
         if (cap < 16) cap = 16;
         array_.reserve(cap);
@@ -308,7 +348,7 @@ class Queue {
     Queue(Queue&& other) noexcept
         : array_(std::move(other.array_)), front_idx_(other.front_idx_),
           size_(other.size_) {
-        other.array_ = DynamicArray<Type>{};
+        other.array_ = Array(array_.getAllocator());
         other.front_idx_ = 0;
         other.size_ = 0;
     }
@@ -318,7 +358,7 @@ class Queue {
         if (this == &other)
             return *this;
 
-        DynamicArray<Type> new_array;
+        Array new_array(array_.getAllocator());
         size_t cap = std::bit_ceil(other.size_);
         if (cap < 16) cap = 16;
         new_array.reserve(cap);
@@ -335,7 +375,7 @@ class Queue {
     }
 
     /// Move assignment operator
-    Queue& operator=(Queue&& other) noexcept {
+    Queue& operator=(Queue&& other) noexcept(std::is_nothrow_move_assignable_v<Array>) {
         if (this == &other)
             return *this;
 
@@ -343,7 +383,7 @@ class Queue {
         front_idx_ = other.front_idx_;
         size_ = other.size_;
 
-        other.array_ = DynamicArray<Type>{};
+        other.array_ = Array(other.array_.getAllocator());
         other.front_idx_ = 0;
         other.size_ = 0;
 
@@ -363,6 +403,12 @@ class Queue {
         return array_.capacity();
     }
 
+    /// Returns a copy of the allocator of the underlying array.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return array_.getAllocator();
+    }
+
     /// Checks if the queue is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
@@ -490,6 +536,23 @@ class Queue {
     }
 
 
+    /**
+     * @brief Shrinks the buffer to the smallest power of two that holds the
+     * current elements (at least MIN_SHRINK_CAPACITY).
+     *
+     * Does nothing under the NeverShrink policy.
+     *
+     * @complexity O(n) when it reallocates.
+     */
+    void shrinkToFit() {
+        if constexpr (CapacityPolicy::SHRINKS_ON_REQUEST) {
+            const size_t target = std::bit_ceil(size_ < MIN_SHRINK_CAPACITY ? MIN_SHRINK_CAPACITY : size_);
+            if (target < array_.capacity())
+                reallocate(target);
+        }
+    }
+
+
     /// Clears the queue, removing all elements while keeping capacity.
     void clear() noexcept {
         array_.clear();
@@ -502,6 +565,15 @@ class Queue {
     ~Queue() = default;
 };
 
+
+namespace pmr {
+
+/// Queue whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using Queue = containers::Queue<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace containers
 
 #endif // QUEUE_HPP
@@ -0,0 +1,842 @@
+#ifndef REDBLACKTREE_HPP
+#define REDBLACKTREE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "BinaryTree.hpp"
+#include "NodePool.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/**
+ * @struct RedBlackNode
+ * @brief A binary tree Node that also carries its red-black color.
+ *
+ * The links stay typed as Node<Type>*, so the generic tree code (height,
+ * traversals) works on red-black nodes unchanged; only the balancing code
+ * looks at the color.
+ *
+ * @tparam Type Element type stored in the node.
+ */
+template <typename Type>
+struct RedBlackNode : Node<Type> {
+    using Node<Type>::Node;
+
+    bool red = true;
+};
+
+
+/**
+ * @class RedBlackTree
+ * @brief Balanced ordered set storing unique elements of type `Type`.
+ *
+ * A red-black tree over Node parent pointers: insert, remove and find are
+ * iterative and take O(log n) time whatever the insertion order, so keys
+ * arriving in sorted order no longer degrade into a linked list as they do
+ * in BinarySearchTree. Elements are visited in order by bidirectional
+ * iterators, and lowerBound() / upperBound() / range() answer ordered
+ * queries.
+ *
+ * Removal relinks nodes instead of swapping their values, so iterators to
+ * other elements stay valid; only iterators to the removed element are
+ * invalidated. Two elements are equal when neither is less than the other
+ * under Compare.
+ *
+ * @tparam Type Element type.
+ * @tparam Compare Strict weak ordering. Defaults to std::less<Type>; with a
+ * transparent comparator such as std::less<> the lookups also accept other
+ * key types.
+ * @tparam NodePolicy Where nodes are allocated, see BinaryTree.
+ */
+template <typename Type, typename Compare = std::less<Type>,
+          typename NodePolicy = HeapNodes>
+class RedBlackTree {
+
+    using RBNode = RedBlackNode<Type>;
+
+    Node<Type>* root_ = nullptr;
+    size_t size_ = 0;
+    [[no_unique_address]] Compare compare_;
+    [[no_unique_address]] node_pool_detail::NodeStore<RBNode, NodePolicy> nodes_;
+
+
+    /// True for types that may be used directly for lookups: Type itself, or
+    /// any type a transparent Compare can order against Type.
+    template <typename K>
+    static constexpr bool is_lookup_key_v =
+        std::is_same_v<std::remove_cvref_t<K>, Type> ||
+        (requires { typename Compare::is_transparent; } &&
+         requires(const Compare& compare, const Type& stored, const K& key) {
+             { compare(stored, key) } -> std::convertible_to<bool>;
+             { compare(key, stored) } -> std::convertible_to<bool>;
+         });
+
+
+    static bool isRed(const Node<Type>* node) noexcept {
+        return node != nullptr && static_cast<const RBNode*>(node)->red;
+    }
+
+    static void setRed(Node<Type>* node, const bool red) noexcept {
+        static_cast<RBNode*>(node)->red = red;
+    }
+
+
+    static const Node<Type>* minNode(const Node<Type>* node) noexcept {
+        while (node->left != nullptr)
+            node = node->left;
+        return node;
+    }
+
+    static const Node<Type>* maxNode(const Node<Type>* node) noexcept {
+        while (node->right != nullptr)
+            node = node->right;
+        return node;
+    }
+
+    static Node<Type>* minNode(Node<Type>* node) noexcept {
+        return const_cast<Node<Type>*>(minNode(static_cast<const Node<Type>*>(node)));
+    }
+
+
+    /// In-order successor of node, or nullptr after the last one.
+    static const Node<Type>* nextNode(const Node<Type>* node) noexcept {
+        if (node->right != nullptr)
+            return minNode(node->right);
+        const Node<Type>* parent = node->parent;
+        while (parent != nullptr && node == parent->right) {
+            node = parent;
+            parent = parent->parent;
+        }
+        return parent;
+    }
+
+    /// In-order predecessor of node, or nullptr before the first one.
+    static const Node<Type>* prevNode(const Node<Type>* node) noexcept {
+        if (node->left != nullptr)
+            return maxNode(node->left);
+        const Node<Type>* parent = node->parent;
+        while (parent != nullptr && node == parent->left) {
+            node = parent;
+            parent = parent->parent;
+        }
+        return parent;
+    }
+
+
+    /// Makes replacement (possibly null) take node's place under its parent.
+    void transplant(const Node<Type>* node, Node<Type>* replacement) noexcept {
+        if (node->parent == nullptr)
+            root_ = replacement;
+        else if (node == node->parent->left)
+            node->parent->left = replacement;
+        else
+            node->parent->right = replacement;
+
+        if (replacement != nullptr)
+            replacement->parent = node->parent;
+    }
+
+
+    /// Lifts node->right above node.
+    void rotateLeft(Node<Type>* node) noexcept {
+        Node<Type>* pivot = node->right;
+        node->right = pivot->left;
+        if (pivot->left != nullptr)
+            pivot->left->parent = node;
+        transplant(node, pivot);
+        pivot->left = node;
+        node->parent = pivot;
+    }
+
+    /// Lifts node->left above node.
+    void rotateRight(Node<Type>* node) noexcept {
+        Node<Type>* pivot = node->left;
+        node->left = pivot->right;
+        if (pivot->right != nullptr)
+            pivot->right->parent = node;
+        transplant(node, pivot);
+        pivot->right = node;
+        node->parent = pivot;
+    }
+
+
+    /**
+     * Restores the red-black invariants after a red leaf has been linked in.
+     *
+     * Recolours while the uncle is red (moving the violation two levels up),
+     * then finishes with at most two rotations.
+     *
+     * @complexity Time: O(log n); Space: O(1).
+     */
+    void insertFixup(Node<Type>* node) noexcept {
+        while (isRed(node->parent)) {
+            Node<Type>* parent = node->parent;
+            Node<Type>* grandparent = parent->parent;
+
+            if (parent == grandparent->left) {
+                Node<Type>* uncle = grandparent->right;
+                if (isRed(uncle)) {
+                    setRed(parent, false);
+                    setRed(uncle, false);
+                    setRed(grandparent, true);
+                    node = grandparent;
+                    continue;
+                }
+                if (node == parent->right) {
+                    rotateLeft(parent);
+                    parent = node;
+                }
+                setRed(parent, false);
+                setRed(grandparent, true);
+                rotateRight(grandparent);
+                break;
+            } else {
+                Node<Type>* uncle = grandparent->left;
+                if (isRed(uncle)) {
+                    setRed(parent, false);
+                    setRed(uncle, false);
+                    setRed(grandparent, true);
+                    node = grandparent;
+                    continue;
+                }
+                if (node == parent->left) {
+                    rotateRight(parent);
+                    parent = node;
+                }
+                setRed(parent, false);
+                setRed(grandparent, true);
+                rotateLeft(grandparent);
+                break;
+            }
+        }
+        setRed(root_, false);
+    }
+
+
+    /**
+     * Restores the red-black invariants after a black node was unlinked.
+     *
+     * `node` carries an extra black and may be null, which is why its parent
+     * is passed separately. At most three rotations are performed.
+     *
+     * @complexity Time: O(log n); Space: O(1).
+     */
+    void eraseFixup(Node<Type>* node, Node<Type>* parent) noexcept {
+        while (node != root_ && !isRed(node)) {
+            if (node == parent->left) {
+                Node<Type>* sibling = parent->right;
+                if (isRed(sibling)) {
+                    setRed(sibling, false);
+                    setRed(parent, true);
+                    rotateLeft(parent);
+                    sibling = parent->right;
+                }
+                if (!isRed(sibling->left) && !isRed(sibling->right)) {
+                    setRed(sibling, true);
+                    node = parent;
+                    parent = node->parent;
+                    continue;
+                }
+                if (!isRed(sibling->right)) {
+                    setRed(sibling->left, false);
+                    setRed(sibling, true);
+                    rotateRight(sibling);
+                    sibling = parent->right;
+                }
+                setRed(sibling, isRed(parent));
+                setRed(parent, false);
+                setRed(sibling->right, false);
+                rotateLeft(parent);
+            } else {
+                Node<Type>* sibling = parent->left;
+                if (isRed(sibling)) {
+                    setRed(sibling, false);
+                    setRed(parent, true);
+                    rotateRight(parent);
+                    sibling = parent->left;
+                }
+                if (!isRed(sibling->left) && !isRed(sibling->right)) {
+                    setRed(sibling, true);
+                    node = parent;
+                    parent = node->parent;
+                    continue;
+                }
+                if (!isRed(sibling->left)) {
+                    setRed(sibling->right, false);
+                    setRed(sibling, true);
+                    rotateLeft(sibling);
+                    sibling = parent->left;
+                }
+                setRed(sibling, isRed(parent));
+                setRed(parent, false);
+                setRed(sibling->left, false);
+                rotateRight(parent);
+            }
+            node = root_;
+        }
+        if (node != nullptr)
+            setRed(node, false);
+    }
+
+
+    /// Unlinks node, rebalances and destroys it.
+    void eraseNode(Node<Type>* node) noexcept {
+        Node<Type>* child;
+        Node<Type>* child_parent;
+        bool removed_red = isRed(node);
+
+        if (node->left == nullptr) {
+            child = node->right;
+            child_parent = node->parent;
+            transplant(node, child);
+        } else if (node->right == nullptr) {
+            child = node->left;
+            child_parent = node->parent;
+            transplant(node, child);
+        } else {
+            // The successor takes node's place and color; the fixup concerns
+            // the spot the successor left behind.
+            Node<Type>* successor = minNode(node->right);
+            removed_red = isRed(successor);
+            child = successor->right;
+
+            if (successor->parent == node) {
+                child_parent = successor;
+            } else {
+                child_parent = successor->parent;
+                transplant(successor, child);
+                successor->right = node->right;
+                successor->right->parent = successor;
+            }
+            transplant(node, successor);
+            successor->left = node->left;
+            successor->left->parent = successor;
+            setRed(successor, isRed(node));
+        }
+
+        nodes_.destroy(static_cast<RBNode*>(node));
+        --size_;
+        if (!removed_red)
+            eraseFixup(child, child_parent);
+    }
+
+
+    /// Node holding an element equal to key, or nullptr.
+    template <typename K>
+    const Node<Type>* findNode(const K& key) const {
+        const Node<Type>* current = root_;
+        while (current != nullptr) {
+            if (compare_(key, current->data))
+                current = current->left;
+            else if (compare_(current->data, key))
+                current = current->right;
+            else
+                return current;
+        }
+        return nullptr;
+    }
+
+    /// First node not less than key, or nullptr.
+    template <typename K>
+    const Node<Type>* lowerBoundNode(const K& key) const {
+        const Node<Type>* result = nullptr;
+        for (const Node<Type>* current = root_; current != nullptr;) {
+            if (!compare_(current->data, key)) {
+                result = current;
+                current = current->left;
+            } else {
+                current = current->right;
+            }
+        }
+        return result;
+    }
+
+    /// First node greater than key, or nullptr.
+    template <typename K>
+    const Node<Type>* upperBoundNode(const K& key) const {
+        const Node<Type>* result = nullptr;
+        for (const Node<Type>* current = root_; current != nullptr;) {
+            if (compare_(key, current->data)) {
+                result = current;
+                current = current->left;
+            } else {
+                current = current->right;
+            }
+        }
+        return result;
+    }
+
+
+    /// Destroys a detached subtree without recursion, see BinaryTree.
+    void destroySubtree(Node<Type>* node) noexcept {
+        while (node != nullptr) {
+            if (Node<Type>* left = node->left; left != nullptr) {
+                node->left = left->right;
+                left->right = node;
+                node = left;
+            } else {
+                Node<Type>* right = node->right;
+                nodes_.destroy(static_cast<RBNode*>(node));
+                node = right;
+            }
+        }
+    }
+
+
+    /// Copies a subtree with its colors; the recursion depth is the tree
+    /// height, which is O(log n) here.
+    Node<Type>* copySubtree(const Node<Type>* other, Node<Type>* parent) {
+        if (other == nullptr)
+            return nullptr;
+
+        RBNode* node = nodes_.create(other->data);
+        node->red = isRed(other);
+        node->parent = parent;
+        try {
+            node->left = copySubtree(other->left, node);
+            node->right = copySubtree(other->right, node);
+        } catch (...) {
+            destroySubtree(node);
+            throw;
+        }
+        return node;
+    }
+
+
+    /// Black height of a subtree, or 0 if it breaks a red-black invariant.
+    size_t checkedBlackHeight(const Node<Type>* node, const Node<Type>* parent) const {
+        if (node == nullptr)
+            return 1;
+        if (node->parent != parent || (isRed(node) && isRed(parent)))
+            return 0;
+        if (node->left != nullptr && !compare_(node->left->data, node->data))
+            return 0;
+        if (node->right != nullptr && !compare_(node->data, node->right->data))
+            return 0;
+
+        const size_t left = checkedBlackHeight(node->left, node);
+        const size_t right = checkedBlackHeight(node->right, node);
+        if (left == 0 || left != right)
+            return 0;
+        return left + (isRed(node) ? 0 : 1);
+    }
+
+
+    static size_t subtreeHeight(const Node<Type>* node) noexcept {
+        if (node == nullptr)
+            return 0;
+        return 1 + std::max(subtreeHeight(node->left), subtreeHeight(node->right));
+    }
+
+
+  public:
+    /**
+     * @class const_iterator
+     *
+     * Bidirectional in-order iterator. Elements are read-only, since changing
+     * one could break the ordering. Decrementing end() yields the greatest
+     * element.
+     */
+    class const_iterator {
+        friend class RedBlackTree;
+
+        const RedBlackTree* tree_;
+        const Node<Type>* current_;
+
+        const_iterator(const RedBlackTree* tree, const Node<Type>* node)
+            : tree_(tree), current_(node) {}
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type*;
+        using reference = const Type&;
+
+        /// Default constructor
+        const_iterator() : tree_(nullptr), current_(nullptr) {}
+
+        const Type& operator*() const { return current_->data; }
+
+        const Type* operator->() const { return &current_->data; }
+
+        const_iterator& operator++() {
+            current_ = nextNode(current_);
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        const_iterator& operator--() {
+            if (current_ == nullptr)
+                current_ = maxNode(tree_->root_);
+            else
+                current_ = prevNode(current_);
+            return *this;
+        }
+
+        const_iterator operator--(int) {
+            const_iterator temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return current_ == other.current_;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return current_ != other.current_;
+        }
+    };
+
+    /// Elements cannot be modified in place, so both iterators are const.
+    using iterator = const_iterator;
+
+
+    /// A [first, last) slice of the tree, usable in range-based for loops.
+    struct Range {
+        const_iterator first;
+        const_iterator last;
+
+        [[nodiscard]] const_iterator begin() const { return first; }
+        [[nodiscard]] const_iterator end() const { return last; }
+        [[nodiscard]] bool isEmpty() const { return first == last; }
+    };
+
+
+    /// Default constructor
+    RedBlackTree() noexcept(std::is_nothrow_default_constructible_v<Compare>) = default;
+
+    /// Creates an empty tree ordered by compare.
+    explicit RedBlackTree(const Compare& compare) : compare_(compare) {}
+
+    /// Constructor for braced-init-lists
+    RedBlackTree(std::initializer_list<Type> initial_data) {
+        for (const Type& element : initial_data)
+            insert(element);
+    }
+
+    /**
+     * Constructs the tree from an array of elements; duplicates are dropped.
+     *
+     * @param array Pointer to the elements to insert.
+     * @param size The number of elements in the array.
+     */
+    RedBlackTree(const Type* array, const size_t size) {
+        for (size_t i = 0; i < size; ++i)
+            insert(array[i]);
+    }
+
+    /// Copy constructor; the copy allocates from a node store of its own.
+    RedBlackTree(const RedBlackTree& other)
+        : root_(nullptr), size_(other.size_), compare_(other.compare_), nodes_() {
+        root_ = copySubtree(other.root_, nullptr);
+    }
+
+    /// Move constructor
+    RedBlackTree(RedBlackTree&& other) noexcept
+        : root_(std::exchange(other.root_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          compare_(std::move(other.compare_)),
+          nodes_(std::move(other.nodes_)) {}
+
+    /// Copy assignment operator
+    RedBlackTree& operator=(const RedBlackTree& other) {
+        if (this == &other)
+            return *this;
+
+        // Copy aside first: clear() may release the slabs of a pooled store.
+        RedBlackTree copy(other);
+        return *this = std::move(copy);
+    }
+
+    /// Move assignment operator
+    RedBlackTree& operator=(RedBlackTree&& other) noexcept {
+        if (this == &other)
+            return *this;
+
+        clear();
+        root_ = std::exchange(other.root_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        compare_ = std::move(other.compare_);
+        nodes_ = std::move(other.nodes_);
+        return *this;
+    }
+
+
+    /// Returns whether the tree holds no elements.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of elements.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Returns the root node, or nullptr for an empty tree.
+    [[nodiscard]]
+    const Node<Type>* getRoot() const noexcept {
+        return root_;
+    }
+
+    /**
+     * Returns the number of levels; at most 2 * log2(n + 1).
+     * @complexity Time: O(n); Space: O(log n).
+     */
+    [[nodiscard]]
+    size_t getHeight() const noexcept {
+        return subtreeHeight(root_);
+    }
+
+
+    /**
+     * @brief Verify the ordering and every red-black invariant.
+     *
+     * Checks that the root is black, no red node has a red child, every
+     * root-to-leaf path has the same number of black nodes, parent pointers
+     * are consistent and the in-order sequence is strictly increasing.
+     */
+    [[nodiscard]]
+    bool isValidRedBlackTree() const {
+        if (isRed(root_))
+            return false;
+        return checkedBlackHeight(root_, nullptr) != 0;
+    }
+
+
+    /**
+     * @brief Insert a value unless an equal one is already present.
+     *
+     * @tparam U A type that can construct `Type` (perfect-forwarded).
+     * @param element The value to insert.
+     * @return An iterator to the element with that value, and whether the
+     * insertion took place.
+     *
+     * @complexity Time: O(log n); Space: O(1).
+     */
+    template <typename U>
+    std::pair<iterator, bool> insert(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+
+        Node<Type>* parent = nullptr;
+        bool go_left = false;
+        for (Node<Type>* current = root_; current != nullptr;) {
+            parent = current;
+            if (compare_(element, current->data)) {
+                go_left = true;
+                current = current->left;
+            } else if (compare_(current->data, element)) {
+                go_left = false;
+                current = current->right;
+            } else {
+                return {iterator(this, current), false};
+            }
+        }
+
+        Node<Type>* node = nodes_.create(std::forward<U>(element));
+        node->parent = parent;
+        if (parent == nullptr)
+            root_ = node;
+        else if (go_left)
+            parent->left = node;
+        else
+            parent->right = node;
+
+        ++size_;
+        insertFixup(node);
+        return {iterator(this, node), true};
+    }
+
+
+    /**
+     * @brief Remove the element equal to key, if present.
+     * @return true if an element was removed.
+     * @complexity Time: O(log n); Space: O(1).
+     */
+    bool remove(const Type& key) {
+        const Node<Type>* node = findNode(key);
+        if (node == nullptr)
+            return false;
+        eraseNode(const_cast<Node<Type>*>(node));
+        return true;
+    }
+
+    /// Heterogeneous overload of remove() for transparent comparators.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    bool remove(const K& key) {
+        const Node<Type>* node = findNode(key);
+        if (node == nullptr)
+            return false;
+        eraseNode(const_cast<Node<Type>*>(node));
+        return true;
+    }
+
+
+    /**
+     * @brief Remove the element at position.
+     * @param position A valid, dereferenceable iterator into this tree.
+     * @return An iterator to the element that followed the removed one.
+     * @complexity Time: O(log n); Space: O(1).
+     */
+    iterator erase(const_iterator position) {
+        const Node<Type>* node = position.current_;
+        const_iterator next(this, nextNode(node));
+        eraseNode(const_cast<Node<Type>*>(node));
+        return next;
+    }
+
+
+    /// @brief Check whether an element equal to key exists.
+    [[nodiscard]]
+    bool contains(const Type& key) const {
+        return findNode(key) != nullptr;
+    }
+
+    /// Heterogeneous overload of contains() for transparent comparators.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    [[nodiscard]]
+    bool contains(const K& key) const {
+        return findNode(key) != nullptr;
+    }
+
+
+    /// @brief Returns an iterator to the element equal to key, or end().
+    [[nodiscard]]
+    const_iterator find(const Type& key) const {
+        return const_iterator(this, findNode(key));
+    }
+
+    /// Heterogeneous overload of find() for transparent comparators.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    [[nodiscard]]
+    const_iterator find(const K& key) const {
+        return const_iterator(this, findNode(key));
+    }
+
+
+    /// @brief Returns an iterator to the first element not less than key.
+    [[nodiscard]]
+    const_iterator lowerBound(const Type& key) const {
+        return const_iterator(this, lowerBoundNode(key));
+    }
+
+    /// Heterogeneous overload of lowerBound() for transparent comparators.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    [[nodiscard]]
+    const_iterator lowerBound(const K& key) const {
+        return const_iterator(this, lowerBoundNode(key));
+    }
+
+
+    /// @brief Returns an iterator to the first element greater than key.
+    [[nodiscard]]
+    const_iterator upperBound(const Type& key) const {
+        return const_iterator(this, upperBoundNode(key));
+    }
+
+    /// Heterogeneous overload of upperBound() for transparent comparators.
+    template <typename K>
+        requires is_lookup_key_v<K>
+    [[nodiscard]]
+    const_iterator upperBound(const K& key) const {
+        return const_iterator(this, upperBoundNode(key));
+    }
+
+
+    /**
+     * @brief The elements in the half-open interval [low, high).
+     *
+     * Empty when high is not greater than low. Iterating the result costs
+     * O(log n + k) for k elements.
+     */
+    template <typename K = Type>
+        requires is_lookup_key_v<K>
+    [[nodiscard]]
+    Range range(const K& low, const K& high) const {
+        if (!compare_(low, high))
+            return Range{end(), end()};
+        return Range{lowerBound(low), lowerBound(high)};
+    }
+
+
+    /**
+     * @brief Return the smallest value in the tree.
+     * @throws std::runtime_error if the tree is empty.
+     */
+    [[nodiscard]]
+    const Type& findMinimum() const {
+        if (isEmpty())
+            throw std::runtime_error("Tree is empty");
+        return minNode(root_)->data;
+    }
+
+    /**
+     * @brief Return the greatest value in the tree.
+     * @throws std::runtime_error if the tree is empty.
+     */
+    [[nodiscard]]
+    const Type& findMaximum() const {
+        if (isEmpty())
+            throw std::runtime_error("Tree is empty");
+        return maxNode(root_)->data;
+    }
+
+
+    [[nodiscard]]
+    const_iterator begin() const {
+        return const_iterator(this, root_ == nullptr ? nullptr : minNode(root_));
+    }
+
+    [[nodiscard]]
+    const_iterator end() const {
+        return const_iterator(this, nullptr);
+    }
+
+
+    /**
+     * Removes every element. Nodes are destroyed iteratively; with
+     * PooledNodes the slabs are released as a whole.
+     *
+     * Exception safety: No-throw.
+     */
+    void clear() noexcept {
+        using Store = node_pool_detail::NodeStore<RBNode, NodePolicy>;
+        if constexpr (!Store::RELEASES_IN_BULK || !std::is_trivially_destructible_v<RBNode>)
+            destroySubtree(root_);
+        nodes_.releaseAll();
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+
+    ~RedBlackTree() noexcept { clear(); }
+};
+
+} // namespace containers
+
+#endif // REDBLACKTREE_HPP
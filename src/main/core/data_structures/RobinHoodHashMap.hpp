@@ -0,0 +1,700 @@
+#ifndef ROBIN_HOOD_HASH_MAP_HPP
+#define ROBIN_HOOD_HASH_MAP_HPP
+
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "DefaultHash.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/** @struct ProbeStatistics
+ *
+ * @brief Summary of how far stored keys sit from their home bucket.
+ *
+ * The displacement of a key is the number of buckets between the bucket its
+ * hash selects and the bucket it actually occupies; a lookup for that key
+ * inspects displacement + 1 buckets.
+ */
+struct ProbeStatistics {
+    size_t max_displacement = 0;
+    double mean_displacement = 0.0;
+};
+
+
+/** @class RobinHoodHashMap
+ * @brief An open-addressing hash map using Robin Hood hashing with
+ * backward-shift deletion.
+ *
+ * Collisions are resolved by linear probing, but an inserted key that has
+ * travelled further from its home bucket than the current occupant takes the
+ * bucket and the occupant continues probing ("take from the rich"). This keeps
+ * displacements short and nearly uniform, and lets lookups stop as soon as they
+ * meet a bucket whose occupant is closer to home than the probed key would be.
+ *
+ * Removal never leaves tombstones: the following cluster is shifted one bucket
+ * back until an empty bucket or a key that already sits at home is reached.
+ * Probe lengths therefore stay bounded under long insert/remove churn, without
+ * waiting for a rehash.
+ *
+ * The public interface mirrors HashMap, plus probeStatistics().
+ *
+ * @par Complexity
+ * - O(1) expected time for insert, lookup and remove.
+ * - Expected maximum displacement O(log n) at a fixed load factor.
+ *
+ * @tparam Key The type of the keys in the map.
+ * @tparam Value The type of the values in the map.
+ * @tparam Hash A hash functor for the key type. Defaults to DefaultHash<Key>.
+ * @tparam LoadFactorPercent The maximum load factor percentage before resizing.
+ * Defaults to 70.
+ */
+template <typename Key, typename Value, typename Hash = DefaultHash<Key>,
+          size_t LoadFactorPercent = 70>
+class RobinHoodHashMap {
+    static_assert(LoadFactorPercent > 0 && LoadFactorPercent < 100,
+                  "LoadFactorPercent must be between 1 and 99.");
+
+    static_assert(std::is_move_constructible_v<Key> && std::is_move_assignable_v<Key> &&
+                  std::is_move_constructible_v<Value> && std::is_move_assignable_v<Value>,
+                  "RobinHoodHashMap relocates entries and requires movable keys and values.");
+
+
+    /** @struct Bucket
+     *
+     * @brief Represents a single bucket in the hash map.
+     *
+     * `distance` is 0 for an empty bucket and displacement + 1 for an occupied
+     * one, so a single field encodes both the state and the probe length.
+     */
+    struct Bucket {
+        alignas(Key) unsigned char key_storage[sizeof(Key)]{};
+        alignas(Value) unsigned char value_storage[sizeof(Value)]{};
+
+        std::uint32_t distance;
+
+        /// Default constructor initializes the bucket to the empty state.
+        Bucket() : distance(0) {}
+
+        /// Returns a pointer to the key stored in the bucket.
+        Key* key() { return std::launder(reinterpret_cast<Key*>(key_storage)); }
+
+        /// Returns a const pointer to the key stored in the bucket.
+        const Key* key() const {
+            return std::launder(reinterpret_cast<const Key*>(key_storage));
+        }
+
+        /// Returns a pointer to the value stored in the bucket.
+        Value* value() {
+            return std::launder(reinterpret_cast<Value*>(value_storage));
+        }
+
+        /// Returns a const pointer to the value stored in the bucket.
+        const Value* value() const {
+            return std::launder(reinterpret_cast<const Value*>(value_storage));
+        }
+
+        /// Returns true if the bucket holds a key-value pair.
+        [[nodiscard]]
+        bool occupied() const noexcept { return distance != 0; }
+
+
+        /**
+         * @brief Constructs a key-value pair in the bucket.
+         *
+         * @tparam K The type of the key (can be a reference or rvalue).
+         * @tparam V The type of the value (can be a reference or rvalue).
+         * @param k The key to be constructed.
+         * @param v The value to be constructed.
+         * @param dist The probe distance (displacement + 1) of the new pair.
+         */
+        template <typename K, typename V>
+        void construct(K&& k, V&& v, const std::uint32_t dist) {
+            new (key_storage) Key(std::forward<K>(k));
+            try {
+                new (value_storage) Value(std::forward<V>(v));
+            } catch (...) {
+                key()->~Key();
+                throw;
+            }
+            distance = dist;
+        }
+
+        /// Destroys the key and value in the bucket if occupied.
+        void destroy() noexcept {
+            if (distance != 0) {
+                key()->~Key();
+                value()->~Value();
+                distance = 0;
+            }
+        }
+    };
+
+
+    Bucket* buckets_;
+    size_t size_;
+    size_t capacity_;
+    Hash hasher_;
+
+    static constexpr float LOAD_FACTOR =
+        static_cast<float>(LoadFactorPercent) / 100.0f;
+    static constexpr size_t DEFAULT_CAPACITY = 8;
+
+
+    /// Computes the next capacity (double the current).
+    static size_t nextCapacity(const size_t current) {
+        return current == 0 ? DEFAULT_CAPACITY : current * 2;
+    }
+
+    /// Rounds up to the next power of two.
+    static size_t roundUpToPowerOfTwo(const size_t n) {
+        size_t cap = 1;
+        while (cap < n)
+            cap <<= 1;
+        return cap;
+    }
+
+    /// Computes the home bucket for a given key.
+    size_t indexFor(const Key& key) const {
+        return hasher_(key) & (capacity_ - 1);
+    }
+
+
+    /**
+     * @brief Locates the bucket holding the given key.
+     *
+     * Probing stops early at the first bucket whose occupant is closer to its
+     * home than the key would be at that position: by the Robin Hood
+     * invariant the key cannot appear further along.
+     *
+     * @return size_t The bucket index, or capacity_ if the key is absent.
+     */
+    size_t findIndex(const Key& key) const {
+        if (size_ == 0)
+            return capacity_;
+
+        size_t idx = indexFor(key);
+        for (std::uint32_t dist = 1;; ++dist) {
+            const Bucket& bucket = buckets_[idx];
+            if (bucket.distance < dist)
+                return capacity_;
+            // Equal keys share a home bucket, hence also the probe distance.
+            if (bucket.distance == dist && *bucket.key() == key)
+                return idx;
+            idx = (idx + 1) & (capacity_ - 1);
+        }
+    }
+
+
+    /**
+     * @brief Places an entry that is known to be absent from the table.
+     *
+     * Walks forward from `idx` with probe distance `dist`, swapping the
+     * carried entry with any occupant that is closer to its home, until an
+     * empty bucket is reached.
+     */
+    void placeDisplaced(size_t idx, std::uint32_t dist, Key&& key, Value&& value) {
+        while (true) {
+            Bucket& bucket = buckets_[idx];
+            if (!bucket.occupied()) {
+                bucket.construct(std::move(key), std::move(value), dist);
+                return;
+            }
+            if (bucket.distance < dist) {
+                using std::swap;
+                swap(key, *bucket.key());
+                swap(value, *bucket.value());
+                swap(dist, bucket.distance);
+            }
+            ++dist;
+            idx = (idx + 1) & (capacity_ - 1);
+        }
+    }
+
+
+    /**
+     * @brief Inserts a new pair or locates the existing one.
+     *
+     * Entries displaced by the new pair move further along; the new pair
+     * itself stays where it was placed.
+     *
+     * @return std::pair<size_t, bool> The bucket that holds the key and
+     * whether an insertion took place.
+     */
+    template <typename K, typename V>
+    std::pair<size_t, bool> insertOrFind(K&& key, V&& value) {
+        size_t idx = indexFor(key);
+        for (std::uint32_t dist = 1;; ++dist) {
+            Bucket& bucket = buckets_[idx];
+
+            if (!bucket.occupied()) {
+                bucket.construct(std::forward<K>(key), std::forward<V>(value), dist);
+                ++size_;
+                return {idx, true};
+            }
+
+            if (bucket.distance == dist && *bucket.key() == key)
+                return {idx, false};
+
+            if (bucket.distance < dist) {
+                // Steal the bucket: the current occupant moves on.
+                Key carried_key(std::move(*bucket.key()));
+                Value carried_value(std::move(*bucket.value()));
+                const std::uint32_t carried_dist = bucket.distance;
+                bucket.destroy();
+                try {
+                    bucket.construct(std::forward<K>(key), std::forward<V>(value), dist);
+                } catch (...) {
+                    bucket.construct(std::move(carried_key), std::move(carried_value),
+                                     carried_dist);
+                    throw;
+                }
+                ++size_;
+                placeDisplaced((idx + 1) & (capacity_ - 1), carried_dist + 1,
+                               std::move(carried_key), std::move(carried_value));
+                return {idx, true};
+            }
+
+            idx = (idx + 1) & (capacity_ - 1);
+        }
+    }
+
+
+    /**
+     * @brief Rehashes the hash map to a new capacity.
+     *
+     * @param new_capacity The new capacity for the hash map.
+     */
+    void rehash(const size_t new_capacity) {
+        RobinHoodHashMap grown(new_capacity);
+        grown.hasher_ = hasher_;
+
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (buckets_[i].occupied()) {
+                grown.placeDisplaced(grown.indexFor(*buckets_[i].key()), 1,
+                                     std::move(*buckets_[i].key()),
+                                     std::move(*buckets_[i].value()));
+                ++grown.size_;
+            }
+        }
+
+        swap(grown);
+    }
+
+
+    /// Ensures the hash map has enough capacity, resizing if necessary.
+    void ensureCapacity() {
+        if ((size_ + 1) > static_cast<size_t>(static_cast<float>(capacity_) * LOAD_FACTOR))
+            rehash(nextCapacity(capacity_));
+    }
+
+
+    /// Removes the pair in bucket idx and closes the gap by backward shifting.
+    void eraseAt(size_t idx) {
+        buckets_[idx].destroy();
+
+        size_t next = (idx + 1) & (capacity_ - 1);
+        while (buckets_[next].distance > 1) {
+            Bucket& from = buckets_[next];
+            buckets_[idx].construct(std::move(*from.key()), std::move(*from.value()),
+                                    from.distance - 1);
+            from.destroy();
+            idx = next;
+            next = (next + 1) & (capacity_ - 1);
+        }
+        --size_;
+    }
+
+
+  public:
+    /// Default constructor initializes the hash map with default capacity.
+    RobinHoodHashMap()
+        : buckets_(new Bucket[DEFAULT_CAPACITY]), size_(0),
+          capacity_(DEFAULT_CAPACITY), hasher_() {}
+
+    /// Constructor with specified initial capacity.
+    explicit RobinHoodHashMap(const size_t capacity)
+        : buckets_(nullptr), size_(0), capacity_(roundUpToPowerOfTwo(capacity)),
+          hasher_() {
+        buckets_ = new Bucket[capacity_];
+    }
+
+    /// Copy constructor.
+    RobinHoodHashMap(const RobinHoodHashMap& other)
+        : buckets_(nullptr), size_(0), capacity_(other.capacity_),
+          hasher_(other.hasher_) {
+        if (capacity_ == 0)
+            return;
+
+        buckets_ = new Bucket[capacity_];
+        try {
+            for (size_t i = 0; i < capacity_; ++i) {
+                const Bucket& src = other.buckets_[i];
+                if (src.occupied()) {
+                    buckets_[i].construct(*src.key(), *src.value(), src.distance);
+                    ++size_;
+                }
+            }
+        } catch (...) {
+            for (size_t i = 0; i < capacity_; ++i)
+                buckets_[i].destroy();
+            delete[] buckets_;
+            throw;
+        }
+    }
+
+    /// Move constructor.
+    RobinHoodHashMap(RobinHoodHashMap&& other) noexcept
+        : buckets_(other.buckets_), size_(other.size_),
+          capacity_(other.capacity_), hasher_(std::move(other.hasher_)) {
+        other.buckets_ = nullptr;
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    /// Copy-and-swap assignment operator.
+    RobinHoodHashMap& operator=(RobinHoodHashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    /// Destructor cleans up allocated resources.
+    ~RobinHoodHashMap() {
+        clear();
+        delete[] buckets_;
+    }
+
+
+    /// Swaps the contents of this hash map with another.
+    void swap(RobinHoodHashMap& other) noexcept {
+        std::swap(buckets_, other.buckets_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(hasher_, other.hasher_);
+    }
+
+    /// Checks if the hash map is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of key-value pairs in the hash map.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Returns the number of buckets currently allocated.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /// Clears the hash map, removing all key-value pairs.
+    void clear() noexcept {
+        for (size_t i = 0; i < capacity_; ++i)
+            buckets_[i].destroy();
+        size_ = 0;
+    }
+
+
+    /**
+     * @brief Inserts or updates a key-value pair in the hash map.
+     *
+     * If the key already exists, its value is updated in place, without
+     * resizing. Otherwise the pair is inserted with Robin Hood displacement,
+     * resizing first if necessary.
+     *
+     * @tparam K The type of the key (can be a reference or rvalue).
+     * @tparam V The type of the value (can be a reference or rvalue).
+     *
+     * @param key The key to be inserted or updated.
+     * @param value The value to be associated with the key.
+     */
+    template <typename K, typename V>
+    void insert(K&& key, V&& value) {
+        // Updating an existing key must not grow the table.
+        if (const size_t idx = findIndex(key); idx != capacity_) {
+            *buckets_[idx].value() = std::forward<V>(value);
+            return;
+        }
+
+        ensureCapacity();
+        insertOrFind(std::forward<K>(key), std::forward<V>(value));
+    }
+
+
+    /**
+     * @brief Accesses the value associated with the given key.
+     *
+     * @param key The key whose associated value is to be accessed.
+     * @return Value& A reference to the value associated with the key.
+     *
+     * @throws std::out_of_range If the key is not found in the hash map.
+     */
+    Value& at(const Key& key) {
+        const size_t idx = findIndex(key);
+        if (idx == capacity_)
+            throw std::out_of_range("Key not found");
+        return *buckets_[idx].value();
+    }
+
+
+    /**
+     * @brief Accesses the value associated with the given key (const version).
+     *
+     * @param key The key whose associated value is to be accessed.
+     * @return const Value& A const reference to the value associated with the
+     * key.
+     *
+     * @throws std::out_of_range If the key is not found in the hash map.
+     */
+    const Value& at(const Key& key) const {
+        const size_t idx = findIndex(key);
+        if (idx == capacity_)
+            throw std::out_of_range("Key not found");
+        return *buckets_[idx].value();
+    }
+
+
+    /**
+     * @brief Accesses or inserts a default-constructed value for the given key.
+     *
+     * @tparam K The type of the key (perfect-forwarded).
+     * @param key The key to look up or insert.
+     * @return Value& Reference to the associated value.
+     */
+    template <typename K>
+    Value& operator[](K&& key) {
+        if (const size_t idx = findIndex(key); idx != capacity_)
+            return *buckets_[idx].value();
+
+        ensureCapacity();
+        return *buckets_[insertOrFind(std::forward<K>(key), Value{}).first].value();
+    }
+
+
+    /**
+     * @brief Removes the key-value pair associated with the given key.
+     *
+     * The gap is closed by shifting the following cluster back by one bucket,
+     * so no tombstone is left behind.
+     *
+     * @param key The key to be removed from the hash map.
+     * @return true If the key was found and removed.
+     * @return false If the key was not found in the hash map.
+     */
+    bool remove(const Key& key) {
+        const size_t idx = findIndex(key);
+        if (idx == capacity_)
+            return false;
+        eraseAt(idx);
+        return true;
+    }
+
+
+    /**
+     * @brief Checks if the hash map contains the given key.
+     *
+     * @param key The key to be checked for existence in the hash map.
+     * @return true If the key exists in the hash map.
+     * @return false If the key does not exist in the hash map.
+     */
+    bool contains(const Key& key) const {
+        return findIndex(key) != capacity_;
+    }
+
+
+    /**
+     * @brief Computes the displacement statistics of the stored keys.
+     *
+     * Scans every bucket, so it is intended for diagnostics and tuning rather
+     * than for hot paths.
+     *
+     * @return ProbeStatistics The maximum and mean displacement (0 when empty).
+     */
+    [[nodiscard]]
+    ProbeStatistics probeStatistics() const noexcept {
+        ProbeStatistics stats;
+        size_t total = 0;
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (!buckets_[i].occupied())
+                continue;
+            const size_t displacement = buckets_[i].distance - 1;
+            total += displacement;
+            if (displacement > stats.max_displacement)
+                stats.max_displacement = displacement;
+        }
+        if (size_ != 0)
+            stats.mean_displacement =
+                static_cast<double>(total) / static_cast<double>(size_);
+        return stats;
+    }
+
+
+    /**
+     * @class iterator
+     * @brief Forward iterator for traversing the occupied buckets.
+     */
+    class iterator {
+      private:
+        friend class RobinHoodHashMap;
+        friend class const_iterator;
+
+        RobinHoodHashMap* map_;
+        size_t idx_;
+
+        /// Advances the index to the next occupied bucket (or to capacity).
+        void advanceToNextOccupied() {
+            while (idx_ < map_->capacity_ && !map_->buckets_[idx_].occupied())
+                ++idx_;
+        }
+
+      public:
+        /// Proxy structure for arrow (->) operator support with structured bindings
+        struct Proxy {
+            std::pair<const Key&, Value&> pair_ref;
+            std::pair<const Key&, Value&>* operator->() { return &pair_ref; }
+        };
+
+        /// Constructs an iterator pointing to the first occupied bucket starting from idx.
+        iterator(RobinHoodHashMap* map, const size_t idx) : map_(map), idx_(idx) {
+            advanceToNextOccupied();
+        }
+
+        /// Returns references to the key and value of the current bucket.
+        std::pair<const Key&, Value&> operator*() const {
+            return { *map_->buckets_[idx_].key(), *map_->buckets_[idx_].value() };
+        }
+
+        /// Arrow operator returns a proxy object for structured binding support.
+        Proxy operator->() const {
+            return Proxy{ **this };
+        }
+
+        /// Pre-increment operator advances the iterator to the next occupied bucket.
+        iterator& operator++() {
+            ++idx_;
+            advanceToNextOccupied();
+            return *this;
+        }
+
+        /// Post-increment operator advances the iterator and returns the
+        /// previous position.
+        iterator operator++(int) {
+            iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// Equality operator checks if two iterators point to the same bucket.
+        bool operator==(const iterator& other) const {
+            return map_ == other.map_ && idx_ == other.idx_;
+        }
+
+        /// Inequality operator checks if two iterators are not equal.
+        bool operator!=(const iterator& other) const {
+            return !(*this == other);
+        }
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+    };
+
+
+    /**
+     * @class const_iterator
+     * @brief Constant forward iterator for the RobinHoodHashMap.
+     */
+    class const_iterator {
+      private:
+        friend class RobinHoodHashMap;
+
+        const RobinHoodHashMap* map_;
+        size_t idx_;
+
+        /// Advances the index to the next occupied bucket (or to capacity).
+        void advanceToNextOccupied() {
+            while (idx_ < map_->capacity_ && !map_->buckets_[idx_].occupied())
+                ++idx_;
+        }
+
+      public:
+        struct Proxy {
+            std::pair<const Key&, const Value&> pair_ref;
+            std::pair<const Key&, const Value&>* operator->() { return &pair_ref; }
+        };
+
+        /// Constructs a const_iterator pointing to the first occupied bucket starting from idx.
+        const_iterator(const RobinHoodHashMap* map, const size_t idx) : map_(map), idx_(idx) {
+            advanceToNextOccupied();
+        }
+
+        /// Constructs a const_iterator from a non-const iterator.
+        explicit const_iterator(const iterator& it) : map_(it.map_), idx_(it.idx_) {}
+
+        /// Returns const references to the key and value of the current bucket.
+        std::pair<const Key&, const Value&> operator*() const {
+            return { *map_->buckets_[idx_].key(), *map_->buckets_[idx_].value() };
+        }
+
+        /// Arrow operator returns a proxy object for structured binding support.
+        Proxy operator->() const {
+            return Proxy{ **this };
+        }
+
+        /// Pre-increment operator advances the iterator to the next occupied bucket.
+        const_iterator& operator++() {
+            ++idx_;
+            advanceToNextOccupied();
+            return *this;
+        }
+
+        /// Post-increment operator advances the iterator and returns the
+        /// previous position.
+        const_iterator operator++(int) {
+            const_iterator temp = *this;
+            ++(*this);
+            return temp;
+        }
+
+        /// Equality operator checks if two const_iterators point to the same bucket.
+        bool operator==(const const_iterator& other) const {
+            return map_ == other.map_ && idx_ == other.idx_;
+        }
+
+        /// Inequality operator checks if two const_iterators are not equal.
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Key, Value>;
+        using difference_type = std::ptrdiff_t;
+    };
+
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, capacity_); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, capacity_); }
+
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+    const_iterator cend() const { return const_iterator(this, capacity_); }
+};
+
+
+} // namespace containers
+
+
+#endif // ROBIN_HOOD_HASH_MAP_HPP
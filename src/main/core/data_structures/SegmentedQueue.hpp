@@ -0,0 +1,321 @@
+#ifndef SEGMENTED_QUEUE_HPP
+#define SEGMENTED_QUEUE_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace segmented_queue_detail {
+
+/// About one page of elements per block, and never fewer than 16.
+template <typename Type>
+constexpr size_t defaultBlockSize() {
+    constexpr size_t per_page = 4096 / sizeof(Type);
+    return per_page < 16 ? 16 : per_page;
+}
+
+} // namespace segmented_queue_detail
+
+
+/**
+ * @class SegmentedQueue
+ * @brief A FIFO queue stored as a chain of fixed-size blocks.
+ *
+ * Unlike `Queue`, which doubles a single ring buffer and moves every element
+ * into it, a full SegmentedQueue just links one more block at the back, so
+ * growth costs one allocation and never copies or moves queued elements.
+ * Elements therefore also keep their address while queued. The block drained
+ * at the front is kept as a spare for the next growth, which lets a queue
+ * that hovers around a block boundary run without allocating; any further
+ * drained blocks are freed at once, so memory follows the queue's size.
+ *
+ * @tparam Type The type of elements stored in the queue.
+ * @tparam BlockSize Elements per block. Defaults to about 4 KiB worth, at
+ * least 16.
+ */
+template <typename Type, size_t BlockSize = segmented_queue_detail::defaultBlockSize<Type>()>
+class SegmentedQueue {
+    static_assert(BlockSize > 0, "BlockSize must be positive");
+
+    struct Block {
+        Block* next = nullptr;
+        alignas(Type) std::byte storage[sizeof(Type) * BlockSize];
+
+        Type* slot(const size_t index) noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage) + index);
+        }
+    };
+
+    Block* head_ = nullptr;   ///< Block holding the front element.
+    Block* tail_ = nullptr;   ///< Block holding the back element.
+    Block* spare_ = nullptr;  ///< One drained block kept for the next growth.
+    size_t head_idx_ = 0;     ///< Index of the front element in head_.
+    size_t tail_idx_ = 0;     ///< One past the back element in tail_.
+    size_t size_ = 0;
+
+
+    Block* acquireBlock() {
+        if (spare_ == nullptr)
+            return new Block;
+        Block* block = spare_;
+        spare_ = nullptr;
+        block->next = nullptr;
+        return block;
+    }
+
+    void releaseBlock(Block* block) noexcept {
+        if (spare_ == nullptr)
+            spare_ = block;
+        else
+            delete block;
+    }
+
+
+    /**
+     * @brief Construct a new element at the back, linking a fresh block when
+     * the tail block is full.
+     *
+     * The element is constructed before the block is linked in, so a
+     * throwing constructor leaves the queue unchanged (strong guarantee).
+     */
+    template <typename... Args>
+    void pushBack(Args&&... args) {
+        if (tail_ != nullptr && tail_idx_ < BlockSize) {
+            ::new (static_cast<void*>(tail_->slot(tail_idx_))) Type(std::forward<Args>(args)...);
+            ++tail_idx_;
+            ++size_;
+            return;
+        }
+
+        Block* block = acquireBlock();
+        try {
+            ::new (static_cast<void*>(block->slot(0))) Type(std::forward<Args>(args)...);
+        } catch (...) {
+            releaseBlock(block);
+            throw;
+        }
+
+        if (tail_ == nullptr)
+            head_ = block;
+        else
+            tail_->next = block;
+        tail_ = block;
+        tail_idx_ = 1;
+        ++size_;
+    }
+
+
+    /// Destroys every element and frees every block, spare included.
+    void release() noexcept {
+        while (size_ > 0)
+            popFront();
+        delete head_;
+        delete spare_;
+        head_ = tail_ = spare_ = nullptr;
+        head_idx_ = tail_idx_ = 0;
+    }
+
+
+    /// Removes the front element of a non-empty queue.
+    void popFront() noexcept {
+        std::destroy_at(head_->slot(head_idx_));
+        ++head_idx_;
+        --size_;
+
+        if (size_ == 0) {
+            // Rewind within the last block instead of freeing it.
+            head_idx_ = tail_idx_ = 0;
+            return;
+        }
+        if (head_idx_ == BlockSize) {
+            Block* drained = head_;
+            head_ = head_->next;
+            head_idx_ = 0;
+            releaseBlock(drained);
+        }
+    }
+
+
+  public:
+    /// Default constructor; allocates nothing until the first enqueue.
+    SegmentedQueue() noexcept = default;
+
+    /// Constructor with initializer list.
+    SegmentedQueue(std::initializer_list<Type> initial_data) {
+        try {
+            for (const auto& item : initial_data)
+                pushBack(item);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /// Copy constructor
+    SegmentedQueue(const SegmentedQueue& other) {
+        try {
+            other.forEach([this](const Type& item) { pushBack(item); });
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /// Move constructor; takes over the blocks.
+    SegmentedQueue(SegmentedQueue&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          spare_(std::exchange(other.spare_, nullptr)),
+          head_idx_(std::exchange(other.head_idx_, 0)),
+          tail_idx_(std::exchange(other.tail_idx_, 0)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    /// Copy assignment operator
+    SegmentedQueue& operator=(const SegmentedQueue& other) {
+        if (this != &other) {
+            SegmentedQueue copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator
+    SegmentedQueue& operator=(SegmentedQueue&& other) noexcept {
+        if (this != &other) {
+            release();
+            head_ = std::exchange(other.head_, nullptr);
+            tail_ = std::exchange(other.tail_, nullptr);
+            spare_ = std::exchange(other.spare_, nullptr);
+            head_idx_ = std::exchange(other.head_idx_, 0);
+            tail_idx_ = std::exchange(other.tail_idx_, 0);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    /// Destructor
+    ~SegmentedQueue() noexcept { release(); }
+
+
+    /// Returns the number of elements in the queue.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the queue is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of elements per block.
+    [[nodiscard]]
+    static constexpr size_t blockSize() noexcept {
+        return BlockSize;
+    }
+
+
+    /**
+     * @brief Enqueue a new element at the back of the queue.
+     *
+     * @complexity O(1); allocates one block every BlockSize elements unless
+     * the spare block can be reused. Never moves queued elements.
+     */
+    template <typename U>
+    void enqueue(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        pushBack(std::forward<U>(element));
+    }
+
+
+    /// Enqueue by constructing the element in place at the back.
+    template <typename... Args>
+    void emplaceBack(Args&&... args) {
+        pushBack(std::forward<Args>(args)...);
+    }
+
+
+    /**
+     * @brief Dequeue (remove) the front element.
+     *
+     * @throws std::out_of_range if the queue is empty.
+     * @complexity O(1).
+     */
+    void dequeue() {
+        if (isEmpty())
+            throw std::out_of_range("Queue is empty");
+        popFront();
+    }
+
+
+    /**
+     * @brief Returns the front element of the queue without removing it.
+     *
+     * @throws std::out_of_range if the queue is empty.
+     */
+    Type& front() {
+        if (isEmpty())
+            throw std::out_of_range("Queue is empty");
+        return *head_->slot(head_idx_);
+    }
+
+    /// Const overload of front().
+    const Type& front() const {
+        return const_cast<SegmentedQueue*>(this)->front();
+    }
+
+
+    /**
+     * @brief Returns the back element of the queue without removing it.
+     *
+     * @throws std::out_of_range if the queue is empty.
+     */
+    Type& back() {
+        if (isEmpty())
+            throw std::out_of_range("Queue is empty");
+        return *tail_->slot(tail_idx_ - 1);
+    }
+
+    /// Const overload of back().
+    const Type& back() const {
+        return const_cast<SegmentedQueue*>(this)->back();
+    }
+
+
+    /// Calls `visit(element)` for every element, front to back.
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        Block* block = head_;
+        size_t index = head_idx_;
+        for (size_t remaining = size_; remaining > 0; --remaining) {
+            if (index == BlockSize) {
+                block = block->next;
+                index = 0;
+            }
+            visit(static_cast<const Type&>(*block->slot(index++)));
+        }
+    }
+
+
+    /// Clears the queue, keeping one block for reuse.
+    void clear() noexcept {
+        while (size_ > 0)
+            popFront();
+    }
+};
+
+} // namespace containers
+
+#endif // SEGMENTED_QUEUE_HPP
@@ -3,6 +3,9 @@
 
 
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
@@ -19,25 +22,48 @@ using std::size_t;
  * @class Stack
  * @brief A LIFO (last-in, first-out) container backed by a resizable contiguous buffer.
  *
- * Implements a classic stack interface on top of DynamicArray<Type>.
+ * Implements a classic stack interface on top of DynamicArray<Type, Allocator,
+ * InlineCapacity, CapacityPolicy>.
+ *
+ * Besides single-element push/pop, bursts can go through pushRange() (one
+ * capacity check for the whole range), pushUnchecked() after reserve(), and
+ * popN(), which never gives memory back. For workloads that repeatedly grow
+ * and drain the stack (e.g. depth-first search), GrowOnlyStack keeps pop()
+ * from shrinking as well, so capacity is reused instead of reallocated.
  *
  * @tparam Type Element type stored by the stack.
+ * @tparam Allocator Allocator of the underlying array. Defaults to
+ * std::allocator<Type>.
+ * @tparam InlineCapacity Number of elements kept inside the object before the
+ * allocator is used. Defaults to 0.
+ * @tparam CapacityPolicy Growth and shrink policy of the underlying array
+ * (see CapacityPolicy.hpp). Defaults to ShrinkWhenSparse<>.
  */
 
-template <typename Type>
+template <typename Type, typename Allocator = std::allocator<Type>,
+          size_t InlineCapacity = 0, typename CapacityPolicy = ShrinkWhenSparse<>>
 class Stack {
 
-    DynamicArray<Type> array_;
+    using Array = DynamicArray<Type, Allocator, InlineCapacity, CapacityPolicy>;
+
+    Array array_;
 
   public:
+    using allocator_type = Allocator;
+
     /// Default constructor
     Stack() : array_() {}
 
+    /// Constructor drawing storage from the given allocator
+    explicit Stack(const Allocator& allocator) : array_(allocator) {}
+
     /// Constructor with initial capacity
-    explicit Stack(size_t capacity) : array_(capacity) {}
+    explicit Stack(size_t capacity, const Allocator& allocator = Allocator())
+        : array_(capacity, allocator) {}
 
     /// Constructor for braced-init-lists
-    Stack(std::initializer_list<Type> initial_data) : array_(initial_data) {}
+    Stack(std::initializer_list<Type> initial_data, const Allocator& allocator = Allocator())
+        : array_(initial_data, allocator) {}
 
     /**
      * Constructor with initial data and size.
@@ -48,15 +74,18 @@ class Stack {
      *
      * @param initial_data Pointer to the initial data array.
      * @param initial_size The number of elements in the initial data array.
+     * @param allocator The allocator of the underlying array.
      */
-    Stack(const Type* initial_data, const size_t initial_size)
-        : array_(initial_data, initial_size) {}
+    Stack(const Type* initial_data, const size_t initial_size,
+          const Allocator& allocator = Allocator())
+        : array_(initial_data, initial_size, allocator) {}
 
     /// Copy constructor
     Stack(const Stack& other) : array_(other.array_) {}
 
     /// Move constructor
-    Stack(Stack&& other) noexcept : array_(std::move(other.array_)) {}
+    Stack(Stack&& other) noexcept(std::is_nothrow_move_constructible_v<Array>)
+        : array_(std::move(other.array_)) {}
 
     /// Copy assignment operator
     Stack& operator=(const Stack& other) {
@@ -67,7 +96,8 @@ class Stack {
     }
 
     /// Move assignment operator
-    Stack& operator=(Stack&& other) noexcept {
+    Stack& operator=(Stack&& other) noexcept(
+        std::is_nothrow_move_assignable_v<Array>) {
         if (this == &other)
             return *this;
         array_ = std::move(other.array_);
@@ -75,6 +105,12 @@ class Stack {
     }
 
 
+    /// Returns a copy of the allocator of the underlying array.
+    [[nodiscard]]
+    Allocator getAllocator() const noexcept {
+        return array_.getAllocator();
+    }
+
     /// Checks if the stack is empty.
     [[nodiscard]]
     bool isEmpty() const noexcept {
@@ -87,6 +123,12 @@ class Stack {
         return array_.size();
     }
 
+    /// Returns the number of elements the stack holds without growing.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return array_.capacity();
+    }
+
     /// Clears the stack, removing all elements.
     void clear() noexcept { array_.clear(); }
 
@@ -114,6 +156,40 @@ class Stack {
     }
 
 
+    /**
+     * Push a new element without checking the capacity.
+     *
+     * Meant for hot loops that call reserve() once for a known number of
+     * pushes.
+     *
+     * @pre size() < capacity(). Checked by assert only.
+     * @tparam U Value type that can construct `Type`.
+     * @param element The value to push (perfect-forwarded).
+     */
+    template <typename U>
+    void pushUnchecked(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "U must be constructible into Type");
+        array_.emplaceLastUnchecked(std::forward<U>(element));
+    }
+
+
+    /**
+     * Push every element of [first, last), the last one ending up on top.
+     *
+     * The capacity is checked once for the whole range, so the stack grows at
+     * most once. If a constructor throws, the contents are left unchanged.
+     *
+     * @tparam Iterator A forward iterator whose elements construct `Type`.
+     * @param first Start of the range; must not refer into this stack.
+     * @param last End of the range.
+     */
+    template <std::forward_iterator Iterator>
+    void pushRange(Iterator first, Iterator last) {
+        array_.appendRange(first, last);
+    }
+
+
     /**
      * Pop the top element from the stack.
      *
@@ -129,6 +205,21 @@ class Stack {
     }
 
 
+    /**
+     * Pop the top `count` elements.
+     *
+     * Never shrinks the underlying array, whatever the capacity policy.
+     *
+     * @param count Number of elements to remove.
+     * @throws std::out_of_range if the stack holds fewer than `count` elements.
+     */
+    void popN(const size_t count) {
+        if (count > array_.size())
+            throw std::out_of_range("Stack holds fewer elements than requested");
+        array_.popBackN(count);
+    }
+
+
     /**
      * Access the top element by reference.
      *
@@ -170,6 +261,25 @@ class Stack {
     ~Stack() = default;
 };
 
+
+/// Stack that keeps up to N elements inside the object.
+template <typename Type, size_t N, typename Allocator = std::allocator<Type>>
+using SmallStack = Stack<Type, Allocator, N>;
+
+
+/// Stack whose pops never give memory back (only shrinkToFit() does).
+template <typename Type, typename Allocator = std::allocator<Type>>
+using GrowOnlyStack = Stack<Type, Allocator, 0, ShrinkOnRequest<>>;
+
+
+namespace pmr {
+
+/// Stack whose storage comes from a std::pmr::memory_resource.
+template <typename Type>
+using Stack = containers::Stack<Type, std::pmr::polymorphic_allocator<Type>>;
+
+} // namespace pmr
+
 } // namespace containers
 
 #endif // STACK_HPP
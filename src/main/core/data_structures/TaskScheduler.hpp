@@ -0,0 +1,448 @@
+#ifndef TASK_SCHEDULER_HPP
+#define TASK_SCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "Queue.hpp"
+#include "WorkStealingDeque.hpp"
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/**
+ * @class TaskScheduler
+ * @brief Fixed pool of worker threads that run fork-join work through
+ * per-worker work-stealing deques.
+ *
+ * `parallelInvoke` and `parallelFor` split work into tasks and return once
+ * all of them have run. A worker pushes the tasks it spawns onto its own
+ * `WorkStealingDeque` and keeps working on them LIFO; idle workers steal the
+ * oldest tasks from a random victim. A worker waiting for its tasks does not
+ * block: it runs spawned tasks (its own first) until they are done, so nested
+ * parallel calls cannot deadlock. A thread outside the pool hands its whole
+ * call to the workers as one task, through a locked injection `Queue`, and
+ * sleeps until it is done; running other callers' tasks itself would stack
+ * their waits on its own call without bound, and for the same reason only a
+ * worker that is not waiting starts such a call. Idle workers sleep on an
+ * atomic wait and are only woken when tasks are spawned.
+ *
+ * Sharing one scheduler (`TaskScheduler::shared()`) between unrelated
+ * parallel calls keeps the total number of threads fixed, where spawning
+ * threads per call would oversubscribe the machine.
+ *
+ * If tasks throw, the first exception is rethrown by the call that spawned
+ * them, after every one of its tasks has finished.
+ */
+class TaskScheduler {
+
+    struct Group;
+
+    /// Type-erased unit of work; lives in the frame of the call that spawned
+    /// it, which waits for it before returning. Root tasks (a whole call
+    /// from outside the pool) have no group and signal completion themselves.
+    struct Task {
+        void (*run)(Task&) = nullptr;
+        Group* group = nullptr;
+    };
+
+    /// Tasks spawned by one call, and the first exception any of them threw.
+    struct Group {
+        std::atomic<size_t> pending{0};
+        std::atomic_flag failed;
+        std::exception_ptr error;
+
+        void fail(std::exception_ptr exception) noexcept {
+            if (!failed.test_and_set(std::memory_order_relaxed))
+                error = std::move(exception);
+        }
+    };
+
+    struct Worker {
+        TaskScheduler* owner;
+        WorkStealingDeque<Task*> deque;
+        uint64_t rng;
+        std::thread thread;
+
+        Worker(TaskScheduler* scheduler, const uint64_t seed) : owner(scheduler), rng(seed) {}
+    };
+
+    template <typename Function>
+    struct InvokeTask : Task {
+        Function* function;
+
+        explicit InvokeTask(Function& fn) : function(&fn) {
+            this->run = [](Task& self) { (*static_cast<InvokeTask&>(self).function)(); };
+        }
+    };
+
+    template <typename Function>
+    struct RangeTask : Task {
+        TaskScheduler* scheduler = nullptr;
+        Function* function = nullptr;
+        size_t first = 0;
+        size_t last = 0;
+        size_t grain = 1;
+
+        RangeTask() = default;
+        RangeTask(TaskScheduler& owner, Function& fn, const size_t begin, const size_t end,
+                  const size_t grain_size)
+            : scheduler(&owner), function(&fn), first(begin), last(end), grain(grain_size) {
+            this->run = [](Task& self) {
+                auto& task = static_cast<RangeTask&>(self);
+                task.scheduler->forRange(task.first, task.last, task.grain, *task.function);
+            };
+        }
+    };
+
+    /// A call from outside the pool, run by a worker while the caller sleeps.
+    template <typename Function>
+    struct RootTask : Task {
+        Function* function;
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        std::exception_ptr error;
+
+        explicit RootTask(Function& fn) : function(&fn) {
+            this->run = [](Task& self) {
+                auto& task = static_cast<RootTask&>(self);
+                try {
+                    (*task.function)();
+                } catch (...) {
+                    task.error = std::current_exception();
+                }
+                // Notify under the lock: once it is released the caller may
+                // return and destroy the task.
+                std::lock_guard lock(task.mutex);
+                task.done = true;
+                task.finished.notify_one();
+            };
+        }
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::mutex injection_mutex_;
+    Queue<Task*> injected_;
+    std::atomic<size_t> injected_count_{0};
+    std::atomic<uint32_t> epoch_{0};    ///< Bumped whenever work appears; sleepers wait on it.
+    std::atomic<size_t> sleepers_{0};
+    std::atomic<bool> stopping_{false};
+
+    inline static thread_local Worker* current_worker_ = nullptr;
+
+
+    /// The calling thread's worker if it belongs to this pool, else nullptr.
+    Worker* localWorker() const noexcept {
+        return current_worker_ != nullptr && current_worker_->owner == this ? current_worker_ : nullptr;
+    }
+
+
+    /// Wakes one sleeping worker, if any, after work was published.
+    void signalWork() noexcept {
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_seq_cst) > 0)
+            epoch_.notify_one();
+    }
+
+
+    /// Pushes a task onto the calling worker's deque.
+    void spawn(Worker& self, Task& task, Group& group) {
+        task.group = &group;
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+        try {
+            self.deque.push(&task);
+        } catch (...) {
+            group.pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+        signalWork();
+    }
+
+
+    /// Runs `work` on a worker on behalf of a thread outside the pool, and
+    /// blocks until it has finished.
+    template <typename Function>
+    void runOnWorker(Function& work) {
+        RootTask<Function> root(work);
+        {
+            std::lock_guard lock(injection_mutex_);
+            injected_.enqueue(&root);
+            injected_count_.fetch_add(1, std::memory_order_release);
+        }
+        signalWork();
+
+        std::unique_lock lock(root.mutex);
+        root.finished.wait(lock, [&] { return root.done; });
+        if (root.error)
+            std::rethrow_exception(root.error);
+    }
+
+
+    Task* takeInjected() {
+        if (injected_count_.load(std::memory_order_acquire) == 0)
+            return nullptr;
+        std::lock_guard lock(injection_mutex_);
+        if (injected_.isEmpty())
+            return nullptr;
+        Task* task = injected_.front();
+        injected_.dequeue();
+        injected_count_.fetch_sub(1, std::memory_order_relaxed);
+        return task;
+    }
+
+
+    /// Own deque first, then a random victim. Never takes injected calls.
+    Task* findSpawnedTask(Worker& self) {
+        if (const auto task = self.deque.take())
+            return *task;
+
+        // xorshift64
+        self.rng ^= self.rng << 13;
+        self.rng ^= self.rng >> 7;
+        self.rng ^= self.rng << 17;
+        const size_t count = workers_.size();
+        const auto start = static_cast<size_t>(self.rng % count);
+        for (size_t i = 0; i < count; ++i) {
+            Worker& victim = *workers_[(start + i) % count];
+            if (&victim == &self)
+                continue;
+            if (const auto task = victim.deque.steal())
+                return *task;
+        }
+        return nullptr;
+    }
+
+
+    /// Spawned tasks first, then the injection queue, so that running calls
+    /// finish before new ones start.
+    Task* findTask(Worker& self) {
+        if (Task* task = findSpawnedTask(self))
+            return task;
+        return takeInjected();
+    }
+
+
+    static void execute(Task& task) noexcept {
+        if (task.group == nullptr) {
+            task.run(task); // root task: reports its own outcome
+            return;
+        }
+        Group& group = *task.group;
+        try {
+            task.run(task);
+        } catch (...) {
+            group.fail(std::current_exception());
+        }
+        // Last access: the spawning frame may return as soon as this lands.
+        group.pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+
+    /// Runs spawned tasks until every task of the group has finished, then
+    /// rethrows the group's first exception. Injected calls are left to
+    /// workers in workerLoop(): starting one here would stack an unrelated
+    /// call on this wait and hold it until that call returns.
+    void wait(Worker& self, Group& group) {
+        while (group.pending.load(std::memory_order_acquire) != 0) {
+            if (Task* task = findSpawnedTask(self))
+                execute(*task);
+            else
+                std::this_thread::yield();
+        }
+        if (group.error)
+            std::rethrow_exception(group.error);
+    }
+
+
+    void workerLoop(Worker& self) {
+        current_worker_ = &self;
+        while (true) {
+            const uint32_t seen = epoch_.load(std::memory_order_seq_cst);
+            if (Task* task = findTask(self)) {
+                execute(*task);
+                continue;
+            }
+            if (stopping_.load(std::memory_order_acquire))
+                return;
+            // Any spawn after `seen` was read has bumped the epoch, so the
+            // wait returns at once instead of missing it.
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            epoch_.wait(seen, std::memory_order_seq_cst);
+            sleepers_.fetch_sub(1, std::memory_order_seq_cst);
+        }
+    }
+
+
+    /// Splits [first, last) in halves, spawning the upper halves, down to
+    /// `grain` indices, then runs the remaining range on this worker.
+    template <typename Function>
+    void forRange(size_t first, size_t last, const size_t grain, Function& fn) {
+        Worker& self = *localWorker();
+        Group group;
+        RangeTask<Function> children[sizeof(size_t) * 8];
+        size_t spawned = 0;
+        try {
+            while (last - first > grain) {
+                const size_t mid = first + (last - first) / 2;
+                children[spawned] = RangeTask<Function>(*this, fn, mid, last, grain);
+                spawn(self, children[spawned++], group);
+                last = mid;
+            }
+            for (size_t i = first; i < last; ++i)
+                fn(i);
+        } catch (...) {
+            group.fail(std::current_exception());
+        }
+        wait(self, group);
+    }
+
+
+    /// parallelInvoke() on a worker: spawns all but the first function.
+    template <typename First, typename... Rest>
+    void invokeAll(First& first, Rest&... rest) {
+        Worker& self = *localWorker();
+        Group group;
+        std::tuple<InvokeTask<Rest>...> tasks{InvokeTask<Rest>(rest)...};
+        try {
+            std::apply([&](auto&... task) { (spawn(self, task, group), ...); }, tasks);
+            first();
+        } catch (...) {
+            group.fail(std::current_exception());
+        }
+        wait(self, group);
+    }
+
+
+    /// Runs `work` here if this thread is a worker, else hands it to one.
+    template <typename Function>
+    void runInPool(Function&& work) {
+        if (localWorker() != nullptr)
+            work();
+        else
+            runOnWorker(work);
+    }
+
+
+  public:
+    /// Number of hardware threads (at least 1).
+    static size_t hardwareThreads() noexcept {
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param thread_count Number of workers (0 means hardwareThreads()).
+     * With 1 no thread is started and every call runs serially on the
+     * calling thread.
+     */
+    explicit TaskScheduler(size_t thread_count = hardwareThreads()) {
+        if (thread_count == 0)
+            thread_count = hardwareThreads();
+        if (thread_count > 1) {
+            workers_.reserve(thread_count);
+            for (size_t i = 1; i <= thread_count; ++i)
+                workers_.push_back(std::make_unique<Worker>(this, 0x9E3779B97F4A7C15ull * i));
+        }
+        try {
+            for (const auto& worker : workers_)
+                worker->thread = std::thread([this, w = worker.get()] { workerLoop(*w); });
+        } catch (...) {
+            stop();
+            throw;
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /// Stops and joins the workers. No parallel call may still be running.
+    ~TaskScheduler() { stop(); }
+
+
+    /// Process-wide scheduler with hardwareThreads() threads, started on
+    /// first use.
+    static TaskScheduler& shared() {
+        static TaskScheduler scheduler;
+        return scheduler;
+    }
+
+
+    /// Threads that work on parallel calls.
+    [[nodiscard]]
+    size_t threadCount() const noexcept {
+        return workers_.empty() ? 1 : workers_.size();
+    }
+
+
+    /**
+     * @brief Calls every function, possibly in parallel, and returns when
+     * all have returned.
+     *
+     * On a worker the first function runs right away and the others are
+     * spawned as tasks.
+     *
+     * @throws The first exception thrown by any of the functions.
+     */
+    template <typename First, typename... Rest>
+    void parallelInvoke(First&& first, Rest&&... rest) {
+        if (sizeof...(Rest) == 0 || workers_.empty()) {
+            first();
+            (rest(), ...);
+            return;
+        }
+        runInPool([&] { invokeAll(first, rest...); });
+    }
+
+
+    /**
+     * @brief Calls fn(i) for every i in [first, last), possibly in parallel,
+     * and returns when all calls have returned.
+     *
+     * The range is halved recursively, each upper half becoming a task that
+     * an idle thread may steal, until pieces have at most `grain` indices.
+     * Each piece runs its indices in increasing order on one thread.
+     *
+     * @throws The first exception thrown by any call of fn.
+     */
+    template <typename Function>
+    void parallelFor(const size_t first, const size_t last, Function&& fn, const size_t grain = 1) {
+        if (first >= last)
+            return;
+        if (workers_.empty()) {
+            for (size_t i = first; i < last; ++i)
+                fn(i);
+            return;
+        }
+        runInPool([&] { forRange(first, last, grain == 0 ? 1 : grain, fn); });
+    }
+
+
+  private:
+    void stop() noexcept {
+        stopping_.store(true, std::memory_order_release);
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+        epoch_.notify_all();
+        for (const auto& worker : workers_)
+            if (worker->thread.joinable())
+                worker->thread.join();
+    }
+};
+
+} // namespace containers
+
+#endif // TASK_SCHEDULER_HPP
@@ -0,0 +1,714 @@
+#ifndef UNROLLED_LINKED_LIST_HPP
+#define UNROLLED_LINKED_LIST_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+namespace unrolled_list_detail {
+
+/// About 256 bytes of elements per node, and never fewer than 4.
+template <typename Type>
+constexpr size_t defaultNodeCapacity() {
+    constexpr size_t per_node = 256 / sizeof(Type);
+    return per_node < 4 ? 4 : per_node;
+}
+
+} // namespace unrolled_list_detail
+
+
+/**
+ * @class UnrolledLinkedList
+ * @brief Doubly linked list whose nodes each hold a small array of elements.
+ *
+ * Storing up to NodeCapacity elements per node divides the number of nodes,
+ * and with it the pointer chasing of traversals, lookups and scans, by up to
+ * NodeCapacity; the elements of a node are contiguous, so scanning them is
+ * a plain loop over an array. Indexed access skips whole nodes and costs
+ * O(size() / NodeCapacity).
+ *
+ * Insertion and erasure through an iterator cost O(NodeCapacity), independent
+ * of the list's size: an insert into a full node first splits it in halves,
+ * and a node that drops below half full after an erase absorbs its
+ * neighbour when the two fit into one node. Empty nodes are freed at once.
+ * splice() relinks the nodes of another list without touching its elements.
+ *
+ * Unlike LinkedList, inserting or erasing invalidates the iterators and
+ * references to the elements of the node(s) involved; all others stay
+ * valid.
+ *
+ * @tparam Type Element type. Must be nothrow move constructible, since
+ * elements shift within and between nodes.
+ * @tparam NodeCapacity Elements per node. Defaults to about 256 bytes worth,
+ * at least 4.
+ */
+template <typename Type, size_t NodeCapacity = unrolled_list_detail::defaultNodeCapacity<Type>()>
+class UnrolledLinkedList {
+    static_assert(NodeCapacity >= 2, "NodeCapacity must be at least 2");
+    static_assert(std::is_nothrow_move_constructible_v<Type>,
+                  "UnrolledLinkedList requires a nothrow move constructible Type");
+
+    struct Node {
+        Node* prev = nullptr;
+        Node* next = nullptr;
+        size_t count = 0;
+        alignas(Type) std::byte storage[sizeof(Type) * NodeCapacity];
+
+        Type* slot(const size_t index) noexcept {
+            return std::launder(reinterpret_cast<Type*>(storage) + index);
+        }
+
+        const Type* slot(const size_t index) const noexcept {
+            return std::launder(reinterpret_cast<const Type*>(storage) + index);
+        }
+    };
+
+    /// Nodes below this many elements try to merge with a neighbour.
+    static constexpr size_t MIN_FILL = NodeCapacity / 2;
+
+    Node* head_ = nullptr;
+    Node* tail_ = nullptr;
+    size_t size_ = 0;
+    size_t node_count_ = 0;
+
+
+    /// Moves `count` elements from `source` into uninitialized `destination`.
+    static void relocate(Type* source, Type* destination, const size_t count) noexcept {
+        if (destination < source) {
+            for (size_t i = 0; i < count; ++i) {
+                std::construct_at(destination + i, std::move(source[i]));
+                std::destroy_at(source + i);
+            }
+        } else {
+            for (size_t i = count; i > 0; --i) {
+                std::construct_at(destination + i - 1, std::move(source[i - 1]));
+                std::destroy_at(source + i - 1);
+            }
+        }
+    }
+
+
+    /// Links `node` in front of `pos` (nullptr: at the back).
+    void linkBefore(Node* pos, Node* node) noexcept {
+        Node* prev = pos != nullptr ? pos->prev : tail_;
+        node->prev = prev;
+        node->next = pos;
+        if (prev != nullptr)
+            prev->next = node;
+        else
+            head_ = node;
+        if (pos != nullptr)
+            pos->prev = node;
+        else
+            tail_ = node;
+        ++node_count_;
+    }
+
+
+    /// Unlinks and frees an empty node.
+    void dropNode(Node* node) noexcept {
+        if (node->prev != nullptr)
+            node->prev->next = node->next;
+        else
+            head_ = node->next;
+        if (node->next != nullptr)
+            node->next->prev = node->prev;
+        else
+            tail_ = node->prev;
+        --node_count_;
+        delete node;
+    }
+
+
+    /**
+     * @brief Moves the elements [at, count) of `node` into a new node linked
+     * right after it.
+     *
+     * @return The new node.
+     * @throws std::bad_alloc if allocating the node fails; nothing changes.
+     */
+    Node* split(Node* node, const size_t at) {
+        Node* upper = new Node;
+        relocate(node->slot(at), upper->slot(0), node->count - at);
+        upper->count = node->count - at;
+        node->count = at;
+        linkBefore(node->next, upper);
+        return upper;
+    }
+
+
+    /// Appends the elements of `source` to `target` and frees `source`.
+    void absorb(Node* target, Node* source) noexcept {
+        relocate(source->slot(0), target->slot(target->count), source->count);
+        target->count += source->count;
+        source->count = 0;
+        dropNode(source);
+    }
+
+
+    /// Finds the node and offset of element `idx` < size(), walking from the
+    /// nearer end one node at a time.
+    std::pair<Node*, size_t> locate(size_t idx) const noexcept {
+        if (idx < size_ / 2) {
+            Node* node = head_;
+            while (idx >= node->count) {
+                idx -= node->count;
+                node = node->next;
+            }
+            return {node, idx};
+        }
+
+        size_t from_back = size_ - 1 - idx;
+        Node* node = tail_;
+        while (from_back >= node->count) {
+            from_back -= node->count;
+            node = node->prev;
+        }
+        return {node, node->count - 1 - from_back};
+    }
+
+
+    /**
+     * @brief Constructs an element in front of offset `index` of `node`
+     * (nullptr: at the back).
+     *
+     * The element is built before the list changes, so a throwing
+     * constructor or a failed node allocation leaves the list unchanged.
+     */
+    template <typename... Args>
+    std::pair<Node*, size_t> insertAt(Node* node, size_t index, Args&&... args) {
+        Type value(std::forward<Args>(args)...);
+
+        if (node == nullptr) {
+            if (tail_ != nullptr && tail_->count < NodeCapacity) {
+                node = tail_;
+                index = tail_->count;
+            } else {
+                node = new Node;
+                linkBefore(nullptr, node);
+                index = 0;
+            }
+        } else if (node->count == NodeCapacity) {
+            Node* upper = split(node, MIN_FILL);
+            if (index > MIN_FILL) {
+                node = upper;
+                index -= MIN_FILL;
+            }
+        }
+
+        relocate(node->slot(index), node->slot(index + 1), node->count - index);
+        std::construct_at(node->slot(index), std::move(value));
+        ++node->count;
+        ++size_;
+        return {node, index};
+    }
+
+
+    /**
+     * @brief Destroys the element at offset `index` of `node` and rebalances.
+     *
+     * @return Position of the element that followed the erased one.
+     */
+    std::pair<Node*, size_t> eraseAt(Node* node, size_t index) noexcept {
+        std::destroy_at(node->slot(index));
+        relocate(node->slot(index + 1), node->slot(index), node->count - index - 1);
+        --node->count;
+        --size_;
+
+        if (node->count == 0) {
+            Node* next = node->next;
+            dropNode(node);
+            return {next, 0};
+        }
+
+        if (node->count < MIN_FILL) {
+            if (node->next != nullptr && node->count + node->next->count <= NodeCapacity) {
+                absorb(node, node->next);
+            } else if (node->prev != nullptr && node->prev->count + node->count <= NodeCapacity) {
+                Node* prev = node->prev;
+                index += prev->count;
+                absorb(prev, node);
+                node = prev;
+            }
+        }
+
+        if (index == node->count)
+            return {node->next, 0};
+        return {node, index};
+    }
+
+
+    /// Destroys every element and frees every node.
+    void release() noexcept {
+        Node* node = head_;
+        while (node != nullptr) {
+            Node* next = node->next;
+            std::destroy(node->slot(0), node->slot(node->count));
+            delete node;
+            node = next;
+        }
+        head_ = tail_ = nullptr;
+        size_ = node_count_ = 0;
+    }
+
+
+    /// Bidirectional iterator over the elements, shared by iterator and
+    /// const_iterator.
+    template <bool Const>
+    class Iterator {
+        friend class UnrolledLinkedList;
+        friend class Iterator<!Const>;
+
+        using ListPtr = std::conditional_t<Const, const UnrolledLinkedList*, UnrolledLinkedList*>;
+
+        ListPtr list_ = nullptr;
+        Node* node_ = nullptr;  ///< nullptr for end().
+        size_t index_ = 0;
+
+        Iterator(ListPtr list, Node* node, const size_t index) noexcept
+            : list_(list), node_(node), index_(index) {}
+
+      public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const Type*, Type*>;
+        using reference = std::conditional_t<Const, const Type&, Type&>;
+
+        /// Default constructor
+        Iterator() noexcept = default;
+
+        /// Conversion from a mutable iterator to a const_iterator.
+        template <bool OtherConst>
+            requires(Const && !OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept
+            : list_(other.list_), node_(other.node_), index_(other.index_) {}
+
+        reference operator*() const { return *node_->slot(index_); }
+        pointer operator->() const { return node_->slot(index_); }
+
+        Iterator& operator++() {
+            if (++index_ == node_->count) {
+                node_ = node_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        Iterator& operator--() {
+            if (node_ == nullptr) {
+                node_ = list_->tail_;
+                index_ = node_->count - 1;
+            } else if (index_ == 0) {
+                node_ = node_->prev;
+                index_ = node_->count - 1;
+            } else {
+                --index_;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) {
+            Iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return node_ == other.node_ && index_ == other.index_;
+        }
+    };
+
+
+  public:
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using value_type = Type;
+    using reference = Type&;
+    using const_reference = const Type&;
+    using difference_type = std::ptrdiff_t;
+    using size_type = size_t;
+
+
+    /// Default constructor; allocates nothing until the first insert.
+    UnrolledLinkedList() noexcept = default;
+
+    /// Constructor for braced-init-lists
+    UnrolledLinkedList(std::initializer_list<Type> initial_data) {
+        try {
+            for (const Type& element : initial_data)
+                addLast(element);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /// Copy constructor; the copy packs its nodes full.
+    UnrolledLinkedList(const UnrolledLinkedList& other) {
+        try {
+            for (const Type& element : other)
+                addLast(element);
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    /// Move constructor; takes over the nodes.
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : head_(std::exchange(other.head_, nullptr)),
+          tail_(std::exchange(other.tail_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          node_count_(std::exchange(other.node_count_, 0)) {}
+
+    /// Copy assignment operator
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other) {
+        if (this != &other) {
+            UnrolledLinkedList copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept {
+        if (this != &other) {
+            release();
+            head_ = std::exchange(other.head_, nullptr);
+            tail_ = std::exchange(other.tail_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            node_count_ = std::exchange(other.node_count_, 0);
+        }
+        return *this;
+    }
+
+    /// Destructor
+    ~UnrolledLinkedList() noexcept { release(); }
+
+
+    /// Returns the number of elements in the list.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return size_;
+    }
+
+    /// Checks if the list is empty.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Returns the number of allocated nodes.
+    [[nodiscard]]
+    size_t nodeCount() const noexcept {
+        return node_count_;
+    }
+
+    /// Returns the number of elements a node holds.
+    [[nodiscard]]
+    static constexpr size_t nodeCapacity() noexcept {
+        return NodeCapacity;
+    }
+
+
+    iterator begin() noexcept { return iterator(this, head_, 0); }
+    iterator end() noexcept { return iterator(this, nullptr, 0); }
+    const_iterator begin() const noexcept { return const_iterator(this, head_, 0); }
+    const_iterator end() const noexcept { return const_iterator(this, nullptr, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+
+    /**
+     * @brief Add a new element to the beginning of the list.
+     *
+     * @tparam U A type that can construct `Type` (enforced at compile time).
+     * @param element Value to insert at the front (perfect-forwarded).
+     * @complexity O(NodeCapacity).
+     */
+    template <typename U>
+    void addFirst(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        insertAt(head_, 0, std::forward<U>(element));
+    }
+
+
+    /**
+     * @brief Add a new element to the end of the list.
+     *
+     * @tparam U A type that can construct `Type` (enforced at compile time).
+     * @param element Value to insert at the back (perfect-forwarded).
+     * @complexity O(1); allocates one node every NodeCapacity elements.
+     */
+    template <typename U>
+    void addLast(U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        insertAt(nullptr, 0, std::forward<U>(element));
+    }
+
+
+    /**
+     * @brief Insert a new element at index `idx`.
+     *
+     * @tparam U A type that can construct `Type` (enforced at compile time).
+     * @param element Value to insert (perfect-forwarded).
+     * @param idx Insertion position in [0, size()].
+     * @throws std::out_of_range If idx > size().
+     * @complexity O(size() / NodeCapacity + NodeCapacity).
+     */
+    template <typename U>
+        requires(!std::is_convertible_v<U&&, const_iterator>)
+    void insert(U&& element, const size_t idx) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        if (idx > size_)
+            throw std::out_of_range("Index out of range");
+
+        if (idx == size_) {
+            insertAt(nullptr, 0, std::forward<U>(element));
+        } else {
+            const auto [node, index] = locate(idx);
+            insertAt(node, index, std::forward<U>(element));
+        }
+    }
+
+
+    /**
+     * @brief Insert an element in front of `pos`.
+     *
+     * @tparam U A type that can construct `Type` (enforced at compile time).
+     * @param pos Position to insert before; end() appends.
+     * @param element Value to insert (perfect-forwarded).
+     * @return Iterator to the inserted element.
+     * @complexity O(NodeCapacity).
+     */
+    template <typename U>
+    iterator insert(const_iterator pos, U&& element) {
+        static_assert(std::is_constructible_v<Type, U&&>,
+                      "Element must be constructible into Type");
+        const auto [node, index] = insertAt(pos.node_, pos.index_, std::forward<U>(element));
+        return iterator(this, node, index);
+    }
+
+
+    /**
+     * @brief Erase the element at `pos`.
+     *
+     * @param pos Iterator to the element to erase; end() is a no-op.
+     * @return Iterator to the element that followed the erased one.
+     * @complexity O(NodeCapacity).
+     */
+    iterator erase(const_iterator pos) noexcept {
+        if (pos.node_ == nullptr)
+            return end();
+        const auto [node, index] = eraseAt(pos.node_, pos.index_);
+        return iterator(this, node, index);
+    }
+
+
+    /// Removes the first element; no-op if the list is empty.
+    void removeFirst() noexcept {
+        if (head_ != nullptr)
+            eraseAt(head_, 0);
+    }
+
+    /// Removes the last element; no-op if the list is empty.
+    void removeLast() noexcept {
+        if (tail_ != nullptr)
+            eraseAt(tail_, tail_->count - 1);
+    }
+
+
+    /**
+     * @brief Remove the element at index `idx`.
+     *
+     * @param idx Zero-based index in [0, size()).
+     * @throws std::out_of_range If idx >= size().
+     * @complexity O(size() / NodeCapacity + NodeCapacity).
+     */
+    void removeAt(const size_t idx) {
+        if (idx >= size_)
+            throw std::out_of_range("Index out of range");
+        const auto [node, index] = locate(idx);
+        eraseAt(node, index);
+    }
+
+
+    /**
+     * @brief Remove the first occurrence of `element`, if any.
+     *
+     * @param element Value to remove (compared via `operator==`).
+     * @return True if an element was removed.
+     */
+    bool remove(const Type& element) {
+        for (Node* node = head_; node != nullptr; node = node->next)
+            for (size_t i = 0; i < node->count; ++i)
+                if (*node->slot(i) == element) {
+                    eraseAt(node, i);
+                    return true;
+                }
+        return false;
+    }
+
+
+    /**
+     * @brief Remove all occurrences of `element` in one pass.
+     *
+     * Each node is compacted in place; nodes left empty are freed, and a
+     * node is merged into its predecessor when both fit into one.
+     *
+     * @param element Value to remove (compared via `operator==`).
+     * @return Number of removed elements.
+     */
+    size_t removeAll(const Type& element) {
+        size_t removed_count = 0;
+        Node* node = head_;
+
+        while (node != nullptr) {
+            Node* next = node->next;
+            size_t kept = 0;
+            for (size_t i = 0; i < node->count; ++i) {
+                if (*node->slot(i) == element) {
+                    std::destroy_at(node->slot(i));
+                    ++removed_count;
+                } else if (kept++ != i) {
+                    relocate(node->slot(i), node->slot(kept - 1), 1);
+                }
+            }
+            size_ -= node->count - kept;
+            node->count = kept;
+
+            if (kept == 0)
+                dropNode(node);
+            else if (node->prev != nullptr && node->prev->count + kept <= NodeCapacity)
+                absorb(node->prev, node);
+            node = next;
+        }
+
+        return removed_count;
+    }
+
+
+    /**
+     * @brief Move every element of `other` in front of `pos`.
+     *
+     * Whole nodes are relinked, so the elements of `other` are not moved and
+     * iterators into `other` stay valid. Only when `pos` points into the
+     * middle of a node is that node split in two first.
+     *
+     * @param pos Position in this list to insert before; end() appends.
+     * @param other List to take the elements from; left empty.
+     * @throws std::bad_alloc if splitting fails; both lists are unchanged.
+     * @complexity O(1), or O(NodeCapacity) with a split.
+     */
+    void splice(const_iterator pos, UnrolledLinkedList& other) {
+        if (&other == this || other.isEmpty())
+            return;
+
+        Node* before = pos.node_;
+        if (before != nullptr && pos.index_ > 0)
+            before = split(before, pos.index_);
+
+        Node* prev = before != nullptr ? before->prev : tail_;
+        other.head_->prev = prev;
+        other.tail_->next = before;
+        if (prev != nullptr)
+            prev->next = other.head_;
+        else
+            head_ = other.head_;
+        if (before != nullptr)
+            before->prev = other.tail_;
+        else
+            tail_ = other.tail_;
+
+        size_ += std::exchange(other.size_, 0);
+        node_count_ += std::exchange(other.node_count_, 0);
+        other.head_ = other.tail_ = nullptr;
+    }
+
+
+    /**
+     * @brief Access the element at index `idx`.
+     *
+     * @param idx Zero-based index in [0, size()).
+     * @throws std::out_of_range If idx >= size().
+     * @complexity O(size() / NodeCapacity).
+     */
+    Type& get(const size_t idx) {
+        if (idx >= size_)
+            throw std::out_of_range("Index out of range");
+        const auto [node, index] = locate(idx);
+        return *node->slot(index);
+    }
+
+    /// Const overload of get().
+    const Type& get(const size_t idx) const {
+        return const_cast<UnrolledLinkedList*>(this)->get(idx);
+    }
+
+    /// Bounds-checked element access, same as get().
+    Type& operator[](const size_t idx) { return get(idx); }
+
+    /// Bounds-checked element access, same as get().
+    const Type& operator[](const size_t idx) const { return get(idx); }
+
+
+    /**
+     * @brief Access the first element.
+     * @throws std::out_of_range If the list is empty.
+     */
+    Type& front() {
+        if (isEmpty())
+            throw std::out_of_range("UnrolledLinkedList is empty");
+        return *head_->slot(0);
+    }
+
+    /// Const overload of front().
+    const Type& front() const {
+        return const_cast<UnrolledLinkedList*>(this)->front();
+    }
+
+
+    /**
+     * @brief Access the last element.
+     * @throws std::out_of_range If the list is empty.
+     */
+    Type& back() {
+        if (isEmpty())
+            throw std::out_of_range("UnrolledLinkedList is empty");
+        return *tail_->slot(tail_->count - 1);
+    }
+
+    /// Const overload of back().
+    const Type& back() const {
+        return const_cast<UnrolledLinkedList*>(this)->back();
+    }
+
+
+    /// Removes every element and frees every node.
+    void clear() noexcept { release(); }
+};
+
+} // namespace containers
+
+#endif // UNROLLED_LINKED_LIST_HPP
@@ -0,0 +1,194 @@
+#ifndef WORK_STEALING_DEQUE_HPP
+#define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace containers {
+
+using std::size_t;
+
+
+/**
+ * @class WorkStealingDeque
+ * @brief Chase–Lev work-stealing deque: one owner thread pushes and takes
+ * at the bottom, any number of thieves steal from the top.
+ *
+ * The owner works LIFO on its own end, which keeps recently spawned (and
+ * cache-hot) work local; thieves take the oldest, usually largest, items.
+ * Owner operations touch only the owner's end unless the deque is down to
+ * its last item, in which case owner and thieves race for it with one CAS
+ * on `top_`. The memory orders follow Lê et al., "Correct and Efficient
+ * Work-Stealing for Weak Memory Models" (PPoPP 2013), with the fences folded
+ * into sequentially consistent accesses.
+ *
+ * The ring grows by doubling when the owner pushes into a full deque.
+ * Thieves may still be reading the old ring, so retired rings are kept until
+ * the deque is destroyed; together they are smaller than the live ring.
+ *
+ * @tparam Type Element type. Must be trivially copyable (typically a task
+ * pointer), because a thief may read a slot that the owner concurrently
+ * reuses before the thief's CAS tells it to discard the value.
+ */
+template <typename Type>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<Type>,
+                  "WorkStealingDeque requires a trivially copyable Type");
+
+    /// Power-of-two circular array of atomic slots.
+    struct Ring {
+        size_t mask;
+        std::unique_ptr<std::atomic<Type>[]> slots;
+
+        explicit Ring(const size_t capacity)
+            : mask(capacity - 1), slots(new std::atomic<Type>[capacity]) {}
+
+        size_t capacity() const noexcept { return mask + 1; }
+
+        Type load(const int64_t index) const noexcept {
+            return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+
+        void store(const int64_t index, const Type value) noexcept {
+            slots[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    static constexpr size_t CACHE_LINE = 64;
+    static constexpr size_t DEFAULT_CAPACITY = 64;
+
+    alignas(CACHE_LINE) std::atomic<int64_t> top_{0};
+    alignas(CACHE_LINE) std::atomic<int64_t> bottom_{0};
+    alignas(CACHE_LINE) std::atomic<Ring*> ring_;
+    std::vector<std::unique_ptr<Ring>> rings_; ///< Owns the live ring and every retired one.
+
+
+    /// Doubles the ring, copying the live range [top, bottom). Owner only.
+    Ring* grow(Ring* old, const int64_t top, const int64_t bottom) {
+        auto bigger = std::make_unique<Ring>(old->capacity() * 2);
+        for (int64_t i = top; i < bottom; ++i)
+            bigger->store(i, old->load(i));
+        Ring* raw = bigger.get();
+        rings_.push_back(std::move(bigger));
+        ring_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+
+  public:
+    /**
+     * @brief Constructs an empty deque.
+     *
+     * @param capacity Initial ring size, rounded up to a power of two.
+     */
+    explicit WorkStealingDeque(const size_t capacity = DEFAULT_CAPACITY) {
+        size_t rounded = 2;
+        while (rounded < capacity)
+            rounded *= 2;
+        rings_.push_back(std::make_unique<Ring>(rounded));
+        ring_.store(rings_.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+
+    /**
+     * @brief Pushes an item at the bottom. Owner thread only.
+     *
+     * @throws std::bad_alloc if growing the ring fails; the deque is then
+     * unchanged.
+     * @complexity Amortized O(1).
+     */
+    void push(const Type item) {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        if (bottom - top >= static_cast<int64_t>(ring->capacity()))
+            ring = grow(ring, top, bottom);
+        ring->store(bottom, item);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+
+    /**
+     * @brief Takes the most recently pushed item. Owner thread only.
+     *
+     * @return The item, or std::nullopt if the deque is empty (or a thief
+     * won the race for the last item).
+     */
+    std::optional<Type> take() noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_seq_cst);
+
+        if (top > bottom) { // empty
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        Type item = ring->load(bottom);
+        if (top == bottom) {
+            // Last item: settle the race with thieves through top_.
+            const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                          std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+                return std::nullopt;
+        }
+        return item;
+    }
+
+
+    /**
+     * @brief Steals the oldest item. Safe from any thread.
+     *
+     * @return The item, or std::nullopt if the deque looked empty or another
+     * thread took the item first. Callers treat both as "try elsewhere".
+     */
+    std::optional<Type> steal() noexcept {
+        int64_t top = top_.load(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+            return std::nullopt;
+
+        const Type item = ring_.load(std::memory_order_acquire)->load(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return std::nullopt;
+        return item;
+    }
+
+
+    /// Approximate number of items; exact when no other thread is active.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    /// Approximate emptiness check; exact when no other thread is active.
+    [[nodiscard]]
+    bool isEmpty() const noexcept {
+        return size() == 0;
+    }
+
+    /// Current ring size. Owner thread only.
+    [[nodiscard]]
+    size_t capacity() const noexcept {
+        return ring_.load(std::memory_order_relaxed)->capacity();
+    }
+};
+
+} // namespace containers
+
+#endif // WORK_STEALING_DEQUE_HPP
@@ -118,6 +118,14 @@ static ArrayAnimation makeSearchAnimation(const Values& values,
                          }
                      });
 
+    QObject::connect(animator, &SearchAnimator::animationFailed, arrayView,
+                     [arrayView](const QString& message) {
+                         if (auto* win = arrayView->window()) {
+                             win->setWindowTitle(
+                                 QString("Search failed: %1").arg(message));
+                         }
+                     });
+
     return {container, animator};
 }
 
@@ -152,6 +160,14 @@ static ArrayAnimation makeSortAnimation(Values& values, SortFunc&& sortFunc) {
     const QPointer<SortAnimator> animator = new SortAnimator(
         values, arrayView, std::forward<SortFunc>(sortFunc), 550, arrayView);
 
+    QObject::connect(animator, &SortAnimator::animationFailed, arrayView,
+                     [arrayView](const QString& message) {
+                         if (auto* win = arrayView->window()) {
+                             win->setWindowTitle(
+                                 QString("Sort failed: %1").arg(message));
+                         }
+                     });
+
     return {container, animator};
 }
 
@@ -3,11 +3,15 @@
 
 #include <QObject>
 #include <QPointer>
+#include <QString>
 #include <QTimer>
 #include <cstddef>
+#include <exception>
+#include <memory>
 #include <utility>
 
 #include "ArrayWidget.hpp"
+#include "StepStream.hpp"
 
 
 namespace ui {
@@ -17,30 +21,28 @@ namespace ui {
  * @brief Generic animator for search algorithms.
  *
  * This class provides functionality to visualize the steps of a search
- * algorithm on a dynamic array using an ArrayWidget. It collects the steps of
- * the search process and animates them using a timer.
+ * algorithm on a dynamic array using an ArrayWidget. It streams the steps of
+ * the search process from a StepStream producer thread and animates them
+ * using a timer, so long linear searches neither delay the first frame nor
+ * hold every visited index in memory.
  */
 class SearchAnimator final : public QObject {
 
     Q_OBJECT
 
   protected:
-    enum class StepType { Visit, Found, NotFound };
-
-    struct Step {
-        StepType type;
-        size_t index;
-    };
-
     QPointer<ArrayWidget> widget_{};
     QTimer timer_{};
-    containers::DynamicArray<Step> steps_{};
-    size_t current_ = 0;
+    size_t size_ = 0;
+    size_t result_ = 0; // Written by the producer; read once the stream is finished.
+    std::unique_ptr<array_algorithms::StepStream> steps_{};
 
 
   signals:
     void elementFound(size_t index);
     void elementNotFound();
+    /// The search threw; playback has stopped.
+    void animationFailed(const QString& message);
 
 
   private slots:
@@ -48,36 +50,35 @@ class SearchAnimator final : public QObject {
     /** Advances to the next step in the animation sequence.
      *  Highlights the current index being visited, or marks the element as
      * found/not found. Stops the timer and emits appropriate signals when the
-     * search concludes.
+     * search concludes, or animationFailed() if it threw. Skips the frame
+     * if the search has not produced the next step yet.
      */
     void nextStep() {
-        if (current_ >= steps_.size()) {
+        if (!steps_) {
             timer_.stop();
             return;
         }
 
-        switch (const auto& [type, idx] = steps_[current_++]; type) {
-            case StepType::Visit:
-                if (widget_) {
-                    widget_->highlightIndex(idx);
-                    widget_->setArrowPosition(idx);
-                }
-                break;
-
-            case StepType::Found:
-                if (widget_)
-                    widget_->markFound(idx);
-                timer_.stop();
-                emit elementFound(idx);
-                break;
-
-            case StepType::NotFound:
-                if (widget_)
-                    widget_->markNotFound();
-                timer_.stop();
-                emit elementNotFound();
-                break;
+        if (array_algorithms::Step step{}; fetchStep(step)) {
+            if (widget_) {
+                widget_->highlightIndex(step.first);
+                widget_->setArrowPosition(step.first);
             }
+            return;
+        }
+        if (!steps_ || !steps_->isFinished())
+            return;
+
+        timer_.stop();
+        if (result_ < size_) {
+            if (widget_)
+                widget_->markFound(result_);
+            emit elementFound(result_);
+        } else {
+            if (widget_)
+                widget_->markNotFound();
+            emit elementNotFound();
+        }
     }
 
 
@@ -101,10 +102,31 @@ class SearchAnimator final : public QObject {
 
 
   private:
+    /// tryNext() that keeps an exception from the algorithm out of Qt's
+    /// event loop: playback stops and animationFailed() reports it instead.
+    bool fetchStep(array_algorithms::Step& step) {
+        try {
+            return steps_->tryNext(step);
+        } catch (const std::exception& error) {
+            fail(QString::fromUtf8(error.what()));
+        } catch (...) {
+            fail(QStringLiteral("Unknown error"));
+        }
+        return false;
+    }
+
+    void fail(const QString& message) {
+        timer_.stop();
+        steps_.reset();
+        emit animationFailed(message);
+    }
+
+
     /**
-     * Collects the steps of the search algorithm by invoking the provided
-     * search function. The search function should call the provided callback
-     * with each index it visits.
+     * Starts streaming the steps of the search algorithm by invoking the
+     * provided search function on a copy of the array in a producer thread.
+     * The search function should call the provided callback with each index
+     * it visits.
      *
      * @tparam Type The type of elements in the array.
      * @tparam SearchFunc The type of the search function (should be callable).
@@ -119,19 +141,14 @@ class SearchAnimator final : public QObject {
     void collectSteps(const containers::DynamicArray<Type>& array,
                       const Type& target, SearchFunc&& searchFunc,
                       const int intervalMs) {
-        steps_.clear();
-        current_ = 0;
-
-        auto step_cb = [this](const size_t idx) {
-            steps_.emplaceLast(Step{StepType::Visit, idx});
-        };
-
-        const size_t result = searchFunc(array, target, step_cb);
-
-        if (result < array.size())
-            steps_.emplaceLast(Step{StepType::Found, result});
-        else
-            steps_.emplaceLast(Step{StepType::NotFound, result});
+        steps_.reset();
+        size_ = array.size();
+        result_ = size_;
+        steps_ = std::make_unique<array_algorithms::StepStream>(
+            [this, array, target, searchFunc = std::forward<SearchFunc>(searchFunc)](
+                array_algorithms::StepSink& sink) mutable {
+                result_ = searchFunc(array, target, sink);
+            });
 
         timer_.setInterval(intervalMs);
     }
@@ -3,6 +3,15 @@
 
 
 #include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <exception>
+#include <memory>
+#include <utility>
+
+#include "ArrayWidget.hpp"
+#include "StepStream.hpp"
 
 
 namespace ui {
@@ -11,60 +20,69 @@ namespace ui {
 /**
  * @brief Generic animator for sorting algorithms.
  *
- * The class records instrumentation steps emitted by a sorting routine and
- * replays them on an ArrayWidget using a timer. Any sorting function that
- * accepts a callback of the form `(size_t code, size_t a, size_t b)` can be
- * visualised by this animator:
+ * The class streams the instrumentation steps emitted by a sorting routine
+ * and replays them on an ArrayWidget using a timer. Any sorting function
+ * that accepts a callback of the form `(size_t code, size_t a, size_t b)`
+ * can be visualised by this animator:
  *   - code = 0 : compare indices a and b
  *   - code = 1 : swap indices a and b
  *   - code = 2 : mark index a as sorted
+ *
+ * The sort runs on a copy of the array in a StepStream producer thread,
+ * which stays only a few compact blocks ahead of playback, so the first
+ * frame appears immediately and memory stays bounded even for quadratic
+ * sorts of large arrays.
  */
 class SortAnimator final : public QObject {
 
     Q_OBJECT
 
   protected:
-    enum class StepType { Compare, Swap, MarkSorted };
-
-    struct Step {
-        StepType type;
-        size_t first;
-        size_t second;
-    };
+    using Step = array_algorithms::Step;
+    using StepOp = array_algorithms::StepOp;
 
     QPointer<ArrayWidget> widget_{};
     QTimer timer_{};
-    containers::DynamicArray<Step> steps_{};
-    size_t current_ = 0;
+    std::unique_ptr<array_algorithms::StepStream> steps_{};
+
+
+  signals:
+    /// The sort threw; playback has stopped.
+    void animationFailed(const QString& message);
 
 
   protected slots:
     /**
      * @brief Perform the next step in the animation sequence.
      *
-     * Executes the recorded operation (comparison, swap or marking an element
-     * as sorted) and advances the internal step counter. Stops the timer when
-     * all steps have been processed.
+     * Executes the next streamed operation (comparison, swap or marking an
+     * element as sorted). Skips the frame if the sort has not produced the
+     * step yet, and stops the timer once every step has been played or the
+     * sort has thrown.
      */
     void nextStep() {
-        if (current_ >= steps_.size()) {
-            timer_.stop();
+        Step step{};
+        if (!steps_ || !fetchStep(step)) {
+            if (!steps_ || steps_->isFinished())
+                timer_.stop();
             return;
         }
 
-        switch (const auto [type, a, b] = steps_[current_++]; type) {
-            case StepType::Compare:
+        switch (const auto [op, a, b] = step; op) {
+            case StepOp::Compare:
                 if (widget_)
                     widget_->highlightIndices(a, b);
                 break;
-            case StepType::Swap:
+            case StepOp::Swap:
                 if (widget_)
                     widget_->swapCells(a, b);
                 break;
-            case StepType::MarkSorted:
+            case StepOp::MarkSorted:
                 if (widget_)
                     widget_->markSorted(a);
                 break;
+            case StepOp::Visit:
+                break;
         }
     }
 
@@ -89,45 +107,48 @@ class SortAnimator final : public QObject {
 
 
   private:
+    /// tryNext() that keeps an exception from the algorithm out of Qt's
+    /// event loop: playback stops and animationFailed() reports it instead.
+    bool fetchStep(array_algorithms::Step& step) {
+        try {
+            return steps_->tryNext(step);
+        } catch (const std::exception& error) {
+            fail(QString::fromUtf8(error.what()));
+        } catch (...) {
+            fail(QStringLiteral("Unknown error"));
+        }
+        return false;
+    }
+
+    void fail(const QString& message) {
+        timer_.stop();
+        steps_.reset();
+        emit animationFailed(message);
+    }
+
+
     /**
-     * @brief Collects steps from the provided sorting function.
+     * @brief Starts streaming steps from the provided sorting function.
      *
-     * Runs the algorithm with an instrumentation callback that records each
-     * comparison, swap or "sorted" event for later playback.
+     * Runs the algorithm on a copy of the array in a producer thread, with
+     * an instrumentation callback that encodes each comparison, swap or
+     * "sorted" event for playback.
      *
      * @tparam Type Type of elements in the array.
      * @tparam SortFunc Callable sorting routine.
-     * @param array Array to be sorted.
+     * @param array Array whose sorting is animated; it is not modified.
      * @param sortFunc Sorting function invoked to produce steps.
      * @param intervalMs Interval between animation frames in milliseconds.
      */
     template <typename Type, typename SortFunc>
-    void collectSteps(containers::DynamicArray<Type>& array,
+    void collectSteps(const containers::DynamicArray<Type>& array,
                       SortFunc&& sortFunc, const int intervalMs) {
-        steps_.clear();
-        current_ = 0;
-
-        // Callback expected by the sorting function:
-        // code: 0=Compare(a,b), 1=Swap(a,b), 2=MarkSorted(a,_)
-        auto step_cb = [this](const size_t code, const size_t a,
-                              const size_t b) {
-            switch (code) {
-                case 0:
-                    steps_.emplaceLast(Step{StepType::Compare, a, b});
-                    break;
-                case 1:
-                    steps_.emplaceLast(Step{StepType::Swap, a, b});
-                    break;
-                case 2:
-                    steps_.emplaceLast(Step{StepType::MarkSorted, a, b});
-                    break;
-                default:
-                    break;
-            }
-        };
-
-        // Run the sort with instrumentation to collect steps
-        sortFunc(array, step_cb);
+        steps_.reset();
+        steps_ = std::make_unique<array_algorithms::StepStream>(
+            [copy = array, sortFunc = std::forward<SortFunc>(sortFunc)](
+                array_algorithms::StepSink& sink) mutable {
+                sortFunc(copy, sink);
+            });
 
         // Configure timer interval for playback
         timer_.setInterval(intervalMs);
@@ -142,14 +163,14 @@ class SortAnimator final : public QObject {
      * Constructor that starts the animation immediately
      *
      * @tparam Type The type of the elements in the array
-     * @param array The array to be sorted
+     * @param array The array whose sorting is animated (left unchanged)
      * @param widget The widget to display the animation
      * @param sortFunc The sorting function to use
      * @param intervalMs The interval between steps in milliseconds
      * @param parent The parent QObject
      */
     template <typename Type, typename SortFunc>
-    SortAnimator(containers::DynamicArray<Type>& array, ArrayWidget* widget,
+    SortAnimator(const containers::DynamicArray<Type>& array, ArrayWidget* widget,
                  SortFunc&& sortFunc, const int intervalMs,
                  QObject* parent = nullptr)
         : QObject(parent), widget_(widget) {
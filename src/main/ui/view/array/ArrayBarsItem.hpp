@@ -0,0 +1,237 @@
+#ifndef ARRAY_BARS_ITEM_HPP
+#define ARRAY_BARS_ITEM_HPP
+
+
+#include <QColor>
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QRectF>
+#include <QStyleOptionGraphicsItem>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+
+#include "DynamicArray.hpp"
+
+
+namespace ui {
+
+
+/**
+ * @class ArrayBarsItem
+ *
+ * @brief A single graphics item that draws a whole array as vertical bars.
+ *
+ * Used by ArrayWidget for arrays too large for one item per element. The
+ * item keeps one normalized height and one state byte per element; changing
+ * an element only invalidates that element's column, and paint() redraws
+ * only the exposed columns, so an animation frame costs O(1) in the array
+ * size.
+ *
+ * When there are more elements than device pixels across, each pixel column
+ * draws the bucket of elements it covers as one line: as tall as the
+ * bucket's tallest element and in the color of its most important state
+ * (highlighted over not found over unsorted over sorted), so a single
+ * highlighted element stays visible among a million.
+ */
+class ArrayBarsItem final : public QGraphicsItem {
+  public:
+    /// Display state of one element, in increasing order of importance.
+    enum class State : std::uint8_t { Sorted, Normal, NotFound, Highlighted };
+
+  private:
+    containers::DynamicArray<float> heights_;
+    containers::DynamicArray<State> states_;
+    containers::DynamicArray<size_t> highlighted_;
+    qreal width_;
+    qreal height_;
+
+
+    static QColor colorOf(const State state) {
+        switch (state) {
+            case State::Sorted:
+                return Qt::green;
+            case State::NotFound:
+                return Qt::red;
+            case State::Highlighted:
+                return Qt::yellow;
+            case State::Normal:
+                break;
+        }
+        return Qt::white;
+    }
+
+    /// Scene-space width of one element.
+    [[nodiscard]]
+    qreal step() const noexcept {
+        return width_ / static_cast<qreal>(heights_.size());
+    }
+
+    /// Invalidates the column of the element at index.
+    void updateIndex(const size_t index) {
+        const qreal x = static_cast<qreal>(index) * step();
+        update(QRectF(x, 0.0, step(), height_));
+    }
+
+    void setState(const size_t index, const State state) {
+        if (states_[index] == State::Sorted || states_[index] == state)
+            return;
+        states_[index] = state;
+        updateIndex(index);
+    }
+
+    void highlightOne(const size_t index) {
+        if (index < size()) {
+            setState(index, State::Highlighted);
+            highlighted_.addLast(index);
+        }
+    }
+
+  public:
+    /**
+     * @brief Creates the item for the given values.
+     *
+     * @param values Values to draw; heights are proportional to value /
+     * maximum value.
+     * @param width Scene width of the item; the view scales it to fit.
+     * @param height Scene height of the tallest bar.
+     */
+    template <typename Type>
+    ArrayBarsItem(const containers::DynamicArray<Type>& values, const qreal width,
+                  const qreal height)
+        : heights_(values.size()), states_(values.size()), width_(width), height_(height) {
+        setFlag(ItemUsesExtendedStyleOption);
+
+        Type maxVal = values.size() > 0 ? values[0] : Type{};
+        for (const auto& v : values)
+            if (v > maxVal)
+                maxVal = v;
+        const double scale = maxVal == Type{} ? 1.0 : 1.0 / static_cast<double>(maxVal);
+
+        for (const auto& v : values) {
+            heights_.addLast(static_cast<float>(static_cast<double>(v) * scale));
+            states_.addLast(State::Normal);
+        }
+    }
+
+
+    [[nodiscard]]
+    QRectF boundingRect() const override {
+        return {0.0, 0.0, width_, height_};
+    }
+
+
+    /**
+     * @brief Draws the columns inside the exposed rectangle.
+     *
+     * One column per element while elements are at least a device pixel
+     * wide; otherwise one column per device pixel, covering a bucket of
+     * elements.
+     */
+    void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget*) override {
+        const size_t n = heights_.size();
+        if (n == 0)
+            return;
+
+        const qreal pixelsPerUnit = std::max(painter->worldTransform().m11(), qreal{1e-9});
+        const qreal elementPixels = step() * pixelsPerUnit;
+        const QRectF exposed = option->exposedRect.intersected(boundingRect());
+
+        const auto drawBar = [&](const qreal x, const qreal w, const float h, const State state) {
+            const qreal barHeight = static_cast<qreal>(h) * height_;
+            painter->fillRect(QRectF(x, height_ - barHeight, w, barHeight), colorOf(state));
+        };
+
+        if (elementPixels >= 1.0) {
+            const auto first = static_cast<size_t>(std::max(0.0, std::floor(exposed.left() / step())));
+            const auto last = std::min(n, static_cast<size_t>(std::ceil(exposed.right() / step())) + 1);
+            // Leave a gap between bars once they are wide enough to show one.
+            const qreal gap = elementPixels >= 4.0 ? step() / 6.0 : 0.0;
+            for (size_t i = first; i < last; ++i)
+                drawBar(static_cast<qreal>(i) * step(), step() - gap, heights_[i], states_[i]);
+            return;
+        }
+
+        const qreal columnWidth = 1.0 / pixelsPerUnit;
+        const auto columns = static_cast<size_t>(std::ceil(width_ * pixelsPerUnit));
+        const auto firstColumn = static_cast<size_t>(std::max(0.0, std::floor(exposed.left() * pixelsPerUnit)));
+        const auto lastColumn = std::min(columns, static_cast<size_t>(std::ceil(exposed.right() * pixelsPerUnit)) + 1);
+        for (size_t column = firstColumn; column < lastColumn; ++column) {
+            const size_t begin = column * n / columns;
+            const size_t end = std::max(begin + 1, std::min(n, (column + 1) * n / columns));
+            float tallest = 0.0f;
+            State state = State::Sorted;
+            for (size_t i = begin; i < end; ++i) {
+                tallest = std::max(tallest, heights_[i]);
+                state = std::max(state, states_[i]);
+            }
+            drawBar(static_cast<qreal>(column) * columnWidth, columnWidth, tallest, state);
+        }
+    }
+
+
+    /// Number of elements drawn.
+    [[nodiscard]]
+    size_t size() const noexcept {
+        return heights_.size();
+    }
+
+    /// Scene x coordinate of the center of the element at index.
+    [[nodiscard]]
+    qreal centerOf(const size_t index) const noexcept {
+        return (static_cast<qreal>(index) + 0.5) * step();
+    }
+
+
+    /// Highlights the given elements and clears the previous highlight;
+    /// with no indices it only clears. Indices out of range are ignored.
+    template <typename... Indices>
+    void highlight(const Indices... indices) {
+        for (const size_t index : highlighted_)
+            if (states_[index] == State::Highlighted)
+                setState(index, State::Normal);
+        highlighted_.clear();
+
+        (highlightOne(static_cast<size_t>(indices)), ...);
+    }
+
+    /// Marks an element as sorted (or found); it keeps that state.
+    void markSorted(const size_t index) {
+        if (index < size() && states_[index] != State::Sorted) {
+            states_[index] = State::Sorted;
+            updateIndex(index);
+        }
+    }
+
+    /// Marks every element that is not sorted as not found.
+    void markAllNotFound() {
+        for (State& state : states_)
+            if (state != State::Sorted)
+                state = State::NotFound;
+        update();
+    }
+
+    /// Exchanges two elements, heights and states. A highlight moves with
+    /// its element and is still cleared by the next highlight().
+    void swap(const size_t first, const size_t second) {
+        if (first >= size() || second >= size() || first == second)
+            return;
+        std::swap(heights_[first], heights_[second]);
+        std::swap(states_[first], states_[second]);
+        for (size_t& index : highlighted_) {
+            if (index == first)
+                index = second;
+            else if (index == second)
+                index = first;
+        }
+        updateIndex(first);
+        updateIndex(second);
+    }
+};
+
+
+} // namespace ui
+
+#endif // ARRAY_BARS_ITEM_HPP
@@ -128,8 +128,8 @@ void ArrayPage::setupAndShowAnimation(QWidget* view, QObject* animator,
  * original UI.
  */
 void ArrayPage::showLinearSearch() {
-    auto values = generateRandomDoubleArray();
-    const double target = values[18];
+    auto values = generateRandomDoubleArray(arraySize());
+    const double target = values[values.size() * 3 / 4];
     auto [view, animator] = createLinearSearchAnimation(values, target);
     setupAndShowAnimation(view, animator, "Dynamic Array - Linear Search");
 }
@@ -144,8 +144,8 @@ void ArrayPage::showLinearSearch() {
  * original UI.
  */
 void ArrayPage::showBinarySearch() {
-    auto values = generateSortedDoubleArray();
-    const double target = values[18];
+    auto values = generateSortedDoubleArray(arraySize());
+    const double target = values[values.size() * 3 / 4];
     auto [view, animator] = createBinarySearchAnimation(values, target);
     setupAndShowAnimation(view, animator, "Dynamic Array - Binary Search");
 }
@@ -160,7 +160,7 @@ void ArrayPage::showBinarySearch() {
  * original UI.
  */
 void ArrayPage::showBubbleSort() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createBubbleSortAnimation(values);
     setupAndShowAnimation(view, animator, "Dynamic Array - Bubble Sort");
 }
@@ -175,7 +175,7 @@ void ArrayPage::showBubbleSort() {
  * original UI.
  */
 void ArrayPage::showImprovedBubbleSort() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createImprovedBubbleSortAnimation(values);
     setupAndShowAnimation(view, animator,
                           "Dynamic Array - Improved Bubble Sort");
@@ -191,7 +191,7 @@ void ArrayPage::showImprovedBubbleSort() {
  * the "Back" button restores the original UI.
  */
 void ArrayPage::showInsertSortLS() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createInsertSortLSAnimation(values);
     setupAndShowAnimation(view, animator,
                           "Dynamic Array - Insertion Sort with Linear Search");
@@ -207,7 +207,7 @@ void ArrayPage::showInsertSortLS() {
  * the "Back" button restores the original UI.
  */
 void ArrayPage::showInsertSortBS() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createInsertSortBSAnimation(values);
     setupAndShowAnimation(view, animator,
                           "Dynamic Array - Insertion Sort with Binary Search");
@@ -223,7 +223,7 @@ void ArrayPage::showInsertSortBS() {
  * original UI.
  */
 void ArrayPage::showQuickSort() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createQuickSortAnimation(values);
     setupAndShowAnimation(view, animator, "Dynamic Array - Quick Sort");
 }
@@ -238,7 +238,7 @@ void ArrayPage::showQuickSort() {
  * original UI.
  */
 void ArrayPage::showMergeSort() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createMergeSortAnimation(values);
     setupAndShowAnimation(view, animator, "Dynamic Array - Merge Sort");
 }
@@ -253,7 +253,7 @@ void ArrayPage::showMergeSort() {
  * original UI.
  */
 void ArrayPage::showHeapSort() {
-    auto values = generateRandomDoubleArray();
+    auto values = generateRandomDoubleArray(arraySize());
     auto [view, animator] = createHeapSortAnimation(values);
     setupAndShowAnimation(view, animator, "Dynamic Array - Heap Sort");
 }
@@ -323,6 +323,12 @@ void ArrayPage::replaceContent(QWidget* container, QWidget* newChild) {
 }
 
 
+/// Number of elements chosen for the next animation
+size_t ArrayPage::arraySize() const {
+    return static_cast<size_t>(uiForm_->spinArraySize->value());
+}
+
+
 /// Destructor that cleans up the UI form
 ArrayPage::~ArrayPage() { delete uiForm_; }
 
@@ -45,6 +45,7 @@ class ArrayPage final : public QWidget {
     void connectButtonActions();
     void setupAndShowAnimation(QWidget* view, QObject* animator,
                                const QString& windowTitle);
+    [[nodiscard]] size_t arraySize() const;
 
 
   private slots:
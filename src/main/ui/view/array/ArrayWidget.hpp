@@ -11,12 +11,14 @@
 #include <QPointF>
 #include <QPolygonF>
 #include <QRectF>
+#include <QResizeEvent>
 #include <QString>
 #include <QVariantAnimation>
 #include <QWidget>
 #include <utility>
 
 
+#include "ArrayBarsItem.hpp"
 #include "DynamicArray.hpp"
 
 
@@ -34,18 +36,70 @@ namespace ui {
  * examined. Cells can be highlighted to indicate the current focus of an
  * algorithm, and can be marked to show whether the target element was found or
  * not found.
+ *
+ * Small arrays get one animated rectangle item per element. Large arrays
+ * are drawn by a single ArrayBarsItem stretched to the view's width, which
+ * repaints only the columns an animation step touches and buckets elements
+ * per pixel column once they outnumber the pixels, so arrays of a million
+ * elements animate at full timer rate.
  */
 class ArrayWidget final : public QGraphicsView {
 
+  public:
+    /// How the elements are drawn.
+    enum class RenderMode {
+        Auto,   ///< Cells up to CELL_LIMIT elements, bars beyond.
+        Cells,  ///< One rectangle item per element, with animated swaps.
+        Bars    ///< One ArrayBarsItem for the whole array.
+    };
+
+    /// Largest array drawn with one item per element in RenderMode::Auto.
+    static constexpr size_t CELL_LIMIT = 256;
+
+  private:
     QGraphicsScene* scene_;
     QGraphicsPolygonItem* arrow_;
     containers::DynamicArray<QGraphicsRectItem*> cells_;
+    ArrayBarsItem* bars_ = nullptr;
+    containers::DynamicArray<size_t> highlighted_;
     int animationDurationMs_ = 300;
 
     static constexpr qreal BAR_WIDTH = 25.0;
     static constexpr qreal BAR_SPACING = 5.0;
     static constexpr qreal MAX_BAR_HEIGHT = 200.0;
     static constexpr qreal ARROW_OFFSET_Y = 15.0;
+    static constexpr qreal BARS_WIDTH = 1000.0;
+
+
+    /// Number of elements displayed in either mode.
+    [[nodiscard]]
+    size_t elementCount() const noexcept {
+        return bars_ ? bars_->size() : cells_.size();
+    }
+
+    /// Resets the cells highlighted by the previous call to white.
+    void clearCellHighlight() {
+        for (const size_t index : highlighted_)
+            if (index < cells_.size() && cells_[index]->brush().color() != Qt::green)
+                cells_[index]->setBrush(QBrush{Qt::white});
+        highlighted_.clear();
+    }
+
+    void highlightCell(const size_t index, const Qt::GlobalColor color) {
+        if (index < cells_.size() && cells_[index]->brush().color() != Qt::green) {
+            cells_[index]->setBrush(QBrush{color});
+            highlighted_.addLast(index);
+        }
+    }
+
+
+  protected:
+    /// Stretches the bars to the view's size.
+    void resizeEvent(QResizeEvent* event) override {
+        QGraphicsView::resizeEvent(event);
+        if (bars_)
+            fitInView(scene_->sceneRect(), Qt::IgnoreAspectRatio);
+    }
 
 
   public:
@@ -58,10 +112,12 @@ class ArrayWidget final : public QGraphicsView {
      *
      * @param values The array of integer values to visualize.
      * @param parent The parent QWidget, defaulting to nullptr.
+     * @param mode How to draw the elements; by default chosen by size.
      */
     template <typename Type>
     explicit ArrayWidget(const containers::DynamicArray<Type>& values,
-                         QWidget* parent = nullptr)
+                         QWidget* parent = nullptr,
+                         const RenderMode mode = RenderMode::Auto)
         : QGraphicsView(parent), scene_(new QGraphicsScene(this)),
           arrow_(nullptr) {
         setScene(scene_);
@@ -71,6 +127,28 @@ class ArrayWidget final : public QGraphicsView {
         QPen pen(Qt::black);
         pen.setWidth(1);
 
+        const QPolygonF polygon{
+            QPointF{0.0, 0.0},
+            QPointF{-8.0, 15.0},
+            QPointF{8.0, 15.0}
+        };
+
+        if (mode == RenderMode::Bars || (mode == RenderMode::Auto && values.size() > CELL_LIMIT)) {
+            bars_ = new ArrayBarsItem(values, BARS_WIDTH, MAX_BAR_HEIGHT);
+            scene_->addItem(bars_);
+
+            // The view stretches the scene; keep the arrow its natural size.
+            arrow_ = scene_->addPolygon(polygon, pen, QBrush{Qt::cyan});
+            arrow_->setFlag(QGraphicsItem::ItemIgnoresTransformations);
+            setArrowPosition(0);
+
+            scene_->setSceneRect(0, 0, BARS_WIDTH, MAX_BAR_HEIGHT + ARROW_OFFSET_Y + 30);
+            setOptimizationFlags(QGraphicsView::DontSavePainterState);
+            setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+            setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+            return;
+        }
+
         Type maxVal = values[0];
         for (const auto& v : values)
             if (v > maxVal)
@@ -88,12 +166,6 @@ class ArrayWidget final : public QGraphicsView {
             cells_.addLast(rect);
         }
 
-        const QPolygonF polygon{
-            QPointF{0.0, 0.0},
-            QPointF{-8.0, 15.0},
-            QPointF{8.0, 15.0}
-        };
-
         arrow_ = scene_->addPolygon(polygon, pen, QBrush{Qt::cyan});
         setArrowPosition(0);
 
@@ -106,42 +178,38 @@ class ArrayWidget final : public QGraphicsView {
 
     /**
      * @brief Highlights the cell at the specified index by changing its color
-     * to yellow, and resets all other cells to white. Also moves the arrow
-     * above the highlighted cell.
+     * to yellow, and resets the previously highlighted cells to white. Cells
+     * marked green keep their color.
      *
      * @param index The index of the cell to highlight.
      * @param color The color to highlight the cell with.
      */
     void highlightIndex(const size_t index,
-                        const Qt::GlobalColor color = Qt::yellow) const {
-        for (auto* cell : cells_)
-            if (cell->brush().color() != Qt::green)
-                cell->setBrush(QBrush{Qt::white});
-
-        if (index < cells_.size() &&
-            cells_[index]->brush().color() != Qt::green)
-            cells_[index]->setBrush(QBrush{color});
+                        const Qt::GlobalColor color = Qt::yellow) {
+        if (bars_) {
+            bars_->highlight(index);
+            return;
+        }
+        clearCellHighlight();
+        highlightCell(index, color);
     }
 
 
     /**
      * @brief Highlights two cells at the specified indices.
      *
-     * Resets all other cells to white before applying the highlight color to
-     * the provided indices.
+     * Resets the previously highlighted cells to white before applying the
+     * highlight color to the provided indices.
      */
     void highlightIndices(const size_t first, const size_t second,
-                          const Qt::GlobalColor color = Qt::yellow) const {
-        for (auto* cell : cells_)
-            if (cell->brush().color() != Qt::green)
-                cell->setBrush(QBrush{Qt::white});
-
-        if (first < cells_.size() &&
-            cells_[first]->brush().color() != Qt::green)
-            cells_[first]->setBrush(QBrush{color});
-        if (second < cells_.size() &&
-            cells_[second]->brush().color() != Qt::green)
-            cells_[second]->setBrush(QBrush{color});
+                          const Qt::GlobalColor color = Qt::yellow) {
+        if (bars_) {
+            bars_->highlight(first, second);
+            return;
+        }
+        clearCellHighlight();
+        highlightCell(first, color);
+        highlightCell(second, color);
     }
 
 
@@ -153,17 +221,21 @@ class ArrayWidget final : public QGraphicsView {
      * @param index The index of the cell above which to position the arrow.
      */
     void setArrowPosition(const size_t index) const {
-        if (!arrow_ || index >= cells_.size())
+        if (!arrow_ || index >= elementCount())
             return;
 
-        const qreal x = static_cast<qreal>(index) * (BAR_WIDTH + BAR_SPACING) + BAR_WIDTH / 2.0;
+        const qreal x = bars_ ? bars_->centerOf(index)
+                              : static_cast<qreal>(index) * (BAR_WIDTH + BAR_SPACING) + BAR_WIDTH / 2.0;
         constexpr qreal y = MAX_BAR_HEIGHT + ARROW_OFFSET_Y;
         arrow_->setPos(x, y);
     }
 
 
     /// Hides the arrow from view.
-    void hideArrow() const { arrow_->hide(); }
+    void hideArrow() const {
+        if (arrow_)
+            arrow_->hide();
+    }
 
 
     /**
@@ -173,13 +245,17 @@ class ArrayWidget final : public QGraphicsView {
      * @param index The index of the cell to mark as found.
      */
     void markFound(const size_t index) const {
-        if (index < cells_.size())
+        if (bars_)
+            bars_->markSorted(index);
+        else if (index < cells_.size())
             cells_[index]->setBrush(QBrush{Qt::green});
     }
 
 
     /// Marks all cells as not found by setting their color to red.
     void markNotFound() const {
+        if (bars_)
+            bars_->markAllNotFound();
         for (auto* cell : cells_)
             cell->setBrush(QBrush{Qt::red});
     }
@@ -199,12 +275,17 @@ class ArrayWidget final : public QGraphicsView {
      * exchanging positions.
      *
      * The two indexed cells move upward, cross over, and settle back in the
-     * opposite locations. Indices outside the array are ignored.
+     * opposite locations. Indices outside the array are ignored. Bars are
+     * swapped instantly.
      *
      * @param first Index of the first cell to swap.
      * @param second Index of the second cell to swap.
      */
     void swapCells(const size_t first, const size_t second) {
+        if (bars_) {
+            bars_->swap(first, second);
+            return;
+        }
         if (first >= cells_.size() || second >= cells_.size() ||
             first == second)
             return;
@@ -231,6 +312,14 @@ class ArrayWidget final : public QGraphicsView {
             rect2->setX(x1);
 
             std::swap(cells_[first], cells_[second]);
+            // A highlighted cell keeps its color, so clearCellHighlight()
+            // has to find it at its new index.
+            for (size_t& index : highlighted_) {
+                if (index == first)
+                    index = second;
+                else if (index == second)
+                    index = first;
+            }
             anim->deleteLater();
         });
 
@@ -1,8 +1,18 @@
 #include "DynamicArray.hpp"
 #include "ArrayAlgorithms.hpp"
+#include "CountingResource.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
 
 using containers::DynamicArray;
 using namespace array_algorithms;
@@ -123,3 +133,808 @@ TEST_F(DynamicArrayAlgorithmsUnitTest, LinearSearchCannotFindElement) {
     const DynamicArray arr{6, 4, 9, 3, 3, 6, 2, 1, 7};
     EXPECT_EQ(LinearSearch(arr, 0), arr.size());
 }
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, SortsUseTheArrayAllocator) {
+    CountingResource resource;
+    {
+        containers::pmr::DynamicArray<int> arr({6, 4, 9, 3, 3, 6, 2, 1, 7}, &resource);
+        containers::pmr::DynamicArray<int> radix(arr, &resource);
+        containers::pmr::DynamicArray<int> bins(arr, &resource);
+        const size_t before = resource.allocations;
+
+        MergeSort(arr);
+        RadixSortLSD(radix);
+        BinSort(bins, static_cast<size_t>(10));
+
+        EXPECT_GT(resource.allocations, before);
+        EXPECT_TRUE(isSorted(arr));
+        EXPECT_TRUE(isSorted(radix));
+        EXPECT_TRUE(isSorted(bins));
+    }
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+}
+
+
+namespace {
+
+/// Sorts a copy with std::sort and checks HybridSort agrees with it.
+template <typename Type>
+void ExpectHybridSortMatchesStdSort(const std::vector<Type>& input) {
+    DynamicArray<Type> arr;
+    for (const Type& value : input)
+        arr.addLast(value);
+    std::vector<Type> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    HybridSort(arr);
+
+    ASSERT_EQ(arr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_EQ(arr[i], expected[i]) << "at index " << i;
+}
+
+} // namespace
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HybridSortCorrectlySorts) {
+    DynamicArray arr{6, 4, 9, 3, 3, 6, 2, 1, 7};
+    HybridSort(arr);
+    for (std::size_t i = 1; i < arr.size(); i++)
+        EXPECT_LE(arr[i - 1], arr[i]);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HybridSortHandlesInputPatterns) {
+    constexpr int n = 5000;
+    std::mt19937 rng(12345);
+    std::vector<int> random(n), sorted(n), reversed(n), few_unique(n), organ_pipe(n);
+    for (int i = 0; i < n; ++i) {
+        random[i] = static_cast<int>(rng());
+        sorted[i] = i;
+        reversed[i] = n - i;
+        few_unique[i] = static_cast<int>(rng() % 4);
+        organ_pipe[i] = i < n / 2 ? i : n - i;
+    }
+    std::vector<int> noisy = sorted;
+    for (int i = 0; i < n / 100; ++i)
+        std::swap(noisy[rng() % n], noisy[rng() % n]);
+
+    ExpectHybridSortMatchesStdSort(random);
+    ExpectHybridSortMatchesStdSort(sorted);
+    ExpectHybridSortMatchesStdSort(reversed);
+    ExpectHybridSortMatchesStdSort(few_unique);
+    ExpectHybridSortMatchesStdSort(organ_pipe);
+    ExpectHybridSortMatchesStdSort(noisy);
+    ExpectHybridSortMatchesStdSort(std::vector<int>(n, 7));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HybridSortSortsDoublesAndStrings) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    std::vector<double> doubles(3000);
+    for (double& value : doubles)
+        value = dist(rng);
+    ExpectHybridSortMatchesStdSort(doubles);
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 500; ++i)
+        strings.push_back(std::to_string(rng() % 50));
+    ExpectHybridSortMatchesStdSort(strings);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HybridSortReportsEveryIndexAsSorted) {
+    std::mt19937 rng(99);
+    DynamicArray<int> arr;
+    for (int i = 0; i < 2000; ++i)
+        arr.addLast(static_cast<int>(rng() % 16));
+
+    std::vector<int> marks(arr.size(), 0);
+    size_t swaps = 0;
+    HybridSort(arr, [&](const size_t code, const size_t a, const size_t b) {
+        ASSERT_LT(a, arr.size());
+        if (code == 1) {
+            ASSERT_LT(b, arr.size());
+            ++swaps;
+        } else if (code == 2) {
+            ++marks[a];
+        }
+    });
+
+    EXPECT_TRUE(isSorted(arr));
+    EXPECT_GT(swaps, 0u);
+    for (size_t i = 0; i < marks.size(); ++i)
+        EXPECT_EQ(marks[i], 1) << "index " << i;
+}
+
+
+namespace {
+
+/// Key-only ordering with a sequence number to observe stability.
+struct Tagged {
+    int key;
+    int order;
+
+    bool operator<(const Tagged& other) const noexcept { return key < other.key; }
+    bool operator<=(const Tagged& other) const noexcept { return key <= other.key; }
+    bool operator>(const Tagged& other) const noexcept { return key > other.key; }
+    bool operator>=(const Tagged& other) const noexcept { return key >= other.key; }
+};
+
+} // namespace
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortIsStableAcrossRuns) {
+    std::mt19937 rng(3);
+    DynamicArray<Tagged> arr;
+    for (int i = 0; i < 4000; ++i)
+        arr.addLast(Tagged{static_cast<int>(rng() % 50), i});
+
+    MergeSort(arr);
+
+    for (size_t i = 1; i < arr.size(); ++i) {
+        ASSERT_LE(arr[i - 1].key, arr[i].key);
+        if (arr[i - 1].key == arr[i].key) {
+            ASSERT_LT(arr[i - 1].order, arr[i].order);
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortMergesPresortedAndReversedSegments) {
+    std::mt19937 rng(11);
+    std::vector<int> input;
+    for (int segment = 0; segment < 20; ++segment) {
+        const int length = 100 + static_cast<int>(rng() % 900);
+        const int offset = static_cast<int>(rng() % 10000);
+        for (int i = 0; i < length; ++i)
+            input.push_back(segment % 3 == 0 ? offset - i : offset + i);
+    }
+    DynamicArray<int> arr;
+    for (const int value : input)
+        arr.addLast(value);
+    std::sort(input.begin(), input.end());
+
+    MergeSort(arr);
+
+    ASSERT_EQ(arr.size(), input.size());
+    for (size_t i = 0; i < input.size(); ++i)
+        ASSERT_EQ(arr[i], input[i]) << "at index " << i;
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortReusesCallerScratch) {
+    CountingResource resource;
+    {
+        std::mt19937 rng(5);
+        containers::pmr::DynamicArray<int> scratch(&resource);
+        containers::pmr::DynamicArray<int> arr(&resource);
+        for (int i = 0; i < 1000; ++i)
+            arr.addLast(static_cast<int>(rng()));
+        containers::pmr::DynamicArray<int> copy(arr, &resource);
+
+        MergeSort(arr, scratch);
+        const size_t after_first = resource.allocations;
+        MergeSort(copy, scratch);
+
+        EXPECT_EQ(resource.allocations, after_first);
+        EXPECT_TRUE(isSorted(arr));
+        EXPECT_TRUE(isSorted(copy));
+        EXPECT_TRUE(scratch.isEmpty());
+    }
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+}
+
+
+namespace {
+
+/// A record sorted by one of its fields.
+struct Employee {
+    std::string name;
+    unsigned age;
+    double salary;
+};
+
+DynamicArray<Employee> MakeEmployees() {
+    DynamicArray<Employee> staff;
+    staff.addLast(Employee{"Dora", 41, 5200.0});
+    staff.addLast(Employee{"Adam", 29, 4100.0});
+    staff.addLast(Employee{"Cleo", 35, 6100.0});
+    staff.addLast(Employee{"Bence", 29, 3900.0});
+    staff.addLast(Employee{"Eszter", 52, 7000.0});
+    staff.addLast(Employee{"Fanni", 35, 4800.0});
+    return staff;
+}
+
+} // namespace
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, SortsAcceptComparatorAndProjection) {
+    auto by_quick = MakeEmployees();
+    QuickSort(by_quick, {}, &Employee::name);
+    EXPECT_EQ(by_quick[0].name, "Adam");
+    EXPECT_EQ(by_quick[5].name, "Fanni");
+
+    auto by_heap = MakeEmployees();
+    HeapSort(by_heap, std::ranges::greater{}, &Employee::salary);
+    for (size_t i = 1; i < by_heap.size(); ++i)
+        EXPECT_GE(by_heap[i - 1].salary, by_heap[i].salary);
+
+    DynamicArray<int> numbers{6, 4, 9, 3, 3, 6, 2, 1, 7};
+    QuickSort(numbers, std::ranges::greater{});
+    for (size_t i = 1; i < numbers.size(); ++i)
+        EXPECT_GE(numbers[i - 1], numbers[i]);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MergeSortWithProjectionIsStable) {
+    auto staff = MakeEmployees();
+    MergeSort(staff, {}, &Employee::age);
+
+    const char* expected[] = {"Adam", "Bence", "Cleo", "Fanni", "Dora", "Eszter"};
+    for (size_t i = 0; i < staff.size(); ++i)
+        EXPECT_EQ(staff[i].name, expected[i]);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BinarySearchFindsProjectedKey) {
+    auto staff = MakeEmployees();
+    MergeSort(staff, {}, &Employee::age);
+
+    EXPECT_EQ(BinarySearch(staff, 35u, {}, &Employee::age), 2u);
+    EXPECT_EQ(BinarySearch(staff, 29u, {}, &Employee::age), 0u);
+    EXPECT_EQ(BinarySearch(staff, 30u, {}, &Employee::age), staff.size());
+
+    const DynamicArray<int> descending{9, 7, 5, 3, 1};
+    EXPECT_EQ(BinarySearch(descending, 3, std::ranges::greater{}), 3u);
+    EXPECT_EQ(BinarySearch(descending, 4, std::ranges::greater{}), descending.size());
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortLSDSortsByUnsignedKey) {
+    auto staff = MakeEmployees();
+    RadixSortLSD(staff, [](const Employee& e) { return e.age; });
+    for (size_t i = 1; i < staff.size(); ++i)
+        EXPECT_LE(staff[i - 1].age, staff[i].age);
+    EXPECT_EQ(staff[0].name, "Adam"); // stable among equal ages
+    EXPECT_EQ(staff[1].name, "Bence");
+
+    // Composite key: age first, then name length.
+    auto composite = MakeEmployees();
+    RadixSortLSD(composite, [](const Employee& e) {
+        return (static_cast<std::uint64_t>(e.age) << 32) | e.name.size();
+    });
+    EXPECT_EQ(composite[0].name, "Adam");
+    EXPECT_EQ(composite[1].name, "Bence");
+    EXPECT_EQ(composite[2].name, "Cleo");
+    EXPECT_EQ(composite[3].name, "Fanni");
+
+    // Small keys take a single pass.
+    DynamicArray<int> values{300, 5, 258, 1, 7};
+    RadixSortLSD(values, [](const int v) { return static_cast<std::uint8_t>(v); });
+    EXPECT_EQ(values[0], 1);
+    EXPECT_EQ(values[1], 258);
+    EXPECT_EQ(values[2], 5);
+    EXPECT_EQ(values[3], 7);
+    EXPECT_EQ(values[4], 300);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, ArgSortReturnsStableSortingPermutation) {
+    const DynamicArray arr{6, 4, 9, 3, 3, 6, 2, 1, 7};
+    const auto permutation = ArgSort(arr);
+
+    const size_t expected[] = {7, 6, 3, 4, 1, 0, 5, 8, 2};
+    ASSERT_EQ(permutation.size(), arr.size());
+    for (size_t i = 0; i < permutation.size(); ++i)
+        EXPECT_EQ(permutation[i], expected[i]);
+    EXPECT_EQ(arr[0], 6); // input untouched
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, ArgSortSupportsNarrowIndicesAndProjections) {
+    const auto staff = MakeEmployees();
+    const DynamicArray<std::uint32_t> permutation =
+        ArgSort<std::uint32_t>(staff, std::ranges::greater{}, &Employee::salary);
+
+    for (size_t i = 1; i < permutation.size(); ++i)
+        EXPECT_GE(staff[permutation[i - 1]].salary, staff[permutation[i]].salary);
+
+    DynamicArray<int> wide(300);
+    for (int i = 0; i < 300; ++i)
+        wide.addLast(300 - i);
+    EXPECT_THROW(ArgSort<std::uint8_t>(wide), std::length_error);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, ApplyPermutationReordersParallelColumns) {
+    std::mt19937 rng(21);
+    DynamicArray<int> keys;
+    DynamicArray<std::string> labels;
+    for (int i = 0; i < 1000; ++i) {
+        const int key = static_cast<int>(rng() % 100);
+        keys.addLast(key);
+        labels.addLast("item" + std::to_string(key));
+    }
+
+    const auto permutation = ArgSort(keys);
+    ApplyPermutation(keys, permutation);
+    ApplyPermutation(labels, permutation);
+
+    EXPECT_TRUE(isSorted(keys));
+    for (size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(labels[i], "item" + std::to_string(keys[i]));
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, ApplyPermutationRejectsInvalidPermutations) {
+    DynamicArray arr{10, 20, 30};
+    const DynamicArray<size_t> duplicate{0, 0, 1};
+    const DynamicArray<size_t> out_of_range{0, 1, 3};
+    const DynamicArray<size_t> too_short{0, 1};
+
+    EXPECT_THROW(ApplyPermutation(arr, duplicate), std::invalid_argument);
+    EXPECT_THROW(ApplyPermutation(arr, out_of_range), std::invalid_argument);
+    EXPECT_THROW(ApplyPermutation(arr, too_short), std::invalid_argument);
+    EXPECT_EQ(arr[0], 10);
+    EXPECT_EQ(arr[1], 20);
+    EXPECT_EQ(arr[2], 30);
+
+    const DynamicArray<size_t> rotate{2, 0, 1};
+    ApplyPermutation(arr, rotate);
+    EXPECT_EQ(arr[0], 30);
+    EXPECT_EQ(arr[1], 10);
+    EXPECT_EQ(arr[2], 20);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortsOrderFloatingPointValues) {
+    const double inf = std::numeric_limits<double>::infinity();
+    const std::vector<double> input{3.5, -0.0, -inf, 1e-300, -2.25, 0.0, inf, -1e-300, 42.0, -42.0};
+    std::vector<double> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    DynamicArray<double> lsd;
+    DynamicArray<double> msd;
+    DynamicArray<float> floats;
+    for (const double value : input) {
+        lsd.addLast(value);
+        msd.addLast(value);
+        floats.addLast(static_cast<float>(value));
+    }
+
+    RadixSortLSD(lsd);
+    RadixSortMSD(msd);
+    RadixSortLSD(floats);
+
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(lsd[i], expected[i]);
+        EXPECT_EQ(msd[i], expected[i]);
+    }
+    EXPECT_TRUE(std::signbit(lsd[4])); // -0.0 sorts before +0.0
+    EXPECT_FALSE(std::signbit(lsd[5]));
+    for (size_t i = 1; i < floats.size(); ++i)
+        EXPECT_LE(floats[i - 1], floats[i]);
+}
+
+
+namespace {
+
+/// Counts move assignments to observe how many radix passes ran.
+struct MoveCounted {
+    static inline size_t moves = 0;
+    std::uint64_t key = 0;
+
+    MoveCounted() = default;
+    explicit MoveCounted(const std::uint64_t k) : key(k) {}
+    MoveCounted(const MoveCounted&) = default;
+    MoveCounted& operator=(const MoveCounted&) = default;
+    MoveCounted& operator=(MoveCounted&& other) noexcept {
+        key = other.key;
+        ++moves;
+        return *this;
+    }
+};
+
+} // namespace
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortLSDSkipsBytesSharedByAllKeys) {
+    std::mt19937 rng(8);
+    DynamicArray<MoveCounted> arr;
+    for (int i = 0; i < 1000; ++i)
+        arr.addLast(MoveCounted(0xABCD'0000'0000'0000ULL | (rng() % 256)));
+
+    MoveCounted::moves = 0;
+    RadixSortLSD(arr, [](const MoveCounted& value) { return value.key; });
+
+    // One distribution pass plus the copy back, instead of eight passes.
+    EXPECT_EQ(MoveCounted::moves, 2 * arr.size());
+    for (size_t i = 1; i < arr.size(); ++i)
+        EXPECT_LE(arr[i - 1].key, arr[i].key);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, RadixSortMSDSortsStrings) {
+    std::mt19937 rng(13);
+    std::vector<std::string> input{"", "", "same", "same", "a", "ab", "abc", "\xff", "\x01"};
+    const char* prefixes[] = {"", "user/", "user/alice/", "log-2024-"};
+    for (int i = 0; i < 3000; ++i) {
+        std::string value = prefixes[rng() % 4];
+        const size_t length = rng() % 6;
+        for (size_t c = 0; c < length; ++c)
+            value.push_back(static_cast<char>('a' + rng() % 5));
+        input.push_back(value);
+    }
+
+    DynamicArray<std::string> arr;
+    for (const std::string& value : input)
+        arr.addLast(value);
+    std::sort(input.begin(), input.end());
+
+    RadixSortMSD(arr);
+
+    ASSERT_EQ(arr.size(), input.size());
+    for (size_t i = 0; i < input.size(); ++i)
+        ASSERT_EQ(arr[i], input[i]) << "at index " << i;
+}
+
+
+namespace {
+
+/// Checks LinearSearch() at every position of arrays whose sizes straddle
+/// the vector widths, for one element type.
+template <typename Type>
+void ExpectLinearSearchFindsEveryPosition() {
+    for (size_t n = 0; n <= 140; ++n) {
+        DynamicArray<Type> arr;
+        for (size_t i = 0; i < n; ++i)
+            arr.addLast(static_cast<Type>(i % 100 + 1));
+
+        for (size_t i = 0; i < n && i < 100; ++i)
+            ASSERT_EQ(LinearSearch(arr, arr[i]), i) << "n=" << n;
+        ASSERT_EQ(LinearSearch(arr, static_cast<Type>(0)), n);
+    }
+}
+
+} // namespace
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, VectorizedLinearSearchHandlesAllWidths) {
+    ExpectLinearSearchFindsEveryPosition<std::int8_t>();
+    ExpectLinearSearchFindsEveryPosition<std::uint16_t>();
+    ExpectLinearSearchFindsEveryPosition<int>();
+    ExpectLinearSearchFindsEveryPosition<std::int64_t>();
+    ExpectLinearSearchFindsEveryPosition<float>();
+    ExpectLinearSearchFindsEveryPosition<double>();
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, VectorizedLinearSearchFollowsOperatorEquals) {
+    DynamicArray<double> arr;
+    for (int i = 0; i < 40; ++i)
+        arr.addLast(std::numeric_limits<double>::quiet_NaN());
+    arr.addLast(-0.0);
+
+    EXPECT_EQ(LinearSearch(arr, std::numeric_limits<double>::quiet_NaN()), arr.size());
+    EXPECT_EQ(LinearSearch(arr, 0.0), 40u);
+
+    // A 64-bit value whose low half matches must not be reported.
+    DynamicArray<std::int64_t> wide;
+    for (int i = 0; i < 20; ++i)
+        wide.addLast((std::int64_t{1} << 40) | 7);
+    wide.addLast(7);
+    EXPECT_EQ(LinearSearch(wide, std::int64_t{7}), 20u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, LinearSearchWithCallbackReportsEveryProbe) {
+    const DynamicArray arr{6, 4, 9, 3, 3, 6, 2, 1, 7};
+    size_t probes = 0;
+    EXPECT_EQ(LinearSearch(arr, 3, [&](size_t) { ++probes; }), 3u);
+    EXPECT_EQ(probes, 4u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, BranchlessBinarySearchMatchesLowerBound) {
+    for (size_t n = 0; n <= 80; ++n) {
+        DynamicArray<int> arr;
+        for (size_t i = 0; i < n; ++i)
+            arr.addLast(static_cast<int>(i / 3) * 2); // triplicated even values
+
+        for (int target = -1; target <= static_cast<int>(n); ++target) {
+            size_t expected = n;
+            for (size_t i = 0; i < n; ++i)
+                if (arr[i] == target) {
+                    expected = i;
+                    break;
+                }
+            ASSERT_EQ(BinarySearch(arr, target), expected) << "n=" << n << " target=" << target;
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, CountingInstrumentationTalliesSortEvents) {
+    DynamicArray arr{8, 7, 6, 5, 4, 3, 2, 1};
+    CountingInstrumentation counts;
+    BubbleSort(arr, counts);
+
+    EXPECT_EQ(counts.compares, 28u);
+    EXPECT_EQ(counts.swaps, 28u);
+    EXPECT_EQ(counts.moves(), 84u);
+    EXPECT_EQ(counts.sorted_marks, arr.size());
+    EXPECT_EQ(counts.probes, 0u);
+
+    counts.reset();
+    BubbleSort(arr, counts);
+    EXPECT_EQ(counts.compares, 0u);
+    EXPECT_EQ(counts.swaps, 0u);
+    EXPECT_EQ(counts.sorted_marks, arr.size());
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, CountingInstrumentationMatchesCallbackEvents) {
+    std::mt19937 rng(18);
+    std::uniform_int_distribution<int> dist(0, 50);
+    DynamicArray<int> input;
+    for (int i = 0; i < 300; ++i)
+        input.addLast(dist(rng));
+
+    size_t compares = 0, swaps = 0;
+    DynamicArray<int> expected(input);
+    HybridSort(expected, [&](size_t code, size_t, size_t) {
+        compares += code == SORT_EVENT_COMPARE;
+        swaps += code == SORT_EVENT_SWAP;
+    });
+
+    DynamicArray<int> arr(input);
+    CountingInstrumentation counts;
+    HybridSort(arr, counts);
+
+    EXPECT_EQ(counts.compares, compares);
+    EXPECT_EQ(counts.swaps, swaps);
+    EXPECT_EQ(counts.sorted_marks, arr.size());
+    for (size_t i = 0; i < arr.size(); ++i)
+        EXPECT_EQ(arr[i], expected[i]);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, CountingInstrumentationCountsSearchProbes) {
+    const DynamicArray arr{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+    CountingInstrumentation counts;
+    EXPECT_EQ(LinearSearch(arr, 6, counts), 5u);
+    EXPECT_EQ(counts.probes, 6u);
+
+    counts.reset();
+    EXPECT_EQ(BinarySearch(arr, 11, counts), 10u);
+    EXPECT_GE(counts.probes, 1u);
+    EXPECT_LE(counts.probes, 5u);
+    EXPECT_EQ(counts.compares, 0u);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, NoInstrumentationIsTheDefaultPolicy) {
+    static_assert(std::is_empty_v<NoInstrumentation>);
+    static_assert(Uninstrumented<NoInstrumentation&>);
+    static_assert(!Uninstrumented<CountingInstrumentation>);
+
+    DynamicArray arr{6, 4, 9, 3, 3, 6, 2, 1, 7};
+    QuickSort(arr, NoInstrumentation{});
+    for (std::size_t i = 1; i < arr.size(); i++)
+        EXPECT_LE(arr[i - 1], arr[i]);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HeapSortSwapEventsReplayToTheSortedArray) {
+    std::mt19937 rng(19);
+    DynamicArray<int> input;
+    for (int i = 0; i < 200; ++i)
+        input.addLast(static_cast<int>(rng() % 100));
+
+    // The sift kernels move values through a hole; the reported swaps must
+    // still describe the permutation they perform.
+    std::vector<int> replay(input.begin(), input.end());
+    DynamicArray<int> arr(input);
+    HeapSort(arr, [&](size_t code, size_t a, size_t b) {
+        if (code == SORT_EVENT_SWAP)
+            std::swap(replay[a], replay[b]);
+    });
+
+    for (size_t i = 0; i < arr.size(); ++i) {
+        EXPECT_EQ(replay[i], arr[i]);
+        if (i > 0) {
+            EXPECT_LE(arr[i - 1], arr[i]);
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, HybridSortSwapEventsReplayTheBranchlessPartition) {
+    std::mt19937 rng(20);
+    DynamicArray<int> input;
+    for (int i = 0; i < 3000; ++i)
+        input.addLast(static_cast<int>(rng() % (i < 1500 ? 1000 : 4)));
+
+    // Instrumented int sorts run the branchless partition; its reported swaps
+    // must describe the writes it performs.
+    std::vector<int> replay(input.begin(), input.end());
+    DynamicArray<int> arr(input);
+    CountingInstrumentation counts;
+    HybridSort(arr, [&](size_t code, size_t a, size_t b) {
+        counts(code, a, b);
+        if (code == SORT_EVENT_SWAP)
+            std::swap(replay[a], replay[b]);
+    });
+
+    DynamicArray<int> uninstrumented(input);
+    HybridSort(uninstrumented);
+    EXPECT_EQ(counts.sorted_marks, arr.size());
+    for (size_t i = 0; i < arr.size(); ++i) {
+        EXPECT_EQ(replay[i], arr[i]);
+        EXPECT_EQ(uninstrumented[i], arr[i]);
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, NthElementMatchesStdNthElement) {
+    constexpr int n = 3000;
+    std::mt19937 rng(33);
+    std::vector<int> random(n), sorted(n), reversed(n), few_unique(n), organ_pipe(n);
+    for (int i = 0; i < n; ++i) {
+        random[i] = static_cast<int>(rng() % 100000);
+        sorted[i] = i;
+        reversed[i] = n - i;
+        few_unique[i] = static_cast<int>(rng() % 4);
+        organ_pipe[i] = i < n / 2 ? i : n - i;
+    }
+
+    for (const auto& input : {random, sorted, reversed, few_unique, organ_pipe, std::vector<int>(n, 7)}) {
+        std::vector<int> expected = input;
+        std::sort(expected.begin(), expected.end());
+        for (const size_t k : {size_t{0}, size_t{1}, size_t{n / 2}, size_t{n * 99 / 100}, size_t{n - 1}}) {
+            DynamicArray<int> arr;
+            for (const int value : input)
+                arr.addLast(value);
+
+            NthElement(arr, k);
+            ASSERT_EQ(arr[k], expected[k]) << "k = " << k;
+            for (size_t i = 0; i < k; ++i)
+                ASSERT_LE(arr[i], arr[k]);
+            for (size_t i = k + 1; i < arr.size(); ++i)
+                ASSERT_GE(arr[i], arr[k]);
+        }
+    }
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, NthElementReportsReplayableEvents) {
+    std::mt19937 rng(8);
+    DynamicArray<int> arr;
+    for (int i = 0; i < 1000; ++i)
+        arr.addLast(static_cast<int>(rng() % 500));
+
+    // The callback observes the same partition as an uninstrumented run.
+    DynamicArray<int> uninstrumented(arr);
+    NthElement(uninstrumented, 250);
+
+    std::vector<int> replay(arr.begin(), arr.end());
+    size_t marked = 0;
+    NthElement(arr, 250, [&](const size_t code, const size_t a, const size_t b) {
+        if (code == SORT_EVENT_SWAP)
+            std::swap(replay[a], replay[b]);
+        else if (code == SORT_EVENT_MARK_SORTED) {
+            EXPECT_EQ(a, 250u);
+            ++marked;
+        }
+    });
+
+    EXPECT_EQ(marked, 1u);
+    for (size_t i = 0; i < arr.size(); ++i) {
+        ASSERT_EQ(replay[i], arr[i]);
+        ASSERT_EQ(uninstrumented[i], arr[i]);
+    }
+
+    DynamicArray<int> empty;
+    EXPECT_THROW(NthElement(empty, 0), std::out_of_range);
+    EXPECT_THROW(NthElement(arr, arr.size()), std::out_of_range);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, MedianOfMediansPivotSplitsTheRange) {
+    std::mt19937 rng(21);
+    DynamicArray<int> arr;
+    for (int i = 0; i < 10000; ++i)
+        arr.addLast(static_cast<int>(rng()));
+
+    NoInstrumentation none;
+    detail::Less less;
+    const size_t pivot = detail::medianOfMedians(arr, 0, arr.size(), none, less);
+
+    size_t below = 0, above = 0;
+    for (const int value : arr) {
+        below += value < arr[pivot];
+        above += arr[pivot] < value;
+    }
+    EXPECT_GE(below * 10, arr.size() * 3 - 100);
+    EXPECT_GE(above * 10, arr.size() * 3 - 100);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, PartialSortSortsTheSmallestElements) {
+    std::mt19937 rng(5);
+    std::vector<double> input(5000);
+    for (double& value : input)
+        value = static_cast<double>(rng() % 10000) / 7.0;
+    std::vector<double> expected = input;
+    std::sort(expected.begin(), expected.end());
+
+    for (const size_t k : {size_t{0}, size_t{1}, size_t{100}, input.size()}) {
+        DynamicArray<double> arr;
+        for (const double value : input)
+            arr.addLast(value);
+
+        PartialSort(arr, k);
+        for (size_t i = 0; i < k; ++i)
+            ASSERT_EQ(arr[i], expected[i]) << "k = " << k;
+    }
+
+    struct Player {
+        int id;
+        unsigned points;
+    };
+    DynamicArray<Player> players;
+    for (int i = 0; i < 200; ++i)
+        players.addLast(Player{i, static_cast<unsigned>((i * 37) % 200)});
+    PartialSort(players, 3, std::ranges::greater{}, &Player::points);
+    EXPECT_EQ(players[0].points, 199u);
+    EXPECT_EQ(players[1].points, 198u);
+    EXPECT_EQ(players[2].points, 197u);
+
+    DynamicArray<double> small{1.0, 2.0};
+    EXPECT_THROW(PartialSort(small, 3), std::out_of_range);
+}
+
+
+TEST_F(DynamicArrayAlgorithmsUnitTest, TopKKeepsTheGreatestOfAStream) {
+    std::mt19937 rng(77);
+    std::vector<int> stream(20000);
+    for (int& value : stream)
+        value = static_cast<int>(rng() % 1000000);
+
+    TopK<int> largest(100);
+    TopK<int, std::greater<int>> smallest(10);
+    for (const int value : stream) {
+        largest.push(value);
+        smallest.push(value);
+    }
+    EXPECT_EQ(largest.size(), 100u);
+
+    std::vector<int> expected = stream;
+    std::sort(expected.begin(), expected.end(), std::greater<int>{});
+    EXPECT_EQ(largest.threshold(), expected[99]);
+
+    const DynamicArray<int> best = largest.extractSorted();
+    ASSERT_EQ(best.size(), 100u);
+    for (size_t i = 0; i < best.size(); ++i)
+        ASSERT_EQ(best[i], expected[i]);
+    EXPECT_TRUE(largest.isEmpty());
+
+    std::sort(expected.begin(), expected.end());
+    const DynamicArray<int> least = smallest.extractSorted();
+    ASSERT_EQ(least.size(), 10u);
+    for (size_t i = 0; i < least.size(); ++i)
+        EXPECT_EQ(least[i], expected[i]);
+
+    TopK<int> none(0);
+    EXPECT_FALSE(none.push(1));
+    EXPECT_TRUE(none.isEmpty());
+    EXPECT_THROW((void)none.threshold(), std::out_of_range);
+
+    TopK<int> few(5);
+    few.pushAll(DynamicArray<int>{3, 1, 2});
+    EXPECT_EQ(few.size(), 3u);
+    EXPECT_EQ(few.threshold(), 1);
+}
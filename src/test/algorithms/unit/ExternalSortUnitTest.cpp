@@ -0,0 +1,187 @@
+#include "ExternalSort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+
+using array_algorithms::ExternalSort;
+using array_algorithms::ExternalSortOptions;
+using array_algorithms::ExternalSortStats;
+
+
+class ExternalSortUnitTest : public testing::Test {
+  protected:
+    std::filesystem::path directory_;
+    std::filesystem::path input_;
+    std::filesystem::path output_;
+
+    void SetUp() override {
+        directory_ = std::filesystem::temp_directory_path() /
+                     ("external_sort_test_" +
+                      std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+        std::filesystem::create_directories(directory_);
+        input_ = directory_ / "input.bin";
+        output_ = directory_ / "output.bin";
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory_); }
+
+    /// Options with the run files in the test directory.
+    [[nodiscard]]
+    ExternalSortOptions options(const size_t budget, const size_t block) const {
+        ExternalSortOptions result;
+        result.memory_budget = budget;
+        result.io_block_bytes = block;
+        result.temp_directory = directory_;
+        return result;
+    }
+
+    /// Files other than input and output left in the test directory.
+    [[nodiscard]]
+    size_t leftoverFiles() const {
+        size_t count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory_))
+            count += entry.path() != input_ && entry.path() != output_;
+        return count;
+    }
+};
+
+
+template <typename Type>
+void writeRecords(const std::filesystem::path& path, const std::vector<Type>& records) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(records.data()),
+              static_cast<std::streamsize>(records.size() * sizeof(Type)));
+}
+
+template <typename Type>
+std::vector<Type> readRecords(const std::filesystem::path& path) {
+    std::vector<Type> records(std::filesystem::file_size(path) / sizeof(Type));
+    std::ifstream in(path, std::ios::binary);
+    in.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(Type)));
+    return records;
+}
+
+
+TEST_F(ExternalSortUnitTest, SortsWithManyRunsAndMergePasses) {
+    std::mt19937 rng(1);
+    std::vector<std::int32_t> records(300000);
+    for (auto& record : records)
+        record = static_cast<std::int32_t>(rng());
+    writeRecords(input_, records);
+
+    // 64 KiB: 4096 records per run and 6 runs per merge.
+    const ExternalSortStats stats = ExternalSort<std::int32_t>(input_, output_, options(64 << 10, 4 << 10));
+    EXPECT_EQ(stats.elements, records.size());
+    EXPECT_EQ(stats.runs, (records.size() + 4095) / 4096);
+    EXPECT_EQ(stats.merge_passes, 3u);
+
+    std::sort(records.begin(), records.end());
+    EXPECT_EQ(readRecords<std::int32_t>(output_), records);
+    EXPECT_EQ(leftoverFiles(), 0u);
+}
+
+
+struct Record {
+    std::uint64_t key;
+    std::uint32_t payload;
+
+    bool operator<(const Record& other) const { return key < other.key; }
+};
+
+
+TEST_F(ExternalSortUnitTest, SortsRecordsWithHybridSort) {
+    std::mt19937_64 rng(2);
+    std::vector<Record> records(50000);
+    for (std::uint32_t i = 0; i < records.size(); ++i)
+        records[i] = Record{rng() % 1000, i};
+    writeRecords(input_, records);
+
+    const ExternalSortStats stats = ExternalSort<Record>(input_, output_, options(256 << 10, 8 << 10));
+    EXPECT_GT(stats.runs, 1u);
+
+    const std::vector<Record> sorted = readRecords<Record>(output_);
+    ASSERT_EQ(sorted.size(), records.size());
+    std::vector<bool> seen(records.size(), false);
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        if (i > 0) {
+            ASSERT_LE(sorted[i - 1].key, sorted[i].key);
+        }
+        ASSERT_EQ(sorted[i].key, records[sorted[i].payload].key);
+        seen[sorted[i].payload] = true;
+    }
+    EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](const bool b) { return b; }));
+}
+
+
+/// Record without a default constructor.
+struct Keyed {
+    std::int64_t key;
+
+    explicit Keyed(const std::int64_t k) : key(k) {}
+    bool operator<(const Keyed& other) const { return key < other.key; }
+};
+
+
+TEST_F(ExternalSortUnitTest, SortsRecordsWithoutDefaultConstructor) {
+    std::mt19937_64 rng(3);
+    std::vector<Keyed> records;
+    for (int i = 0; i < 40000; ++i)
+        records.emplace_back(static_cast<std::int64_t>(rng() % 100000) - 50000);
+    writeRecords(input_, records);
+
+    const ExternalSortStats stats = ExternalSort<Keyed>(input_, output_, options(64 << 10, 4 << 10));
+    EXPECT_GT(stats.merge_passes, 1u);
+
+    std::vector<std::int64_t> keys;
+    for (const Keyed& record : records)
+        keys.push_back(record.key);
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(readRecords<std::int64_t>(output_), keys);
+    EXPECT_EQ(leftoverFiles(), 0u);
+}
+
+
+TEST_F(ExternalSortUnitTest, HandlesEmptySingleRunAndInPlaceSorts) {
+    writeRecords(input_, std::vector<double>{});
+    EXPECT_EQ(ExternalSort<double>(input_, output_, options(64 << 10, 4 << 10)).runs, 0u);
+    EXPECT_EQ(std::filesystem::file_size(output_), 0u);
+
+    std::vector<double> records = {3.5, -1.0, 2.25, 0.0, -7.5};
+    writeRecords(input_, records);
+    const ExternalSortStats stats = ExternalSort<double>(input_, input_, options(64 << 10, 4 << 10));
+    EXPECT_EQ(stats.runs, 1u);
+    EXPECT_EQ(stats.merge_passes, 0u);
+    std::sort(records.begin(), records.end());
+    EXPECT_EQ(readRecords<double>(input_), records);
+    EXPECT_EQ(leftoverFiles(), 0u);
+}
+
+
+TEST_F(ExternalSortUnitTest, RejectsBadInputs) {
+    {
+        std::ofstream out(input_, std::ios::binary);
+        out << "abcde";
+    }
+    EXPECT_THROW(ExternalSort<std::uint32_t>(input_, output_, options(64 << 10, 4 << 10)),
+                 std::invalid_argument);
+    EXPECT_THROW(ExternalSort<std::uint32_t>(input_, output_, options(1 << 10, 4 << 10)),
+                 std::invalid_argument);
+    EXPECT_THROW(ExternalSort<std::uint32_t>(directory_ / "missing", output_, options(64 << 10, 4 << 10)),
+                 std::filesystem::filesystem_error);
+
+    writeRecords(input_, std::vector<std::uint32_t>(100000, 1));
+    EXPECT_THROW(ExternalSort<std::uint32_t>(input_, directory_ / "no" / "such" / "dir", options(64 << 10, 4 << 10)),
+                 std::system_error);
+    EXPECT_EQ(leftoverFiles(), 0u);
+}
@@ -0,0 +1,90 @@
+#include "DynamicArray.hpp"
+#include "EytzingerArray.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+using containers::DynamicArray;
+using array_algorithms::EytzingerArray;
+
+
+class EytzingerArrayUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(EytzingerArrayUnitTest, EmptyIndexFindsNothing) {
+    const DynamicArray<int> empty;
+    const EytzingerArray index(empty);
+
+    EXPECT_TRUE(index.isEmpty());
+    EXPECT_EQ(index.lowerBound(5), 0u);
+    EXPECT_EQ(index.find(5), 0u);
+    EXPECT_FALSE(index.contains(5));
+}
+
+
+TEST_F(EytzingerArrayUnitTest, LowerBoundMatchesStdLowerBoundForAllSizes) {
+    for (int n = 1; n <= 70; ++n) {
+        DynamicArray<int> sorted;
+        std::vector<int> reference;
+        for (int i = 0; i < n; ++i) {
+            sorted.addLast(2 * i);
+            reference.push_back(2 * i);
+        }
+        const EytzingerArray index(sorted);
+        ASSERT_EQ(index.size(), static_cast<size_t>(n));
+
+        for (int target = -1; target <= 2 * n; ++target) {
+            const auto expected = static_cast<size_t>(
+                std::lower_bound(reference.begin(), reference.end(), target) - reference.begin());
+            ASSERT_EQ(index.lowerBound(target), expected) << "n=" << n << " target=" << target;
+            ASSERT_EQ(index.contains(target), target >= 0 && target % 2 == 0 && target < 2 * n);
+        }
+    }
+}
+
+
+TEST_F(EytzingerArrayUnitTest, FindReturnsRankOfFirstDuplicate) {
+    const DynamicArray<int> sorted{1, 3, 3, 3, 7, 7, 9};
+    const EytzingerArray index(sorted);
+
+    EXPECT_EQ(index.find(3), 1u);
+    EXPECT_EQ(index.find(7), 4u);
+    EXPECT_EQ(index.find(9), 6u);
+    EXPECT_EQ(index.find(4), sorted.size());
+    EXPECT_EQ(index.find(10), sorted.size());
+    EXPECT_EQ(index.lowerBound(0), 0u);
+}
+
+
+TEST_F(EytzingerArrayUnitTest, WorksWithStringKeys) {
+    std::mt19937 rng(4);
+    std::vector<std::string> words;
+    for (int i = 0; i < 500; ++i)
+        words.push_back("key" + std::to_string(rng() % 10000));
+    std::sort(words.begin(), words.end());
+
+    DynamicArray<std::string> sorted;
+    for (const std::string& word : words)
+        sorted.addLast(word);
+    const EytzingerArray index(sorted);
+
+    for (const std::string& word : words)
+        EXPECT_EQ(sorted[index.find(word)], word);
+    EXPECT_FALSE(index.contains("absent"));
+}
+
+
+TEST_F(EytzingerArrayUnitTest, RejectsUnsortedInput) {
+    const DynamicArray<int> unsorted{1, 5, 3};
+    EXPECT_THROW(EytzingerArray<int>{unsorted}, std::invalid_argument);
+}
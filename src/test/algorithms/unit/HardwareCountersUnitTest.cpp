@@ -0,0 +1,89 @@
+#include "ArrayAlgorithms.hpp"
+#include "DynamicArray.hpp"
+#include "HardwareCounters.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+
+using containers::DynamicArray;
+using array_algorithms::CounterReading;
+using array_algorithms::CounterSource;
+using array_algorithms::HardwareCounters;
+using array_algorithms::HardwareEvent;
+using array_algorithms::HybridSort;
+using array_algorithms::MeasureHardwareCounters;
+
+
+class HardwareCountersUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+DynamicArray<int> randomArray(const size_t n) {
+    DynamicArray<int> array(n);
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < n; ++i)
+        array.addLast(static_cast<int>(rng()));
+    return array;
+}
+
+
+// Whether perf events are available depends on the machine, so the tests
+// check what the counters report about themselves.
+TEST_F(HardwareCountersUnitTest, CountsWhatItReports) {
+    HardwareCounters counters;
+    DynamicArray<int> array = randomArray(100000);
+
+    counters.start();
+    HybridSort(array);
+    const CounterReading reading = counters.stop();
+
+    EXPECT_EQ(reading.source, counters.source());
+    if (reading.source == CounterSource::Timestamp) {
+        EXPECT_EQ(reading.measured, HardwareEvent::Cycles);
+        EXPECT_FALSE(reading.has(HardwareEvent::Instructions));
+        EXPECT_EQ(reading.instructions, 0u);
+    }
+    if (reading.has(HardwareEvent::Cycles)) {
+        EXPECT_GT(reading.cycles, 0u);
+    }
+    if (reading.has(HardwareEvent::Instructions)) {
+        // Sorting 1e5 elements retires well over one instruction per element.
+        EXPECT_GT(reading.instructions, 100000u);
+        EXPECT_GT(reading.instructionsPerCycle(), 0.0);
+    }
+}
+
+
+TEST_F(HardwareCountersUnitTest, TimestampFallbackCountsCycles) {
+    HardwareCounters counters(HardwareEvent::All, CounterSource::Timestamp);
+    EXPECT_EQ(counters.source(), CounterSource::Timestamp);
+    EXPECT_EQ(counters.events(), HardwareEvent::Cycles);
+
+    CounterReading total;
+    for (int run = 0; run < 3; ++run) {
+        DynamicArray<int> array = randomArray(10000);
+        counters.start();
+        HybridSort(array);
+        const CounterReading reading = counters.stop();
+        EXPECT_GT(reading.cycles, 0u);
+        total += reading;
+    }
+    EXPECT_TRUE(total.has(HardwareEvent::Cycles));
+    EXPECT_GT(CounterReading::perElement(total.cycles, 30000), 0.0);
+    EXPECT_EQ(CounterReading::perElement(total.cycles, 0), 0.0);
+    EXPECT_EQ(total.instructionsPerCycle(), 0.0);
+}
+
+
+TEST_F(HardwareCountersUnitTest, MeasureRunsTheBodyOnce) {
+    int runs = 0;
+    const CounterReading reading = MeasureHardwareCounters([&] { ++runs; }, HardwareEvent::Cycles);
+    EXPECT_EQ(runs, 1);
+    EXPECT_TRUE(reading.has(HardwareEvent::Cycles));
+    EXPECT_FALSE(reading.has(HardwareEvent::None));
+}
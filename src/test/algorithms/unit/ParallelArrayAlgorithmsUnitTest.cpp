@@ -0,0 +1,171 @@
+#include "DynamicArray.hpp"
+#include "ParallelArrayAlgorithms.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+
+using containers::DynamicArray;
+using namespace array_algorithms;
+
+
+class ParallelArrayAlgorithmsUnitTest : public testing::Test {
+  protected:
+    /// Produces n values in [low, high] from a fixed seed.
+    static DynamicArray<int64_t> randomArray(const size_t n, const int64_t low,
+                                             const int64_t high) {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<int64_t> dist(low, high);
+        DynamicArray<int64_t> array(n);
+        for (size_t i = 0; i < n; ++i)
+            array.addLast(dist(rng));
+        return array;
+    }
+
+    /// Checks that array holds exactly the values of original, sorted.
+    static void expectSortedPermutation(const DynamicArray<int64_t>& array,
+                                        const DynamicArray<int64_t>& original) {
+        std::vector<int64_t> expected(original.begin(), original.end());
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(array.size(), expected.size());
+        EXPECT_TRUE(std::equal(array.begin(), array.end(), expected.begin()));
+    }
+
+    /// Runs sort on several input shapes and thread counts.
+    template <typename Sort>
+    static void checkSort(Sort sort) {
+        const size_t n = 3 * PARALLEL_THRESHOLD + 17;
+        const DynamicArray<int64_t> inputs[] = {
+            randomArray(n, INT64_MIN, INT64_MAX),
+            randomArray(n, -5, 5),
+            randomArray(100, -1000, 1000),
+        };
+        for (const size_t threads : {1u, 2u, 3u, 8u}) {
+            for (const DynamicArray<int64_t>& input : inputs) {
+                DynamicArray<int64_t> array(input);
+                sort(array, threads);
+                expectSortedPermutation(array, input);
+            }
+
+            DynamicArray<int64_t> descending(n);
+            for (size_t i = 0; i < n; ++i)
+                descending.addLast(static_cast<int64_t>(n - i) - 1000);
+            const DynamicArray<int64_t> original(descending);
+            sort(descending, threads);
+            expectSortedPermutation(descending, original);
+            sort(descending, threads); // already sorted input
+            expectSortedPermutation(descending, original);
+        }
+    }
+};
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ParallelQuickSortSorts) {
+    checkSort([](DynamicArray<int64_t>& a, const size_t t) { ParallelQuickSort(a, t); });
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ParallelMergeSortSorts) {
+    checkSort([](DynamicArray<int64_t>& a, const size_t t) { ParallelMergeSort(a, t); });
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ParallelRadixSortLSDSorts) {
+    checkSort([](DynamicArray<int64_t>& a, const size_t t) { ParallelRadixSortLSD(a, t); });
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ParallelMergeSortIsStable) {
+    // Sort pairs by key only; the index must stay ascending within a key.
+    struct Keyed {
+        int key = 0;
+        size_t index = 0;
+        bool operator<(const Keyed& other) const { return key < other.key; }
+    };
+
+    const size_t n = 2 * PARALLEL_THRESHOLD + 5;
+    std::mt19937 rng(7);
+    DynamicArray<Keyed> array(n);
+    for (size_t i = 0; i < n; ++i)
+        array.addLast(Keyed{static_cast<int>(rng() % 16), i});
+
+    ParallelMergeSort(array, 4);
+    for (size_t i = 1; i < n; ++i) {
+        ASSERT_LE(array[i - 1].key, array[i].key);
+        if (array[i - 1].key == array[i].key) {
+            ASSERT_LT(array[i - 1].index, array[i].index);
+        }
+    }
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ZeroThreadsUsesDefault) {
+    DynamicArray<int64_t> array = randomArray(PARALLEL_THRESHOLD * 2, -100, 100);
+    const DynamicArray<int64_t> original(array);
+    ParallelQuickSort(array, 0);
+    expectSortedPermutation(array, original);
+
+    DynamicArray<int> empty;
+    ParallelMergeSort(empty);
+    ParallelRadixSortLSD(empty);
+    EXPECT_TRUE(empty.isEmpty());
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ParallelRadixSortLSDSortsDoubles) {
+    const size_t n = 2 * PARALLEL_THRESHOLD + 11;
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    DynamicArray<double> array(n);
+    std::vector<double> expected;
+    for (size_t i = 0; i < n; ++i) {
+        const double value = dist(rng);
+        array.addLast(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    ParallelRadixSortLSD(array, 4);
+    for (size_t i = 0; i < n; ++i)
+        ASSERT_EQ(array[i], expected[i]);
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, SortsOnAGivenScheduler) {
+    containers::TaskScheduler scheduler(3);
+    const DynamicArray<int64_t> input = randomArray(3 * PARALLEL_THRESHOLD, INT64_MIN, INT64_MAX);
+
+    DynamicArray<int64_t> quick(input), merge(input), radix(input);
+    ParallelQuickSort(quick, scheduler);
+    ParallelMergeSort(merge, scheduler, 5);
+    ParallelRadixSortLSD(radix, scheduler);
+    expectSortedPermutation(quick, input);
+    expectSortedPermutation(merge, input);
+    expectSortedPermutation(radix, input);
+}
+
+
+TEST_F(ParallelArrayAlgorithmsUnitTest, ConcurrentSortsShareOneScheduler) {
+    containers::TaskScheduler scheduler(4);
+    const DynamicArray<int64_t> input = randomArray(2 * PARALLEL_THRESHOLD, -1000, 1000);
+
+    std::vector<DynamicArray<int64_t>> arrays(4, input);
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < arrays.size(); ++i)
+        callers.emplace_back([&, i] {
+            if (i % 2 == 0)
+                ParallelQuickSort(arrays[i], scheduler);
+            else
+                ParallelMergeSort(arrays[i], scheduler);
+        });
+    for (std::thread& caller : callers)
+        caller.join();
+
+    for (const DynamicArray<int64_t>& array : arrays)
+        expectSortedPermutation(array, input);
+}
@@ -0,0 +1,248 @@
+#include "ArrayAlgorithms.hpp"
+#include "DynamicArray.hpp"
+#include "StepStream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+
+using containers::DynamicArray;
+using array_algorithms::CompactStepBlock;
+using array_algorithms::Step;
+using array_algorithms::StepOp;
+using array_algorithms::StepSink;
+using array_algorithms::StepStream;
+
+
+class StepStreamUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+/// Records every sort event uncompressed, as the animators used to.
+struct RecordingCallback {
+    std::vector<Step> steps;
+
+    void operator()(const size_t code, const size_t a, const size_t b) {
+        if (code <= 2)
+            steps.push_back({static_cast<StepOp>(code), a, code == 2 ? 0 : b});
+    }
+
+    void operator()(const size_t index) { steps.push_back({StepOp::Visit, index, 0}); }
+};
+
+
+/// Drains a stream, spinning while the producer is behind.
+std::vector<Step> drain(StepStream& stream) {
+    std::vector<Step> steps;
+    Step step{};
+    while (!stream.isFinished()) {
+        if (stream.tryNext(step))
+            steps.push_back(step);
+        else
+            std::this_thread::yield();
+    }
+    return steps;
+}
+
+
+void expectSameSteps(const std::vector<Step>& actual, const std::vector<Step>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        ASSERT_EQ(actual[i].op, expected[i].op) << "step " << i;
+        ASSERT_EQ(actual[i].first, expected[i].first) << "step " << i;
+        ASSERT_EQ(actual[i].second, expected[i].second) << "step " << i;
+    }
+}
+
+
+DynamicArray<int> randomArray(const size_t n, const unsigned seed) {
+    std::mt19937 rng(seed);
+    DynamicArray<int> array;
+    for (size_t i = 0; i < n; ++i)
+        array.addLast(static_cast<int>(rng() % 1000));
+    return array;
+}
+
+
+TEST_F(StepStreamUnitTest, BlockRoundTripsAndCompressesSortedRuns) {
+    CompactStepBlock block;
+    ASSERT_TRUE(block.append(StepOp::Compare, 3, 4));
+    ASSERT_TRUE(block.append(StepOp::Swap, 4, 3));
+    for (uint32_t i = 10; i < 20; ++i)
+        ASSERT_TRUE(block.append(StepOp::MarkSorted, i, 0));
+    for (uint32_t i = 9; i > 5; --i)
+        ASSERT_TRUE(block.append(StepOp::MarkSorted, i, 0));
+    ASSERT_TRUE(block.append(StepOp::Visit, 7, 0));
+    ASSERT_TRUE(block.append(StepOp::MarkSorted, 0, 0));
+
+    // The descending marks 9..6 do not continue the ascending run 10..19.
+    EXPECT_EQ(block.records(), 6u);
+
+    std::vector<size_t> marked;
+    Step step{};
+    ASSERT_TRUE(block.next(step));
+    EXPECT_EQ(step.op, StepOp::Compare);
+    EXPECT_EQ(step.second, 4u);
+    ASSERT_TRUE(block.next(step));
+    EXPECT_EQ(step.op, StepOp::Swap);
+    while (block.next(step) && step.op == StepOp::MarkSorted)
+        marked.push_back(step.first);
+    EXPECT_EQ(step.op, StepOp::Visit);
+    EXPECT_EQ(step.first, 7u);
+    ASSERT_TRUE(block.next(step));
+    EXPECT_EQ(step.op, StepOp::MarkSorted);
+    EXPECT_FALSE(block.next(step));
+
+    std::vector<size_t> expected;
+    for (size_t i = 10; i < 20; ++i)
+        expected.push_back(i);
+    for (size_t i = 9; i > 5; --i)
+        expected.push_back(i);
+    EXPECT_EQ(marked, expected);
+
+    block.clear();
+    EXPECT_TRUE(block.isEmpty());
+    EXPECT_FALSE(block.next(step));
+}
+
+
+TEST_F(StepStreamUnitTest, BlockReportsWhenFull) {
+    CompactStepBlock block;
+    for (size_t i = 0; i < CompactStepBlock::CAPACITY; ++i)
+        ASSERT_TRUE(block.append(StepOp::Compare, 0, 1));
+    EXPECT_FALSE(block.append(StepOp::Swap, 0, 1));
+    EXPECT_FALSE(block.append(StepOp::MarkSorted, 1, 0));
+}
+
+
+TEST_F(StepStreamUnitTest, StreamsTheSameStepsAsRecording) {
+    const auto sorts = {
+        +[](DynamicArray<int>& a, StepSink& sink) { array_algorithms::BubbleSort(a, sink); },
+        +[](DynamicArray<int>& a, StepSink& sink) { array_algorithms::QuickSort(a, sink); },
+        +[](DynamicArray<int>& a, StepSink& sink) { array_algorithms::MergeSortInPlace(a, sink); },
+        +[](DynamicArray<int>& a, StepSink& sink) { array_algorithms::HeapSort(a, sink); },
+        +[](DynamicArray<int>& a, StepSink& sink) { array_algorithms::BinaryInsertionSort(a, sink); },
+    };
+    const auto recorded = {
+        +[](DynamicArray<int>& a, RecordingCallback& cb) { array_algorithms::BubbleSort(a, cb); },
+        +[](DynamicArray<int>& a, RecordingCallback& cb) { array_algorithms::QuickSort(a, cb); },
+        +[](DynamicArray<int>& a, RecordingCallback& cb) { array_algorithms::MergeSortInPlace(a, cb); },
+        +[](DynamicArray<int>& a, RecordingCallback& cb) { array_algorithms::HeapSort(a, cb); },
+        +[](DynamicArray<int>& a, RecordingCallback& cb) { array_algorithms::BinaryInsertionSort(a, cb); },
+    };
+
+    auto record = recorded.begin();
+    for (const auto sort : sorts) {
+        const DynamicArray<int> input = randomArray(300, 11);
+
+        RecordingCallback expected;
+        DynamicArray<int> copy(input);
+        (*record++)(copy, expected);
+
+        StepStream stream([sort, array = input](StepSink& sink) mutable { sort(array, sink); }, 2);
+        expectSameSteps(drain(stream), expected.steps);
+    }
+}
+
+
+TEST_F(StepStreamUnitTest, StreamsSearchVisits) {
+    DynamicArray<int> sorted;
+    for (int i = 0; i < 1000; ++i)
+        sorted.addLast(2 * i);
+
+    RecordingCallback expected;
+    const size_t found = array_algorithms::BinarySearch(sorted, 1234, expected);
+
+    size_t result = 0;
+    StepStream stream([&result, sorted](StepSink& sink) {
+        result = array_algorithms::BinarySearch(sorted, 1234, sink);
+    });
+    expectSameSteps(drain(stream), expected.steps);
+    EXPECT_EQ(result, found);
+}
+
+
+TEST_F(StepStreamUnitTest, ProducerStaysWithinTheRing) {
+    std::atomic<size_t> emitted{0};
+    StepStream stream([&emitted](StepSink& sink) {
+        for (size_t i = 0; i < 100 * CompactStepBlock::CAPACITY; ++i) {
+            sink(0, i, i + 1);
+            emitted.store(i + 1, std::memory_order_relaxed);
+        }
+    }, 3);
+
+    // Without a consumer the producer stops once every block is full.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_LE(emitted.load(), 3 * CompactStepBlock::CAPACITY + 1);
+    EXPECT_FALSE(stream.isFinished());
+
+    const std::vector<Step> steps = drain(stream);
+    ASSERT_EQ(steps.size(), 100 * CompactStepBlock::CAPACITY);
+    EXPECT_EQ(steps.back().first, steps.size() - 1);
+}
+
+
+TEST_F(StepStreamUnitTest, DestroyingTheStreamStopsTheProducer) {
+    const auto start = std::chrono::steady_clock::now();
+    {
+        StepStream stream([array = randomArray(100000, 5)](StepSink& sink) mutable {
+            array_algorithms::BubbleSort(array, sink);
+        });
+        Step step{};
+        while (!stream.tryNext(step))
+            std::this_thread::yield();
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+
+TEST_F(StepStreamUnitTest, CancelledProducerStopsAtItsNextEvent) {
+    std::atomic<size_t> emitted{0};
+    {
+        StepStream stream([&emitted](StepSink& sink) {
+            for (size_t i = 0;; ++i) {
+                sink(i);
+                emitted.store(i + 1, std::memory_order_relaxed);
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        });
+        while (emitted.load(std::memory_order_relaxed) == 0)
+            std::this_thread::yield();
+    }
+    // It stops well before a full block would make it wait on the ring.
+    EXPECT_LT(emitted.load(), CompactStepBlock::CAPACITY);
+}
+
+
+TEST_F(StepStreamUnitTest, ProducerErrorsReachTheConsumer) {
+    StepStream stream([](StepSink& sink) {
+        sink(0, 1, 2);
+        throw std::runtime_error("failed");
+    });
+
+    Step step{};
+    std::vector<Step> steps;
+    bool threw = false;
+    while (!threw && !stream.isFinished()) {
+        try {
+            if (stream.tryNext(step))
+                steps.push_back(step);
+        } catch (const std::runtime_error&) {
+            threw = true;
+        }
+    }
+    EXPECT_TRUE(threw);
+    ASSERT_EQ(steps.size(), 1u);
+    EXPECT_EQ(steps[0].op, StepOp::Compare);
+
+    EXPECT_THROW(StepStream([](StepSink&) {}, 1), std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "BinarySearchTree.hpp"
+#include "DynamicArray.hpp"
+#include "LinkedList.hpp"
+#include "NodePool.hpp"
+
+
+using containers::AllocationCounter;
+using containers::allocationCounter;
+using containers::BinarySearchTree;
+using containers::CountingAllocator;
+using containers::CountingNodes;
+using containers::DynamicArray;
+using containers::HeapNodes;
+using containers::LinkedList;
+using containers::PooledNodes;
+
+
+class AllocationCounterUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+struct VectorTag {};
+struct ListTag {};
+struct TreeTag {};
+
+using TaggedAllocator = CountingAllocator<int, VectorTag>;
+
+
+TEST_F(AllocationCounterUnitTest, CountsDynamicArrayGrowth) {
+    AllocationCounter counter;
+    {
+        DynamicArray<int, CountingAllocator<int>> array{CountingAllocator<int>(counter)};
+        for (int i = 0; i < 1000; ++i)
+            array.addLast(i);
+
+        const auto counts = counter.counts();
+        EXPECT_GT(counts.allocations, 1u);
+        EXPECT_LT(counts.allocations, 30u); // Geometric growth.
+        EXPECT_GE(counts.live_bytes, 1000 * sizeof(int));
+        EXPECT_GE(counts.peak_bytes, counts.live_bytes);
+        EXPECT_EQ(counts.allocations - counts.deallocations, 1u);
+
+        // Copies report to the same counter.
+        const auto copy = array;
+        EXPECT_EQ(counter.counts().allocations, counts.allocations + 1);
+        EXPECT_EQ(&copy.getAllocator().counter(), &counter);
+    }
+    const auto counts = counter.counts();
+    EXPECT_EQ(counts.allocations, counts.deallocations);
+    EXPECT_EQ(counts.live_bytes, 0u);
+
+    counter.reset();
+    EXPECT_EQ(counter.counts().allocations, 0u);
+    EXPECT_EQ(counter.counts().peak_bytes, 0u);
+}
+
+
+TEST_F(AllocationCounterUnitTest, DefaultAllocatorsShareTheTagCounter) {
+    AllocationCounter& counter = allocationCounter<VectorTag>();
+    counter.reset();
+    {
+        std::vector<int, TaggedAllocator> vector(100);
+        EXPECT_EQ(counter.counts().allocations, 1u);
+        EXPECT_EQ(counter.counts().bytes_allocated, 100 * sizeof(int));
+    }
+    EXPECT_EQ(counter.counts().live_bytes, 0u);
+    EXPECT_TRUE(TaggedAllocator() == TaggedAllocator());
+
+    AllocationCounter other;
+    EXPECT_FALSE(TaggedAllocator() == TaggedAllocator(other));
+}
+
+
+TEST_F(AllocationCounterUnitTest, CountsNodes) {
+    AllocationCounter& counter = allocationCounter<ListTag>();
+    counter.reset();
+    {
+        LinkedList<int, CountingNodes<HeapNodes, ListTag>> list;
+        for (int i = 0; i < 100; ++i)
+            list.addLast(i);
+        EXPECT_EQ(counter.counts().allocations, 100u);
+        list.removeFirst();
+        EXPECT_EQ(counter.counts().deallocations, 1u);
+    }
+    EXPECT_EQ(counter.counts().deallocations, 100u);
+    EXPECT_EQ(counter.counts().live_bytes, 0u);
+}
+
+
+TEST_F(AllocationCounterUnitTest, CountsPooledNodesThroughClear) {
+    AllocationCounter& counter = allocationCounter<TreeTag>();
+    counter.reset();
+
+    BinarySearchTree<int, CountingNodes<PooledNodes<16>, TreeTag>> tree;
+    for (const int value : {50, 30, 70, 20, 40, 60, 80})
+        tree.insert(value);
+    EXPECT_EQ(counter.counts().allocations, 7u);
+    EXPECT_TRUE(tree.contains(40));
+
+    auto moved = std::move(tree);
+    EXPECT_TRUE(moved.contains(60));
+
+    moved.clear();
+    EXPECT_EQ(counter.counts().deallocations, 7u);
+    EXPECT_EQ(counter.counts().live_bytes, 0u);
+}
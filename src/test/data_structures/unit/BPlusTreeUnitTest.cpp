@@ -0,0 +1,230 @@
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BPlusTree.hpp"
+#include "DynamicArray.hpp"
+
+
+using containers::BPlusTree;
+using containers::DynamicArray;
+
+
+class BPlusTreeUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+  public:
+    /// Small nodes, so that a few hundred keys already build several levels.
+    using SmallTree = BPlusTree<int, int, 4>;
+};
+
+
+TEST_F(BPlusTreeUnitTest, NewTreeShouldBeEmpty) {
+    const BPlusTree<int, std::string> tree;
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_EQ(tree.getHeight(), 0);
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_FALSE(tree.contains(1));
+    EXPECT_EQ(tree.lowerBound(1), tree.end());
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_THROW((void)tree.at(1), std::out_of_range);
+}
+
+
+TEST_F(BPlusTreeUnitTest, DefaultFanoutShouldFillFourCacheLines) {
+    EXPECT_EQ((BPlusTree<int, int>::fanout()), 64);
+    EXPECT_EQ((BPlusTree<double, int>::fanout()), 32);
+    EXPECT_EQ((BPlusTree<std::string, int>::fanout()), 8);
+}
+
+
+TEST_F(BPlusTreeUnitTest, InsertShouldAssignExistingKeys) {
+    SmallTree tree;
+    EXPECT_TRUE(tree.insert(5, 50));
+    EXPECT_FALSE(tree.insert(5, 55));
+    EXPECT_EQ(tree.size(), 1);
+    EXPECT_EQ(tree.at(5), 55);
+
+    tree.at(5) = 7;
+    EXPECT_EQ(tree.find(5)->second, 7);
+}
+
+
+TEST_F(BPlusTreeUnitTest, SortedInsertsShouldSplitIntoAValidTree) {
+    SmallTree tree;
+    for (int i = 0; i < 1000; ++i)
+        tree.insert(i, i * 10);
+
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_EQ(tree.size(), 1000);
+    EXPECT_GE(tree.getHeight(), 5);
+    for (int i = 0; i < 1000; ++i)
+        ASSERT_EQ(tree.at(i), i * 10);
+}
+
+
+TEST_F(BPlusTreeUnitTest, RandomChurnShouldMatchStdMap) {
+    std::mt19937 rng(23);
+    std::uniform_int_distribution<int> key(0, 3000);
+    SmallTree tree;
+    std::map<int, int> reference;
+
+    for (int step = 0; step < 30000; ++step) {
+        const int k = key(rng);
+        if (rng() % 2 == 0) {
+            ASSERT_EQ(tree.remove(k), reference.erase(k) == 1);
+        } else {
+            const bool inserted = reference.insert_or_assign(k, step).second;
+            ASSERT_EQ(tree.insert(k, step), inserted);
+        }
+        if (step % 1000 == 0) {
+            ASSERT_TRUE(tree.isValidBPlusTree());
+        }
+    }
+
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    ASSERT_EQ(tree.size(), reference.size());
+    auto expected = reference.begin();
+    for (const auto [k, v] : tree) {
+        EXPECT_EQ(k, expected->first);
+        EXPECT_EQ(v, expected->second);
+        ++expected;
+    }
+}
+
+
+TEST_F(BPlusTreeUnitTest, RemovingEverythingShouldLeaveAnEmptyTree) {
+    SmallTree tree;
+    for (int i = 0; i < 500; ++i)
+        tree.insert(i, i);
+    for (int i = 499; i >= 0; --i)
+        ASSERT_TRUE(tree.remove(i));
+
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.getHeight(), 0);
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_FALSE(tree.remove(0));
+}
+
+
+TEST_F(BPlusTreeUnitTest, BulkLoadShouldPackSortedInput) {
+    DynamicArray<int> keys;
+    DynamicArray<int> values;
+    for (int i = 0; i < 10000; ++i) {
+        keys.addLast(2 * i);
+        values.addLast(i);
+    }
+
+    const BPlusTree<int, int, 8> tree(keys, values);
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_EQ(tree.size(), 10000);
+    // 1250 full leaves need ceil(log9(1250)) = 4 inner levels.
+    EXPECT_EQ(tree.getHeight(), 5);
+    EXPECT_EQ(tree.at(2 * 1234), 1234);
+    EXPECT_FALSE(tree.contains(3));
+}
+
+
+TEST_F(BPlusTreeUnitTest, BulkLoadShouldRejectBadInput) {
+    const DynamicArray<int> unsorted{1, 3, 2};
+    const DynamicArray<int> duplicated{1, 2, 2};
+    const DynamicArray<int> three{0, 0, 0};
+    const DynamicArray<int> two{0, 0};
+
+    EXPECT_THROW((SmallTree(unsorted, three)), std::invalid_argument);
+    EXPECT_THROW((SmallTree(duplicated, three)), std::invalid_argument);
+    EXPECT_THROW((SmallTree(unsorted, two)), std::invalid_argument);
+}
+
+
+TEST_F(BPlusTreeUnitTest, BulkLoadedTreeShouldAcceptUpdates) {
+    DynamicArray<int> keys;
+    DynamicArray<int> values;
+    for (int i = 0; i < 300; ++i) {
+        keys.addLast(i);
+        values.addLast(i);
+    }
+    SmallTree tree(keys, values);
+
+    for (int i = 0; i < 300; i += 3)
+        tree.remove(i);
+    for (int i = 300; i < 400; ++i)
+        tree.insert(i, i);
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_EQ(tree.size(), 300);
+}
+
+
+TEST_F(BPlusTreeUnitTest, BoundsAndRangesShouldCrossLeaves) {
+    SmallTree tree;
+    for (int i = 0; i < 100; ++i)
+        tree.insert(i * 10, i);
+
+    EXPECT_EQ(tree.lowerBound(55).key(), 60);
+    EXPECT_EQ(tree.lowerBound(60).key(), 60);
+    EXPECT_EQ(tree.upperBound(60).key(), 70);
+    EXPECT_EQ(tree.lowerBound(991), tree.end());
+    EXPECT_EQ(tree.upperBound(990), tree.end());
+
+    std::vector<int> keys;
+    for (const auto [k, v] : tree.range(95, 205))
+        keys.push_back(k);
+    EXPECT_EQ(keys, (std::vector<int>{100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200}));
+    EXPECT_TRUE(tree.range(100, 100).isEmpty());
+
+    long sum = 0;
+    const size_t visited = tree.scan(95, 205, [&](const int, const int value) { sum += value; });
+    EXPECT_EQ(visited, 11);
+    EXPECT_EQ(sum, 10 + 11 + 12 + 13 + 14 + 15 + 16 + 17 + 18 + 19 + 20);
+}
+
+
+TEST_F(BPlusTreeUnitTest, IteratorsShouldWalkBothWaysAndWriteValues) {
+    SmallTree tree;
+    for (int i = 0; i < 50; ++i)
+        tree.insert(i, 0);
+
+    for (auto it = tree.begin(); it != tree.end(); ++it)
+        it->second = it->first * 2;
+
+    int expected = 49;
+    for (auto it = tree.end(); it != tree.begin(); --expected) {
+        --it;
+        EXPECT_EQ(it.key(), expected);
+        EXPECT_EQ(it.value(), expected * 2);
+    }
+    EXPECT_EQ(expected, -1);
+}
+
+
+TEST_F(BPlusTreeUnitTest, CopyAndMoveShouldPreserveContents) {
+    BPlusTree<std::string, int, 4> tree;
+    for (int i = 0; i < 200; ++i)
+        tree.insert(std::to_string(i), i);
+
+    BPlusTree copy(tree);
+    EXPECT_TRUE(copy.isValidBPlusTree());
+    EXPECT_EQ(copy.size(), 200);
+    EXPECT_EQ(copy.at("123"), 123);
+
+    BPlusTree<std::string, int, 4> assigned;
+    assigned.insert("x", 1);
+    assigned = copy;
+    EXPECT_EQ(assigned.size(), 200);
+    EXPECT_FALSE(assigned.contains("x"));
+
+    BPlusTree moved(std::move(copy));
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(moved.size(), 200);
+
+    tree = std::move(moved);
+    EXPECT_TRUE(tree.isValidBPlusTree());
+    EXPECT_EQ(tree.at("77"), 77);
+}
@@ -2,11 +2,14 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "BinarySearchTree.hpp"
 #include "BinaryTree.hpp"
 #include "Record.hpp"
 
 
+using containers::BinarySearchTree;
 using containers::BinaryTree;
 using containers::Node;
 
@@ -301,3 +304,115 @@ TEST_F(BinaryTreeUnitTest, NullArrayWithZeroSizeSucceeds) {
     EXPECT_TRUE(tree.isEmpty());
     EXPECT_EQ(tree.size(), 0);
 }
+
+
+namespace {
+
+template <typename Range>
+std::vector<int> collect(const Range& range) {
+    std::vector<int> values;
+    for (const int& value : range)
+        values.push_back(value);
+    return values;
+}
+
+} // namespace
+
+
+TEST_F(BinaryTreeUnitTest, TraversalsShouldVisitInEachOrder) {
+    // Level-order insertion: 1 has children 2 and 3, 2 has 4 and 5, 3 has 6.
+    const BinaryTree<int> tree{1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(collect(tree.preOrder()), (std::vector<int>{1, 2, 4, 5, 3, 6}));
+    EXPECT_EQ(collect(tree.inOrder()), (std::vector<int>{4, 2, 5, 1, 6, 3}));
+    EXPECT_EQ(collect(tree.postOrder()), (std::vector<int>{4, 5, 2, 6, 3, 1}));
+    EXPECT_EQ(collect(tree.levelOrder()), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+
+    const BinaryTree<int> empty;
+    EXPECT_TRUE(empty.preOrder().isEmpty());
+    EXPECT_TRUE(collect(empty.postOrder()).empty());
+    EXPECT_TRUE(collect(empty.levelOrder()).empty());
+}
+
+
+TEST_F(BinaryTreeUnitTest, TraversalsShouldYieldReferencesToStoredValues) {
+    const BinaryTree<std::string> tree{"a", "b", "c"};
+    const std::string& root = *tree.preOrder().begin();
+    EXPECT_EQ(&root, &tree.getRoot()->data);
+    EXPECT_EQ(&*tree.levelOrder().begin(), &tree.getRoot()->data);
+}
+
+
+TEST_F(BinaryTreeUnitTest, TraversalsShouldFollowOneSidedChains) {
+    BinaryTree<int> tree;
+    for (int i = 0; i < 5; ++i)
+        tree.insertLeft(i);
+    tree.insertRight(9);
+
+    EXPECT_EQ(collect(tree.preOrder()), (std::vector<int>{0, 1, 2, 3, 4, 9}));
+    EXPECT_EQ(collect(tree.inOrder()), (std::vector<int>{4, 3, 2, 1, 0, 9}));
+    EXPECT_EQ(collect(tree.postOrder()), (std::vector<int>{4, 3, 2, 1, 9, 0}));
+    EXPECT_EQ(collect(tree.levelOrder()), (std::vector<int>{0, 1, 9, 2, 3, 4}));
+}
+
+
+TEST_F(BinaryTreeUnitTest, InsertShouldFillGapsLeftByEdgeInserts) {
+    BinaryTree<int> tree;
+    tree.insertRight(1);
+    tree.insertRight(3); // gap at index 2
+    tree.insert(2);
+    EXPECT_TRUE(tree.isCompleteTree());
+
+    tree.insert(4);
+    tree.insertLeft(8); // lands at index 8 while index 5 is free
+    EXPECT_FALSE(tree.isCompleteTree());
+    tree.insert(5);
+    tree.insert(6);
+    tree.insert(7);
+    EXPECT_TRUE(tree.isCompleteTree());
+    EXPECT_EQ(collect(tree.levelOrder()), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+
+    // Edge inserts that land on the next index keep the tree complete.
+    BinaryTree<int> edges;
+    edges.insertLeft(1);
+    edges.insertLeft(2);
+    edges.insert(3);
+    edges.insertLeft(4);
+    edges.insert(5);
+    EXPECT_TRUE(edges.isCompleteTree());
+    EXPECT_EQ(collect(edges.levelOrder()), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+
+TEST_F(BinaryTreeUnitTest, LargeTreesShouldNotRecurse) {
+    constexpr int count = 1000000;
+    BinaryTree<int> complete;
+    for (int i = 0; i < count; ++i)
+        complete.insert(i);
+    EXPECT_TRUE(complete.isCompleteTree());
+    EXPECT_EQ(complete.getHeight(), 20);
+    EXPECT_TRUE(complete.contains(count - 1));
+
+    // A right chain is as deep as it is long.
+    constexpr int depth = 50000;
+    BinaryTree<int> chain;
+    for (int i = 0; i < depth; ++i)
+        chain.insertRight(i);
+    EXPECT_EQ(chain.getHeight(), depth);
+    EXPECT_TRUE(chain.contains(depth - 1));
+    EXPECT_FALSE(chain.contains(-1));
+
+    const BinaryTree copy(chain);
+    EXPECT_EQ(copy.getHeight(), depth);
+    size_t visited = 0;
+    for (const int value : copy.postOrder())
+        visited += value >= 0;
+    EXPECT_EQ(visited, depth);
+}
+
+
+TEST_F(BinaryTreeUnitTest, BinarySearchTreeInOrderShouldBeSorted) {
+    const BinarySearchTree<int> tree{8, 3, 10, 1, 6, 14, 4, 7, 13};
+    EXPECT_EQ(collect(tree.inOrder()), (std::vector<int>{1, 3, 4, 6, 7, 8, 10, 13, 14}));
+    EXPECT_EQ(collect(tree.levelOrder()), (std::vector<int>{8, 3, 10, 1, 6, 14, 4, 7, 13}));
+}
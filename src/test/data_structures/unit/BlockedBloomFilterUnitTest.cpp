@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "BlockedBloomFilter.hpp"
+
+
+using containers::BlockedBloomFilter;
+
+
+class BlockedBloomFilterUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(BlockedBloomFilterUnitTest, InsertedKeysAreAlwaysFound) {
+    BlockedBloomFilter<std::uint64_t> filter(10000);
+    for (std::uint64_t i = 0; i < 10000; ++i)
+        filter.insert(i * 977);
+    for (std::uint64_t i = 0; i < 10000; ++i)
+        ASSERT_TRUE(filter.mayContain(i * 977)) << i;
+    EXPECT_EQ(filter.size(), 10000u);
+}
+
+
+TEST_F(BlockedBloomFilterUnitTest, FalsePositiveRateMatchesTheDesign) {
+    for (const double rate : {0.05, 0.01, 0.001}) {
+        BlockedBloomFilter<std::uint64_t> filter(100000, rate);
+        for (std::uint64_t i = 0; i < 100000; ++i)
+            filter.insert(i);
+
+        size_t positives = 0;
+        for (std::uint64_t i = 100000; i < 1100000; ++i)
+            positives += filter.mayContain(i);
+        const double measured = static_cast<double>(positives) / 1000000.0;
+
+        EXPECT_LE(filter.falsePositiveRate(), rate);
+        EXPECT_LT(measured, rate * 1.25) << "rate " << rate;
+        EXPECT_GT(measured, rate * 0.5) << "rate " << rate;
+    }
+
+    // About 10.5 bits per key for 1%.
+    const BlockedBloomFilter<int> filter(100000);
+    EXPECT_LT(filter.byteSize() * 8, 100000u * 11);
+    EXPECT_GT(filter.byteSize() * 8, 100000u * 9);
+}
+
+
+TEST_F(BlockedBloomFilterUnitTest, StringKeysAndHashes) {
+    BlockedBloomFilter<std::string> filter(100);
+    filter.insert("apple");
+    filter.insert("pear");
+    EXPECT_TRUE(filter.mayContain("apple"));
+    EXPECT_TRUE(filter.mayContain("pear"));
+
+    size_t positives = 0;
+    for (int i = 0; i < 1000; ++i)
+        positives += filter.mayContain("absent" + std::to_string(i));
+    EXPECT_LT(positives, 20u);
+
+    EXPECT_TRUE(filter.insertHash(12345));
+    EXPECT_TRUE(filter.mayContainHash(12345));
+}
+
+
+TEST_F(BlockedBloomFilterUnitTest, ClearAndInvalidRates) {
+    BlockedBloomFilter<int> filter(0);
+    EXPECT_EQ(filter.blockCount(), 1u);
+    filter.insert(7);
+    EXPECT_TRUE(filter.mayContain(7));
+    filter.clear();
+    EXPECT_FALSE(filter.mayContain(7));
+    EXPECT_EQ(filter.size(), 0u);
+
+    EXPECT_THROW(BlockedBloomFilter<int>(10, 0.0), std::invalid_argument);
+    EXPECT_THROW(BlockedBloomFilter<int>(10, 1.0), std::invalid_argument);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentHashMap.hpp"
+
+
+using containers::ConcurrentHashMap;
+using containers::DefaultHash;
+
+
+class ConcurrentHashMapUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr int THREADS = 8;
+    static constexpr int KEYS_PER_THREAD = 2000;
+};
+
+
+TEST_F(ConcurrentHashMapUnitTest, DefaultConstructor) {
+    const ConcurrentHashMap<int, int> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.shardCount(), 64);
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, InsertFindAndRemove) {
+    ConcurrentHashMap<std::string, int> map;
+    map.insert("one", 1);
+    map.insert("two", 2);
+    map.insert("one", 11);
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.at("one"), 11);
+    EXPECT_EQ(map.find("two"), 2);
+    EXPECT_FALSE(map.find("three").has_value());
+    EXPECT_THROW(static_cast<void>(map.at("three")), std::out_of_range);
+
+    EXPECT_TRUE(map.remove("one"));
+    EXPECT_FALSE(map.remove("one"));
+    EXPECT_FALSE(map.contains("one"));
+    EXPECT_TRUE(map.contains("two"));
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, SingleShard) {
+    ConcurrentHashMap<int, int, DefaultHash<int>, 1> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i, i);
+    EXPECT_EQ(map.size(), 100);
+    EXPECT_EQ(map.at(42), 42);
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, UpdateAndVisit) {
+    ConcurrentHashMap<int, std::string> map;
+    map.insert(1, std::string("a"));
+
+    EXPECT_TRUE(map.update(1, [](std::string& value) { value += "b"; }));
+    EXPECT_FALSE(map.update(2, [](std::string& value) { value += "b"; }));
+
+    std::string seen;
+    EXPECT_TRUE(map.visit(1, [&](const std::string& value) { seen = value; }));
+    EXPECT_EQ(seen, "ab");
+    EXPECT_FALSE(map.visit(2, [&](const std::string&) { seen.clear(); }));
+    EXPECT_EQ(seen, "ab");
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, ClearAndForEach) {
+    ConcurrentHashMap<int, int> map;
+    for (int i = 0; i < 500; ++i)
+        map.insert(i, i * 2);
+
+    long long sum = 0;
+    size_t count = 0;
+    map.forEach([&](const int key, const int value) {
+        EXPECT_EQ(value, key * 2);
+        sum += value;
+        ++count;
+    });
+    EXPECT_EQ(count, 500);
+    EXPECT_EQ(sum, 2LL * (499 * 500 / 2));
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(10));
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, ConcurrentDisjointInserts) {
+    ConcurrentHashMap<int, int> map;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&map, t] {
+            for (int i = 0; i < KEYS_PER_THREAD; ++i) {
+                const int key = t * KEYS_PER_THREAD + i;
+                map.insert(key, key);
+                static_cast<void>(map.contains(key / 2));
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+
+    EXPECT_EQ(map.size(), static_cast<size_t>(THREADS * KEYS_PER_THREAD));
+    for (int key = 0; key < THREADS * KEYS_PER_THREAD; ++key)
+        EXPECT_EQ(map.at(key), key);
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, ComputeIfAbsentRunsFactoryOnce) {
+    ConcurrentHashMap<int, int> map;
+    std::atomic<int> factory_calls{0};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&] {
+            for (int key = 0; key < KEYS_PER_THREAD; ++key) {
+                const int value = map.computeIfAbsent(key, [&] {
+                    factory_calls.fetch_add(1, std::memory_order_relaxed);
+                    return key * 7;
+                });
+                EXPECT_EQ(value, key * 7);
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+
+    EXPECT_EQ(factory_calls.load(), KEYS_PER_THREAD);
+    EXPECT_EQ(map.size(), static_cast<size_t>(KEYS_PER_THREAD));
+}
+
+
+TEST_F(ConcurrentHashMapUnitTest, ConcurrentUpdatesAreAtomic) {
+    ConcurrentHashMap<int, int> map;
+    for (int key = 0; key < 16; ++key)
+        map.insert(key, 0);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&map] {
+            for (int i = 0; i < KEYS_PER_THREAD; ++i)
+                map.update(i % 16, [](int& value) { ++value; });
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+
+    int total = 0;
+    map.forEach([&](int, const int value) { total += value; });
+    EXPECT_EQ(total, THREADS * KEYS_PER_THREAD);
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ConcurrentQueue.hpp"
+
+
+using containers::MpmcQueue;
+using containers::SpscQueue;
+
+
+class ConcurrentQueueUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static constexpr int THREADS = 4;
+    static constexpr int ITEMS_PER_THREAD = 50000;
+};
+
+
+/// Runs the single-threaded contract shared by both queues.
+template <typename Queue>
+void expectFifoWithinCapacity() {
+    Queue queue(5);
+    EXPECT_EQ(queue.capacity(), 8);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.tryDequeue().has_value());
+
+    for (int i = 0; i < 8; ++i)
+        ASSERT_TRUE(queue.tryEnqueue(i));
+    EXPECT_FALSE(queue.tryEnqueue(8));
+    EXPECT_EQ(queue.size(), 8);
+
+    // Wrap around the ring a few times.
+    for (int i = 8; i < 40; ++i) {
+        ASSERT_EQ(queue.tryDequeue(), i - 8);
+        ASSERT_TRUE(queue.tryEnqueue(i));
+    }
+    for (int i = 32; i < 40; ++i)
+        ASSERT_EQ(queue.tryDequeue(), i);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, SpscShouldBeFifoWithinCapacity) {
+    expectFifoWithinCapacity<SpscQueue<int>>();
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, MpmcShouldBeFifoWithinCapacity) {
+    expectFifoWithinCapacity<MpmcQueue<int>>();
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, ZeroCapacityShouldThrow) {
+    EXPECT_THROW(SpscQueue<int>(0), std::invalid_argument);
+    EXPECT_THROW(MpmcQueue<int>(0), std::invalid_argument);
+    EXPECT_EQ(SpscQueue<int>(1).capacity(), 2);
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, BulkOperationsShouldStopAtCapacity) {
+    SpscQueue<int> spsc(8);
+    MpmcQueue<int> mpmc(8);
+    const std::vector<int> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    EXPECT_EQ(spsc.enqueueBulk(input.begin(), 6), 6);
+    EXPECT_EQ(spsc.enqueueBulk(input.begin() + 6, 4), 2);
+    EXPECT_EQ(mpmc.enqueueBulk(input.begin(), 10), 8);
+    EXPECT_EQ(mpmc.enqueueBulk(input.begin(), 1), 0);
+
+    std::vector<int> out;
+    EXPECT_EQ(spsc.dequeueBulk(std::back_inserter(out), 3), 3);
+    EXPECT_EQ(spsc.dequeueBulk(std::back_inserter(out), 100), 5);
+    EXPECT_EQ(mpmc.dequeueBulk(std::back_inserter(out), 100), 8);
+    EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_EQ(spsc.dequeueBulk(std::back_inserter(out), 1), 0);
+    EXPECT_EQ(mpmc.dequeueBulk(std::back_inserter(out), 1), 0);
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, ShouldMoveOnlyTypesAndDestroyLeftovers) {
+    const auto shared = std::make_shared<int>(7);
+    {
+        SpscQueue<std::shared_ptr<int>> spsc(4);
+        MpmcQueue<std::unique_ptr<std::string>> mpmc(4);
+        spsc.tryEnqueue(shared);
+        spsc.tryEnqueue(shared);
+        mpmc.tryEmplace(std::make_unique<std::string>("left behind"));
+        mpmc.tryEmplace(std::make_unique<std::string>("taken"));
+
+        EXPECT_EQ(*spsc.tryDequeue().value(), 7);
+        EXPECT_EQ(shared.use_count(), 2);
+        EXPECT_EQ(*mpmc.tryDequeue().value(), "left behind");
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, SpscShouldHandOffEveryItemInOrder) {
+    constexpr int count = 200000;
+    SpscQueue<int> queue(64);
+
+    std::thread producer([&] {
+        int next = 0;
+        while (next < count) {
+            if (next % 3 == 0) {
+                int batch[16];
+                for (int i = 0; i < 16; ++i)
+                    batch[i] = next + i;
+                const int size = count - next < 16 ? count - next : 16;
+                next += static_cast<int>(queue.enqueueBulk(batch, static_cast<size_t>(size)));
+            } else if (queue.tryEnqueue(next)) {
+                ++next;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    std::vector<int> batch;
+    while (expected < count) {
+        batch.clear();
+        if (queue.dequeueBulk(std::back_inserter(batch), 32) == 0) {
+            if (const auto value = queue.tryDequeue()) {
+                ASSERT_EQ(*value, expected);
+                ++expected;
+            } else {
+                std::this_thread::yield();
+            }
+            continue;
+        }
+        for (const int value : batch)
+            ASSERT_EQ(value, expected++);
+    }
+    producer.join();
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+
+TEST_F(ConcurrentQueueUnitTest, MpmcShouldDeliverEveryItemExactlyOnce) {
+    MpmcQueue<int> queue(128);
+    std::vector<std::vector<int>> received(THREADS);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < THREADS; ++t) {
+        workers.emplace_back([&queue, t] {
+            const int first = t * ITEMS_PER_THREAD;
+            int next = first;
+            while (next < first + ITEMS_PER_THREAD) {
+                int batch[8];
+                for (int i = 0; i < 8; ++i)
+                    batch[i] = next + i;
+                const int left = first + ITEMS_PER_THREAD - next;
+                const size_t sent = queue.enqueueBulk(batch, static_cast<size_t>(left < 8 ? left : 8));
+                if (sent == 0)
+                    std::this_thread::yield();
+                next += static_cast<int>(sent);
+            }
+        });
+        workers.emplace_back([&queue, &received, t] {
+            std::vector<int>& mine = received[static_cast<size_t>(t)];
+            while (mine.size() < ITEMS_PER_THREAD) {
+                size_t taken = 0;
+                if (t % 2 == 0) {
+                    if (const auto value = queue.tryDequeue()) {
+                        mine.push_back(*value);
+                        taken = 1;
+                    }
+                } else {
+                    taken = queue.dequeueBulk(std::back_inserter(mine), ITEMS_PER_THREAD - mine.size());
+                }
+                if (taken == 0)
+                    std::this_thread::yield();
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // Every item arrives once, and items from one producer stay in order
+    // within each consumer.
+    std::vector<int> seen(THREADS * ITEMS_PER_THREAD, 0);
+    for (const std::vector<int>& mine : received) {
+        std::vector<int> last(THREADS, -1);
+        for (const int value : mine) {
+            ++seen[static_cast<size_t>(value)];
+            int& previous = last[static_cast<size_t>(value / ITEMS_PER_THREAD)];
+            ASSERT_LT(previous, value);
+            previous = value;
+        }
+    }
+    for (const int times : seen)
+        ASSERT_EQ(times, 1);
+    EXPECT_TRUE(queue.isEmpty());
+}
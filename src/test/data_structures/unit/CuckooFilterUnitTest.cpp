@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+
+#include "CuckooFilter.hpp"
+
+
+using containers::CuckooFilter;
+
+
+class CuckooFilterUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(CuckooFilterUnitTest, FillsToCapacityWithoutLosingKeys) {
+    CuckooFilter<std::uint64_t> filter(100000);
+    for (std::uint64_t i = 0; i < 100000; ++i)
+        ASSERT_TRUE(filter.insert(i)) << i;
+    for (std::uint64_t i = 0; i < 100000; ++i)
+        ASSERT_TRUE(filter.mayContain(i)) << i;
+    EXPECT_EQ(filter.size(), 100000u);
+
+    size_t positives = 0;
+    for (std::uint64_t i = 100000; i < 1100000; ++i)
+        positives += filter.mayContain(i);
+    EXPECT_LT(static_cast<double>(positives) / 1000000.0, 2 * filter.falsePositiveRate());
+}
+
+
+TEST_F(CuckooFilterUnitTest, ReportsFullInsteadOfDroppingKeys) {
+    CuckooFilter<std::uint32_t> filter(1000);
+    std::uint32_t inserted = 0;
+    while (filter.insert(inserted))
+        ++inserted;
+
+    EXPECT_GE(inserted, 1000u);
+    EXPECT_LE(inserted, filter.slotCount() + 1);
+    for (std::uint32_t i = 0; i < inserted; ++i)
+        ASSERT_TRUE(filter.mayContain(i)) << i;
+
+    // Removals make room again.
+    for (std::uint32_t i = 0; i < inserted / 10; ++i)
+        ASSERT_TRUE(filter.remove(i));
+    EXPECT_TRUE(filter.insert(inserted));
+    EXPECT_TRUE(filter.mayContain(inserted));
+    for (std::uint32_t i = inserted / 10; i < inserted; ++i)
+        ASSERT_TRUE(filter.mayContain(i)) << i;
+}
+
+
+TEST_F(CuckooFilterUnitTest, RemoveForgetsKeys) {
+    CuckooFilter<int> filter(10000);
+    for (int i = 0; i < 10000; ++i)
+        filter.insert(i);
+    for (int i = 0; i < 10000; i += 2)
+        ASSERT_TRUE(filter.remove(i));
+    EXPECT_EQ(filter.size(), 5000u);
+
+    size_t still = 0;
+    for (int i = 0; i < 10000; ++i) {
+        if (i % 2 == 1)
+            ASSERT_TRUE(filter.mayContain(i)) << i;
+        else
+            still += filter.mayContain(i);
+    }
+    EXPECT_LT(still, 10u);
+
+    // Duplicates are counted and removed one at a time.
+    filter.insert(-1);
+    filter.insert(-1);
+    EXPECT_TRUE(filter.remove(-1));
+    EXPECT_TRUE(filter.mayContain(-1));
+    EXPECT_TRUE(filter.remove(-1));
+
+    filter.clear();
+    EXPECT_EQ(filter.size(), 0u);
+    EXPECT_FALSE(filter.mayContain(1));
+}
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DaryHeap.hpp"
+
+
+using containers::DaryHeap;
+using containers::DynamicArray;
+using containers::MaxDaryHeap;
+using containers::MinDaryHeap;
+
+
+class DaryHeapUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+/// Drains a heap and checks that the elements come out in descending order
+/// of Compare, matching a sorted copy of the expected values.
+template <typename Heap, typename Compare = std::less<>>
+void expectDrainsInOrder(Heap& heap, std::vector<int> expected, Compare compare = {}) {
+    std::ranges::sort(expected, [&](int a, int b) { return compare(b, a); });
+    for (const int value : expected) {
+        ASSERT_TRUE(heap.isValidHeap());
+        ASSERT_EQ(heap.extractRoot(), value);
+    }
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+
+TEST_F(DaryHeapUnitTest, NewHeapShouldBeEmpty) {
+    const DaryHeap<int> heap;
+    EXPECT_EQ(heap.size(), 0);
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_EQ(heap.arity(), 4u);
+    EXPECT_THROW((void)heap.peekRoot(), std::out_of_range);
+}
+
+
+TEST_F(DaryHeapUnitTest, InsertShouldKeepGreatestOnTop) {
+    DaryHeap<int> heap;
+    for (const int value : {5, 3, 7, 1, 4, 9, 2})
+        heap.insert(value);
+
+    EXPECT_EQ(heap.size(), 7);
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_EQ(heap.peekRoot(), 9);
+    expectDrainsInOrder(heap, {5, 3, 7, 1, 4, 9, 2});
+}
+
+
+TEST_F(DaryHeapUnitTest, MinHeapAliasShouldKeepSmallestOnTop) {
+    MinDaryHeap<int> heap{5, 3, 7, 1, 4, 9, 2, 1};
+    EXPECT_EQ(heap.peekRoot(), 1);
+    expectDrainsInOrder(heap, {5, 3, 7, 1, 4, 9, 2, 1}, std::greater<>{});
+}
+
+
+TEST_F(DaryHeapUnitTest, HeapifyShouldMatchRepeatedInsertion) {
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    for (size_t n = 0; n <= 100; n += 7) {
+        std::vector<int> values;
+        DynamicArray<int> elements;
+        for (size_t i = 0; i < n; ++i) {
+            values.push_back(dist(rng));
+            elements.addLast(values.back());
+        }
+
+        DaryHeap<int, 3> heap(std::move(elements));
+        EXPECT_EQ(heap.size(), n);
+        expectDrainsInOrder(heap, values);
+    }
+}
+
+
+TEST_F(DaryHeapUnitTest, ArrayConstructorShouldHeapify) {
+    const int values[] = {5, 3, 7, 1, 4, 9, 2};
+    MaxDaryHeap<int, 2> heap(values, 7);
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_EQ(heap.peekRoot(), 9);
+    expectDrainsInOrder(heap, {5, 3, 7, 1, 4, 9, 2});
+}
+
+
+TEST_F(DaryHeapUnitTest, PushPopShouldReturnGreatestOfHeapAndElement) {
+    MinDaryHeap<int> heap{4, 8, 6};
+
+    // Smaller than the top: returned without touching the heap.
+    EXPECT_EQ(heap.pushPop(2), 2);
+    EXPECT_EQ(heap.size(), 3);
+    EXPECT_EQ(heap.peekRoot(), 4);
+
+    // Larger than the top: the top leaves and the element stays.
+    EXPECT_EQ(heap.pushPop(7), 4);
+    EXPECT_EQ(heap.size(), 3);
+    expectDrainsInOrder(heap, {6, 7, 8}, std::greater<>{});
+
+    EXPECT_EQ(heap.pushPop(5), 5); // empty heap
+    EXPECT_TRUE(heap.isEmpty());
+}
+
+
+TEST_F(DaryHeapUnitTest, ReplaceTopShouldAlwaysReturnTheOldTop) {
+    MinDaryHeap<int> heap{4, 8, 6};
+    EXPECT_EQ(heap.replaceTop(1), 4);
+    EXPECT_EQ(heap.peekRoot(), 1);
+    EXPECT_EQ(heap.replaceTop(9), 1);
+    expectDrainsInOrder(heap, {6, 8, 9}, std::greater<>{});
+
+    EXPECT_THROW(heap.replaceTop(3), std::out_of_range);
+    EXPECT_THROW(heap.extractRoot(), std::out_of_range);
+}
+
+
+TEST_F(DaryHeapUnitTest, PushPopShouldKeepTheKLargestOfAStream) {
+    std::mt19937 rng(7);
+    std::vector<int> stream(500);
+    for (int& value : stream)
+        value = static_cast<int>(rng() % 10000);
+
+    constexpr size_t K = 10;
+    MinDaryHeap<int> best;
+    for (const int value : stream) {
+        if (best.size() < K)
+            best.insert(value);
+        else
+            best.pushPop(value);
+    }
+
+    std::ranges::sort(stream, std::greater<>{});
+    stream.resize(K);
+    expectDrainsInOrder(best, stream, std::greater<>{});
+}
+
+
+TEST_F(DaryHeapUnitTest, ShouldHoldMoveOnlyTypes) {
+    DaryHeap<std::unique_ptr<int>, 4,
+             decltype([](const std::unique_ptr<int>& a, const std::unique_ptr<int>& b) {
+                 return *a > *b;
+             })>
+        heap;
+    for (const int value : {3, 1, 2})
+        heap.emplace(std::make_unique<int>(value));
+
+    EXPECT_EQ(*heap.peekRoot(), 1);
+    EXPECT_EQ(*heap.replaceTop(std::make_unique<int>(5)), 1);
+    EXPECT_EQ(*heap.extractRoot(), 2);
+    EXPECT_EQ(*heap.extractRoot(), 3);
+    EXPECT_EQ(*heap.extractRoot(), 5);
+}
+
+
+TEST_F(DaryHeapUnitTest, CopiesShouldBeIndependent) {
+    DaryHeap<std::string> original{"pear", "apple", "fig"};
+    DaryHeap<std::string> copy(original);
+    original.extractRoot();
+
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy.peekRoot(), "pear");
+    EXPECT_EQ(original.peekRoot(), "fig");
+
+    copy.clear();
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(original.size(), 2);
+}
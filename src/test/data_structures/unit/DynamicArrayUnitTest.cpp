@@ -1,10 +1,15 @@
 #include <cstdint>
+#include <cstring>
 #include <gtest/gtest.h>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "CountingResource.hpp"
 #include "DynamicArray.hpp"
 #include "Record.hpp"
 #include "ThrowingType.hpp"
@@ -461,6 +466,67 @@ TEST_F(DynamicArrayUnitTest, CapacityDoesNotReduceBelowDefault) {
 }
 
 
+TEST_F(DynamicArrayUnitTest, GrowthFactorFollowsCapacityPolicy) {
+    DynamicArray<int, std::allocator<int>, 0, containers::ShrinkWhenSparse<150>> arr;
+    std::vector<size_t> capacities;
+    for (int i = 0; i < 40; ++i) {
+        arr.addLast(i);
+        if (capacities.empty() || capacities.back() != arr.capacity())
+            capacities.push_back(arr.capacity());
+    }
+    EXPECT_EQ(capacities, (std::vector<size_t>{5, 7, 10, 15, 22, 33, 49}));
+    for (int i = 0; i < 40; ++i)
+        EXPECT_EQ(arr.get(i), i);
+}
+
+
+TEST_F(DynamicArrayUnitTest, NeverShrinkKeepsCapacity) {
+    DynamicArray<int, std::allocator<int>, 0, containers::NeverShrink<>> arr;
+    for (int i = 0; i < 100; ++i)
+        arr.addLast(i);
+    const size_t peak = arr.capacity();
+    while (!arr.isEmpty())
+        arr.removeLast();
+    arr.shrinkToFit();
+    EXPECT_EQ(arr.capacity(), peak);
+}
+
+
+TEST_F(DynamicArrayUnitTest, ShrinkOnRequestShrinksOnlyOnShrinkToFit) {
+    DynamicArray<int, std::allocator<int>, 0, containers::ShrinkOnRequest<>> arr;
+    for (int i = 0; i < 100; ++i)
+        arr.addLast(i);
+    const size_t peak = arr.capacity();
+    for (int i = 0; i < 90; ++i)
+        arr.removeLast();
+    EXPECT_EQ(arr.capacity(), peak);
+    arr.shrinkToFit();
+    EXPECT_EQ(arr.capacity(), 10u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, HysteresisShrinksOnlyAfterStayingSparse) {
+    DynamicArray<int, std::allocator<int>, 0, containers::HysteresisShrink<8>> arr;
+    for (int i = 0; i < 80; ++i)
+        arr.addLast(i);
+    const size_t peak = arr.capacity();
+
+    // Bursts that dip below a quarter for a few removals keep the buffer.
+    for (int burst = 0; burst < 10; ++burst) {
+        while (arr.size() > peak / 4 - 5)
+            arr.removeLast();
+        while (arr.size() < 80)
+            arr.addLast(0);
+        EXPECT_EQ(arr.capacity(), peak);
+    }
+
+    // A long sparse spell halves it.
+    while (arr.size() > peak / 4 - 10)
+        arr.removeLast();
+    EXPECT_EQ(arr.capacity(), peak / 2);
+}
+
+
 TEST_F(DynamicArrayUnitTest, RemoveAllKeepsCapacityAndZeroesSize) {
     DynamicArray<int> arr;
     for (int i = 0; i < 12; ++i)
@@ -1186,3 +1252,275 @@ TEST_F(DynamicArrayUnitTest, RemoveAllWithMoveOnly) {
     EXPECT_EQ(a.size(), 0u);
     EXPECT_GE(a.capacity(), 5u);
 }
+
+
+TEST_F(DynamicArrayUnitTest, PmrArrayAllocatesFromResource) {
+    CountingResource resource;
+    {
+        containers::pmr::DynamicArray<std::string> arr(&resource);
+        EXPECT_EQ(resource.allocations, 1u);
+        for (int i = 0; i < 100; ++i)
+            arr.addLast(std::to_string(i));
+        EXPECT_GT(resource.allocations, 1u);
+        EXPECT_EQ(arr.getAllocator().resource(), &resource);
+        EXPECT_EQ(arr[42], "42");
+    }
+    EXPECT_EQ(resource.allocations, resource.deallocations);
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, PmrArrayOnMonotonicBuffer) {
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                              std::pmr::null_memory_resource());
+    containers::pmr::DynamicArray<int> arr(16, &arena);
+    for (int i = 0; i < 16; ++i)
+        arr.addLast(i);
+    EXPECT_EQ(arr.size(), 16u);
+    EXPECT_EQ(arr.getLast(), 15);
+}
+
+
+TEST_F(DynamicArrayUnitTest, PmrCopyUsesDefaultResourceAndMoveKeepsStorage) {
+    CountingResource resource;
+    containers::pmr::DynamicArray<int> arr({1, 2, 3}, &resource);
+
+    // polymorphic_allocator does not propagate on copy construction.
+    const containers::pmr::DynamicArray<int> copy(arr);
+    EXPECT_EQ(copy.getAllocator().resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(copy[2], 3);
+
+    const containers::pmr::DynamicArray<int> copy_here(arr, &resource);
+    EXPECT_EQ(copy_here.getAllocator().resource(), &resource);
+
+    const size_t allocations = resource.allocations;
+    const containers::pmr::DynamicArray<int> moved(std::move(arr));
+    EXPECT_EQ(resource.allocations, allocations);
+    EXPECT_EQ(moved.getAllocator().resource(), &resource);
+    EXPECT_EQ(moved[0], 1);
+}
+
+
+TEST_F(DynamicArrayUnitTest, PmrMoveAssignBetweenResourcesMovesElements) {
+    CountingResource first;
+    CountingResource second;
+    containers::pmr::DynamicArray<std::string> source({"a", "b"}, &first);
+    containers::pmr::DynamicArray<std::string> target(&second);
+
+    target = std::move(source);
+    EXPECT_EQ(target.getAllocator().resource(), &second);
+    ASSERT_EQ(target.size(), 2u);
+    EXPECT_EQ(target[1], "b");
+    EXPECT_TRUE(source.isEmpty());
+    EXPECT_EQ(first.allocations, 1u);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SmallArrayStaysInlineUpToCapacity) {
+    CountingResource resource;
+    containers::SmallDynamicArray<int, 8, std::pmr::polymorphic_allocator<int>> arr(&resource);
+    EXPECT_EQ(arr.inlineCapacity(), 8u);
+    EXPECT_EQ(arr.capacity(), 8u);
+
+    for (int i = 0; i < 8; ++i)
+        arr.addLast(i);
+    EXPECT_TRUE(arr.usesInlineStorage());
+    EXPECT_EQ(resource.allocations, 0u);
+
+    arr.addLast(8);
+    EXPECT_FALSE(arr.usesInlineStorage());
+    EXPECT_EQ(resource.allocations, 1u);
+    for (int i = 0; i < 9; ++i)
+        EXPECT_EQ(arr[i], i);
+
+    while (arr.size() > 2)
+        arr.popBack();
+    EXPECT_TRUE(arr.usesInlineStorage());
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+    EXPECT_EQ(arr.getLast(), 1);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SmallArrayMoveMovesInlineElements) {
+    containers::SmallDynamicArray<std::string, 4> source;
+    source.addLast("a");
+    source.addLast("b");
+
+    containers::SmallDynamicArray<std::string, 4> moved(std::move(source));
+    EXPECT_TRUE(moved.usesInlineStorage());
+    ASSERT_EQ(moved.size(), 2u);
+    EXPECT_EQ(moved[1], "b");
+    EXPECT_TRUE(source.isEmpty());
+    source.addLast("c");
+    EXPECT_EQ(source.getFirst(), "c");
+
+    containers::SmallDynamicArray<std::string, 4> spilled;
+    for (int i = 0; i < 10; ++i)
+        spilled.addLast(std::to_string(i));
+    const std::string* heap_data = &spilled[0];
+    moved = std::move(spilled);
+    EXPECT_EQ(&moved[0], heap_data);
+    EXPECT_TRUE(spilled.usesInlineStorage());
+    EXPECT_TRUE(spilled.isEmpty());
+}
+
+
+TEST_F(DynamicArrayUnitTest, SmallArrayCopyAndMiddleInsert) {
+    containers::SmallDynamicArray<int, 4> arr{1, 2, 4};
+    arr.insert(3, 2);
+    EXPECT_TRUE(arr.usesInlineStorage());
+    arr.addFirst(0);
+    EXPECT_FALSE(arr.usesInlineStorage());
+
+    const containers::SmallDynamicArray<int, 4> copy(arr);
+    ASSERT_EQ(copy.size(), 5u);
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(copy[i], i);
+
+    containers::SmallDynamicArray<int, 4> small{7};
+    small = copy;
+    EXPECT_EQ(small.size(), 5u);
+    EXPECT_EQ(small.getLast(), 4);
+}
+
+
+TEST_F(DynamicArrayUnitTest, SmallArrayGrowthFailureLeavesInlineArrayUnchanged) {
+    containers::SmallDynamicArray<ThrowingType, 2> arr;
+    arr.emplaceLast(1);
+    arr.emplaceLast(2);
+    ThrowingType::should_throw = true;
+    EXPECT_THROW(arr.emplaceLast(3), std::runtime_error);
+    ThrowingType::should_throw = false;
+    EXPECT_TRUE(arr.usesInlineStorage());
+    ASSERT_EQ(arr.size(), 2u);
+    EXPECT_EQ(arr[0].value, 1);
+    EXPECT_EQ(arr[1].value, 2);
+}
+
+
+TEST_F(DynamicArrayUnitTest, AddLastOfOwnElementWhileFull) {
+    DynamicArray<std::string> arr;
+    while (arr.size() < arr.capacity())
+        arr.addLast(std::string(32, 'x') + std::to_string(arr.size()));
+
+    const std::string first = arr[0];
+    arr.addLast(arr[0]);
+    EXPECT_EQ(arr.getLast(), first);
+    arr.addFirst(arr.getLast());
+    EXPECT_EQ(arr.getFirst(), first);
+}
+
+
+namespace {
+
+/// Owns heap memory but holds no self-pointers, so it opts into bitwise
+/// relocation. Counts move constructions to observe the fast path.
+struct Boxed {
+    static inline int moves = 0;
+    std::unique_ptr<int> value;
+
+    explicit Boxed(const int v) : value(std::make_unique<int>(v)) {}
+    Boxed(Boxed&& other) noexcept : value(std::move(other.value)) { ++moves; }
+    Boxed& operator=(Boxed&& other) noexcept {
+        value = std::move(other.value);
+        ++moves;
+        return *this;
+    }
+};
+
+} // namespace
+
+template <>
+struct containers::is_trivially_relocatable<Boxed> : std::true_type {};
+
+
+TEST_F(DynamicArrayUnitTest, RelocatableTypeIsMovedBitwise) {
+    static_assert(containers::is_trivially_relocatable_v<double>);
+    static_assert(!containers::is_trivially_relocatable_v<std::string>);
+
+    Boxed::moves = 0;
+    DynamicArray<Boxed> arr;
+    for (int i = 0; i < 100; ++i)
+        arr.emplaceLast(i);
+    arr.emplaceAt(50, -1);
+    arr.emplaceFirst(-2);
+    arr.removeAt(10);
+    arr.erase(arr.begin() + 20, arr.begin() + 30);
+    EXPECT_EQ(Boxed::moves, 1); // only removeAt() moves the returned element out
+
+    ASSERT_EQ(arr.size(), 91u);
+    EXPECT_EQ(*arr[0].value, -2);
+    EXPECT_EQ(*arr[1].value, 0);
+    EXPECT_EQ(*arr[10].value, 10);
+    EXPECT_EQ(*arr[20].value, 30);
+    EXPECT_EQ(*arr.getLast().value, 99);
+}
+
+
+TEST_F(DynamicArrayUnitTest, TriviallyCopyableMiddleInsertAndErase) {
+    DynamicArray<double> arr;
+    for (int i = 0; i < 10; ++i)
+        arr.addLast(i);
+    arr.insert(arr[9], 0);
+    arr.insert(2.5, 3);
+    EXPECT_EQ(arr[0], 9.0);
+    EXPECT_EQ(arr[3], 2.5);
+    EXPECT_EQ(arr[4], 2.0);
+    arr.removeAt(0);
+    arr.erase(arr.begin(), arr.begin() + 2);
+    ASSERT_EQ(arr.size(), 9u);
+    EXPECT_EQ(arr[0], 2.5);
+    EXPECT_EQ(arr.getLast(), 9.0);
+
+    const DynamicArray<double> copy(arr);
+    EXPECT_EQ(copy[1], 2.0);
+}
+
+
+TEST_F(DynamicArrayUnitTest, AppendRangeAndPopBackN) {
+    DynamicArray<int> arr;
+    const int values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    arr.appendRange(std::begin(values), std::end(values));
+    ASSERT_EQ(arr.size(), 12u);
+    EXPECT_EQ(arr[0], 1);
+    EXPECT_EQ(arr.getLast(), 12);
+
+    // A small append into a full array still grows geometrically.
+    arr.shrinkToFit();
+    arr.appendRange(std::begin(values), std::begin(values) + 1);
+    EXPECT_EQ(arr.capacity(), 24u);
+
+    const size_t capacity = arr.capacity();
+    arr.popBackN(11);
+    EXPECT_EQ(arr.size(), 2u);
+    EXPECT_EQ(arr.capacity(), capacity);
+    EXPECT_THROW(arr.popBackN(3), std::out_of_range);
+
+    arr.reserve(10);
+    arr.emplaceLastUnchecked(42);
+    EXPECT_EQ(arr.getLast(), 42);
+}
+
+
+TEST_F(DynamicArrayUnitTest, AppendForOverwriteFillsInPlace) {
+    // No default constructor: the elements are only ever written as bytes.
+    struct Pair {
+        int a, b;
+        Pair(const int x, const int y) : a(x), b(y) {}
+    };
+    const Pair source[] = {{1, 2}, {3, 4}, {5, 6}};
+
+    DynamicArray<Pair> arr;
+    arr.emplaceLast(0, 0);
+    Pair* slots = arr.appendForOverwrite(3);
+    ASSERT_EQ(arr.size(), 4u);
+    EXPECT_EQ(slots, arr.begin() + 1);
+    std::memcpy(static_cast<void*>(slots), source, 2 * sizeof(Pair));
+    arr.popBackN(1);
+
+    ASSERT_EQ(arr.size(), 3u);
+    EXPECT_EQ(arr[1].a, 1);
+    EXPECT_EQ(arr[2].b, 4);
+    EXPECT_EQ(arr.appendForOverwrite(0), arr.end());
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "FilteredHashMap.hpp"
+
+
+using containers::CuckooFilter;
+using containers::DefaultHash;
+using containers::FilteredHashMap;
+
+using CuckooFilteredMap = FilteredHashMap<int, int, DefaultHash<int>, CuckooFilter<int, DefaultHash<int>>>;
+
+
+class FilteredHashMapUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+template <typename Map>
+void exerciseMap() {
+    Map map;
+    for (int i = 0; i < 20000; ++i)
+        map.insert(i, i * 2);
+    map.insert(5, -5);
+    EXPECT_EQ(map.size(), 20000u);
+    EXPECT_EQ(map.at(5), -5);
+
+    // The filter grew with the map and still knows every key.
+    EXPECT_GE(map.filter().size(), 20000u);
+    for (int i = 0; i < 20000; ++i)
+        ASSERT_TRUE(map.contains(i)) << i;
+    for (int i = 20000; i < 40000; ++i)
+        ASSERT_FALSE(map.contains(i)) << i;
+    EXPECT_EQ(map.find(40001), map.end());
+    EXPECT_EQ((*map.find(7)).second, 14);
+    EXPECT_THROW((void)map.at(-1), std::out_of_range);
+
+    // Remove most keys, then add them back.
+    for (int i = 0; i < 20000; ++i) {
+        if (i % 10 != 0) {
+            ASSERT_TRUE(map.remove(i)) << i;
+        }
+    }
+    EXPECT_FALSE(map.remove(1));
+    EXPECT_EQ(map.size(), 2000u);
+    for (int i = 0; i < 20000; ++i)
+        ASSERT_EQ(map.contains(i), i % 10 == 0) << i;
+
+    for (int i = 0; i < 20000; ++i)
+        map.insert(i, i);
+    for (int i = 0; i < 20000; ++i)
+        ASSERT_EQ(map.at(i), i);
+
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(0));
+}
+
+
+TEST_F(FilteredHashMapUnitTest, BloomFilteredMap) {
+    exerciseMap<FilteredHashMap<int, int>>();
+}
+
+
+TEST_F(FilteredHashMapUnitTest, CuckooFilteredMap) {
+    exerciseMap<CuckooFilteredMap>();
+}
+
+
+TEST_F(FilteredHashMapUnitTest, StringKeysWithViews) {
+    FilteredHashMap<std::string, int> map(100);
+    map.insert(std::string("alpha"), 1);
+    map.insert(std::string_view("beta"), 2);
+    EXPECT_TRUE(map.contains(std::string_view("alpha")));
+    EXPECT_TRUE(map.contains("beta"));
+    EXPECT_FALSE(map.contains("gamma"));
+    EXPECT_EQ(map.at(std::string_view("beta")), 2);
+    EXPECT_TRUE(map.remove("alpha"));
+    EXPECT_FALSE(map.contains("alpha"));
+}
+
+
+TEST_F(FilteredHashMapUnitTest, MostMissesSkipTheTable) {
+    FilteredHashMap<int, int> map(100000);
+    for (int i = 0; i < 100000; ++i)
+        map.insert(i, i);
+
+    size_t passed = 0;
+    for (int i = 100000; i < 200000; ++i)
+        passed += map.filter().mayContainHash(map.map().hashOf(i));
+    EXPECT_LT(passed, 1500u);
+}
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+#include "FlatHashMap.hpp"
+
+
+using containers::FlatHashMap;
+
+
+class FlatHashMapUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(FlatHashMapUnitTest, DefaultConstructor) {
+    const FlatHashMap<int, int> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.capacity(), 16);
+}
+
+
+TEST_F(FlatHashMapUnitTest, CapacityConstructorRoundsUp) {
+    const FlatHashMap<int, int> map(100);
+    EXPECT_EQ(map.capacity(), 128);
+}
+
+
+TEST_F(FlatHashMapUnitTest, InsertAndRetrieve) {
+    FlatHashMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    EXPECT_EQ(map.at(1), 10);
+    EXPECT_EQ(map.at(2), 20);
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST_F(FlatHashMapUnitTest, OverwriteValue) {
+    FlatHashMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(1, 42);
+    EXPECT_EQ(map.at(1), 42);
+    EXPECT_EQ(map.size(), 1);
+}
+
+
+TEST_F(FlatHashMapUnitTest, SubscriptInsertsDefault) {
+    FlatHashMap<std::string, int> map;
+    map["a"] += 3;
+    map["a"] += 4;
+    map["b"];
+    EXPECT_EQ(map.at("a"), 7);
+    EXPECT_EQ(map.at("b"), 0);
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST_F(FlatHashMapUnitTest, RemoveKey) {
+    FlatHashMap<int, int> map;
+    map.insert(5, 50);
+    EXPECT_TRUE(map.remove(5));
+    EXPECT_FALSE(map.remove(5));
+    EXPECT_FALSE(map.contains(5));
+    EXPECT_THROW(map.at(5), std::out_of_range);
+    EXPECT_TRUE(map.isEmpty());
+}
+
+
+TEST_F(FlatHashMapUnitTest, RehashKeepsValues) {
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 10000; ++i)
+        map.insert(i, i * 2);
+    EXPECT_EQ(map.size(), 10000);
+    for (int i = 0; i < 10000; ++i)
+        EXPECT_EQ(map.at(i), i * 2);
+    EXPECT_FALSE(map.contains(10000));
+}
+
+
+TEST_F(FlatHashMapUnitTest, ChurnDoesNotGrowCapacity) {
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 5; ++i)
+        map.insert(i, i);
+    const size_t capacity = map.capacity();
+
+    // Continuous insert/remove leaves deleted slots behind; they must be
+    // purged by same-size rebuilds rather than by growing the table.
+    for (int i = 5; i < 100000; ++i) {
+        map.insert(i, i);
+        EXPECT_TRUE(map.remove(i - 5));
+    }
+    EXPECT_EQ(map.size(), 5);
+    EXPECT_EQ(map.capacity(), capacity);
+    for (int i = 100000 - 5; i < 100000; ++i)
+        EXPECT_EQ(map.at(i), i);
+}
+
+
+TEST_F(FlatHashMapUnitTest, IterationVisitsEveryPair) {
+    FlatHashMap<int, int> map;
+    for (int i = 0; i < 200; ++i)
+        map.insert(i, i + 1);
+    for (int i = 0; i < 200; i += 2)
+        map.remove(i);
+
+    size_t count = 0;
+    long long key_sum = 0;
+    for (auto [key, value] : map) {
+        EXPECT_EQ(key % 2, 1);
+        EXPECT_EQ(value, key + 1);
+        key_sum += key;
+        ++count;
+    }
+    EXPECT_EQ(count, 100);
+    EXPECT_EQ(key_sum, 100LL * 100);
+}
+
+
+TEST_F(FlatHashMapUnitTest, CopyConstructor) {
+    FlatHashMap<int, std::string> map;
+    for (int i = 0; i < 50; ++i)
+        map.insert(i, std::to_string(i));
+    map.remove(7);
+    FlatHashMap<int, std::string> copy(map);
+    EXPECT_EQ(copy.size(), map.size());
+    EXPECT_FALSE(copy.contains(7));
+    for (int i = 0; i < 50; ++i) {
+        if (i != 7) {
+            EXPECT_EQ(copy.at(i), std::to_string(i));
+        }
+    }
+}
+
+
+TEST_F(FlatHashMapUnitTest, MoveConstructorLeavesUsableSource) {
+    FlatHashMap<int, int> map;
+    map.insert(1, 1);
+    FlatHashMap<int, int> moved(std::move(map));
+    EXPECT_EQ(moved.size(), 1);
+    EXPECT_TRUE(moved.contains(1));
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(1));
+
+    map.insert(2, 2);
+    EXPECT_EQ(map.at(2), 2);
+}
+
+
+TEST_F(FlatHashMapUnitTest, ClearKeepsCapacity) {
+    FlatHashMap<std::string, std::string> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(std::to_string(i), std::string(32, 'x'));
+    const size_t capacity = map.capacity();
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_FALSE(map.contains("1"));
+    map.insert("1", "one");
+    EXPECT_EQ(map.at("1"), "one");
+}
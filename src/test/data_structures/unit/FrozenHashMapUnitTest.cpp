@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DefaultHash.hpp"
+#include "FrozenHashMap.hpp"
+#include "HashMap.hpp"
+
+
+using containers::DefaultHash;
+using containers::FrozenHashMap;
+using containers::HashMap;
+using containers::ImageCheck;
+
+
+class FrozenHashMapUnitTest : public testing::Test {
+  protected:
+    std::filesystem::path path_;
+
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path() /
+                ("frozen_hash_map_" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+};
+
+
+struct Record {
+    uint32_t id;
+    float score;
+};
+
+
+TEST_F(FrozenHashMapUnitTest, RoundTripsHashMap) {
+    HashMap<uint64_t, Record> map;
+    for (uint64_t i = 0; i < 5000; ++i)
+        map.insert(i * 7919, Record{static_cast<uint32_t>(i), static_cast<float>(i) / 2});
+    FrozenHashMap<uint64_t, Record>::save(path_, map);
+
+    const FrozenHashMap<uint64_t, Record> frozen(path_, ImageCheck::Checksum);
+    EXPECT_EQ(frozen.size(), 5000u);
+    EXPECT_GE(frozen.capacity() * 70, frozen.size() * 100);
+
+    for (uint64_t i = 0; i < 5000; ++i) {
+        const Record* record = frozen.find(i * 7919);
+        ASSERT_NE(record, nullptr);
+        ASSERT_EQ(record->id, i);
+        ASSERT_FALSE(frozen.contains(i * 7919 + 1));
+    }
+    EXPECT_EQ(frozen.at(7919 * 3).score, 1.5f);
+    EXPECT_THROW(frozen.at(1), std::out_of_range);
+
+    size_t visited = 0;
+    frozen.forEach([&](const uint64_t key, const Record& record) {
+        EXPECT_EQ(key, record.id * uint64_t{7919});
+        ++visited;
+    });
+    EXPECT_EQ(visited, 5000u);
+}
+
+
+TEST_F(FrozenHashMapUnitTest, LastDuplicateWinsAndEmptyMapsWork) {
+    const std::vector<std::pair<int32_t, int32_t>> entries = {{1, 10}, {2, 20}, {1, 11}, {3, 30}};
+    FrozenHashMap<int32_t, int32_t>::save(path_, entries);
+    const FrozenHashMap<int32_t, int32_t> frozen(path_);
+    EXPECT_EQ(frozen.size(), 3u);
+    EXPECT_EQ(frozen.at(1), 11);
+    EXPECT_EQ(frozen.at(3), 30);
+
+    FrozenHashMap<int32_t, int32_t>::save(path_, std::vector<std::pair<int32_t, int32_t>>{});
+    const FrozenHashMap<int32_t, int32_t> empty(path_, ImageCheck::Checksum);
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty.find(1), nullptr);
+
+    const FrozenHashMap<int32_t, int32_t> unopened;
+    EXPECT_FALSE(unopened.contains(0));
+}
+
+
+TEST_F(FrozenHashMapUnitTest, FindManyMatchesFind) {
+    std::vector<std::pair<uint32_t, uint32_t>> entries;
+    for (uint32_t i = 0; i < 1000; ++i)
+        entries.emplace_back(i * 3, i);
+    FrozenHashMap<uint32_t, uint32_t>::save(path_, entries);
+    const FrozenHashMap<uint32_t, uint32_t> frozen(path_);
+
+    std::mt19937 rng(3);
+    std::vector<uint32_t> keys(200);
+    for (uint32_t& key : keys)
+        key = rng() % 3000;
+    std::vector<const uint32_t*> out(keys.size());
+
+    size_t expected = 0;
+    const size_t found = frozen.findMany(keys.data(), keys.size(), out.data());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(out[i], frozen.find(keys[i]));
+        expected += out[i] != nullptr;
+    }
+    EXPECT_EQ(found, expected);
+    EXPECT_GT(found, 0u);
+}
+
+
+TEST_F(FrozenHashMapUnitTest, RejectsMismatchedImages) {
+    const std::vector<std::pair<int32_t, int64_t>> entries = {{1, 2}, {3, 4}};
+    FrozenHashMap<int32_t, int64_t>::save(path_, entries);
+
+    using WrongValue = FrozenHashMap<int32_t, int32_t>;
+    EXPECT_THROW(WrongValue{path_}, std::runtime_error);
+
+    // A per-process random seed hashes keys differently than the image.
+    using RandomSeed = FrozenHashMap<int32_t, int64_t, DefaultHash<int32_t, true>>;
+    EXPECT_THROW(RandomSeed{path_}, std::runtime_error);
+
+    const std::filesystem::path other = path_.string() + "_array";
+    {
+        std::ofstream out(other, std::ios::binary);
+        out << std::string(256, 'x');
+    }
+    EXPECT_THROW((FrozenHashMap<int32_t, int64_t>{other}), std::runtime_error);
+    std::filesystem::remove(other);
+}
+
+
+TEST_F(FrozenHashMapUnitTest, ChecksumDetectsCorruptTable) {
+    std::vector<std::pair<uint64_t, uint64_t>> entries;
+    for (uint64_t i = 0; i < 100; ++i)
+        entries.emplace_back(i, i);
+    FrozenHashMap<uint64_t, uint64_t>::save(path_, entries);
+
+    {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('\x7f');
+    }
+    EXPECT_NO_THROW((FrozenHashMap<uint64_t, uint64_t>{path_}));
+    EXPECT_THROW((FrozenHashMap<uint64_t, uint64_t>{path_, ImageCheck::Checksum}), std::runtime_error);
+}
@@ -1,10 +1,20 @@
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include "HashMap.hpp"
 
 
+using containers::DefaultHash;
 using containers::HashMap;
+using containers::IncrementalRehash;
+
+using IncrementalMap = HashMap<int, int, DefaultHash<int>, 70, IncrementalRehash<2>>;
 
 
 class HashMapUnitTest : public testing::Test {
@@ -75,3 +85,416 @@ TEST_F(HashMapUnitTest, MoveConstructor) {
     EXPECT_TRUE(moved.contains(1));
     EXPECT_TRUE(map.isEmpty());
 }
+
+
+TEST_F(HashMapUnitTest, ChurnReusesTombstones) {
+    HashMap<int, int> map;
+    for (int i = 0; i < 5; ++i)
+        map.insert(i, i);
+    for (int i = 5; i < 100; ++i) {
+        map.remove(i - 5);
+        map.insert(i, i);
+    }
+    const size_t capacity = map.capacity();
+
+    // Without tombstone accounting this loop never terminates once every
+    // bucket has been used once; with it the table is rebuilt in place.
+    for (int i = 100; i < 10000; ++i) {
+        EXPECT_TRUE(map.remove(i - 5));
+        map.insert(i, i);
+        EXPECT_FALSE(map.contains(i - 5));
+    }
+    EXPECT_EQ(map.size(), 5);
+    EXPECT_EQ(map.capacity(), capacity);
+    for (int i = 9995; i < 10000; ++i)
+        EXPECT_EQ(map.at(i), i);
+}
+
+
+TEST_F(HashMapUnitTest, ClearAllowsReuse) {
+    HashMap<int, int> map;
+    for (int i = 0; i < 50; ++i)
+        map.insert(i, i);
+    for (int i = 0; i < 25; ++i)
+        map.remove(i);
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(30));
+    map.insert(7, 70);
+    EXPECT_EQ(map.at(7), 70);
+    EXPECT_EQ(map.size(), 1);
+}
+
+
+TEST_F(HashMapUnitTest, IncrementalRehashMigratesGradually) {
+    IncrementalMap map;
+    bool saw_rehashing = false;
+    for (int i = 0; i < 1000; ++i) {
+        map.insert(i, i * 3);
+        saw_rehashing = saw_rehashing || map.isRehashing();
+
+        // Every key stays reachable while the migration is in progress.
+        EXPECT_TRUE(map.contains(i / 2));
+    }
+    EXPECT_TRUE(saw_rehashing);
+    EXPECT_EQ(map.size(), 1000);
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.at(i), i * 3);
+}
+
+
+TEST_F(HashMapUnitTest, IncrementalRehashMutationsDuringMigration) {
+    IncrementalMap map;
+    int next = 0;
+    // Grow past the first few resizes so the migration spans many operations.
+    while (next < 200 || !map.isRehashing()) {
+        map.insert(next, next);
+        ++next;
+    }
+
+    // Overwrite, remove and re-insert keys that may still live in the old array.
+    map.insert(0, 100);
+    EXPECT_TRUE(map.remove(1));
+    EXPECT_FALSE(map.remove(1));
+    map[2] += 5;
+    EXPECT_TRUE(map.isRehashing());
+
+    EXPECT_EQ(map.at(0), 100);
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.at(2), 7);
+    EXPECT_EQ(map.size(), static_cast<size_t>(next - 1));
+
+    size_t visited = 0;
+    for (auto [key, value] : map) {
+        EXPECT_NE(key, 1);
+        ++visited;
+    }
+    EXPECT_EQ(visited, map.size());
+}
+
+
+TEST_F(HashMapUnitTest, IncrementalRehashCopyAndMove) {
+    HashMap<std::string, int, DefaultHash<std::string>, 70, IncrementalRehash<1>> map;
+    int next = 0;
+    while (!map.isRehashing()) {
+        map.insert(std::to_string(next), next);
+        ++next;
+    }
+
+    auto copy = map;
+    EXPECT_FALSE(copy.isRehashing());
+    EXPECT_EQ(copy.size(), map.size());
+
+    auto moved = std::move(map);
+    EXPECT_TRUE(moved.isRehashing());
+    EXPECT_TRUE(map.isEmpty());
+
+    for (int i = 0; i < next; ++i) {
+        EXPECT_EQ(copy.at(std::to_string(i)), i);
+        EXPECT_EQ(moved.at(std::to_string(i)), i);
+    }
+
+    moved.clear();
+    EXPECT_FALSE(moved.isRehashing());
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+
+TEST_F(HashMapUnitTest, HeterogeneousStringLookup) {
+    HashMap<std::string, int> map;
+    map.insert(std::string("alpha"), 1);
+    map.insert("beta", 2);
+
+    const std::string_view alpha = "alpha";
+    EXPECT_TRUE(map.contains(alpha));
+    EXPECT_TRUE(map.contains("beta"));
+    EXPECT_FALSE(map.contains(std::string_view("gamma")));
+    EXPECT_EQ(map.at(alpha), 1);
+    EXPECT_EQ(std::as_const(map).at(std::string_view("beta")), 2);
+    EXPECT_THROW(map.at(std::string_view("gamma")), std::out_of_range);
+
+    map[std::string_view("gamma")] = 3;
+    EXPECT_EQ(map.at("gamma"), 3);
+
+    EXPECT_TRUE(map.remove(alpha));
+    EXPECT_FALSE(map.remove(alpha));
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST_F(HashMapUnitTest, PrecomputedHash) {
+    HashMap<std::string, int> map;
+    const std::string_view key = "request-id";
+    const size_t hash = map.hashOf(key);
+    EXPECT_EQ(hash, map.hashOf(std::string(key)));
+
+    EXPECT_FALSE(map.contains(key, hash));
+    EXPECT_TRUE(map.insertOrAssign(key, 1, hash).second);
+    EXPECT_TRUE(map.contains(key, hash));
+    EXPECT_EQ(map.at(key, hash), 1);
+    EXPECT_EQ(map.find(key, hash)->second, 1);
+    EXPECT_TRUE(map.remove(key, hash));
+    EXPECT_EQ(map.find(key, hash), map.end());
+}
+
+
+TEST_F(HashMapUnitTest, TryEmplaceConstructsOnlyWhenAbsent) {
+    HashMap<int, std::string> map;
+
+    auto [it, inserted] = map.tryEmplace(1, 3, 'x');
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(it->first, 1);
+    EXPECT_EQ(it->second, "xxx");
+
+    std::string value = "moved";
+    auto [again, inserted_again] = map.tryEmplace(1, std::move(value));
+    EXPECT_FALSE(inserted_again);
+    EXPECT_EQ(again->second, "xxx");
+    EXPECT_EQ(value, "moved"); // not consumed for an existing key
+
+    auto [empty, inserted_empty] = map.tryEmplace(2);
+    EXPECT_TRUE(inserted_empty);
+    EXPECT_TRUE(empty->second.empty());
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST_F(HashMapUnitTest, InsertOrAssignReportsInsertion) {
+    HashMap<std::string, int> map;
+    auto [first, inserted] = map.insertOrAssign(std::string_view("k"), 1);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(first->second, 1);
+
+    auto [second, inserted_again] = map.insertOrAssign("k", 2);
+    EXPECT_FALSE(inserted_again);
+    EXPECT_EQ(second->second, 2);
+    EXPECT_EQ(map.at("k"), 2);
+    EXPECT_EQ(map.size(), 1);
+}
+
+
+TEST_F(HashMapUnitTest, FindDuringIncrementalRehash) {
+    IncrementalMap map;
+    int next = 0;
+    while (next < 200 || !map.isRehashing()) {
+        map.tryEmplace(next, next);
+        ++next;
+    }
+
+    for (int key = 0; key < next; ++key) {
+        const auto it = std::as_const(map).find(key);
+        ASSERT_NE(it, map.cend());
+        EXPECT_EQ(it->second, key);
+    }
+    EXPECT_EQ(map.find(next), map.end());
+    EXPECT_FALSE(map.tryEmplace(0, -1).second);
+    EXPECT_EQ(map.at(0), 0);
+}
+
+
+TEST_F(HashMapUnitTest, ReserveAvoidsRehash) {
+    HashMap<int, int> map;
+    map.reserve(1000);
+    const size_t capacity = map.capacity();
+    EXPECT_GE(capacity * 70 / 100, 1000);
+
+    for (int i = 0; i < 1000; ++i)
+        map.insert(i, i);
+    EXPECT_EQ(map.capacity(), capacity);
+
+    map.reserve(10); // never shrinks
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.at(999), 999);
+}
+
+
+TEST_F(HashMapUnitTest, ReserveDuringIncrementalRehash) {
+    IncrementalMap map;
+    int next = 0;
+    while (next < 200 || !map.isRehashing()) {
+        map.insert(next, next);
+        ++next;
+    }
+    map.reserve(5000);
+    EXPECT_FALSE(map.isRehashing());
+    for (int key = 0; key < next; ++key)
+        EXPECT_EQ(map.at(key), key);
+}
+
+
+TEST_F(HashMapUnitTest, RangeConstructorAndInsertRange) {
+    const std::vector<std::pair<std::string, int>> entries = {
+        {"a", 1}, {"b", 2}, {"c", 3}, {"a", 4}};
+
+    HashMap<std::string, int> map(entries.begin(), entries.end());
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.at("a"), 4); // later duplicates win
+    EXPECT_EQ(map.at("c"), 3);
+
+    HashMap<std::string, int> copy;
+    copy.insertRange(map.begin(), map.end());
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy.at("b"), 2);
+}
+
+
+TEST_F(HashMapUnitTest, FindManyReportsEveryKey) {
+    HashMap<int, int> map;
+    for (int i = 0; i < 100; i += 2)
+        map.insert(i, i * 10);
+
+    int keys[37];
+    const int* out[37];
+    for (int i = 0; i < 37; ++i)
+        keys[i] = i;
+
+    EXPECT_EQ(map.findMany(keys, 37, out), 19);
+    for (int i = 0; i < 37; ++i) {
+        if (i % 2 == 0) {
+            ASSERT_NE(out[i], nullptr);
+            EXPECT_EQ(*out[i], i * 10);
+        } else {
+            EXPECT_EQ(out[i], nullptr);
+        }
+    }
+
+    const HashMap<int, int> empty;
+    EXPECT_EQ(empty.findMany(keys, 37, out), 0);
+    EXPECT_EQ(out[0], nullptr);
+}
+
+
+TEST_F(HashMapUnitTest, FindManyWithStringViews) {
+    HashMap<std::string, int> map;
+    map.insert("x", 1);
+    map.insert("y", 2);
+
+    const std::string_view keys[] = {"x", "z", "y"};
+    const int* out[3];
+    EXPECT_EQ(map.findMany(keys, 3, out), 2);
+    EXPECT_EQ(*out[0], 1);
+    EXPECT_EQ(out[1], nullptr);
+    EXPECT_EQ(*out[2], 2);
+}
+
+
+TEST_F(HashMapUnitTest, InsertManyLoadsParallelArrays) {
+    std::vector<long> keys;
+    std::vector<int> values;
+    for (int i = 0; i < 1000; ++i) {
+        keys.push_back(i * 7 - 300);
+        values.push_back(i);
+    }
+    keys.push_back(-300); // A duplicate replaces the first value.
+    values.push_back(-1);
+
+    HashMap<long, int> map;
+    map.insert(5, 99);
+    map.insertMany(keys.data(), values.data(), keys.size());
+    map.insertMany(keys.data(), values.data(), 0);
+
+    EXPECT_EQ(map.size(), 1001u);
+    EXPECT_EQ(map.at(-300), -1);
+    EXPECT_EQ(map.at(5), 99);
+    for (size_t i = 1; i < 1000; ++i)
+        EXPECT_EQ(map.at(keys[i]), values[i]);
+}
+
+
+TEST_F(HashMapUnitTest, DefaultHashBatchMatchesScalar) {
+    enum class Color : std::int16_t { Red = -2, Green = 0, Blue = 7 };
+
+    const std::int64_t ints[] = {0, 1, -1, 42, INT64_MIN, INT64_MAX, 1 << 20, 3, 5, 8, 13};
+    size_t out[std::size(ints)];
+    DefaultHash<std::int64_t>::hashBatch(ints, std::size(ints), out);
+    for (size_t i = 0; i < std::size(ints); ++i)
+        EXPECT_EQ(out[i], DefaultHash<std::int64_t>{}(ints[i]));
+
+    using ColorHash = DefaultHash<Color, false>;
+    const Color colors[] = {Color::Blue, Color::Red, Color::Green};
+    ColorHash::hashBatch(colors, 3, out);
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_EQ(out[i], ColorHash{}(colors[i]));
+}
+
+
+TEST_F(HashMapUnitTest, DefaultHashStringsByCharacters) {
+    const DefaultHash<std::string> hash;
+    std::set<size_t> seen;
+    std::string text;
+    // Every length class of the byte hash: empty, 1-3, 4-16, 17-48, longer.
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(hash(text), hash(std::string_view(text)));
+        EXPECT_EQ(hash(text), hash(text.c_str()));
+        EXPECT_TRUE(seen.insert(hash(text)).second) << "length " << i;
+        text.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    // Changing any single byte of a long key changes the hash.
+    const std::string base(100, 'q');
+    for (size_t i = 0; i < base.size(); ++i) {
+        std::string changed = base;
+        changed[i] = 'r';
+        EXPECT_NE(hash(changed), hash(base)) << "byte " << i;
+    }
+
+    const DefaultHash<std::u16string> wide;
+    EXPECT_EQ(wide(std::u16string_view(u"key")), wide(std::u16string(u"key")));
+    EXPECT_NE(wide(std::u16string_view(u"key")), wide(std::u16string_view(u"kez")));
+}
+
+
+struct GridPoint {
+    std::int32_t x;
+    std::int32_t y;
+
+    bool operator==(const GridPoint&) const = default;
+};
+
+struct Triple {
+    std::uint64_t a;
+    std::uint64_t b;
+    std::uint64_t c;
+
+    bool operator==(const Triple&) const = default;
+};
+
+
+TEST_F(HashMapUnitTest, PlainStructKeysHashByBytes) {
+    HashMap<GridPoint, int> grid;
+    for (std::int32_t x = -20; x < 20; ++x)
+        for (std::int32_t y = -20; y < 20; ++y)
+            grid.insert(GridPoint{x, y}, x * 100 + y);
+    EXPECT_EQ(grid.size(), 1600u);
+    EXPECT_EQ(grid.at(GridPoint{-7, 13}), -687);
+    EXPECT_FALSE(grid.contains(GridPoint{20, 0}));
+
+    HashMap<Triple, int> triples;
+    for (int i = 0; i < 500; ++i)
+        triples.insert(Triple{static_cast<std::uint64_t>(i), 1, static_cast<std::uint64_t>(i % 3)}, i);
+    EXPECT_EQ(triples.size(), 500u);
+    EXPECT_EQ(triples.at(Triple{321, 1, 0}), 321);
+}
+
+
+TEST_F(HashMapUnitTest, RehashCountTracksRebuilds) {
+    HashMap<int, int> grown;
+    for (int i = 0; i < 1000; ++i)
+        grown.insert(i, i);
+    EXPECT_GT(grown.rehashCount(), 3u);
+
+    HashMap<int, int> reserved;
+    reserved.reserve(1000);
+    for (int i = 0; i < 1000; ++i)
+        reserved.insert(i, i);
+    EXPECT_EQ(reserved.rehashCount(), 0u);
+
+    const size_t before = grown.rehashCount();
+    HashMap<int, int> moved(std::move(grown));
+    EXPECT_EQ(moved.rehashCount(), before);
+
+    IncrementalMap incremental;
+    for (int i = 0; i < 1000; ++i)
+        incremental.insert(i, i);
+    EXPECT_GT(incremental.rehashCount(), 3u);
+}
@@ -0,0 +1,227 @@
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IndexedHeap.hpp"
+
+
+using containers::IndexedHeap;
+using containers::MaxIndexedHeap;
+using containers::MinIndexedHeap;
+
+
+class IndexedHeapUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(IndexedHeapUnitTest, NewHeapShouldBeEmpty) {
+    const MinIndexedHeap<int> heap;
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_EQ(heap.size(), 0);
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_FALSE(heap.contains(0));
+    EXPECT_THROW((void)heap.peekRoot(), std::out_of_range);
+    EXPECT_THROW((void)heap.peekRootHandle(), std::out_of_range);
+}
+
+
+TEST_F(IndexedHeapUnitTest, ExtractShouldReturnElementsInAscendingOrder) {
+    MinIndexedHeap<int> heap;
+    std::vector values = {5, 3, 7, 1, 4, 9, 2, 3};
+    for (const int value : values)
+        heap.insert(value);
+
+    std::ranges::sort(values);
+    for (const int expected : values) {
+        ASSERT_TRUE(heap.isValidHeap());
+        EXPECT_EQ(heap.extractRoot(), expected);
+    }
+    EXPECT_TRUE(heap.isEmpty());
+    EXPECT_THROW(heap.extractRoot(), std::out_of_range);
+}
+
+
+TEST_F(IndexedHeapUnitTest, HandlesShouldFollowTheirElements) {
+    MinIndexedHeap<std::string> heap;
+    const auto pear = heap.insert("pear");
+    const auto apple = heap.insert("apple");
+    const auto fig = heap.insert("fig");
+
+    EXPECT_EQ(heap.get(pear), "pear");
+    EXPECT_EQ(heap.get(apple), "apple");
+    EXPECT_EQ(heap.peekRootHandle(), apple);
+
+    EXPECT_EQ(heap.extractRoot(), "apple");
+    EXPECT_FALSE(heap.contains(apple));
+    EXPECT_THROW((void)heap.get(apple), std::out_of_range);
+    EXPECT_EQ(heap.get(fig), "fig");
+    EXPECT_EQ(heap.peekRootHandle(), fig);
+}
+
+
+TEST_F(IndexedHeapUnitTest, DecreaseKeyShouldMoveElementTowardsTheTop) {
+    MinIndexedHeap<int> heap;
+    const auto a = heap.insert(10);
+    const auto b = heap.insert(20);
+    const auto c = heap.insert(30);
+
+    heap.decreaseKey(c, 5);
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_EQ(heap.peekRootHandle(), c);
+    EXPECT_EQ(heap.get(c), 5);
+
+    heap.decreaseKey(b, 20); // equal is allowed
+    EXPECT_THROW(heap.decreaseKey(a, 11), std::invalid_argument);
+    EXPECT_EQ(heap.get(a), 10);
+}
+
+
+TEST_F(IndexedHeapUnitTest, IncreaseKeyShouldMoveElementAwayFromTheTop) {
+    MinIndexedHeap<int> heap;
+    const auto a = heap.insert(1);
+    heap.insert(2);
+    heap.insert(3);
+
+    heap.increaseKey(a, 10);
+    EXPECT_TRUE(heap.isValidHeap());
+    EXPECT_EQ(heap.peekRoot(), 2);
+    EXPECT_THROW(heap.increaseKey(a, 9), std::invalid_argument);
+
+    heap.update(a, 0);
+    EXPECT_EQ(heap.peekRootHandle(), a);
+}
+
+
+TEST_F(IndexedHeapUnitTest, EraseShouldRemoveArbitraryElements) {
+    MinIndexedHeap<int, 3> heap;
+    std::vector<MinIndexedHeap<int, 3>::Handle> handles;
+    for (int i = 0; i < 50; ++i)
+        handles.push_back(heap.insert((i * 37) % 50));
+
+    for (size_t i = 0; i < handles.size(); i += 2) {
+        const int value = heap.get(handles[i]);
+        EXPECT_EQ(heap.erase(handles[i]), value);
+        ASSERT_TRUE(heap.isValidHeap());
+    }
+    EXPECT_EQ(heap.size(), 25);
+    EXPECT_THROW(heap.erase(handles[0]), std::out_of_range);
+
+    int previous = std::numeric_limits<int>::min();
+    while (!heap.isEmpty()) {
+        const int value = heap.extractRoot();
+        EXPECT_LE(previous, value);
+        previous = value;
+    }
+}
+
+
+TEST_F(IndexedHeapUnitTest, ReleasedHandlesShouldBeReused) {
+    MinIndexedHeap<int> heap;
+    const auto a = heap.insert(1);
+    heap.insert(2);
+    heap.erase(a);
+
+    const auto c = heap.insert(3);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(heap.get(c), 3);
+}
+
+
+TEST_F(IndexedHeapUnitTest, MaxHeapAliasShouldKeepGreatestOnTop) {
+    MaxIndexedHeap<int> heap;
+    heap.insert(3);
+    const auto h = heap.insert(1);
+    heap.insert(2);
+    EXPECT_EQ(heap.peekRoot(), 3);
+
+    heap.decreaseKey(h, 7); // "decrease" in the heap's order: moves up
+    EXPECT_EQ(heap.peekRootHandle(), h);
+}
+
+
+TEST_F(IndexedHeapUnitTest, MergeShouldRemapHandles) {
+    for (const int other_size : {3, 200}) {
+        MinIndexedHeap<int> heap;
+        for (int i = 0; i < 20; ++i)
+            heap.insert(2 * i);
+
+        MinIndexedHeap<int> other;
+        std::vector<MinIndexedHeap<int>::Handle> theirs;
+        for (int i = 0; i < other_size; ++i)
+            theirs.push_back(other.insert(2 * i + 1));
+        other.erase(theirs[1]);
+
+        const auto remap = heap.merge(std::move(other));
+        EXPECT_TRUE(other.isEmpty());
+        EXPECT_EQ(heap.size(), static_cast<size_t>(20 + other_size - 1));
+        EXPECT_TRUE(heap.isValidHeap());
+
+        EXPECT_EQ(remap[theirs[1]], MinIndexedHeap<int>::INVALID_HANDLE);
+        for (size_t i = 0; i < theirs.size(); ++i) {
+            if (i != 1) {
+                EXPECT_EQ(heap.get(remap[theirs[i]]), static_cast<int>(2 * i + 1));
+            }
+        }
+    }
+}
+
+
+TEST_F(IndexedHeapUnitTest, DijkstraShouldMatchBellmanFord) {
+    constexpr size_t N = 300;
+    struct Edge {
+        size_t from, to;
+        std::uint64_t weight;
+    };
+    std::mt19937 rng(20);
+    std::vector<Edge> edges;
+    for (size_t i = 0; i < N * 6; ++i)
+        edges.push_back({rng() % N, rng() % N, rng() % 100});
+
+    std::vector<std::vector<Edge>> adjacency(N);
+    for (const Edge& edge : edges)
+        adjacency[edge.from].push_back(edge);
+
+    constexpr std::uint64_t INF = std::numeric_limits<std::uint64_t>::max();
+    std::vector<std::uint64_t> expected(N, INF);
+    expected[0] = 0;
+    for (size_t round = 0; round < N; ++round)
+        for (const Edge& edge : edges)
+            if (expected[edge.from] != INF)
+                expected[edge.to] = std::min(expected[edge.to], expected[edge.from] + edge.weight);
+
+    // One heap entry per reached node, improved in place.
+    using Heap = MinIndexedHeap<std::pair<std::uint64_t, size_t>>;
+    Heap heap;
+    std::vector<Heap::Handle> handle_of(N, Heap::INVALID_HANDLE);
+    std::vector<std::uint64_t> distance(N, INF);
+    distance[0] = 0;
+    handle_of[0] = heap.insert(std::pair{std::uint64_t{0}, size_t{0}});
+    size_t max_size = 0;
+
+    while (!heap.isEmpty()) {
+        max_size = std::max(max_size, heap.size());
+        const auto [d, node] = heap.extractRoot();
+        for (const Edge& edge : adjacency[node]) {
+            const std::uint64_t candidate = d + edge.weight;
+            if (candidate >= distance[edge.to])
+                continue;
+            distance[edge.to] = candidate;
+            if (heap.contains(handle_of[edge.to]) && heap.get(handle_of[edge.to]).second == edge.to)
+                heap.decreaseKey(handle_of[edge.to], std::pair{candidate, edge.to});
+            else
+                handle_of[edge.to] = heap.insert(std::pair{candidate, edge.to});
+        }
+    }
+
+    EXPECT_EQ(distance, expected);
+    EXPECT_LE(max_size, N);
+}
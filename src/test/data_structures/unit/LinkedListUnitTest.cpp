@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "LinkedList.hpp"
 #include "Record.hpp"
@@ -805,3 +809,104 @@ TEST_F(LinkedListUnitTest, RecordsReflectExternalChanges) {
     EXPECT_EQ(list.get(0).value, 42);
     EXPECT_EQ(list.get(1).value, -7);
 }
+
+
+template <typename List>
+std::vector<int> toVector(const List& list) {
+    return std::vector<int>(list.begin(), list.end());
+}
+
+
+TEST_F(LinkedListUnitTest, IteratorsModelBidirectionalIterator) {
+    static_assert(std::bidirectional_iterator<LinkedList<int>::iterator>);
+    static_assert(std::bidirectional_iterator<LinkedList<int>::const_iterator>);
+
+    LinkedList<int> list = {5, 3, 9, 1};
+    EXPECT_EQ(*std::max_element(list.begin(), list.end()), 9);
+    EXPECT_EQ(*std::ranges::find(list, 3), 3);
+    EXPECT_EQ(std::ranges::distance(list), 4);
+}
+
+
+TEST_F(LinkedListUnitTest, InsertAtIteratorKeepsOtherIteratorsValid) {
+    LinkedList<int> list = {1, 3};
+    auto three = std::next(list.begin());
+
+    auto two = list.insert(three, 2);
+    EXPECT_EQ(*two, 2);
+    EXPECT_EQ(*three, 3);
+    list.insert(list.end(), 4);
+    list.insert(list.begin(), 0);
+    EXPECT_EQ(toVector(list), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    list.erase(two);
+    EXPECT_EQ(*three, 3);
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_EQ(toVector(list), (std::vector<int>{0, 1, 3, 4}));
+
+    // The index overload is still picked for size_t elements.
+    LinkedList<size_t> indices = {7};
+    indices.insert(size_t{8}, 1);
+    indices.insert(indices.begin(), size_t{6});
+    EXPECT_EQ(indices.back(), 8u);
+    EXPECT_EQ(indices.front(), 6u);
+}
+
+
+TEST_F(LinkedListUnitTest, SpliceRelinksWholeList) {
+    LinkedList<int> list = {1, 5};
+    LinkedList<int> other = {2, 3, 4};
+    int* three = &*std::next(other.begin());
+
+    list.splice(std::next(list.begin()), other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(&list.get(2), three); // moved without copying
+
+    list.splice(list.end(), other);
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(list.back(), 5);
+}
+
+
+TEST_F(LinkedListUnitTest, SpliceRangeBetweenAndWithinLists) {
+    LinkedList<int> list = {1, 2, 3, 4, 5, 6};
+    LinkedList<int> other = {10, 20};
+
+    // Move 2, 3 to the front of other.
+    other.splice(other.begin(), list, std::next(list.begin()), std::next(list.begin(), 3));
+    EXPECT_EQ(toVector(other), (std::vector<int>{2, 3, 10, 20}));
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 4, 5, 6}));
+    EXPECT_EQ(other.size(), 4u);
+    EXPECT_EQ(list.size(), 4u);
+
+    // Rotate within a list: move the tail [5, 6] in front.
+    list.splice(list.begin(), list, std::next(list.begin(), 2), list.end());
+    EXPECT_EQ(toVector(list), (std::vector<int>{5, 6, 1, 4}));
+    EXPECT_EQ(list.size(), 4u);
+    EXPECT_EQ(list.back(), 4);
+    EXPECT_EQ(*std::prev(list.end()), 4);
+}
+
+
+TEST_F(LinkedListUnitTest, MergeIsStableAndLeavesOtherEmpty) {
+    using Pair = std::pair<int, char>;
+    const auto by_key = [](const Pair& a, const Pair& b) { return a.first < b.first; };
+    LinkedList<Pair> list = {{1, 'a'}, {3, 'a'}, {3, 'b'}, {7, 'a'}};
+    LinkedList<Pair> other = {{0, 'x'}, {3, 'x'}, {4, 'x'}, {5, 'x'}, {9, 'x'}};
+
+    list.merge(other, by_key);
+    EXPECT_TRUE(other.isEmpty());
+    ASSERT_EQ(list.size(), 9u);
+
+    const std::vector<Pair> expected = {{0, 'x'}, {1, 'a'}, {3, 'a'}, {3, 'b'}, {3, 'x'},
+                                        {4, 'x'}, {5, 'x'}, {7, 'a'}, {9, 'x'}};
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin(), expected.end()));
+    EXPECT_EQ(list.back().first, 9);
+
+    LinkedList<int> empty;
+    LinkedList<int> numbers = {2, 4};
+    empty.merge(numbers);
+    EXPECT_EQ(toVector(empty), (std::vector<int>{2, 4}));
+}
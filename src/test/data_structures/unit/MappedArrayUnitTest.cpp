@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "DynamicArray.hpp"
+#include "MappedArray.hpp"
+
+
+using containers::DynamicArray;
+using containers::ImageCheck;
+using containers::MappedArray;
+
+
+class MappedArrayUnitTest : public testing::Test {
+  protected:
+    std::filesystem::path path_;
+
+    void SetUp() override {
+        path_ = std::filesystem::temp_directory_path() /
+                ("mapped_array_" + std::string(testing::UnitTest::GetInstance()->current_test_info()->name()));
+    }
+
+    void TearDown() override { std::filesystem::remove(path_); }
+
+    /// Flips one byte of the file at offset.
+    void corrupt(const std::streamoff offset) const {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(offset);
+        const char byte = static_cast<char>(file.get() ^ 0x5a);
+        file.seekp(offset);
+        file.put(byte);
+    }
+};
+
+
+struct Point {
+    int32_t x;
+    int32_t y;
+    double weight;
+};
+
+
+TEST_F(MappedArrayUnitTest, RoundTripsDynamicArray) {
+    DynamicArray<int64_t> array;
+    for (int64_t i = 0; i < 10000; ++i)
+        array.addLast(i * i);
+    MappedArray<int64_t>::save(path_, array);
+
+    const MappedArray<int64_t> mapped(path_, ImageCheck::Checksum);
+    ASSERT_EQ(mapped.size(), array.size());
+    EXPECT_FALSE(mapped.isEmpty());
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped.data()) % 64, 0u);
+    for (size_t i = 0; i < array.size(); ++i)
+        ASSERT_EQ(mapped[i], array[i]);
+    EXPECT_EQ(std::accumulate(mapped.begin(), mapped.end(), int64_t{0}),
+              std::accumulate(array.begin(), array.end(), int64_t{0}));
+    EXPECT_EQ(mapped.get(9999), 9999 * 9999);
+    EXPECT_THROW(mapped.get(10000), std::out_of_range);
+
+    DynamicArray<int64_t> copy = mapped.toDynamicArray();
+    copy.addLast(-1);
+    EXPECT_EQ(copy.size(), 10001u);
+    EXPECT_EQ(copy[5000], array[5000]);
+}
+
+
+TEST_F(MappedArrayUnitTest, RoundTripsStructsAndEmptyArrays) {
+    const Point points[] = {{1, 2, 0.5}, {3, 4, 1.5}, {-5, 6, 2.5}};
+    MappedArray<Point>::save(path_, points, 3);
+    MappedArray<Point> mapped(path_);
+    EXPECT_EQ(mapped.size(), 3u);
+    EXPECT_EQ(mapped[2].x, -5);
+    EXPECT_EQ(mapped[1].weight, 1.5);
+
+    // Moving keeps the mapping alive.
+    const MappedArray<Point> moved(std::move(mapped));
+    EXPECT_EQ(moved[0].y, 2);
+
+    MappedArray<Point>::save(path_, points, 0);
+    const MappedArray<Point> empty(path_, ImageCheck::Checksum);
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+
+TEST_F(MappedArrayUnitTest, SaveReplacesExistingImage) {
+    const int32_t first[] = {1, 2, 3};
+    const int32_t second[] = {7, 8};
+    MappedArray<int32_t>::save(path_, first, 3);
+    const MappedArray<int32_t> old(path_);
+
+    MappedArray<int32_t>::save(path_, second, 2);
+    const MappedArray<int32_t> current(path_);
+    EXPECT_EQ(current.size(), 2u);
+    EXPECT_EQ(current[0], 7);
+
+    // The earlier mapping still sees the file it opened.
+    EXPECT_EQ(old.size(), 3u);
+    EXPECT_EQ(old[2], 3);
+}
+
+
+TEST_F(MappedArrayUnitTest, FailedSaveRemovesTemporaryFile) {
+    // A file cannot be renamed over a non-empty directory.
+    std::filesystem::create_directory(path_);
+    std::ofstream(path_ / "occupied").put('x');
+    std::filesystem::path temporary = path_;
+    temporary += ".tmp";
+
+    const int32_t values[] = {1, 2, 3};
+    EXPECT_THROW(MappedArray<int32_t>::save(path_, values, 3), std::filesystem::filesystem_error);
+    EXPECT_FALSE(std::filesystem::exists(temporary));
+
+    std::filesystem::remove_all(path_);
+}
+
+
+TEST_F(MappedArrayUnitTest, ChecksumDetectsCorruptPayload) {
+    DynamicArray<int32_t> array;
+    for (int32_t i = 0; i < 1000; ++i)
+        array.addLast(i);
+    MappedArray<int32_t>::save(path_, array);
+    corrupt(128 + 4 * 500);
+
+    // A header-only check does not read the payload...
+    const MappedArray<int32_t> unchecked(path_);
+    EXPECT_NE(unchecked[500], 500);
+
+    // ...the checksum check does.
+    EXPECT_THROW(MappedArray<int32_t>(path_, ImageCheck::Checksum), std::runtime_error);
+}
+
+
+TEST_F(MappedArrayUnitTest, RejectsMismatchedImages) {
+    const int32_t values[] = {1, 2, 3, 4};
+    MappedArray<int32_t>::save(path_, values, 4);
+
+    EXPECT_THROW(MappedArray<int64_t>{path_}, std::runtime_error);
+    EXPECT_THROW(MappedArray<uint16_t>{path_}, std::runtime_error);
+
+    std::filesystem::resize_file(path_, 128 + 8);
+    EXPECT_THROW(MappedArray<int32_t>{path_}, std::runtime_error);
+
+    MappedArray<int32_t>::save(path_, values, 4);
+    corrupt(8);  // version
+    EXPECT_THROW(MappedArray<int32_t>{path_}, std::runtime_error);
+
+    {
+        std::ofstream text(path_, std::ios::trunc);
+        text << "definitely not an image file, but long enough to hold a header if it were one, "
+                "which it is not, as the magic bytes at the start make plain";
+    }
+    EXPECT_THROW(MappedArray<int32_t>{path_}, std::runtime_error);
+
+    std::filesystem::remove(path_);
+    EXPECT_THROW(MappedArray<int32_t>{path_}, std::system_error);
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "BinarySearchTree.hpp"
+#include "LinkedList.hpp"
+#include "MaxHeap.hpp"
+#include "MinHeap.hpp"
+#include "NodePool.hpp"
+
+
+using containers::BinarySearchTree;
+using containers::BinaryTree;
+using containers::HeapNodes;
+using containers::LinkedList;
+using containers::MaxHeap;
+using containers::MinHeap;
+using containers::Node;
+using containers::NodePool;
+using containers::PooledNodes;
+using containers::ThreadPooledNodes;
+
+
+class NodePoolUnitTest : public testing::Test {
+  protected:
+    void SetUp() override { Tracked::live = 0; }
+    void TearDown() override { EXPECT_EQ(Tracked::live, 0); }
+
+  public:
+    /// Counts live instances, to check that every element is destroyed once.
+    struct Tracked {
+        static inline int live = 0;
+        int value;
+
+        Tracked(const int value) : value(value) { ++live; }
+        Tracked(const Tracked& other) : value(other.value) { ++live; }
+        Tracked& operator=(const Tracked&) = default;
+        ~Tracked() { --live; }
+
+        bool operator==(const Tracked& other) const { return value == other.value; }
+        bool operator<(const Tracked& other) const { return value < other.value; }
+        bool operator>(const Tracked& other) const { return value > other.value; }
+    };
+};
+
+
+/// Tree that can grow a degenerate chain in O(n), which no public insert can.
+template <typename Type, typename NodePolicy>
+class ChainTree : public BinaryTree<Type, NodePolicy> {
+  public:
+    void growChain(const size_t length, const bool to_the_left) {
+        Node<Type>* tip = this->root_;
+        while (tip != nullptr && (to_the_left ? tip->left : tip->right) != nullptr)
+            tip = to_the_left ? tip->left : tip->right;
+
+        for (size_t i = 0; i < length; ++i) {
+            Node<Type>* node = this->nodes_.create(static_cast<int>(i));
+            node->parent = tip;
+            if (tip == nullptr)
+                this->root_ = node;
+            else
+                (to_the_left ? tip->left : tip->right) = node;
+            tip = node;
+            ++this->size_;
+        }
+    }
+};
+
+
+TEST_F(NodePoolUnitTest, PoolShouldRecycleFreedStorageFirst) {
+    NodePool<Node<int>, 4> pool;
+    EXPECT_EQ(pool.slabCount(), 0);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    EXPECT_EQ(pool.slabCount(), 1);
+    EXPECT_EQ(static_cast<char*>(b) - static_cast<char*>(a),
+              static_cast<std::ptrdiff_t>(sizeof(Node<int>)));
+
+    pool.deallocate(a);
+    EXPECT_EQ(pool.allocate(), a);
+
+    for (int i = 0; i < 3; ++i)
+        (void)pool.allocate();
+    EXPECT_EQ(pool.slabCount(), 2);
+
+    pool.release();
+    EXPECT_EQ(pool.slabCount(), 0);
+
+    NodePool<Node<int>, 4> moved(std::move(pool));
+    (void)moved.allocate();
+    EXPECT_EQ(moved.slabCount(), 1);
+}
+
+
+TEST_F(NodePoolUnitTest, DegenerateTreesShouldClearWithoutRecursion) {
+    // Deep enough to overflow the stack with a recursive teardown.
+    constexpr size_t DEPTH = 1'000'000;
+    for (const bool to_the_left : {true, false}) {
+        ChainTree<int, HeapNodes> tree;
+        tree.growChain(DEPTH, to_the_left);
+        EXPECT_EQ(tree.size(), DEPTH);
+        tree.clear();
+        EXPECT_TRUE(tree.isEmpty());
+
+        ChainTree<int, PooledNodes<>> pooled;
+        pooled.growChain(DEPTH, to_the_left);
+        EXPECT_EQ(pooled.size(), DEPTH);
+    }
+}
+
+
+TEST_F(NodePoolUnitTest, PooledTreesShouldDestroyEveryElementOnce) {
+    {
+        ChainTree<Tracked, PooledNodes<8>> tree;
+        tree.growChain(100, true);
+        tree.growChain(100, false);
+        EXPECT_EQ(Tracked::live, 200);
+
+        ChainTree<Tracked, PooledNodes<8>> copy(tree);
+        EXPECT_EQ(Tracked::live, 400);
+        tree.clear();
+        EXPECT_EQ(Tracked::live, 200);
+
+        tree = copy;
+        EXPECT_EQ(tree.size(), 200);
+        EXPECT_EQ(Tracked::live, 400);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+
+    {
+        ChainTree<Tracked, ThreadPooledNodes<8>> tree;
+        tree.growChain(50, true);
+        ChainTree<Tracked, ThreadPooledNodes<8>> moved(std::move(tree));
+        EXPECT_EQ(moved.size(), 50);
+        EXPECT_EQ(Tracked::live, 50);
+    }
+}
+
+
+TEST_F(NodePoolUnitTest, PooledBSTShouldMatchDefault) {
+    std::mt19937 rng(21);
+    BinarySearchTree<int> reference;
+    BinarySearchTree<int, PooledNodes<16>> pooled;
+    std::set<int> expected;
+
+    for (int step = 0; step < 4000; ++step) {
+        const int value = static_cast<int>(rng() % 500);
+        if (rng() % 3 == 0) {
+            reference.remove(value);
+            pooled.remove(value);
+            expected.erase(value);
+        } else {
+            reference.insert(value);
+            pooled.insert(value);
+            expected.insert(value);
+        }
+    }
+
+    EXPECT_EQ(pooled.size(), expected.size());
+    EXPECT_EQ(pooled.size(), reference.size());
+    EXPECT_TRUE(pooled.isValidBST());
+    for (int value = 0; value < 500; ++value)
+        EXPECT_EQ(pooled.contains(value), expected.contains(value));
+
+    BinarySearchTree<int, PooledNodes<16>> copy;
+    copy = pooled;
+    pooled.clear();
+    EXPECT_TRUE(pooled.isEmpty());
+    EXPECT_EQ(copy.size(), expected.size());
+    EXPECT_EQ(copy.findMinimum(), *expected.begin());
+
+    pooled = std::move(copy);
+    EXPECT_EQ(pooled.findMaximum(), *expected.rbegin());
+}
+
+
+TEST_F(NodePoolUnitTest, PooledHeapsShouldDrainInOrder) {
+    MinHeap<std::string, PooledNodes<4>> min_heap{"pear", "apple", "fig", "kiwi", "date"};
+    MaxHeap<Tracked, ThreadPooledNodes<4>> max_heap;
+    for (const int value : {5, 1, 4, 2, 3})
+        max_heap.insert(value);
+
+    EXPECT_EQ(min_heap.extractRoot(), "apple");
+    EXPECT_EQ(min_heap.extractRoot(), "date");
+    min_heap.insert("banana");
+    EXPECT_TRUE(min_heap.isValidHeap());
+    EXPECT_EQ(min_heap.extractRoot(), "banana");
+
+    for (int expected = 5; expected >= 1; --expected)
+        EXPECT_EQ(max_heap.extractRoot().value, expected);
+    EXPECT_TRUE(max_heap.isEmpty());
+}
+
+
+TEST_F(NodePoolUnitTest, PooledListsShouldBehaveLikeDefault) {
+    LinkedList<Tracked, PooledNodes<4>> list;
+    for (int i = 0; i < 10; ++i)
+        list.addLast(i);
+    list.addFirst(-1);
+    list.insert(100, 5);
+    list.removeAt(0);
+    list.remove(3);
+    list.removeLast();
+    EXPECT_EQ(list.size(), 9);
+    EXPECT_EQ(Tracked::live, 9);
+
+    LinkedList<Tracked, PooledNodes<4>> copy;
+    copy = list;
+    list.clear();
+    EXPECT_EQ(Tracked::live, 9);
+    EXPECT_EQ(copy.front().value, 0);
+    EXPECT_EQ(copy.get(3).value, 100);
+    EXPECT_EQ(copy.back().value, 8);
+
+    list = std::move(copy);
+    EXPECT_EQ(list.size(), 9);
+    list.clear();
+    EXPECT_EQ(Tracked::live, 0);
+
+    LinkedList<int, ThreadPooledNodes<>> shared{1, 2, 3};
+    shared.removeFirst();
+    shared.addLast(4);
+    EXPECT_EQ(shared.front(), 2);
+    EXPECT_EQ(shared.back(), 4);
+}
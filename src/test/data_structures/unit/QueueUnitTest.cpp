@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+#include "CountingResource.hpp"
 #include "Queue.hpp"
 #include "ThrowingType.hpp"
 
@@ -784,6 +786,84 @@ TEST_F(QueueUnitTest, CapacityShrinksAfterDequeueInterval) {
 }
 
 
+TEST_F(QueueUnitTest, NeverShrinkKeepsCapacityAfterDrain) {
+    Queue<int, std::allocator<int>, containers::NeverShrink<>> queue;
+    for (int i = 0; i < 1000; ++i)
+        queue.enqueue(i);
+    const size_t peak = queue.capacity();
+
+    while (!queue.isEmpty())
+        queue.dequeue();
+    queue.shrinkToFit();
+    EXPECT_EQ(queue.capacity(), peak);
+}
+
+
+TEST_F(QueueUnitTest, ShrinkOnRequestOnlyShrinksWhenAsked) {
+    Queue<int, std::allocator<int>, containers::ShrinkOnRequest<>> queue;
+    for (int i = 0; i < 1000; ++i)
+        queue.enqueue(i);
+    const size_t peak = queue.capacity();
+
+    for (int i = 0; i < 990; ++i)
+        queue.dequeue();
+    EXPECT_EQ(queue.capacity(), peak);
+
+    queue.shrinkToFit();
+    EXPECT_EQ(queue.capacity(), 16);
+    for (int i = 990; i < 1000; ++i) {
+        EXPECT_EQ(queue.front(), i);
+        queue.dequeue();
+    }
+}
+
+
+TEST_F(QueueUnitTest, HysteresisKeepsCapacityAcrossBursts) {
+    // Three shrink checks (one per 16 dequeues) must find the queue sparse in
+    // a row before it shrinks. Each drain below only reaches two.
+    Queue<int, std::allocator<int>, containers::HysteresisShrink<3>> queue;
+    for (int i = 0; i < 64; ++i)
+        queue.enqueue(i);
+    const size_t peak = queue.capacity();
+
+    // Drain to sparse, then refill before the second sparse check.
+    for (int burst = 0; burst < 4; ++burst) {
+        for (int i = 0; i < 64; ++i)
+            queue.dequeue();
+        for (int i = 0; i < 64; ++i)
+            queue.enqueue(i);
+        EXPECT_EQ(queue.capacity(), peak);
+    }
+
+    // Staying sparse for long enough does give the memory back.
+    for (int i = 0; i < 64; ++i)
+        queue.dequeue();
+    for (int i = 0; i < 64; ++i) {
+        queue.enqueue(i);
+        queue.dequeue();
+    }
+    EXPECT_LT(queue.capacity(), peak);
+}
+
+
+TEST_F(QueueUnitTest, ShrinkToFitKeepsOrder) {
+    Queue<int> queue;
+    for (int i = 0; i < 40; ++i)
+        queue.enqueue(i);
+    for (int i = 0; i < 30; ++i)
+        queue.dequeue();
+    for (int i = 40; i < 50; ++i)
+        queue.enqueue(i);
+
+    queue.shrinkToFit();
+    EXPECT_EQ(queue.capacity(), 32);
+    for (int i = 30; i < 50; ++i) {
+        EXPECT_EQ(queue.front(), i);
+        queue.dequeue();
+    }
+}
+
+
 TEST_F(QueueUnitTest, EmplaceBackWithStdStringArgs) {
     Queue<std::string> queue;
 
@@ -842,3 +922,20 @@ TEST_F(QueueUnitTest, EmplaceLastConstructsInPlace) {
 
     EXPECT_EQ(queue.size(), 0);
 }
+
+
+TEST_F(QueueUnitTest, PmrQueueAllocatesFromResource) {
+    CountingResource resource;
+    {
+        containers::pmr::Queue<std::string> queue(&resource);
+        for (int i = 0; i < 50; ++i)
+            queue.enqueue(std::to_string(i));
+        for (int i = 0; i < 45; ++i)
+            queue.dequeue();
+        EXPECT_GT(resource.allocations, 1u);
+        EXPECT_EQ(queue.getAllocator().resource(), &resource);
+        EXPECT_EQ(queue.front(), "45");
+        EXPECT_EQ(queue.back(), "49");
+    }
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "BinarySearchTree.hpp"
+#include "RedBlackTree.hpp"
+
+
+using containers::BinarySearchTree;
+using containers::PooledNodes;
+using containers::RedBlackTree;
+
+
+class RedBlackTreeUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(RedBlackTreeUnitTest, NewTreeShouldBeEmpty) {
+    const RedBlackTree<int> tree;
+    EXPECT_TRUE(tree.isEmpty());
+    EXPECT_EQ(tree.size(), 0);
+    EXPECT_EQ(tree.getRoot(), nullptr);
+    EXPECT_EQ(tree.begin(), tree.end());
+    EXPECT_TRUE(tree.isValidRedBlackTree());
+    EXPECT_THROW((void)tree.findMinimum(), std::runtime_error);
+    EXPECT_THROW((void)tree.findMaximum(), std::runtime_error);
+}
+
+
+TEST_F(RedBlackTreeUnitTest, InsertShouldRejectDuplicates) {
+    RedBlackTree<int> tree;
+    const auto [first, inserted] = tree.insert(5);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(*first, 5);
+
+    const auto [again, inserted_again] = tree.insert(5);
+    EXPECT_FALSE(inserted_again);
+    EXPECT_EQ(again, first);
+    EXPECT_EQ(tree.size(), 1);
+}
+
+
+TEST_F(RedBlackTreeUnitTest, SortedInsertsShouldStayBalanced) {
+    constexpr int count = 100000;
+    RedBlackTree<int> ascending;
+    RedBlackTree<int> descending;
+    for (int i = 0; i < count; ++i) {
+        ascending.insert(i);
+        descending.insert(count - i);
+    }
+
+    EXPECT_TRUE(ascending.isValidRedBlackTree());
+    EXPECT_TRUE(descending.isValidRedBlackTree());
+    // A red-black tree is never taller than 2 * log2(n + 1).
+    EXPECT_LE(ascending.getHeight(), 34);
+    EXPECT_LE(descending.getHeight(), 34);
+    EXPECT_EQ(ascending.findMinimum(), 0);
+    EXPECT_EQ(ascending.findMaximum(), count - 1);
+}
+
+
+TEST_F(RedBlackTreeUnitTest, IterationShouldBeInOrderBothWays) {
+    const RedBlackTree<int> tree{8, 3, 10, 1, 6, 14, 4, 7, 13};
+
+    std::vector<int> forward(tree.begin(), tree.end());
+    EXPECT_EQ(forward, (std::vector<int>{1, 3, 4, 6, 7, 8, 10, 13, 14}));
+
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();)
+        backward.push_back(*--it);
+    EXPECT_EQ(backward, (std::vector<int>{14, 13, 10, 8, 7, 6, 4, 3, 1}));
+}
+
+
+TEST_F(RedBlackTreeUnitTest, BoundsAndRangesShouldMatchStdSet) {
+    const RedBlackTree<int> tree{10, 20, 30, 40, 50};
+
+    EXPECT_EQ(*tree.lowerBound(20), 20);
+    EXPECT_EQ(*tree.upperBound(20), 30);
+    EXPECT_EQ(*tree.lowerBound(21), 30);
+    EXPECT_EQ(*tree.lowerBound(-5), 10);
+    EXPECT_EQ(tree.lowerBound(51), tree.end());
+    EXPECT_EQ(tree.upperBound(50), tree.end());
+
+    std::vector<int> inside;
+    for (const int value : tree.range(15, 40))
+        inside.push_back(value);
+    EXPECT_EQ(inside, (std::vector<int>{20, 30}));
+
+    EXPECT_TRUE(tree.range(40, 40).isEmpty());
+    EXPECT_TRUE(tree.range(45, 15).isEmpty());
+}
+
+
+TEST_F(RedBlackTreeUnitTest, RemoveShouldKeepInvariantsUnderChurn) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> key(0, 2000);
+    RedBlackTree<int> tree;
+    std::set<int> reference;
+
+    for (int step = 0; step < 20000; ++step) {
+        const int value = key(rng);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(tree.remove(value), reference.erase(value) == 1);
+        } else {
+            EXPECT_EQ(tree.insert(value).second, reference.insert(value).second);
+        }
+
+        if (step % 1000 == 0) {
+            ASSERT_TRUE(tree.isValidRedBlackTree());
+        }
+    }
+
+    EXPECT_TRUE(tree.isValidRedBlackTree());
+    EXPECT_EQ(tree.size(), reference.size());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), reference.begin(), reference.end()));
+}
+
+
+TEST_F(RedBlackTreeUnitTest, EraseShouldReturnNextAndKeepOtherIterators) {
+    RedBlackTree<int> tree{1, 2, 3, 4, 5, 6, 7};
+    const auto six = tree.find(6);
+
+    auto it = tree.erase(tree.find(4));
+    EXPECT_EQ(*it, 5);
+    it = tree.erase(tree.begin());
+    EXPECT_EQ(*it, 2);
+
+    EXPECT_EQ(*six, 6);
+    EXPECT_EQ(tree.find(6), six);
+    EXPECT_EQ(tree.find(4), tree.end());
+    EXPECT_EQ(tree.size(), 5);
+    EXPECT_TRUE(tree.isValidRedBlackTree());
+}
+
+
+TEST_F(RedBlackTreeUnitTest, TransparentComparatorShouldAllowOtherKeyTypes) {
+    RedBlackTree<std::string, std::less<>> tree{"apple", "banana", "cherry"};
+
+    const std::string_view key = "banana";
+    EXPECT_TRUE(tree.contains(key));
+    EXPECT_EQ(*tree.lowerBound(std::string_view("b")), "banana");
+    EXPECT_TRUE(tree.remove(key));
+    EXPECT_FALSE(tree.contains("banana"));
+}
+
+
+TEST_F(RedBlackTreeUnitTest, CustomComparatorShouldReverseOrder) {
+    const RedBlackTree<int, std::greater<>> tree{1, 5, 3};
+    EXPECT_EQ(std::vector<int>(tree.begin(), tree.end()), (std::vector<int>{5, 3, 1}));
+    EXPECT_EQ(tree.findMinimum(), 5);
+}
+
+
+TEST_F(RedBlackTreeUnitTest, CopyAndMoveShouldPreserveContents) {
+    RedBlackTree<int, std::less<int>, PooledNodes<8>> tree;
+    for (int i = 0; i < 100; ++i)
+        tree.insert(i);
+
+    RedBlackTree copy(tree);
+    EXPECT_TRUE(copy.isValidRedBlackTree());
+    EXPECT_TRUE(std::equal(tree.begin(), tree.end(), copy.begin(), copy.end()));
+
+    RedBlackTree<int, std::less<int>, PooledNodes<8>> assigned{-1};
+    assigned = copy;
+    EXPECT_EQ(assigned.size(), 100);
+
+    RedBlackTree moved(std::move(copy));
+    EXPECT_TRUE(copy.isEmpty());
+    EXPECT_EQ(moved.size(), 100);
+
+    tree.clear();
+    tree = std::move(moved);
+    EXPECT_EQ(tree.size(), 100);
+    EXPECT_TRUE(tree.isValidRedBlackTree());
+}
+
+
+TEST_F(RedBlackTreeUnitTest, BinarySearchTreeShouldHandleDegenerateShapes) {
+    // Sorted input makes a plain BST a linked list; its insert, remove and
+    // validation must not recurse to that depth.
+    constexpr int count = 200000;
+    BinarySearchTree<int> tree;
+    for (int i = 0; i < count; ++i)
+        tree.insert(i);
+
+    EXPECT_TRUE(tree.isValidBST());
+    for (int i = 0; i < count; i += 2)
+        tree.remove(i);
+    EXPECT_EQ(tree.size(), count / 2);
+    EXPECT_TRUE(tree.isValidBST());
+    tree.clear();
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "RobinHoodHashMap.hpp"
+
+
+using containers::ProbeStatistics;
+using containers::RobinHoodHashMap;
+
+
+class RobinHoodHashMapUnitTest : public testing::Test {
+protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(RobinHoodHashMapUnitTest, DefaultConstructor) {
+    const RobinHoodHashMap<int, int> map;
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_EQ(map.size(), 0);
+    const ProbeStatistics stats = map.probeStatistics();
+    EXPECT_EQ(stats.max_displacement, 0);
+    EXPECT_EQ(stats.mean_displacement, 0.0);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, InsertAndRetrieve) {
+    RobinHoodHashMap<int, int> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    EXPECT_EQ(map.at(1), 10);
+    EXPECT_EQ(map.at(2), 20);
+    EXPECT_EQ(map.size(), 2);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, OverwriteValue) {
+    RobinHoodHashMap<int, std::string> map;
+    map.insert(1, "ten");
+    map.insert(1, "forty-two");
+    EXPECT_EQ(map.at(1), "forty-two");
+    EXPECT_EQ(map.size(), 1);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, OverwriteAtLoadThresholdDoesNotGrow) {
+    // Fill up to the last pair that fits without growing.
+    RobinHoodHashMap<int, int> map;
+    int next = 0;
+    for (;; ++next) {
+        RobinHoodHashMap<int, int> probe(map);
+        probe.insert(next, next);
+        if (probe.capacity() != map.capacity())
+            break;
+        map.insert(next, next);
+    }
+
+    const size_t capacity = map.capacity();
+    for (int i = 0; i < next; ++i)
+        map.insert(i, -i);
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.at(next - 1), 1 - next);
+
+    map.insert(next, next);
+    EXPECT_GT(map.capacity(), capacity);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, SubscriptInsertsDefault) {
+    RobinHoodHashMap<std::string, int> map;
+    for (int i = 0; i < 100; ++i)
+        map[std::to_string(i % 10)] += 1;
+    EXPECT_EQ(map.size(), 10);
+    for (int i = 0; i < 10; ++i)
+        EXPECT_EQ(map.at(std::to_string(i)), 10);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, RemoveKey) {
+    RobinHoodHashMap<int, int> map;
+    map.insert(5, 50);
+    EXPECT_TRUE(map.remove(5));
+    EXPECT_FALSE(map.remove(5));
+    EXPECT_FALSE(map.contains(5));
+    EXPECT_THROW(map.at(5), std::out_of_range);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, RehashKeepsValues) {
+    RobinHoodHashMap<int, int> map;
+    for (int i = 0; i < 10000; ++i)
+        map.insert(i, i * 2);
+    for (int i = 0; i < 10000; ++i)
+        EXPECT_EQ(map.at(i), i * 2);
+    EXPECT_FALSE(map.contains(-1));
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, BackwardShiftKeepsClusterReachable) {
+    RobinHoodHashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map.insert(i, i);
+    for (int i = 0; i < 1000; i += 3)
+        EXPECT_TRUE(map.remove(i));
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 3 == 0)
+            EXPECT_FALSE(map.contains(i));
+        else
+            EXPECT_EQ(map.at(i), i);
+    }
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, ChurnKeepsProbesShortWithoutGrowing) {
+    RobinHoodHashMap<int, int> map;
+    for (int i = 0; i < 500; ++i)
+        map.insert(i, i);
+    const size_t capacity = map.capacity();
+
+    std::mt19937 rng(42);
+    int next = 500;
+    for (int round = 0; round < 100000; ++round) {
+        map.insert(next, next);
+        ++next;
+        std::uniform_int_distribution<int> pick(next - 501, next - 1);
+        int victim = pick(rng);
+        while (!map.remove(victim))
+            victim = pick(rng);
+    }
+
+    EXPECT_EQ(map.size(), 500);
+    EXPECT_EQ(map.capacity(), capacity);
+
+    const ProbeStatistics stats = map.probeStatistics();
+    EXPECT_LT(stats.mean_displacement, 2.0);
+    EXPECT_LT(stats.max_displacement, 32);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, IterationVisitsEveryPair) {
+    RobinHoodHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.insert(i, -i);
+
+    size_t count = 0;
+    for (const auto [key, value] : map) {
+        EXPECT_EQ(value, -key);
+        ++count;
+    }
+    EXPECT_EQ(count, 100);
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, CopyConstructor) {
+    RobinHoodHashMap<int, std::string> map;
+    for (int i = 0; i < 20; ++i)
+        map.insert(i, std::to_string(i));
+    const RobinHoodHashMap<int, std::string> copy(map);
+    map.remove(3);
+    EXPECT_EQ(copy.size(), 20);
+    for (int i = 0; i < 20; ++i)
+        EXPECT_EQ(copy.at(i), std::to_string(i));
+}
+
+
+TEST_F(RobinHoodHashMapUnitTest, MoveConstructor) {
+    RobinHoodHashMap<int, int> map;
+    map.insert(1, 1);
+    RobinHoodHashMap<int, int> moved(std::move(map));
+    EXPECT_EQ(moved.size(), 1);
+    EXPECT_TRUE(moved.contains(1));
+    EXPECT_TRUE(map.isEmpty());
+    map.insert(2, 2);
+    EXPECT_EQ(map.at(2), 2);
+}
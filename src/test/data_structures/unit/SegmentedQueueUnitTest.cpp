@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "SegmentedQueue.hpp"
+#include "ThrowingType.hpp"
+
+
+using containers::SegmentedQueue;
+
+
+class SegmentedQueueUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override { ThrowingType::reset(); }
+};
+
+
+/// Collects the queue's elements front to back.
+template <typename Queue>
+auto contents(const Queue& queue) {
+    std::vector<std::decay_t<decltype(queue.front())>> out;
+    queue.forEach([&](const auto& item) { out.push_back(item); });
+    return out;
+}
+
+
+TEST_F(SegmentedQueueUnitTest, DefaultConstructor) {
+    const SegmentedQueue<int> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.size(), 0);
+    EXPECT_THROW(queue.front(), std::out_of_range);
+    EXPECT_THROW(queue.back(), std::out_of_range);
+}
+
+
+TEST_F(SegmentedQueueUnitTest, DefaultBlockSizeIsAboutAPage) {
+    EXPECT_EQ(SegmentedQueue<int>::blockSize(), 1024);
+    EXPECT_EQ((SegmentedQueue<char[1000]>::blockSize()), 16);
+}
+
+
+TEST_F(SegmentedQueueUnitTest, FifoAcrossBlockBoundaries) {
+    SegmentedQueue<int, 4> queue;
+    for (int i = 0; i < 50; ++i) {
+        queue.enqueue(i);
+        EXPECT_EQ(queue.back(), i);
+    }
+    EXPECT_EQ(queue.size(), 50);
+
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(queue.front(), i);
+        queue.dequeue();
+    }
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_THROW(queue.dequeue(), std::out_of_range);
+}
+
+
+TEST_F(SegmentedQueueUnitTest, InterleavedOperationsKeepOrder) {
+    SegmentedQueue<int, 3> queue;
+    int next_in = 0;
+    int next_out = 0;
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < round % 7; ++i)
+            queue.enqueue(next_in++);
+        for (int i = 0; i < round % 5 && !queue.isEmpty(); ++i) {
+            ASSERT_EQ(queue.front(), next_out++);
+            queue.dequeue();
+        }
+        ASSERT_EQ(queue.size(), static_cast<size_t>(next_in - next_out));
+    }
+}
+
+
+TEST_F(SegmentedQueueUnitTest, GrowthDoesNotMoveElements) {
+    SegmentedQueue<int, 8> queue;
+    queue.enqueue(1);
+    const int* first = &queue.front();
+    for (int i = 0; i < 1000; ++i)
+        queue.enqueue(i);
+    EXPECT_EQ(&queue.front(), first);
+}
+
+
+TEST_F(SegmentedQueueUnitTest, EmplaceBackAndMoveOnlyTypes) {
+    SegmentedQueue<std::unique_ptr<std::string>, 2> queue;
+    queue.emplaceBack(std::make_unique<std::string>("a"));
+    queue.enqueue(std::make_unique<std::string>("b"));
+    queue.emplaceBack(new std::string("c"));
+
+    EXPECT_EQ(*queue.front(), "a");
+    EXPECT_EQ(*queue.back(), "c");
+    std::unique_ptr<std::string> taken = std::move(queue.front());
+    queue.dequeue();
+    EXPECT_EQ(*taken, "a");
+    EXPECT_EQ(*queue.front(), "b");
+}
+
+
+TEST_F(SegmentedQueueUnitTest, DestroysEveryElement) {
+    const auto shared = std::make_shared<int>(0);
+    {
+        SegmentedQueue<std::shared_ptr<int>, 4> queue;
+        for (int i = 0; i < 30; ++i)
+            queue.enqueue(shared);
+        for (int i = 0; i < 11; ++i)
+            queue.dequeue();
+        EXPECT_EQ(shared.use_count(), 20);
+        queue.clear();
+        EXPECT_EQ(shared.use_count(), 1);
+        for (int i = 0; i < 9; ++i)
+            queue.enqueue(shared);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+
+TEST_F(SegmentedQueueUnitTest, CopyAndMove) {
+    SegmentedQueue<std::string, 3> original{"a", "b", "c", "d", "e"};
+    original.dequeue();
+
+    SegmentedQueue copy(original);
+    EXPECT_EQ(contents(copy), (std::vector<std::string>{"b", "c", "d", "e"}));
+
+    SegmentedQueue moved(std::move(original));
+    EXPECT_TRUE(original.isEmpty());
+    EXPECT_EQ(contents(moved), contents(copy));
+
+    original.enqueue("reused");
+    EXPECT_EQ(original.front(), "reused");
+
+    copy = original;
+    EXPECT_EQ(contents(copy), (std::vector<std::string>{"reused"}));
+
+    copy = std::move(moved);
+    EXPECT_EQ(contents(copy), (std::vector<std::string>{"b", "c", "d", "e"}));
+    EXPECT_TRUE(moved.isEmpty());
+}
+
+
+TEST_F(SegmentedQueueUnitTest, ThrowingConstructorLeavesQueueUnchanged) {
+    SegmentedQueue<ThrowingType, 2> queue;
+    queue.emplaceBack(1);
+    queue.emplaceBack(2);
+
+    // The next element needs a new block; the failed construction must not
+    // link it in.
+    ThrowingType::should_throw = true;
+    EXPECT_THROW(queue.emplaceBack(3), std::runtime_error);
+    ThrowingType::should_throw = false;
+
+    EXPECT_EQ(queue.size(), 2);
+    EXPECT_EQ(queue.back().value, 2);
+    queue.emplaceBack(4);
+    EXPECT_EQ(queue.back().value, 4);
+    queue.dequeue();
+    queue.dequeue();
+    EXPECT_EQ(queue.front().value, 4);
+}
@@ -1,8 +1,13 @@
 #include <gtest/gtest.h>
+#include <iterator>
+#include <list>
+#include <memory_resource>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "CountingResource.hpp"
 #include "Stack.hpp"
 #include "ThrowingType.hpp"
 
@@ -566,3 +571,141 @@ TEST_F(StackUnitTest, EmplaceConstructsInPlace) {
     EXPECT_EQ(stack.top().x, 3);
     EXPECT_EQ(stack.top().y, 4);
 }
+
+
+TEST_F(StackUnitTest, PmrStackAllocatesFromResource) {
+    CountingResource resource;
+    {
+        containers::pmr::Stack<std::string> stack(&resource);
+        for (int i = 0; i < 50; ++i)
+            stack.push(std::to_string(i));
+        EXPECT_GT(resource.allocations, 1u);
+        EXPECT_EQ(stack.getAllocator().resource(), &resource);
+        EXPECT_EQ(stack.top(), "49");
+        stack.pop();
+        EXPECT_EQ(stack.top(), "48");
+    }
+    EXPECT_EQ(resource.bytes_in_use, 0u);
+}
+
+
+TEST_F(StackUnitTest, SmallStackAvoidsAllocationsWhileInline) {
+    CountingResource resource;
+    containers::SmallStack<int, 16, std::pmr::polymorphic_allocator<int>> stack(&resource);
+    for (int i = 0; i < 16; ++i)
+        stack.push(i);
+    EXPECT_EQ(resource.allocations, 0u);
+    EXPECT_EQ(stack.top(), 15);
+
+    stack.push(16);
+    EXPECT_EQ(resource.allocations, 1u);
+
+    containers::SmallStack<int, 16, std::pmr::polymorphic_allocator<int>> moved(std::move(stack));
+    EXPECT_EQ(moved.size(), 17u);
+    EXPECT_EQ(moved.top(), 16);
+}
+
+
+TEST_F(StackUnitTest, PushRangeGrowsOnceAndKeepsOrder) {
+    Stack<int> stack;
+    stack.push(-1);
+    const std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    stack.pushRange(values.begin(), values.end());
+
+    EXPECT_EQ(stack.size(), 13u);
+    EXPECT_GE(stack.capacity(), 13u);
+    for (int expected = 11; expected >= -1; --expected) {
+        EXPECT_EQ(stack.top(), expected);
+        stack.pop();
+    }
+
+    const std::list<std::string> words = {"a", "b"};
+    Stack<std::string> strings;
+    strings.pushRange(words.begin(), words.end());
+    EXPECT_EQ(strings.top(), "b");
+}
+
+
+/// Counts live objects; copying throws once `copies_left` reaches zero.
+struct FailingCopy {
+    static inline int live = 0;
+    static inline int copies_left = 0;
+    int value;
+
+    explicit FailingCopy(const int v) : value(v) { ++live; }
+    FailingCopy(const FailingCopy& other) : value(other.value) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy failed");
+        ++live;
+    }
+    FailingCopy& operator=(const FailingCopy& other) {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy failed");
+        value = other.value;
+        return *this;
+    }
+    ~FailingCopy() { --live; }
+};
+
+
+TEST_F(StackUnitTest, PushRangeIsAllOrNothing) {
+    FailingCopy::copies_left = 100;
+    {
+        Stack<FailingCopy> stack;
+        stack.emplace(1);
+        const std::vector<FailingCopy> source = {FailingCopy(2), FailingCopy(3), FailingCopy(4)};
+        FailingCopy::copies_left = 2;
+
+        EXPECT_THROW(stack.pushRange(source.begin(), source.end()), std::runtime_error);
+        EXPECT_EQ(stack.size(), 1u);
+        EXPECT_EQ(stack.top().value, 1);
+        EXPECT_EQ(FailingCopy::live, 4);
+    }
+    EXPECT_EQ(FailingCopy::live, 0);
+}
+
+
+TEST_F(StackUnitTest, PushUncheckedAfterReserve) {
+    Stack<int> stack;
+    stack.reserve(100);
+    for (int i = 0; i < 100; ++i)
+        stack.pushUnchecked(i);
+
+    EXPECT_EQ(stack.size(), 100u);
+    EXPECT_EQ(stack.capacity(), 100u);
+    EXPECT_EQ(stack.top(), 99);
+}
+
+
+TEST_F(StackUnitTest, PopNKeepsCapacity) {
+    Stack<int> stack;
+    for (int i = 0; i < 1000; ++i)
+        stack.push(i);
+    const size_t capacity = stack.capacity();
+
+    stack.popN(990);
+    EXPECT_EQ(stack.size(), 10u);
+    EXPECT_EQ(stack.top(), 9);
+    EXPECT_EQ(stack.capacity(), capacity);
+
+    EXPECT_THROW(stack.popN(11), std::out_of_range);
+    EXPECT_EQ(stack.size(), 10u);
+    stack.popN(10);
+    EXPECT_TRUE(stack.isEmpty());
+    stack.popN(0);
+}
+
+
+TEST_F(StackUnitTest, GrowOnlyStackNeverShrinksOnPop) {
+    containers::GrowOnlyStack<int> stack;
+    for (int i = 0; i < 1000; ++i)
+        stack.push(i);
+    const size_t capacity = stack.capacity();
+
+    while (!stack.isEmpty())
+        stack.pop();
+    EXPECT_EQ(stack.capacity(), capacity);
+
+    stack.shrinkToFit();
+    EXPECT_LT(stack.capacity(), capacity);
+}
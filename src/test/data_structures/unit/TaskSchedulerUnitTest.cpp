@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "TaskScheduler.hpp"
+
+
+using containers::TaskScheduler;
+
+
+class TaskSchedulerUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+/// Naive recursive Fibonacci, forking both calls while n is large.
+int64_t fib(TaskScheduler& scheduler, const int n) {
+    if (n < 2)
+        return n;
+    if (n < 12)
+        return fib(scheduler, n - 1) + fib(scheduler, n - 2);
+    int64_t a = 0, b = 0;
+    scheduler.parallelInvoke([&] { a = fib(scheduler, n - 1); },
+                             [&] { b = fib(scheduler, n - 2); });
+    return a + b;
+}
+
+
+TEST_F(TaskSchedulerUnitTest, ThreadCountMatchesRequest) {
+    EXPECT_EQ(TaskScheduler(1).threadCount(), 1);
+    EXPECT_EQ(TaskScheduler(4).threadCount(), 4);
+    EXPECT_EQ(TaskScheduler(0).threadCount(), TaskScheduler::hardwareThreads());
+    EXPECT_EQ(&TaskScheduler::shared(), &TaskScheduler::shared());
+}
+
+
+TEST_F(TaskSchedulerUnitTest, ParallelForVisitsEveryIndexOnce) {
+    for (const size_t threads : {1u, 2u, 4u}) {
+        TaskScheduler scheduler(threads);
+        for (const size_t grain : {1u, 7u, 1000u}) {
+            std::vector<std::atomic<int>> visits(10007);
+            scheduler.parallelFor(3, visits.size(), [&](const size_t i) { visits[i].fetch_add(1); }, grain);
+            for (size_t i = 0; i < visits.size(); ++i)
+                ASSERT_EQ(visits[i].load(), i < 3 ? 0 : 1) << "threads " << threads << " grain " << grain;
+        }
+        scheduler.parallelFor(5, 5, [](size_t) { FAIL(); });
+    }
+}
+
+
+TEST_F(TaskSchedulerUnitTest, NestedParallelCallsComplete) {
+    TaskScheduler scheduler(4);
+    EXPECT_EQ(fib(scheduler, 25), 75025);
+
+    std::atomic<int> total{0};
+    scheduler.parallelFor(0, 8, [&](size_t) {
+        scheduler.parallelFor(0, 100, [&](size_t) { total.fetch_add(1); });
+    });
+    EXPECT_EQ(total.load(), 800);
+}
+
+
+TEST_F(TaskSchedulerUnitTest, ParallelInvokeRunsEveryFunction) {
+    TaskScheduler scheduler(3);
+    int a = 0, b = 0, c = 0;
+    scheduler.parallelInvoke([&] { a = 1; }, [&] { b = 2; }, [&] { c = 3; });
+    EXPECT_EQ(a + b + c, 6);
+    scheduler.parallelInvoke([&] { a = 10; });
+    EXPECT_EQ(a, 10);
+}
+
+
+TEST_F(TaskSchedulerUnitTest, FirstExceptionIsRethrownAfterAllTasksFinish) {
+    TaskScheduler scheduler(4);
+    std::atomic<int> finished{0};
+    EXPECT_THROW(scheduler.parallelFor(0, 64, [&](const size_t i) {
+        if (i % 16 == 5)
+            throw std::runtime_error("task failed");
+        finished.fetch_add(1);
+    }), std::runtime_error);
+    EXPECT_EQ(finished.load(), 60);
+
+    EXPECT_THROW(scheduler.parallelInvoke([] {}, [] { throw std::logic_error("second"); }),
+                 std::logic_error);
+
+    // The scheduler is still usable afterwards.
+    std::atomic<int> count{0};
+    scheduler.parallelFor(0, 10, [&](size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 10);
+}
+
+
+TEST_F(TaskSchedulerUnitTest, CallersOutsideThePoolShareIt) {
+    TaskScheduler scheduler(2);
+    std::vector<int64_t> results(4);
+    std::vector<std::thread> callers;
+    for (size_t i = 0; i < results.size(); ++i)
+        callers.emplace_back([&, i] { results[i] = fib(scheduler, 20 + static_cast<int>(i)); });
+    for (std::thread& caller : callers)
+        caller.join();
+    EXPECT_EQ(results, (std::vector<int64_t>{6765, 10946, 17711, 28657}));
+}
+
+
+TEST_F(TaskSchedulerUnitTest, WaitingWorkerDoesNotStartInjectedCalls) {
+    TaskScheduler scheduler(2);
+    std::atomic<bool> second_started{false};
+    std::atomic<bool> second_injected{false};
+    std::atomic<bool> spawned_done{false};
+    std::atomic<bool> ran_inside_wait{false};
+    std::thread::id waiting_thread;
+    std::thread second_caller;
+
+    scheduler.parallelInvoke(
+        [&] {
+            waiting_thread = std::this_thread::get_id();
+            second_caller = std::thread([&] {
+                second_injected.store(true);
+                // Two functions, so that the call is injected into the pool.
+                scheduler.parallelInvoke(
+                    [&] {
+                        if (std::this_thread::get_id() == waiting_thread && !spawned_done.load())
+                            ran_inside_wait.store(true);
+                        second_started.store(true);
+                    },
+                    [] {});
+            });
+            // Returning lets this worker wait while the other one holds the
+            // spawned task below.
+            while (!second_injected.load())
+                std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        },
+        [&] {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+            while (!second_started.load() && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            spawned_done.store(true);
+        });
+    second_caller.join();
+
+    EXPECT_TRUE(second_started.load());
+    EXPECT_FALSE(ran_inside_wait.load());
+}
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "UnrolledLinkedList.hpp"
+
+
+using containers::UnrolledLinkedList;
+using std::size_t;
+
+
+class UnrolledLinkedListUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+template <typename List>
+std::vector<typename List::value_type> toVector(const List& list) {
+    return {list.begin(), list.end()};
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, AddAndAccessAcrossNodes) {
+    UnrolledLinkedList<int, 4> list;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_THROW(list.front(), std::out_of_range);
+    EXPECT_THROW(list.get(0), std::out_of_range);
+
+    for (int i = 0; i < 10; ++i)
+        list.addLast(i);
+    list.addFirst(-1);
+
+    EXPECT_EQ(list.size(), 11u);
+    EXPECT_EQ(list.front(), -1);
+    EXPECT_EQ(list.back(), 9);
+    for (size_t i = 0; i < list.size(); ++i)
+        EXPECT_EQ(list[i], static_cast<int>(i) - 1);
+    EXPECT_THROW(list.get(11), std::out_of_range);
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, AppendsFillNodesCompletely) {
+    UnrolledLinkedList<int, 8> list;
+    for (int i = 0; i < 64; ++i)
+        list.addLast(i);
+    EXPECT_EQ(list.nodeCount(), 8u);
+
+    const UnrolledLinkedList<int, 8> copy(list);
+    EXPECT_EQ(copy.nodeCount(), 8u);
+    EXPECT_EQ(toVector(copy), toVector(list));
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, IteratorsModelBidirectionalIterator) {
+    static_assert(std::bidirectional_iterator<UnrolledLinkedList<int>::iterator>);
+    static_assert(std::bidirectional_iterator<UnrolledLinkedList<int>::const_iterator>);
+
+    UnrolledLinkedList<int, 4> list = {4, 8, 15, 16, 23, 42};
+    EXPECT_EQ(*std::max_element(list.begin(), list.end()), 42);
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 6);
+
+    std::vector<int> reversed;
+    for (auto it = list.end(); it != list.begin();)
+        reversed.push_back(*--it);
+    EXPECT_EQ(reversed, (std::vector<int>{42, 23, 16, 15, 8, 4}));
+
+    UnrolledLinkedList<int, 4>::const_iterator first = list.begin();
+    EXPECT_TRUE(first == list.begin());
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, InsertAndEraseAtIterator) {
+    UnrolledLinkedList<std::string, 4> list = {"a", "b", "c", "d"};
+
+    // Inserting into a full node splits it.
+    auto it = list.insert(std::next(list.begin(), 3), "x");
+    EXPECT_EQ(*it, "x");
+    EXPECT_EQ(list.nodeCount(), 2u);
+    EXPECT_EQ(toVector(list), (std::vector<std::string>{"a", "b", "c", "x", "d"}));
+
+    it = list.erase(it);
+    EXPECT_EQ(*it, "d");
+    it = list.erase(it);
+    EXPECT_TRUE(it == list.end());
+    EXPECT_EQ(toVector(list), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(list.nodeCount(), 1u);
+
+    list.insert(list.end(), "e");
+    EXPECT_EQ(list.back(), "e");
+    EXPECT_TRUE(list.erase(list.end()) == list.end());
+
+    // The index overload is still picked for size_t elements.
+    UnrolledLinkedList<size_t> indices = {7};
+    indices.insert(size_t{8}, 1);
+    indices.insert(indices.begin(), size_t{6});
+    EXPECT_EQ(toVector(indices), (std::vector<size_t>{6, 7, 8}));
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, RemoveAndRemoveAll) {
+    UnrolledLinkedList<int, 4> list;
+    for (int i = 0; i < 40; ++i)
+        list.addLast(i % 3);
+
+    EXPECT_TRUE(list.remove(2));
+    EXPECT_EQ(list.size(), 39u);
+    EXPECT_EQ(list[2], 0);
+    EXPECT_FALSE(list.remove(7));
+
+    EXPECT_EQ(list.removeAll(0), 14u);
+    EXPECT_EQ(list.size(), 25u);
+    EXPECT_EQ(std::count(list.begin(), list.end(), 1), 13);
+    EXPECT_LE(list.nodeCount(), 9u);
+
+    EXPECT_EQ(list.removeAll(1), 13u);
+    EXPECT_EQ(list.removeAll(2), 12u);
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.nodeCount(), 0u);
+    EXPECT_TRUE(list.begin() == list.end());
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, SpliceRelinksNodes) {
+    UnrolledLinkedList<int, 4> list = {1, 2, 7, 8};
+    UnrolledLinkedList<int, 4> other = {3, 4, 5, 6};
+    const int* three = &other.front();
+
+    // Splicing into the middle of a node splits it first.
+    list.splice(std::next(list.begin(), 2), other);
+    EXPECT_TRUE(other.isEmpty());
+    EXPECT_EQ(other.nodeCount(), 0u);
+    EXPECT_EQ(toVector(list), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+    EXPECT_EQ(&list[2], three);
+    EXPECT_EQ(list.nodeCount(), 3u);
+
+    UnrolledLinkedList<int, 4> front = {0};
+    list.splice(list.begin(), front);
+    UnrolledLinkedList<int, 4> back = {9};
+    list.splice(list.end(), back);
+    EXPECT_EQ(list.size(), 10u);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 9);
+    EXPECT_EQ(list[5], 5);
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, MatchesVectorUnderRandomEdits) {
+    std::mt19937 rng(7);
+    UnrolledLinkedList<int, 6> list;
+    std::vector<int> model;
+
+    for (int step = 0; step < 5000; ++step) {
+        const size_t op = rng() % 6;
+        if (op < 3 || model.empty()) {
+            const size_t idx = rng() % (model.size() + 1);
+            list.insert(step, idx);
+            model.insert(model.begin() + static_cast<std::ptrdiff_t>(idx), step);
+        } else if (op == 3) {
+            const size_t idx = rng() % model.size();
+            list.removeAt(idx);
+            model.erase(model.begin() + static_cast<std::ptrdiff_t>(idx));
+        } else if (op == 4) {
+            const size_t idx = rng() % model.size();
+            auto it = list.erase(std::next(list.begin(), static_cast<std::ptrdiff_t>(idx)));
+            auto next = model.erase(model.begin() + static_cast<std::ptrdiff_t>(idx));
+            ASSERT_EQ(it == list.end(), next == model.end());
+            if (next != model.end()) {
+                ASSERT_EQ(*it, *next);
+            }
+        } else {
+            list.removeFirst();
+            model.erase(model.begin());
+        }
+
+        ASSERT_EQ(list.size(), model.size());
+        if (step % 97 == 0) {
+            ASSERT_EQ(toVector(list), model);
+        }
+    }
+    EXPECT_EQ(toVector(list), model);
+    EXPECT_GE(list.nodeCount() * 6, list.size());
+}
+
+
+TEST_F(UnrolledLinkedListUnitTest, CopyAndMoveSemantics) {
+    UnrolledLinkedList<std::string, 4> list = {"a", "b", "c", "d", "e"};
+
+    UnrolledLinkedList<std::string, 4> copy;
+    copy = list;
+    copy.removeLast();
+    EXPECT_EQ(list.size(), 5u);
+    EXPECT_EQ(copy.back(), "d");
+
+    UnrolledLinkedList<std::string, 4> moved(std::move(list));
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(moved.size(), 5u);
+
+    copy = std::move(moved);
+    EXPECT_EQ(toVector(copy), (std::vector<std::string>{"a", "b", "c", "d", "e"}));
+
+    copy.clear();
+    EXPECT_TRUE(copy.isEmpty());
+    copy.addLast("z");
+    EXPECT_EQ(copy.front(), "z");
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingDeque.hpp"
+
+
+using containers::WorkStealingDeque;
+
+
+class WorkStealingDequeUnitTest : public testing::Test {
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+
+TEST_F(WorkStealingDequeUnitTest, OwnerTakesLifoThievesStealFifo) {
+    WorkStealingDeque<int> deque;
+    EXPECT_TRUE(deque.isEmpty());
+    EXPECT_FALSE(deque.take().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+
+    for (int i = 0; i < 5; ++i)
+        deque.push(i);
+    EXPECT_EQ(deque.size(), 5);
+
+    EXPECT_EQ(deque.take(), 4);
+    EXPECT_EQ(deque.steal(), 0);
+    EXPECT_EQ(deque.take(), 3);
+    EXPECT_EQ(deque.steal(), 1);
+    EXPECT_EQ(deque.take(), 2);
+    EXPECT_FALSE(deque.take().has_value());
+    EXPECT_FALSE(deque.steal().has_value());
+    EXPECT_TRUE(deque.isEmpty());
+}
+
+
+TEST_F(WorkStealingDequeUnitTest, GrowsWhenFull) {
+    WorkStealingDeque<int> deque(4);
+    EXPECT_EQ(deque.capacity(), 4);
+
+    // Offset the indices so that the copy has to unwrap the ring.
+    deque.push(-1);
+    deque.push(-2);
+    EXPECT_EQ(deque.steal(), -1);
+    EXPECT_EQ(deque.steal(), -2);
+
+    for (int i = 0; i < 100; ++i)
+        deque.push(i);
+    EXPECT_EQ(deque.capacity(), 128);
+    for (int i = 0; i < 50; ++i)
+        EXPECT_EQ(deque.steal(), i);
+    for (int i = 99; i >= 50; --i)
+        EXPECT_EQ(deque.take(), i);
+}
+
+
+TEST_F(WorkStealingDequeUnitTest, EveryItemIsTakenOrStolenExactlyOnce) {
+    constexpr int items = 200000;
+    constexpr int thieves = 3;
+    WorkStealingDeque<int> deque(8);
+    std::vector<std::atomic<int>> seen(items);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; ++t)
+        threads.emplace_back([&] {
+            while (!done.load(std::memory_order_acquire)) {
+                if (const auto item = deque.steal())
+                    seen[static_cast<size_t>(*item)].fetch_add(1, std::memory_order_relaxed);
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    // The owner pushes in bursts and takes some back, racing the thieves
+    // for the last item every time the deque runs low.
+    int next = 0;
+    while (next < items) {
+        for (int i = 0; i < 7 && next < items; ++i)
+            deque.push(next++);
+        for (int i = 0; i < 3; ++i)
+            if (const auto item = deque.take())
+                seen[static_cast<size_t>(*item)].fetch_add(1, std::memory_order_relaxed);
+    }
+    while (const auto item = deque.take())
+        seen[static_cast<size_t>(*item)].fetch_add(1, std::memory_order_relaxed);
+
+    done.store(true, std::memory_order_release);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (const std::atomic<int>& count : seen)
+        ASSERT_EQ(count.load(), 1);
+}
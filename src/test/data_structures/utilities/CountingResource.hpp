@@ -0,0 +1,41 @@
+#ifndef COUNTING_RESOURCE_HPP
+#define COUNTING_RESOURCE_HPP
+
+#include <cstddef>
+#include <memory_resource>
+
+
+/// Memory resource that forwards to an upstream resource and counts the
+/// allocations routed through it.
+class CountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream_;
+
+  public:
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes_in_use = 0;
+
+    explicit CountingResource(
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : upstream_(upstream) {}
+
+  private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        void* p = upstream_->allocate(bytes, alignment);
+        ++allocations;
+        bytes_in_use += bytes;
+        return p;
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+        ++deallocations;
+        bytes_in_use -= bytes;
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+#endif // COUNTING_RESOURCE_HPP